@@ -0,0 +1,55 @@
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <vector>
+#include <boost/random.hpp>
+
+#include "mybitcoin/field.h"
+#include "mybitcoin/scalar.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+// Every measurement inverts about this many elements in total, split into batches of different sizes
+const size_t ELEMENTS_PER_ROUND = 4096;
+
+int main() {
+    boost::random::mt19937_64 gen(20221031);
+    vector<S256Field> elements(ELEMENTS_PER_ROUND);
+    vector<S256Scalar> scalars(ELEMENTS_PER_ROUND);
+    for (size_t i = 0; i < ELEMENTS_PER_ROUND; ++i) {
+        uint64_t limbs[4] = {gen(), gen(), gen(), gen() & 0x7FFFFFFFFFFFFFFFULL};
+        elements[i] = S256Field::from_limbs(limbs);
+        scalars[i] = S256Scalar::from_limbs(limbs);
+    }
+
+    printf("Cost per element of inverting %zu elements in batches of N\n", ELEMENTS_PER_ROUND);
+    printf("%6s %24s %24s\n", "N", "S256Field (mod p), ns", "S256Scalar (mod n), ns");
+    S256Field field_sink = S256Field(1);
+    S256Scalar scalar_sink = S256Scalar((uint64_t)1);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t i = 0; i < ELEMENTS_PER_ROUND; ++i) { field_sink = field_sink + elements[i].inverse(); }
+    double field_elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (size_t i = 0; i < ELEMENTS_PER_ROUND; ++i) { scalar_sink = scalar_sink + scalars[i].inverse(); }
+    double scalar_elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    printf("%6s %24.1f %24.1f\n", "single", field_elapsed / ELEMENTS_PER_ROUND, scalar_elapsed / ELEMENTS_PER_ROUND);
+
+    for (size_t batch = 1; batch <= ELEMENTS_PER_ROUND; batch *= 4) {
+        vector<S256Field> field_batch = elements;
+        vector<S256Scalar> scalar_batch = scalars;
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < ELEMENTS_PER_ROUND; i += batch) { S256Field::batch_inverse(&field_batch[i], batch); }
+        field_elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < ELEMENTS_PER_ROUND; i += batch) { S256Scalar::batch_inverse(&scalar_batch[i], batch); }
+        scalar_elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        field_sink = field_sink + field_batch[0];
+        scalar_sink = scalar_sink + scalar_batch[0];
+        printf("%6zu %24.1f %24.1f\n", batch, field_elapsed / ELEMENTS_PER_ROUND, scalar_elapsed / ELEMENTS_PER_ROUND);
+    }
+    do_not_optimize(field_sink);
+    do_not_optimize(scalar_sink);
+    return 0;
+}
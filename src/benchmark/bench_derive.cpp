@@ -0,0 +1,40 @@
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "mybitcoin/derive.h"
+#include "mybitcoin/ecc.h"
+
+using namespace std;
+
+const size_t BASELINE_KEYS = 2000;
+const size_t KEYS = 200000;
+
+int main() {
+    const int512_t start = (int512_t)"0x7f3c9a1e55d0b2c48e6a13f9d2b7054ac1e86f3b92d07a5c64e1b8f03d9a2c71";
+    uint8_t start_key[32];
+    S256Scalar(start).get_bytes(start_key);
+    vector<char> addresses(KEYS * (S256Point::ADDRESS_MAX_LEN + 1));
+
+    // One ECDSAKey and one get_address() per key, what deriving a range costs without s256_derive_range()
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    for (size_t i = 0; i < BASELINE_KEYS; ++i) {
+        ECDSAKey key = ECDSAKey(start + i);
+        key.public_key().get_address(true, false, &addresses[i * (S256Point::ADDRESS_MAX_LEN + 1)]);
+    }
+    double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - begin).count();
+    double baseline = elapsed / BASELINE_KEYS;
+    printf("%-40s %10.2f ns/key\n", "ECDSAKey + get_address()", baseline);
+
+    unsigned int hardware_threads = max(thread::hardware_concurrency(), 1u);
+    for (unsigned int threads = 1; threads <= hardware_threads; threads *= 2) {
+        begin = chrono::steady_clock::now();
+        s256_derive_range(start_key, KEYS, true, false, nullptr, nullptr, addresses.data(), threads);
+        elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - begin).count();
+        char name[64];
+        snprintf(name, sizeof(name), "s256_derive_range(), %u thread(s)", threads);
+        printf("%-40s %10.2f ns/key (%.1fx) %s\n", name, elapsed / KEYS, baseline / (elapsed / KEYS), &addresses[0]);
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <vector>
+#include <boost/random.hpp>
+
+#include "mybitcoin/group.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+const size_t SAMPLES = 4000;
+
+/**
+ * @brief Get scalars whose Hamming weights vary a lot, as that is what the variable-time paths are sensitive to:
+ * every fourth one is uniformly random, the rest have only a few (random) bits set or cleared.
+ */
+void get_scalars(vector<array<uint64_t, 4>>& scalars) {
+    boost::random::mt19937_64 gen(20221031);
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        array<uint64_t, 4> scalar = {gen(), gen(), gen(), gen() & 0x7FFFFFFFFFFFFFFFULL};
+        if (i % 4 == 1) {
+            scalar = {0, 0, 0, 0};
+            for (int j = 0; j < 8; ++j) { scalar[gen() % 4] |= 1ULL << (gen() % 63); }
+        } else if (i % 4 == 2) {
+            scalar = {~0ULL, ~0ULL, ~0ULL, 0x7FFFFFFFFFFFFFFFULL};
+            for (int j = 0; j < 8; ++j) { scalar[gen() % 4] &= ~(1ULL << (gen() % 63)); }
+        } else if (i % 4 == 3) {
+            scalar = {gen() & 0xFFFF, 0, 0, 0};
+        }
+        scalars.push_back(scalar);
+    }
+}
+
+template <typename Func>
+void measure(const char* name, const vector<array<uint64_t, 4>>& scalars, Func multiply) {
+    vector<double> latencies(scalars.size());
+    S256JacobianPoint sink;
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        S256JacobianPoint res = multiply(scalars[i].data());
+        latencies[i] = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        sink = sink.add(res);
+    }
+    double mean = 0;
+    for (size_t i = 0; i < latencies.size(); ++i) { mean += latencies[i] / latencies.size(); }
+    sort(latencies.begin(), latencies.end());
+    do_not_optimize(sink);
+    printf("%-36s %9.2f %9.2f %9.2f %9.2f %9.2f\n", name, latencies[0], latencies[latencies.size() / 2], mean,
+        latencies[latencies.size() * 99 / 100], latencies.back());
+}
+
+int main() {
+    vector<array<uint64_t, 4>> scalars;
+    get_scalars(scalars);
+    uint64_t p_scalar[4] = {0x5A8B4C1E9D3F2701ULL, 0x1234567890ABCDEFULL, 0xC0FFEE0DDBA11ULL, 0x7E57ED5CA1A2ULL};
+    const S256AffineCoords p = s256_multiply(s256_generator(), p_scalar).to_affine();
+
+    printf("Latency of variable-time vs fixed-schedule scalar multiplications over %zu scalars, in us\n", SAMPLES);
+    printf("%-36s %9s %9s %9s %9s %9s\n", "", "min", "p50", "mean", "p99", "max");
+    measure("G * k, s256_multiply_generator()", scalars, [](const uint64_t* k) {
+        return s256_multiply_generator(k);
+    });
+    measure("G * k, s256_multiply_generator_fixed()", scalars, [](const uint64_t* k) {
+        return s256_multiply_generator_fixed(k);
+    });
+    measure("P * k, s256_multiply()", scalars, [&p](const uint64_t* k) { return s256_multiply(p, k); });
+    measure("P * k, s256_multiply_fixed()", scalars, [&p](const uint64_t* k) { return s256_multiply_fixed(p, k); });
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <boost/random.hpp>
+
+#include "mybitcoin/group.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+const int ITERATIONS = 2000;
+
+void get_random_scalars(uint64_t scalars[][4], const size_t count) {
+    boost::random::mt19937_64 gen(20221031);
+    for (size_t i = 0; i < count; ++i) {
+        for (int j = 0; j < 4; ++j) { scalars[i][j] = gen(); }
+        // Keep them smaller than n, as s256_multiply_glv() and s256_multiply_joint_glv() require
+        scalars[i][3] &= 0x7FFFFFFFFFFFFFFFULL;
+    }
+}
+
+void report(const char* name, const chrono::steady_clock::time_point start, const S256JacobianPoint& sink) {
+    double elapsed = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    do_not_optimize(sink);
+    printf("%-48s %10.2f us/op\n", name, elapsed / ITERATIONS);
+}
+
+int main() {
+    static uint64_t scalars[ITERATIONS][4], other_scalars[ITERATIONS][4];
+    get_random_scalars(scalars, ITERATIONS);
+    get_random_scalars(other_scalars, ITERATIONS);
+    uint64_t p_scalar[4] = {0x5A8B4C1E9D3F2701ULL, 0x1234567890ABCDEFULL, 0xC0FFEE0DDBA11ULL, 0x7E57ED5CA1A2ULL};
+    S256AffineCoords p = s256_multiply(s256_generator(), p_scalar).to_affine();
+
+    printf("Comparing plain and GLV endomorphism-accelerated scalar multiplications, %d iterations each\n",
+        ITERATIONS);
+    S256JacobianPoint sink;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) { sink = sink.add(s256_multiply(p, scalars[i])); }
+    report("P * k, s256_multiply()", start, sink);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) { sink = sink.add(s256_multiply_glv(p, scalars[i])); }
+    report("P * k, s256_multiply_glv()", start, sink);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) { sink = sink.add(s256_multiply_joint(scalars[i], p, other_scalars[i])); }
+    report("G * u + P * v, s256_multiply_joint()", start, sink);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        sink = sink.add(s256_multiply_joint_glv(scalars[i], p, other_scalars[i]));
+    }
+    report("G * u + P * v, s256_multiply_joint_glv()", start, sink);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <vector>
+#include <boost/random.hpp>
+
+#include "mybitcoin/group.h"
+#include "mybitcoin/kernel.h"
+#include "mybitcoin/scalar.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+const int FIELD_ITERATIONS = 1000000;
+const int POINT_ITERATIONS = 2000;
+const size_t BATCH_SIZE = 512;
+const int BATCH_ITERATIONS = 200;
+
+void report(const char* name, const chrono::steady_clock::time_point start, const int iterations,
+    const uint64_t sink) {
+    double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    do_not_optimize(sink);
+    printf("  %-40s %12.2f ns/op\n", name, elapsed / iterations);
+}
+
+int main() {
+    boost::random::mt19937_64 gen(20221031);
+    uint64_t a[4], b[4], scalar[4];
+    for (int i = 0; i < 4; ++i) { a[i] = gen(); b[i] = gen(); scalar[i] = gen(); }
+    a[3] &= 0x7FFFFFFFFFFFFFFFULL; b[3] &= 0x7FFFFFFFFFFFFFFFULL; scalar[3] &= 0x7FFFFFFFFFFFFFFFULL;
+    printf("The kernel set picked for this CPU is %s\n", s256_kernel().name);
+
+    // The same points, in Jacobian coordinates, for every kernel set's batch_to_affine()
+    vector<S256JacobianPoint> points(BATCH_SIZE);
+    vector<S256AffineCoords> affine(BATCH_SIZE);
+    points[0] = s256_multiply_fixed(s256_generator(), scalar);
+    for (size_t i = 1; i < BATCH_SIZE; ++i) { points[i] = points[i - 1].add_affine(s256_generator()); }
+
+    for (const char* name : {"portable", "mulx_adx", "avx512_ifma"}) {
+        if (!s256_select_kernel(name)) {
+            printf("%s: not supported by this CPU\n", name);
+            continue;
+        }
+        printf("%s:\n", name);
+        // Each iteration depends on the previous one, so this measures latency rather than throughput
+        S256Field x = S256Field::from_limbs(a), y = S256Field::from_limbs(b);
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int i = 0; i < FIELD_ITERATIONS; ++i) { x = x * y; }
+        report("S256Field::operator*", start, FIELD_ITERATIONS, x.limbs()[0]);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < FIELD_ITERATIONS; ++i) { x = x.square(); }
+        report("S256Field::square()", start, FIELD_ITERATIONS, x.limbs()[0]);
+
+        uint64_t s[4] = {a[0], a[1], a[2], a[3]};
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < FIELD_ITERATIONS; ++i) { s256_scalar_multiply(s, b, s); }
+        report("s256_scalar_multiply()", start, FIELD_ITERATIONS, s[0]);
+
+        S256JacobianPoint sink;
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < POINT_ITERATIONS; ++i) {
+            scalar[0] = i;
+            sink = sink.add(s256_multiply_fixed(s256_generator(), scalar));
+        }
+        report("s256_multiply_fixed()", start, POINT_ITERATIONS, sink.infinity());
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < BATCH_ITERATIONS; ++i) {
+            S256JacobianPoint::batch_to_affine(points.data(), BATCH_SIZE, affine.data());
+        }
+        report("batch_to_affine(), per point", start, BATCH_ITERATIONS * (int)BATCH_SIZE,
+            affine[BATCH_SIZE - 1].x.limbs()[0]);
+    }
+    return 0;
+}
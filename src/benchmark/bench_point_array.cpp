@@ -0,0 +1,58 @@
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "mybitcoin/derive.h"
+#include "mybitcoin/pointarray.h"
+
+using namespace std;
+
+const size_t KEYS = 100000;
+
+double get_elapsed(const chrono::steady_clock::time_point start) {
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    // A key set to index, e.g., every public key seen in a range of blocks
+    const int512_t start = (int512_t)"0x4e9b17c2a05d38f6b1c7e2094d5a8f3c62b0e1d7a9f4c3b85e2d1a07f6c9b3e2";
+    uint8_t start_key[32];
+    S256Scalar(start).get_bytes(start_key);
+    vector<uint8_t> secs(KEYS * S256Point::SEC_COMPRESSED_LEN);
+    s256_derive_range(start_key, KEYS, true, false, secs.data(), nullptr, nullptr);
+
+    printf("%zu compressed keys:\n", KEYS);
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    vector<S256Point> points(KEYS);
+    vector<char> results(KEYS);
+    S256Point::parse_sec_batch(secs.data(), S256Point::SEC_COMPRESSED_LEN, KEYS, points.data(), (bool*)results.data());
+    double elapsed = get_elapsed(begin);
+    printf("  %-40s %8.2f ns/key, %4zu bytes/key\n", "parse_sec_batch() to S256Points", elapsed / KEYS,
+        points.capacity() * sizeof(S256Point) / KEYS);
+
+    begin = chrono::steady_clock::now();
+    S256PointArray array;
+    array.reserve(KEYS);
+    array.append_sec(secs.data(), S256Point::SEC_COMPRESSED_LEN, KEYS, nullptr);
+    elapsed = get_elapsed(begin);
+    printf("  %-40s %8.2f ns/key, %4zu bytes/key\n", "S256PointArray::append_sec()", elapsed / KEYS,
+        array.memory_usage() / KEYS);
+
+    // A scan over the whole set, e.g., counting the keys with an odd y
+    size_t odd = 0;
+    begin = chrono::steady_clock::now();
+    for (size_t i = 0; i < KEYS; ++i) {
+        odd += points[i].affine_coords().y.is_odd();
+    }
+    elapsed = get_elapsed(begin);
+    printf("  %-40s %8.2f ns/key (%zu)\n", "Scanning the S256Points", elapsed / KEYS, odd);
+    odd = 0;
+    begin = chrono::steady_clock::now();
+    const S256Field* ys = array.ys();
+    for (size_t i = 0; i < KEYS; ++i) {
+        odd += ys[i].is_odd();
+    }
+    elapsed = get_elapsed(begin);
+    printf("  %-40s %8.2f ns/key (%zu)\n", "Scanning the S256PointArray", elapsed / KEYS, odd);
+    return 0;
+}
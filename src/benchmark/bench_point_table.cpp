@@ -0,0 +1,52 @@
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "mybitcoin/tablecache.h"
+#include "mybitcoin/utils.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+const int ITERATIONS = 1000;
+
+void report(const char* name, const chrono::steady_clock::time_point start, const int operations, const int sink) {
+    double elapsed = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    do_not_optimize(sink);
+    printf("  %-48s %10.2f us/verification\n", name, elapsed / operations);
+}
+
+int main() {
+    // One hot key signing many messages, as verified by an exchange's hot wallet
+    ECDSAKey key = ECDSAKey((int512_t)"0x3c5e8a1f9b2d7064e1a3c5b7d9f0e2a4c6b8d0f1e3a5c7b9d1f3e5a7c9b0d2f4");
+    S256Point pubkey = key.public_key();
+    vector<int512_t> msg_hashes(ITERATIONS);
+    vector<Signature> sigs(ITERATIONS);
+    uint8_t msg_hash[SHA256_HASH_SIZE] = {0};
+    for (int i = 0; i < ITERATIONS; ++i) {
+        msg_hash[0] = (uint8_t)i;
+        msg_hash[1] = (uint8_t)(i >> 8);
+        msg_hashes[i] = get_int512_from_bytes(msg_hash, SHA256_HASH_SIZE);
+        sigs[i] = key.sign(msg_hash, SHA256_HASH_SIZE);
+    }
+
+    int sink = 0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) { sink += pubkey.verify(msg_hashes[i], sigs[i]); }
+    report("S256Point::verify()", start, ITERATIONS, sink);
+
+    start = chrono::steady_clock::now();
+    S256PointTable table(pubkey.affine_coords());
+    double elapsed = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    printf("  %-48s %10.2f us (%lu bytes)\n", "Building an S256PointTable", elapsed, table.memory_usage());
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) { sink += pubkey.verify(msg_hashes[i], sigs[i], table); }
+    report("S256Point::verify() with an S256PointTable", start, ITERATIONS, sink);
+
+    S256PointTableCache cache(1 << 20, 16);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) { sink += cache.verify(pubkey, msg_hashes[i], sigs[i]); }
+    report("S256PointTableCache::verify(), threshold 16", start, ITERATIONS, sink);
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mycrypto/hmac.h>
+#include <mycrypto/sha256.h>
+
+#include "mybitcoin/ecc.h"
+#include "mybitcoin/rfc6979.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+const int ITERATIONS = 20000;
+
+/**
+ * @brief RFC 6979 with one-shot hmac_sha256() calls and a malloc()'ed data buffer, how
+ * ECDSAKey::get_deterministic_k() used to do it
+ */
+void get_k_one_shot(const uint8_t* privkey, const uint8_t* msg_hash, uint8_t* v) {
+    uint8_t k[SHA256_HASH_SIZE] = {0};
+    memset(v, 0x01, SHA256_HASH_SIZE);
+    const size_t data_len = SHA256_HASH_SIZE * 3 + 1;
+    uint8_t* data = (uint8_t*)malloc(data_len);
+    for (uint8_t separator : {0x00, 0x01}) {
+        memcpy(data, v, SHA256_HASH_SIZE);
+        data[SHA256_HASH_SIZE] = separator;
+        memcpy(data + SHA256_HASH_SIZE + 1, privkey, SHA256_HASH_SIZE);
+        memcpy(data + SHA256_HASH_SIZE * 2 + 1, msg_hash, SHA256_HASH_SIZE);
+        hmac_sha256(k, SHA256_HASH_SIZE, data, data_len, k);
+        hmac_sha256(k, SHA256_HASH_SIZE, v, SHA256_HASH_SIZE, v);
+    }
+    hmac_sha256(k, SHA256_HASH_SIZE, v, SHA256_HASH_SIZE, v);
+    free(data);
+}
+
+void report(const char* name, const chrono::steady_clock::time_point start, const uint64_t sink) {
+    double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    do_not_optimize(sink);
+    printf("  %-48s %10.2f ns/signature\n", name, elapsed / ITERATIONS);
+}
+
+int main() {
+    uint8_t privkey[SHA256_HASH_SIZE], msg_hash[SHA256_HASH_SIZE], extra[SHA256_HASH_SIZE], k[SHA256_HASH_SIZE];
+    for (size_t i = 0; i < SHA256_HASH_SIZE; ++i) {
+        privkey[i] = (uint8_t)(i * 7 + 1);
+        msg_hash[i] = (uint8_t)(i * 13 + 5);
+        extra[i] = (uint8_t)(i * 31 + 3);
+    }
+    ECDSAKey key = ECDSAKey(privkey, SHA256_HASH_SIZE);
+    RFC6979Generator generator = RFC6979Generator(privkey);
+    uint64_t sink = 0;
+
+    printf("RFC 6979 k:\n");
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        msg_hash[0] = (uint8_t)i;
+        get_k_one_shot(privkey, msg_hash, k);
+        sink += k[0];
+    }
+    report("one-shot hmac_sha256()", start, sink);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        msg_hash[0] = (uint8_t)i;
+        sink += generator.generate(msg_hash).limbs()[0];
+    }
+    report("RFC6979Generator::generate()", start, sink);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        msg_hash[0] = (uint8_t)i;
+        sink += generator.generate(msg_hash, extra, sizeof(extra)).limbs()[0];
+    }
+    report("RFC6979Generator::generate(), extra entropy", start, sink);
+
+    printf("Whole signatures:\n");
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        msg_hash[0] = (uint8_t)i;
+        sink += (uint64_t)key.sign(msg_hash, SHA256_HASH_SIZE).r_scalar().limbs()[0];
+    }
+    report("ECDSAKey::sign()", start, sink);
+    return 0;
+}
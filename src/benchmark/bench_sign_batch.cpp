@@ -0,0 +1,45 @@
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "mybitcoin/ecc.h"
+
+#include "bench_utils.h"
+
+using namespace std;
+
+const size_t KEYS = 16;
+const size_t JOBS = 4000;
+
+int main() {
+    vector<ECDSAKey> keys;
+    for (size_t i = 0; i < KEYS; ++i) {
+        keys.push_back(ECDSAKey((int512_t)"0x5d3a8c1e9f07b264a1c3e58d7f902b4c6e1a3d5f7092b4c6d8e0f1a2b3c4d5e6" + i));
+    }
+    vector<uint8_t> msg_hashes(JOBS * SHA256_HASH_SIZE);
+    vector<ECDSASigningJob> jobs(JOBS);
+    for (size_t i = 0; i < JOBS; ++i) {
+        for (size_t j = 0; j < SHA256_HASH_SIZE; ++j) { msg_hashes[i * SHA256_HASH_SIZE + j] = (uint8_t)(i * 131 + j); }
+        jobs[i].key = &keys[i % KEYS];
+        jobs[i].msg_hash = &msg_hashes[i * SHA256_HASH_SIZE];
+    }
+    vector<uint8_t> ders(JOBS * Signature::DER_MAX_LEN);
+    vector<size_t> lengths(JOBS);
+
+    // 1, 2, 4, ... threads, and one per hardware thread
+    unsigned int hardware_threads = max(thread::hardware_concurrency(), 1u);
+    vector<unsigned int> thread_counts;
+    for (unsigned int threads = 1; threads < hardware_threads; threads *= 2) { thread_counts.push_back(threads); }
+    thread_counts.push_back(hardware_threads);
+    double single_thread = 0;
+    for (unsigned int threads : thread_counts) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        ECDSAKey::sign_batch(jobs.data(), JOBS, ders.data(), lengths.data(), threads);
+        double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        if (threads == 1) { single_thread = elapsed; }
+        do_not_optimize(lengths[JOBS - 1]);
+        printf("%3u thread(s): %10.2f signatures/s, %5.2fx\n", threads, JOBS / elapsed * 1e9, single_thread / elapsed);
+    }
+    return 0;
+}
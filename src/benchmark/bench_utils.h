@@ -0,0 +1,12 @@
+#ifndef BENCH_UTILS_H
+#define BENCH_UTILS_H
+
+/**
+ * @brief Make the compiler assume value is read, so that the loops that compute it can't be optimized away. It emits
+ * no instructions.
+ */
+template <typename T> inline void do_not_optimize(const T& value) {
+    __asm__ __volatile__("" : : "m"(value) : "memory");
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "mybitcoin/ecc.h"
+#include "mybitcoin/utils.h"
+
+using namespace std;
+
+const size_t KEYS = 16;
+const size_t SIGNATURES = 2000;
+
+int main() {
+    vector<S256Point> pubkeys;
+    vector<int512_t> msg_hashes;
+    vector<Signature> sigs;
+    uint8_t msg_hash[SHA256_HASH_SIZE];
+    for (size_t i = 0; i < KEYS; ++i) {
+        ECDSAKey key = ECDSAKey((int512_t)"0x3b9e1d7c5a2f8064e1c3a5b7d9f0e2c4a6b8d0f1e3c5a7b9d1f3e5c7a9b0d2f4" + i);
+        pubkeys.push_back(key.public_key());
+    }
+    for (size_t i = 0; i < SIGNATURES; ++i) {
+        for (size_t j = 0; j < SHA256_HASH_SIZE; ++j) { msg_hash[j] = (uint8_t)(i * 137 + j); }
+        ECDSAKey key = ECDSAKey((int512_t)"0x3b9e1d7c5a2f8064e1c3a5b7d9f0e2c4a6b8d0f1e3c5a7b9d1f3e5c7a9b0d2f4" + i % KEYS);
+        msg_hashes.push_back(get_int512_from_bytes(msg_hash, SHA256_HASH_SIZE));
+        sigs.push_back(key.sign(msg_hash, SHA256_HASH_SIZE));
+    }
+    // The threads only read these, through plain S256Point::verify() calls, so nothing is locked or copied
+    const vector<S256Point>& shared_pubkeys = pubkeys;
+
+    // 1, 2, 4, ... threads, and one per hardware thread
+    unsigned int hardware_threads = max(thread::hardware_concurrency(), 1u);
+    vector<unsigned int> thread_counts;
+    for (unsigned int threads = 1; threads < hardware_threads; threads *= 2) { thread_counts.push_back(threads); }
+    thread_counts.push_back(hardware_threads);
+    double single_thread = 0;
+    for (unsigned int threads : thread_counts) {
+        vector<size_t> valid(threads, 0);
+        auto verify_share = [&](const unsigned int t) {
+            // Counted locally, as valid's slots share cache lines
+            size_t count = 0;
+            for (size_t i = t; i < SIGNATURES; i += threads) {
+                count += shared_pubkeys[i % KEYS].verify(msg_hashes[i], sigs[i]);
+            }
+            valid[t] = count;
+        };
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        vector<thread> workers;
+        for (unsigned int t = 1; t < threads; ++t) {
+            workers.emplace_back(verify_share, t);
+        }
+        verify_share(0);
+        for (size_t i = 0; i < workers.size(); ++i) {
+            workers[i].join();
+        }
+        double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        if (threads == 1) { single_thread = elapsed; }
+        size_t total_valid = 0;
+        for (size_t v : valid) { total_valid += v; }
+        // The speedup over one thread, and how close it is to linear
+        printf("%3u thread(s): %10.2f verifications/s, %5.2fx, %5.1f%% efficiency (%lu valid)\n", threads,
+            SIGNATURES / elapsed * 1e9, single_thread / elapsed, single_thread / elapsed / threads * 100, total_valid);
+    }
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <math.h>
 
 #include "mybitcoin/ecc.h"
+#include "mybitcoin/small_field.h"
 #include "mybitcoin/utils.h"
 
 using namespace std;
@@ -121,6 +122,70 @@ int exercise9() {
     return 0;
 }
 
+int testFieldContext() {
+    // Contexts are unique per prime
+    const FieldContext* ctx = FieldContext::get(223);
+    if (ctx != FieldContext::get(223) || ctx == FieldContext::get(19) || ctx->prime() != 223) return 1;
+    if (FieldElement(17, ctx) != FieldElement(17, 223)) return 1;
+    try {
+        FieldContext::get(221); // 13 * 17
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    try {
+        FieldElement(223, ctx);
+        return 1;
+    } catch (const invalid_argument& ia) {}
+
+    // Primes shorter than 64 bits take the native Barrett reduction, check it against int512_t's % near the top of
+    // its range, where the Barrett quotient is the most likely to be off.
+    const int512_t primes[] = {2, 3, 223, 4294967291, 4611686018427387847, 9223372036854775783};
+    for (size_t i = 0; i < sizeof(primes) / sizeof(primes[0]); ++i) {
+        const int512_t p = primes[i];
+        const int512_t nums[] = {0, 1, p / 2, p - 2, p - 1};
+        for (size_t j = 0; j < sizeof(nums) / sizeof(nums[0]); ++j) {
+            for (size_t k = 0; k < sizeof(nums) / sizeof(nums[0]); ++k) {
+                FieldElement a = FieldElement(nums[j], p), b = FieldElement(nums[k], p);
+                if ((a * b).num() != nums[j] * nums[k] % p) return 1;
+                if ((a + b).num() != (nums[j] + nums[k]) % p) return 1;
+                if ((a - b).num() != ((nums[j] - nums[k]) % p + p) % p) return 1;
+                if (a.power(nums[k]).num() != powm(nums[j], nums[k], p)) return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int testSmallFieldElement() {
+    using F19 = small_field::FieldElement<19>;
+    using F31 = small_field::FieldElement<31>;
+    // The same as testDivision() and exercise9(), but evaluated by the compiler
+    static_assert((F19(2) / F19(7)).num() == 3, "2 / 7 (mod 19) should be 3");
+    static_assert((F19(7) / F19(5)).num() == 9, "7 / 5 (mod 19) should be 9");
+    static_assert(F31(17).power(-3).num() == 29, "17^-3 (mod 31) should be 29");
+    static_assert((F31(4).power(-4) * F31(11)).num() == 13, "4^-4 * 11 (mod 31) should be 13");
+    static_assert(F31(0).power(30).num() == 0 && F31(0).power(0).num() == 1, "0^30 should be 0 and 0^0 be 1");
+    static_assert(small_field::is_prime(18446744073709551557ULL) && !small_field::is_prime(3215031751ULL),
+        "2^64 - 59 is the largest 64-bit prime and 3215031751 is a strong pseudoprime to bases 2, 3, 5 and 7");
+
+    // Runtime results must agree with the int512_t FieldElement, including for primes close to 2^64
+    using FBig = small_field::FieldElement<18446744073709551557ULL>;
+    const uint64_t nums[] = {0, 1, 2, 9223372036854775807ULL, 18446744073709551555ULL, 18446744073709551556ULL};
+    for (uint64_t a : nums) {
+        for (uint64_t b : nums) {
+            FieldElement ga = FieldElement(a, FBig::prime()), gb = FieldElement(b, FBig::prime());
+            if ((FBig(a) + FBig(b)).num() != (ga + gb).num()) return 1;
+            if ((FBig(a) - FBig(b)).num() != (ga - gb).num()) return 1;
+            if ((FBig(a) * FBig(b)).num() != (ga * gb).num()) return 1;
+            if (b != 0 && (FBig(a) / FBig(b)).num() != (ga / gb).num()) return 1;
+        }
+    }
+    try {
+        F19(19);
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    return 0;
+}
+
 int main() {
     int retval = 0;
     struct Test_Suite {
@@ -135,6 +200,8 @@ int main() {
         {"testMultiplication()", &testMultiplication},
         {"exercise8()", &exercise8},
         {"exercise9()", &exercise9},
+        {"testFieldContext()", &testFieldContext},
+        {"testSmallFieldElement()", &testSmallFieldElement},
     };
 
     for (uint32_t i = 0; i < sizeof(test_suites)/sizeof(test_suites[0]); ++i) {
@@ -1,10 +1,23 @@
+#include <atomic>
 #include <iostream>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/integer/mod_inverse.hpp>
+#include <boost/random.hpp>
 
 #include "mybitcoin/ecc.h"
+#include "mybitcoin/kernel.h"
+#include "mybitcoin/modinv.h"
+#include "mybitcoin/precomputed.h"
+#include "mybitcoin/rfc6979.h"
+#include "mybitcoin/scalar.h"
+#include "mybitcoin/sigcache.h"
+#include "mybitcoin/small_field.h"
+#include "mybitcoin/tablecache.h"
 #include "mybitcoin/utils.h"
+#include "test_helpers.h"
 
 using namespace std;
 
@@ -323,6 +336,35 @@ int findOrderOfGroup() {
     return 0;
 }
 
+int testSmallFieldElementPoint() {
+    using Point = small_field::FieldElementPoint<0, 7, 223>;
+    // The same results as testFieldElementPointScalarMultiplication() and findOrderOfGroup(), evaluated by the compiler
+    static_assert(Point(192, 105) * 2 == Point(49, 71), "2 * (192, 105) should be (49, 71)");
+    static_assert(Point(47, 71) * 8 == Point(116, 55), "8 * (47, 71) should be (116, 55)");
+    static_assert((Point(47, 71) * 21).infinity(), "21 * (47, 71) should be at infinity");
+    static_assert(Point(15, 86).order() == 7, "the order of (15, 86) should be 7");
+    static_assert(Point(47, 71).order() == 21, "the order of (47, 71) should be 21");
+
+    // Runtime results must agree with the int512_t FieldElementPoint
+    FieldElement a = FieldElement(0, 223), b = FieldElement(7, 223);
+    const uint64_t coords[][2] = {{192, 105}, {17, 56}, {1, 193}, {47, 71}, {143, 98}, {15, 86}};
+    for (size_t i = 0; i < sizeof(coords) / sizeof(coords[0]); ++i) {
+        Point p = Point(coords[i][0], coords[i][1]);
+        FieldElementPoint gp = FieldElementPoint(FieldElement(coords[i][0], 223), FieldElement(coords[i][1], 223), a, b);
+        for (uint64_t coef = 0; coef < 30; ++coef) {
+            Point res = p * coef;
+            FieldElementPoint expected = gp * coef;
+            if (res.infinity() != expected.infinity()) return 1;
+            if (!res.infinity() && (res.x().num() != expected.x().num() || res.y().num() != expected.y().num())) return 1;
+        }
+    }
+    try {
+        Point(200, 119);
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    return 0;
+}
+
 int testSecp256k1() {
     int512_t gx{"0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"}; // string-based constructor
     int512_t gy{"0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8"};    
@@ -379,6 +421,396 @@ int testS256SubClass() {
     return 0;
 }
 
+int testS256Field() {
+    // Cross-check S256Field against int512_t arithmetic, including values right below the prime so that every
+    // reduction branch is taken.
+    int512_t prime{"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f"};
+    int512_t nums[] = {
+        0, 1, 2, 7, prime - 1, prime - 2, (int512_t)"0xffffffffffffffffffffffffffffffff",
+        (int512_t)"0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798",
+        (int512_t)"0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8",
+        (int512_t)"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffe00000000"
+    };
+    for (size_t i = 0; i < sizeof(nums) / sizeof(nums[0]); ++i) {
+        S256Field a = S256Field(nums[i]);
+        if (a.num() != nums[i]) return 1;
+        uint8_t bytes[32];
+        a.get_bytes(bytes);
+        if (S256Field::from_bytes(bytes) != a) return 1;
+        if (a.square().num() != nums[i] * nums[i] % prime) return 1;
+        if (a.negate().num() != (prime - nums[i]) % prime) return 1;
+        if (!a.is_zero() && (a * a.inverse()).num() != 1) return 1;
+        S256Field root = a.square().sqrt();
+        if (root != a && root != a.negate()) return 1;
+        for (size_t j = 0; j < sizeof(nums) / sizeof(nums[0]); ++j) {
+            S256Field b = S256Field(nums[j]);
+            if ((a + b).num() != (nums[i] + nums[j]) % prime) return 1;
+            if ((a - b).num() != (nums[i] - nums[j] + prime) % prime) return 1;
+            if ((a * b).num() != nums[i] * nums[j] % prime) return 1;
+        }
+    }
+    S256Element x = S256Element((int512_t)"0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+    S256Element y = S256Element((int512_t)"0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8");
+    if ((x.power(3) + S256Element(7)).sqrt() != y && (x.power(3) + S256Element(7)).sqrt().num() != prime - y.num()) {
+        return 1;
+    }
+    if ((x / y) * y != x) return 1;
+    if (x.power(-1) != S256Element(1) / x) return 1;
+    return 0;
+}
+
+int testS256PointArithmetic() {
+    // Scalar multiplications are computed in Jacobian coordinates, check them against additions and against the
+    // generic FieldElementPoint implementation.
+    S256Point p = G + G;
+    if (!(p == G * 2)) return 1;
+    if (!(p + G == G * 3)) return 1;
+    if (!(G * 3 + G * 5 == G * 8)) return 1;
+    if (!(G * G.order()).infinity()) return 1;
+    if (!(G * (G.order() + 1) == G)) return 1;
+    if (!(G * (G.order() - 1) + G).infinity()) return 1;
+    if (!(G * 0 == S256Point())) return 1;
+    if (!(S256Point() + G == G)) return 1;
+
+    int512_t k{"0x1e99423a4ed27608a15a2616a2b0e9e52ced330ac530edcc32c8ffc6a526aedd"};
+    FieldElementPoint g = FieldElementPoint(G.x(), G.y(), G.a(), G.b());
+    FieldElementPoint expected = g * k;
+    S256Point res = G * k;
+    if (res.x().num() != expected.x().num() || res.y().num() != expected.y().num()) return 1;
+    if (!(res * 7 == G * (k * 7))) return 1;
+    return 0;
+}
+
+int testS256GeneratorTable() {
+    // s256_multiply_generator() looks G * k up window by window, check it against the plain double-and-add,
+    // including scalars whose windows are all 0 or all 0xf.
+    uint64_t scalars[][4] = {
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {0xf, 0, 0, 0},
+        {0, 0, 0, 0xf000000000000000ULL},
+        {0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0FFFFFFFFFFFFFFFULL},
+        {0xBFD25E8CD0364140ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}, // n - 1
+        {0x32c8ffc6a526aeddULL, 0x2ced330ac530edccULL, 0xa15a2616a2b0e9e5ULL, 0x1e99423a4ed27608ULL}
+    };
+    for (size_t i = 0; i < sizeof(scalars) / sizeof(scalars[0]); ++i) {
+        S256AffineCoords expected = s256_multiply(s256_generator(), scalars[i]).to_affine();
+        S256AffineCoords res = s256_multiply_generator(scalars[i]).to_affine();
+        if (!isSameAffinePoint(expected, res)) return 1;
+    }
+    // The same table of an arbitrary point
+    uint64_t k[4] = {0x1234567890abcdefULL, 0xfedcba0987654321ULL, 0x0f0f0f0f0f0f0f0fULL, 0x7777777777777777ULL};
+    S256AffineCoords p = s256_multiply(s256_generator(), k).to_affine();
+    S256PointTable table(p);
+    for (size_t i = 0; i < sizeof(scalars) / sizeof(scalars[0]); ++i) {
+        S256AffineCoords expected = s256_multiply(p, scalars[i]).to_affine();
+        S256AffineCoords res = table.multiply(scalars[i]).to_affine();
+        if (!isSameAffinePoint(expected, res)) return 1;
+    }
+    S256AffineCoords infinity;
+    infinity.infinity = true;
+    if (!S256PointTable(infinity).multiply(k).infinity()) return 1;
+    return 0;
+}
+
+int testS256PrecomputedConstants() {
+    // The curve constants are compile-time constants, and G, which skipped the curve check, is on the curve
+    static_assert(S256Field::PRIME == ((int512_t)1 << 256) - ((int512_t)1 << 32) - 977, "wrong p");
+    static_assert(
+        S256Field(1, 2, 3, 4).num() == (((int512_t)4 << 192) | ((int512_t)3 << 128) | ((int512_t)2 << 64) | 1),
+        "wrong limb order"
+    );
+    S256Point g = S256Point(
+        S256Element((int512_t)"0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"),
+        S256Element((int512_t)"0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8")
+    );
+    if (!(g == G) || !(g == S256Point::generator())) return 1;
+    if (S256Scalar::order() != (int512_t)"0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141") return 1;
+    if (FieldContext::get(S256Field::PRIME) != FieldContext::s256()) return 1;
+
+    // Every entry of the compiled-in tables against the plain double-and-add
+    for (int i = 0; i < 64; ++i) {
+        for (int j = 1; j < 16; ++j) {
+            uint64_t k[4] = {0, 0, 0, 0};
+            k[i / 16] = (uint64_t)j << (4 * (i % 16));
+            S256AffineCoords expected = s256_multiply(s256_generator(), k).to_affine();
+            if (!isSameAffinePoint(expected, S256_GENERATOR_WINDOW_TABLE[i * 15 + j - 1])) return 1;
+            if (j % 2 == 1 && !isSameAffinePoint(expected, S256_GENERATOR_FIXED_TABLE[i * 8 + j / 2])) return 1;
+        }
+    }
+    // 16^64 = 2^256 ≡ 2^256 - n (mod n)
+    uint64_t top[4] = {0x402DA1732FC9BEBFULL, 0x4551231950B75FC4ULL, 1, 0};
+    S256AffineCoords expected = s256_multiply(s256_generator(), top).to_affine();
+    if (!isSameAffinePoint(expected, S256_GENERATOR_FIXED_TABLE[64 * 8])) return 1;
+    for (uint64_t i = 0; i < S256_GENERATOR_ODD_MULTIPLES_SIZE; ++i) {
+        uint64_t k[4] = {2 * i + 1, 0, 0, 0};
+        expected = s256_multiply(s256_generator(), k).to_affine();
+        if (!isSameAffinePoint(expected, S256_GENERATOR_ODD_MULTIPLES[i])) return 1;
+        expected = S256JacobianPoint(expected).endomorphism().to_affine();
+        if (!isSameAffinePoint(expected, S256_LAMBDA_GENERATOR_ODD_MULTIPLES[i])) return 1;
+    }
+    return 0;
+}
+
+int testS256JointMultiplication() {
+    // s256_multiply_joint() must agree with two separate multiplications followed by an addition, including when
+    // a scalar is zero and when the two terms cancel out (G * k + (-G) * k).
+    uint64_t scalars[][4] = {
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {0x7f, 0, 0, 0},
+        {0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0FFFFFFFFFFFFFFFULL},
+        {0xBFD25E8CD0364140ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}, // n - 1
+        {0x32c8ffc6a526aeddULL, 0x2ced330ac530edccULL, 0xa15a2616a2b0e9e5ULL, 0x1e99423a4ed27608ULL}
+    };
+    uint64_t p_scalar[4] = {0x5A8B4C1E9D3F2701ULL, 0x1234567890ABCDEFULL, 0xC0FFEE0DDBA11ULL, 0x7E57ED5CA1A2ULL};
+    S256AffineCoords p = s256_multiply(s256_generator(), p_scalar).to_affine();
+    S256AffineCoords neg_g = s256_generator();
+    neg_g.y = neg_g.y.negate();
+    const size_t count = sizeof(scalars) / sizeof(scalars[0]);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < count; ++j) {
+            S256AffineCoords expected = s256_multiply(s256_generator(), scalars[i]).add(
+                s256_multiply(p, scalars[j])
+            ).to_affine();
+            S256AffineCoords res = s256_multiply_joint(scalars[i], p, scalars[j]).to_affine();
+            if (!isSameAffinePoint(expected, res)) return 1;
+        }
+        if (!s256_multiply_joint(scalars[i], neg_g, scalars[i]).infinity()) return 1;
+    }
+    return 0;
+}
+
+int testS256FixedMultiplication() {
+    // Even scalars take the n - k path and odd ones don't, so cover both, as well as the ends of [0, n)
+    uint64_t scalars[][4] = {
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {2, 0, 0, 0},
+        {0x10, 0, 0, 0},
+        {0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0FFFFFFFFFFFFFFFULL},
+        {0xBFD25E8CD036413FULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}, // n - 2
+        {0xBFD25E8CD0364140ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}, // n - 1
+        {0x32c8ffc6a526aeddULL, 0x2ced330ac530edccULL, 0xa15a2616a2b0e9e5ULL, 0x1e99423a4ed27608ULL},
+        {0x32c8ffc6a526aedcULL, 0x2ced330ac530edccULL, 0xa15a2616a2b0e9e5ULL, 0x1e99423a4ed27608ULL}
+    };
+    uint64_t p_scalar[4] = {0x5A8B4C1E9D3F2701ULL, 0x1234567890ABCDEFULL, 0xC0FFEE0DDBA11ULL, 0x7E57ED5CA1A2ULL};
+    S256AffineCoords p = s256_multiply(s256_generator(), p_scalar).to_affine();
+    for (size_t i = 0; i < sizeof(scalars) / sizeof(scalars[0]); ++i) {
+        S256AffineCoords expected = s256_multiply(s256_generator(), scalars[i]).to_affine();
+        S256AffineCoords res = s256_multiply_generator_fixed(scalars[i]).to_affine();
+        if (!isSameAffinePoint(expected, res)) return 1;
+        expected = s256_multiply(p, scalars[i]).to_affine();
+        res = s256_multiply_fixed(p, scalars[i]).to_affine();
+        if (!isSameAffinePoint(expected, res)) return 1;
+    }
+    S256Point q = G * 12345;
+    if (!(G.multiply_fixed(67890) == G * 67890) || !(q.multiply_fixed(67890) == q * 67890)) return 1;
+    return 0;
+}
+
+int testS256Endomorphism() {
+    const int512_t n = (int512_t)"0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141";
+    uint64_t lambda[4] = {0xDF02967C1B23BD72ULL, 0x122E22EA20816678ULL, 0xA5261C028812645AULL, 0x5363AD4CC05C30E0ULL};
+    // lambda * G must be G with its x multiplied by beta
+    S256AffineCoords lambda_g = s256_multiply(s256_generator(), lambda).to_affine();
+    S256AffineCoords expected_lambda_g = S256JacobianPoint(s256_generator()).endomorphism().to_affine();
+    if (!isSameAffinePoint(lambda_g, expected_lambda_g)) return 1;
+
+    uint64_t scalars[][4] = {
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {0xDF02967C1B23BD72ULL, 0x122E22EA20816678ULL, 0xA5261C028812645AULL, 0x5363AD4CC05C30E0ULL}, // lambda
+        {0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x0FFFFFFFFFFFFFFFULL},
+        {0xBFD25E8CD0364140ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}, // n - 1
+        {0x32c8ffc6a526aeddULL, 0x2ced330ac530edccULL, 0xa15a2616a2b0e9e5ULL, 0x1e99423a4ed27608ULL}
+    };
+    uint64_t p_scalar[4] = {0x5A8B4C1E9D3F2701ULL, 0x1234567890ABCDEFULL, 0xC0FFEE0DDBA11ULL, 0x7E57ED5CA1A2ULL};
+    S256AffineCoords p = s256_multiply(s256_generator(), p_scalar).to_affine();
+    const size_t count = sizeof(scalars) / sizeof(scalars[0]);
+    for (size_t i = 0; i < count; ++i) {
+        // k1 + k2 * lambda ≡ k (mod n), with both halves no longer than 129 bits
+        uint64_t k1[4], k2[4];
+        bool k1_negative, k2_negative;
+        s256_split_scalar(scalars[i], k1, k1_negative, k2, k2_negative);
+        if (k1[3] != 0 || k1[2] > 1 || k2[3] != 0 || k2[2] > 1) return 1;
+        int512_t k = 0, r1 = 0, r2 = 0, l = 0;
+        for (int j = 3; j >= 0; --j) {
+            k = (k << 64) | scalars[i][j];
+            r1 = (r1 << 64) | k1[j];
+            r2 = (r2 << 64) | k2[j];
+            l = (l << 64) | lambda[j];
+        }
+        if (k1_negative) r1 = -r1;
+        if (k2_negative) r2 = -r2;
+        if (((r1 + r2 * l - k) % n) != 0) return 1;
+
+        S256AffineCoords expected = s256_multiply(p, scalars[i]).to_affine();
+        S256AffineCoords res = s256_multiply_glv(p, scalars[i]).to_affine();
+        if (!isSameAffinePoint(expected, res)) return 1;
+        for (size_t j = 0; j < count; ++j) {
+            expected = s256_multiply_joint(scalars[i], p, scalars[j]).to_affine();
+            res = s256_multiply_joint_glv(scalars[i], p, scalars[j]).to_affine();
+            if (!isSameAffinePoint(expected, res)) return 1;
+        }
+    }
+    return 0;
+}
+
+int testModularInverse() {
+    // safegcd must agree with the extended Euclidean algorithm, for edge cases as well as random numbers
+    const int512_t p = (int512_t)"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f";
+    const int512_t n = (int512_t)"0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141";
+    vector<int512_t> nums = {0, 1, 2, 3, 0xFFFFFFFFFFFFFFFFULL, (int512_t)1 << 255, n - 1, p - 1, n / 2, p / 2};
+    boost::random::mt19937_64 gen(20221031);
+    for (int i = 0; i < 200; ++i) {
+        nums.push_back(((int512_t)gen() << 192) | ((int512_t)gen() << 128) | ((int512_t)gen() << 64) | gen());
+    }
+    for (size_t i = 0; i < nums.size(); ++i) {
+        int512_t num_p = nums[i] % p, num_n = nums[i] % n;
+        int512_t expected_p = num_p == 0 ? 0 : boost::integer::mod_inverse(num_p, p);
+        int512_t expected_n = num_n == 0 ? 0 : boost::integer::mod_inverse(num_n, n);
+        if (S256Field(num_p).inverse().num() != expected_p) return 1;
+        if (S256Scalar(num_n).inverse().num() != expected_n) return 1;
+        if (S256Scalar(num_n).negate().inverse().num() != (expected_n == 0 ? 0 : n - expected_n)) return 1;
+    }
+    return 0;
+}
+
+int testBatchInversion() {
+    // Zeros (or points at infinity) are mixed in, including at both ends, as batch inversion has to skip them.
+    const size_t count = 9;
+    S256Field elements[count], inverses[count];
+    S256Scalar scalars[count], scalar_inverses[count];
+    S256JacobianPoint points[count];
+    S256AffineCoords affine[count];
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t limbs[4] = {0x9C47D08FFB10D4B8ULL * (i + 1), 0xFD17B448A6855419ULL, i, 0x483ADA7726A3C465ULL};
+        elements[i] = i % 4 == 0 ? S256Field() : S256Field::from_limbs(limbs);
+        inverses[i] = elements[i];
+        scalars[i] = i % 4 == 0 ? S256Scalar() : S256Scalar::from_limbs(limbs);
+        scalar_inverses[i] = scalars[i];
+        uint64_t scalar[4] = {i % 4 == 0 ? 0 : 12345 + i, 0, 0, 0};
+        points[i] = s256_multiply(s256_generator(), scalar).add(S256JacobianPoint(s256_generator()));
+    }
+    S256Field::batch_inverse(inverses, count);
+    S256Scalar::batch_inverse(scalar_inverses, count);
+    S256JacobianPoint::batch_to_affine(points, count, affine);
+    for (size_t i = 0; i < count; ++i) {
+        if (inverses[i] != elements[i].inverse()) return 1;
+        if (i % 4 != 0 && inverses[i] * elements[i] != S256Field(1)) return 1;
+        if (scalar_inverses[i] != scalars[i].inverse()) return 1;
+        if (i % 4 != 0 && scalar_inverses[i] * scalars[i] != S256Scalar((uint64_t)1)) return 1;
+        S256AffineCoords expected = points[i].to_affine();
+        if (!isSameAffinePoint(expected, affine[i])) return 1;
+    }
+    S256Field::batch_inverse(nullptr, 0);
+    S256Scalar::batch_inverse(nullptr, 0);
+    return 0;
+}
+
+int testS256Kernels() {
+    // Every kernel set the CPU supports must agree with int512_t arithmetic, for edge cases as well as random numbers
+    const int512_t p = (int512_t)"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f";
+    const int512_t n = (int512_t)"0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141";
+    vector<int512_t> nums = {0, 1, 2, 0xFFFFFFFFFFFFFFFFULL, (int512_t)1 << 255, n - 1, p - 1, n, p - n};
+    boost::random::mt19937_64 gen(20221031);
+    for (int i = 0; i < 100; ++i) {
+        nums.push_back(((int512_t)gen() << 192) | ((int512_t)gen() << 128) | ((int512_t)gen() << 64) | gen());
+    }
+    const string default_kernel = s256_kernel().name;
+    if (s256_select_kernel("no_such_kernel") || default_kernel != s256_kernel().name) return 1;
+    for (const char* name : {"portable", "mulx_adx", "avx512_ifma"}) {
+        if (!s256_select_kernel(name)) {
+            printf("(%s is not supported by this CPU, skipped) ", name);
+            continue;
+        }
+        for (size_t i = 0; i < nums.size(); ++i) {
+            const int512_t a = nums[i], b = nums[(i * 7 + 3) % nums.size()];
+            uint64_t a_limbs[4], b_limbs[4], a_n[4], b_n[4], product[8], r[4];
+            for (int j = 0; j < 4; ++j) {
+                a_limbs[j] = (uint64_t)((a >> (64 * j)) & 0xFFFFFFFFFFFFFFFFULL);
+                b_limbs[j] = (uint64_t)((b >> (64 * j)) & 0xFFFFFFFFFFFFFFFFULL);
+            }
+            s256_kernel().multiply_wide(a_limbs, b_limbs, product);
+            int512_t wide = 0;
+            for (int j = 7; j >= 0; --j) { wide = (wide << 64) | product[j]; }
+            if (wide != a * b) return 1;
+            S256Field fa = S256Field(a % p), fb = S256Field(b % p);
+            if ((fa * fb).num() != a % p * (b % p) % p) return 1;
+            if (fa.square().num() != a % p * (a % p) % p) return 1;
+            s256_scalar_reduce(a_limbs, a_n);
+            s256_scalar_reduce(b_limbs, b_n);
+            if (S256Field::from_limbs(a_n).num() != a % n) return 1;
+            s256_scalar_multiply(a_n, b_n, r);
+            if (S256Field::from_limbs(r).num() != a % n * (b % n) % n) return 1;
+            s256_scalar_add(a_n, b_n, r);
+            if (S256Field::from_limbs(r).num() != (a + b) % n) return 1;
+        }
+        // With a SIMD kernel, batch_to_affine() works on groups of 8 points, the last one partial here, and has to
+        // skip the points at infinity
+        vector<S256JacobianPoint> points(37);
+        vector<S256AffineCoords> affine(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            uint64_t scalar[4] = {gen(), gen(), gen(), gen() & 0x7FFFFFFFFFFFFFFFULL};
+            if (i % 10 != 3) { points[i] = s256_multiply(s256_generator(), scalar); }
+        }
+        S256JacobianPoint::batch_to_affine(points.data(), points.size(), affine.data());
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (!isSameAffinePoint(points[i].to_affine(), affine[i])) return 1;
+        }
+    }
+    return s256_select_kernel(default_kernel.c_str()) ? 0 : 1;
+}
+
+int testS256Scalar() {
+    // S256Scalar must agree with int512_t arithmetic modulo n, for edge cases as well as random numbers
+    const int512_t n = (int512_t)"0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141";
+    vector<int512_t> nums = {0, 1, 2, 0xFFFFFFFFFFFFFFFFULL, (int512_t)1 << 255, n - 1, n / 2, n / 2 + 1};
+    boost::random::mt19937_64 gen(20221031);
+    for (int i = 0; i < 100; ++i) {
+        nums.push_back((((int512_t)gen() << 192) | ((int512_t)gen() << 128) | ((int512_t)gen() << 64) | gen()) % n);
+    }
+    vector<S256Scalar> scalars, inverses;
+    for (size_t i = 0; i < nums.size(); ++i) {
+        const int512_t a = nums[i], b = nums[(i * 7 + 3) % nums.size()];
+        S256Scalar sa = S256Scalar(a), sb = S256Scalar(b);
+        if (sa.num() != a) return 1;
+        if ((sa + sb).num() != (a + b) % n) return 1;
+        if ((sa - sb).num() != (a - b + n) % n) return 1;
+        if ((sa * sb).num() != a * b % n) return 1;
+        if (sa.negate().num() != (n - a) % n) return 1;
+        if (sa.inverse().num() != (a == 0 ? 0 : boost::integer::mod_inverse(a, n))) return 1;
+        if (sa.is_high() != (a > n / 2)) return 1;
+        uint8_t bytes[32];
+        bool overflow = true;
+        sa.get_bytes(bytes);
+        if (S256Scalar::from_bytes(bytes, &overflow) != sa || overflow) return 1;
+        scalars.push_back(sa);
+    }
+    // Values from n up to 2^256 - 1 are reduced, and reported as such
+    uint8_t bytes[32];
+    memset(bytes, 0xFF, sizeof(bytes));
+    bool overflow = false;
+    if (S256Scalar::from_bytes(bytes, &overflow).num() != (((int512_t)1 << 256) - 1) % n || !overflow) return 1;
+    uint64_t n_limbs[4] = {0xBFD25E8CD0364141ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL};
+    if (!S256Scalar::from_limbs(n_limbs).is_zero()) return 1;
+    inverses = scalars;
+    S256Scalar::batch_inverse(inverses.data(), inverses.size());
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        if (inverses[i] != scalars[i].inverse()) return 1;
+    }
+    try {
+        S256Scalar(n).num();
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    try {
+        S256Scalar((int512_t)-1).num();
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    return 0;
+}
+
 int testS256Verification() {
     S256Point p1 = S256Point(
         (int512_t)"0x04519fac3d910ca7e7138f7013706f619fa8f033e6ec6e09370ea38cee6a7574",
@@ -411,6 +843,205 @@ int testS256Verification() {
     return 0;
 }
 
+int testS256BatchVerification() {
+    // A mix of valid signatures and ones tampered with in different ways, verify_batch() must agree with verify()
+    // on every one of them, no matter how the work is split among threads.
+    const size_t count = 23;
+    vector<S256Point> pubkeys;
+    vector<int512_t> msg_hashes;
+    vector<Signature> sigs;
+    makeSignedTriples(count, 12345, 1000003, pubkeys, msg_hashes, sigs);
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 4 == 1) {
+            msg_hashes[i] += 1;
+        } else if (i % 4 == 2) {
+            sigs[i] = Signature(sigs[i].r(), sigs[i].s() + 1);
+        } else if (i % 4 == 3 && i % 8 == 3) {
+            sigs[i] = Signature(sigs[i].r(), 0);
+        }
+    }
+    bool expected[count], results[count];
+    for (size_t i = 0; i < count; ++i) {
+        expected[i] = pubkeys[i].verify(msg_hashes[i], sigs[i]);
+        if (expected[i] != (i % 4 == 0 || i % 8 == 7)) return 1;
+    }
+    unsigned int threads[] = {1, 2, 5, 64, 0};
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); ++i) {
+        memset(results, 0, sizeof(results));
+        S256Point::verify_batch(pubkeys.data(), msg_hashes.data(), sigs.data(), count, results, threads[i]);
+        if (memcmp(results, expected, sizeof(results)) != 0) return 1;
+    }
+    S256Point::verify_batch(nullptr, nullptr, nullptr, 0, nullptr, 4);
+    return 0;
+}
+
+int testSignatureCache() {
+    const size_t count = 12;
+    vector<S256Point> pubkeys;
+    vector<int512_t> msg_hashes;
+    vector<Signature> sigs;
+    makeSignedTriples(count, 54321, 1000033, pubkeys, msg_hashes, sigs);
+
+    SignatureCache cache(1000);
+    if (cache.capacity() != 1024) return 1;
+    for (size_t i = 0; i < count; ++i) {
+        if (!cache.verify(pubkeys[i], msg_hashes[i], sigs[i])) return 1;
+    }
+    SignatureCache::Stats stats = cache.stats();
+    if (stats.hits != 0 || stats.misses != count || stats.insertions != count || stats.evictions != 0) return 1;
+    for (size_t i = 0; i < count; ++i) {
+        if (!cache.verify(pubkeys[i], msg_hashes[i], sigs[i])) return 1;
+        // A cached triple must not make any other triple with one part in common pass
+        if (cache.verify(pubkeys[i], msg_hashes[i] + 1, sigs[i]) ||
+            cache.verify(pubkeys[(i + 1) % count], msg_hashes[i], sigs[i]) ||
+            cache.verify(pubkeys[i], msg_hashes[i], Signature(sigs[i].r(), sigs[i].s() + 1))) return 1;
+    }
+    stats = cache.stats();
+    if (stats.hits != count || stats.misses != count * 4 || stats.insertions != count) return 1;
+    // Failed verifications aren't cached, so they are checked every time
+    if (cache.verify(pubkeys[0], msg_hashes[0] + 1, sigs[0]) || cache.contains(pubkeys[0], msg_hashes[0] + 1, sigs[0]))
+        return 1;
+    // Hashes with the same low 256 bits are different messages to verify(), unless they are congruent modulo n
+    if (cache.verify(pubkeys[0], msg_hashes[0] + ((int512_t)1 << 256), sigs[0]) ||
+        cache.verify(pubkeys[0], msg_hashes[0] - ((int512_t)1 << 256), sigs[0]) ||
+        cache.verify(pubkeys[0], -msg_hashes[0], sigs[0])) return 1;
+    if (!cache.contains(pubkeys[0], msg_hashes[0] + S256Scalar::order(), sigs[0])) return 1;
+
+    // A cache much smaller than its working set keeps evicting, but never gets an answer wrong
+    SignatureCache small_cache(4);
+    for (int round = 0; round < 3; ++round) {
+        for (size_t i = 0; i < count; ++i) {
+            if (!small_cache.verify(pubkeys[i], msg_hashes[i], sigs[i])) return 1;
+        }
+    }
+    stats = small_cache.stats();
+    if (stats.evictions == 0 || stats.hits + stats.misses != count * 3 || stats.insertions != stats.misses) return 1;
+
+    // Many threads looking up and inserting the same triples at once
+    SignatureCache shared_cache(1024);
+    atomic<bool> failed(false);
+    vector<thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&, t]() {
+            vector<S256Point> local_pubkeys = pubkeys;
+            for (int round = 0; round < 3; ++round) {
+                for (size_t i = 0; i < count; ++i) {
+                    size_t j = (i + t * 3) % count;
+                    if (!shared_cache.verify(local_pubkeys[j], msg_hashes[j], sigs[j]) ||
+                        shared_cache.verify(local_pubkeys[j], msg_hashes[j] + 1, sigs[j])) failed = true;
+                }
+            }
+        });
+    }
+    for (size_t i = 0; i < workers.size(); ++i) { workers[i].join(); }
+    if (failed) return 1;
+    for (size_t i = 0; i < count; ++i) {
+        if (!shared_cache.contains(pubkeys[i], msg_hashes[i], sigs[i])) return 1;
+    }
+    return 0;
+}
+
+int testS256PointTableCache() {
+    const size_t count = 3;
+    vector<S256Point> pubkeys;
+    vector<int512_t> msg_hashes;
+    vector<Signature> sigs;
+    makeSignedTriples(count, 98765, 1000037, pubkeys, msg_hashes, sigs);
+    // Verification with a table agrees with the plain one, on good and bad signatures alike
+    S256PointTable table(pubkeys[0].affine_coords());
+    if (!pubkeys[0].verify(msg_hashes[0], sigs[0], table) || pubkeys[0].verify(msg_hashes[0] + 1, sigs[0], table) ||
+        pubkeys[0].verify(msg_hashes[1], sigs[1], table) ||
+        pubkeys[0].verify(msg_hashes[0], Signature(sigs[0].r(), 0), table)) return 1;
+
+    // Room for the tables of two keys, which get them on their third verification
+    const size_t budget = table.memory_usage() * 2 + 1024;
+    S256PointTableCache cache(budget, 3);
+    for (int round = 0; round < 5; ++round) {
+        for (size_t i = 0; i < 2; ++i) {
+            if (!cache.verify(pubkeys[i], msg_hashes[i], sigs[i]) || cache.verify(pubkeys[i], msg_hashes[i] + 1, sigs[i]))
+                return 1;
+        }
+    }
+    S256PointTableCache::Stats stats = cache.stats();
+    // Each key verified 10 times, the first 2 without a table
+    if (stats.tables_built != 2 || stats.tables != 2 || stats.keys != 2 || stats.evictions != 0 ||
+        stats.plain_verifications != 4 || stats.table_verifications != 16 || stats.memory_usage > budget) return 1;
+    // A third key's table doesn't fit, so the least recently used key, 0, goes
+    if (!cache.verify(pubkeys[1], msg_hashes[1], sigs[1])) return 1;
+    for (int i = 0; i < 3; ++i) {
+        if (!cache.verify(pubkeys[2], msg_hashes[2], sigs[2])) return 1;
+    }
+    stats = cache.stats();
+    if (stats.tables_built != 3 || stats.tables != 2 || stats.keys != 2 || stats.evictions != 1 ||
+        stats.memory_usage > budget) return 1;
+    // Key 0 starts counting from scratch
+    if (!cache.verify(pubkeys[0], msg_hashes[0], sigs[0])) return 1;
+    stats = cache.stats();
+    if (stats.plain_verifications != 7 || stats.keys != 3) return 1;
+
+    // A budget too small for any table only counts
+    S256PointTableCache small_cache(4096, 1);
+    for (int i = 0; i < 3; ++i) {
+        if (!small_cache.verify(pubkeys[0], msg_hashes[0], sigs[0])) return 1;
+    }
+    stats = small_cache.stats();
+    if (stats.tables != 0 || stats.keys != 1 || stats.memory_usage > 4096) return 1;
+    return 0;
+}
+
+int testConcurrentSignAndVerify() {
+    // Keys, public keys, G and the caches are shared by all the threads, which sign and verify the same messages
+    // at the same time. Every thread must get what a single thread gets.
+    const size_t count = 4;
+    vector<ECDSAKey> keys;
+    vector<S256Point> pubkeys;
+    vector<int512_t> msg_hashes;
+    vector<Signature> sigs;
+    vector<S256Point> products;
+    uint8_t msg_hash_bytes[count][SHA256_HASH_SIZE];
+    makeSignedTriples(count, 24680, 1000039, pubkeys, msg_hashes, sigs, &keys, msg_hash_bytes);
+    for (size_t i = 0; i < count; ++i) { products.push_back(pubkeys[i] * msg_hashes[i]); }
+    const vector<ECDSAKey>& shared_keys = keys;
+    const vector<S256Point>& shared_pubkeys = pubkeys;
+    SignatureCache sig_cache(64);
+    S256PointTableCache table_cache(1 << 20, 2);
+
+    atomic<int> failures(0);
+    auto stress = [&](const size_t id) {
+        for (int round = 0; round < 3; ++round) {
+            for (size_t j = 0; j < count; ++j) {
+                const size_t i = (id + j) % count;
+                Signature sig = shared_keys[i].sign(msg_hash_bytes[i], SHA256_HASH_SIZE);
+                if (sig.r() != sigs[i].r() || sig.s() != sigs[i].s()) { ++failures; }
+                if (!shared_pubkeys[i].verify(msg_hashes[i], sig) || shared_pubkeys[i].verify(msg_hashes[i] + 1, sig))
+                    ++failures;
+                if (!sig_cache.verify(shared_pubkeys[i], msg_hashes[i], sig) ||
+                    !table_cache.verify(shared_pubkeys[i], msg_hashes[i], sig) ||
+                    table_cache.verify(shared_pubkeys[(i + 1) % count], msg_hashes[i], sig)) ++failures;
+                if (!(G.multiply_fixed((int512_t)24680 + i * 1000039) == shared_pubkeys[i]) ||
+                    !(shared_keys[i].public_key() == shared_pubkeys[i])) ++failures;
+                if (!(shared_pubkeys[i] * msg_hashes[i] == products[i])) { ++failures; }
+            }
+            bool results[count] = {false};
+            S256Point::verify_batch(shared_pubkeys.data(), msg_hashes.data(), sigs.data(), count, results, 2);
+            for (size_t i = 0; i < count; ++i) {
+                if (!results[i]) { ++failures; }
+            }
+        }
+    };
+    vector<thread> threads;
+    for (size_t id = 0; id < 8; ++id) {
+        threads.emplace_back(stress, id);
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    if (failures != 0) return 1;
+    // G itself is untouched
+    if (!(G == S256Point::generator()) || !(G * 1 == G)) return 1;
+    return 0;
+}
+
 int testBytesToInt512() {
     uint8_t input0[] = { 0xff, 0x00 };
     if (get_int512_from_bytes(input0, sizeof(input0), true) != 65280) return 1;
@@ -485,6 +1116,94 @@ int testSignatureCreation() {
     return 0;
 }
 
+/**
+ * @brief RFC 6979 step by step with one-shot hmac_sha256() calls, what RFC6979Generator must agree with
+ */
+int512_t rfc6979_reference(const uint8_t* privkey, const uint8_t* msg_hash, const uint8_t* extra, size_t extra_len) {
+    uint8_t k[SHA256_HASH_SIZE] = {0}, v[SHA256_HASH_SIZE], h1[SHA256_HASH_SIZE];
+    memset(v, 0x01, sizeof(v));
+    S256Scalar::from_bytes(msg_hash).get_bytes(h1);
+    vector<uint8_t> data(SHA256_HASH_SIZE * 3 + 1 + extra_len);
+    for (uint8_t separator : {0x00, 0x01}) {
+        memcpy(data.data(), v, SHA256_HASH_SIZE);
+        data[SHA256_HASH_SIZE] = separator;
+        memcpy(&data[SHA256_HASH_SIZE + 1], privkey, SHA256_HASH_SIZE);
+        memcpy(&data[SHA256_HASH_SIZE * 2 + 1], h1, SHA256_HASH_SIZE);
+        if (extra_len > 0) { memcpy(&data[SHA256_HASH_SIZE * 3 + 1], extra, extra_len); }
+        hmac_sha256(k, SHA256_HASH_SIZE, data.data(), data.size(), k);
+        hmac_sha256(k, SHA256_HASH_SIZE, v, SHA256_HASH_SIZE, v);
+    }
+    hmac_sha256(k, SHA256_HASH_SIZE, v, SHA256_HASH_SIZE, v);
+    return get_int512_from_bytes(v, SHA256_HASH_SIZE);
+}
+
+int testRFC6979() {
+    boost::random::mt19937_64 gen(20221114);
+    uint8_t buf[300], expected[SHA256_HASH_SIZE], actual[SHA256_HASH_SIZE];
+    for (size_t i = 0; i < sizeof(buf); ++i) { buf[i] = (uint8_t)gen(); }
+    // Every length across a few block boundaries, written in two pieces
+    for (size_t len = 0; len < 200; ++len) {
+        cal_sha256_hash(buf, len, expected);
+        SHA256Hasher hasher;
+        size_t split = gen() % (len + 1);
+        hasher.write(buf, split);
+        hasher.write(buf + split, len - split);
+        hasher.finalize(actual);
+        if (memcmp(expected, actual, SHA256_HASH_SIZE) != 0) return 1;
+    }
+    for (size_t key_len : {0, 1, 32, 64, 65, 100}) {
+        for (size_t data_len : {0, 32, 97, 129}) {
+            hmac_sha256(buf + 150, key_len, buf, data_len, expected);
+            HMACSHA256(buf + 150, key_len).compute(buf, data_len, actual);
+            if (memcmp(expected, actual, SHA256_HASH_SIZE) != 0) return 1;
+        }
+    }
+
+    uint8_t privkey[SHA256_HASH_SIZE], msg_hash[SHA256_HASH_SIZE], extra[SHA256_HASH_SIZE];
+    for (int i = 0; i < 20; ++i) {
+        for (size_t j = 0; j < SHA256_HASH_SIZE; ++j) {
+            privkey[j] = (uint8_t)gen();
+            msg_hash[j] = (uint8_t)gen();
+            extra[j] = (uint8_t)gen();
+        }
+        // Includes a message hash >= n, which is reduced first
+        if (i == 0) { memset(msg_hash, 0xFF, SHA256_HASH_SIZE); }
+        privkey[0] &= 0x7F;
+        ECDSAKey key = ECDSAKey(privkey, SHA256_HASH_SIZE);
+        RFC6979Generator generator = RFC6979Generator(privkey);
+        if (generator.generate(msg_hash).num() != rfc6979_reference(privkey, msg_hash, nullptr, 0) ||
+            key.get_deterministic_k(msg_hash, SHA256_HASH_SIZE) != rfc6979_reference(privkey, msg_hash, nullptr, 0))
+            return 1;
+        for (size_t extra_len : {1, 16, 32}) {
+            if (generator.generate(msg_hash, extra, extra_len).num() !=
+                rfc6979_reference(privkey, msg_hash, extra, extra_len)) return 1;
+        }
+        // Extra entropy gives a different signature of the same message, which verifies all the same
+        Signature sig = key.sign(msg_hash, SHA256_HASH_SIZE);
+        Signature other_sig = key.sign(msg_hash, SHA256_HASH_SIZE, extra, SHA256_HASH_SIZE);
+        int512_t z = get_int512_from_bytes(msg_hash, SHA256_HASH_SIZE);
+        if (other_sig.r() == sig.r() || !key.public_key().verify(z, other_sig) || !key.public_key().verify(z, sig))
+            return 1;
+    }
+
+    // A little-endian private key signs with the key it stands for
+    for (size_t j = 0; j < SHA256_HASH_SIZE; ++j) { privkey[j] = (uint8_t)gen(); }
+    privkey[SHA256_HASH_SIZE - 1] &= 0x7F;
+    ECDSAKey key = ECDSAKey(privkey, SHA256_HASH_SIZE, true);
+    if (!key.public_key().verify(get_int512_from_bytes(msg_hash, SHA256_HASH_SIZE),
+        key.sign(msg_hash, SHA256_HASH_SIZE))) return 1;
+    // and with the same K as that key given in big-endian order or as an integer
+    uint8_t privkey_big_endian[SHA256_HASH_SIZE];
+    for (size_t j = 0; j < SHA256_HASH_SIZE; ++j) { privkey_big_endian[j] = privkey[SHA256_HASH_SIZE - 1 - j]; }
+    ECDSAKey big_endian_key = ECDSAKey(privkey_big_endian, SHA256_HASH_SIZE);
+    ECDSAKey int_key = ECDSAKey(get_int512_from_bytes(privkey_big_endian, SHA256_HASH_SIZE));
+    int512_t k = key.get_deterministic_k(msg_hash, SHA256_HASH_SIZE);
+    if (k != big_endian_key.get_deterministic_k(msg_hash, SHA256_HASH_SIZE) ||
+        k != int_key.get_deterministic_k(msg_hash, SHA256_HASH_SIZE) ||
+        k != rfc6979_reference(privkey_big_endian, msg_hash, nullptr, 0)) return 1;
+    return 0;
+}
+
 int main() {
     int retval = 0;
     struct Test_Suite {
@@ -497,11 +1216,28 @@ int main() {
         {"testIfPointsNotOnCurve()", &testIfPointsNotOnCurve},
         {"findOrderOfGroup()", &findOrderOfGroup},
         {"testFieldElementPointScalarMultiplication()", &testFieldElementPointScalarMultiplication},
+        {"testSmallFieldElementPoint()", &testSmallFieldElementPoint},
         {"testSecp256k1()", &testSecp256k1},
         {"testS256SubClass()", &testS256SubClass},
+        {"testS256Field()", &testS256Field},
+        {"testS256PointArithmetic()", &testS256PointArithmetic},
+        {"testS256GeneratorTable()", &testS256GeneratorTable},
+        {"testS256PrecomputedConstants()", &testS256PrecomputedConstants},
+        {"testS256JointMultiplication()", &testS256JointMultiplication},
+        {"testS256FixedMultiplication()", &testS256FixedMultiplication},
+        {"testS256Endomorphism()", &testS256Endomorphism},
+        {"testModularInverse()", &testModularInverse},
+        {"testBatchInversion()", &testBatchInversion},
+        {"testS256Kernels()", &testS256Kernels},
+        {"testS256Scalar()", &testS256Scalar},
         {"testS256Verification()", &testS256Verification},
+        {"testS256BatchVerification()", &testS256BatchVerification},
+        {"testSignatureCache()", &testSignatureCache},
+        {"testS256PointTableCache()", &testS256PointTableCache},
+        {"testConcurrentSignAndVerify()", &testConcurrentSignAndVerify},
         {"testBytesToInt512()", &testBytesToInt512},
         {"testSignatureCreation()", &testSignatureCreation},
+        {"testRFC6979()", &testRFC6979},
         {"testFieldElementPointAddition()", &testFieldElementPointAddition}
     };
 
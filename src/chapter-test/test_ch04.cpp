@@ -1,7 +1,13 @@
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 
+#include "mybitcoin/derive.h"
 #include "mybitcoin/ecc.h"
+#include "mybitcoin/pointarray.h"
+#include "mybitcoin/scalar.h"
 #include "mybitcoin/utils.h"
+#include "test_helpers.h"
 
 int test_uncompressed_sec_format_from_bytes() {
     const size_t test_case_size = 3;
@@ -115,6 +121,149 @@ int test_compressed_sec_format_from_int512() {
     return 0;
 }
 
+int test_parse_sec() {
+    // Both formats of a few keys must parse back to the same point
+    int512_t private_key_ints[] = {1, 5000, 5001, (int512_t)33466154331649568, (int512_t)3917405025026849};
+    for (size_t i = 0; i < sizeof(private_key_ints) / sizeof(private_key_ints[0]); ++i) {
+        S256Point pubkey = ECDSAKey(private_key_ints[i]).public_key();
+        for (bool compressed : {true, false}) {
+            uint8_t* sec = pubkey.get_sec_format(compressed);
+            S256Point parsed = S256Point::parse_sec(sec, compressed ? 33 : 65);
+            free(sec);
+            if (parsed.to_string() != pubkey.to_string()) return 1;
+        }
+    }
+    uint8_t sec[65];
+    uint8_t* g_sec = G.get_sec_format(false);
+    memcpy(sec, g_sec, sizeof(sec));
+    free(g_sec);
+    vector<uint8_t> uncompressed(sec, sec + 65), compressed(sec, sec + 33), off_curve = uncompressed,
+        unknown_prefix = compressed, no_root(33, 0x00), too_large(33, 0xFF), zeros(65, 0x00);
+    compressed[0] = 0x02;
+    off_curve[64] ^= 0x01;
+    unknown_prefix[0] = 0x05;
+    no_root[0] = 0x02;
+    no_root[32] = 0x05;  // 5^3 + 7 has no square root
+    too_large[0] = 0x03;
+    zeros[0] = 0x04;
+    vector<pair<vector<uint8_t>, bool>> cases = {
+        {uncompressed, true},
+        {compressed, true},
+        {vector<uint8_t>(sec, sec + 33), false},  // 0x04 with a compressed key's length
+        {vector<uint8_t>(sec, sec + 1), false},
+        {vector<uint8_t>(), false},
+        {off_curve, false},
+        {unknown_prefix, false},
+        {no_root, false},
+        {too_large, false},                       // x >= p
+        {zeros, false}                            // (0, 0) is not on the curve
+    };
+    for (size_t i = 0; i < cases.size(); ++i) {
+        try {
+            S256Point::parse_sec(cases[i].first.data(), cases[i].first.size());
+            if (!cases[i].second) return 1;
+        } catch (const invalid_argument& ia) {
+            if (cases[i].second) return 1;
+        }
+    }
+    return 0;
+}
+
+int test_parse_sec_batch() {
+    // parse_sec_batch() must agree with parse_sec() on valid and invalid keys alike, no matter how the work is split
+    // among threads.
+    const size_t count = 37;
+    for (size_t sec_len : {33, 65}) {
+        vector<uint8_t> secs(count * sec_len);
+        vector<string> expected(count);
+        for (size_t i = 0; i < count; ++i) {
+            uint8_t* sec = ECDSAKey((int512_t)12345 + i * 1000003).public_key().get_sec_format(sec_len == 33);
+            memcpy(&secs[i * sec_len], sec, sec_len);
+            free(sec);
+            if (i % 5 == 3) { secs[i * sec_len + sec_len - 1] ^= 0x01; }
+            try {
+                expected[i] = S256Point::parse_sec(&secs[i * sec_len], sec_len).to_string();
+            } catch (const invalid_argument& ia) {}
+        }
+        for (unsigned int threads : {1, 3, 64, 0}) {
+            vector<S256Point> points(count);
+            bool results[count];
+            S256Point::parse_sec_batch(secs.data(), sec_len, count, points.data(), results, threads);
+            for (size_t i = 0; i < count; ++i) {
+                if (results[i] != !expected[i].empty()) return 1;
+                if (results[i] && points[i].to_string() != expected[i]) return 1;
+            }
+        }
+    }
+    S256Point::parse_sec_batch(nullptr, 33, 0, nullptr, nullptr, 4);
+    return 0;
+}
+
+int test_point_array() {
+    if (sizeof(S256CompactPoint) != 64) return 1;
+    S256AffineCoords infinity;
+    if (!S256CompactPoint::from_affine(infinity).infinity()) return 1;
+    if (!S256CompactPoint::from_affine(infinity).to_affine().infinity) return 1;
+    // append_sec() must agree with parse_sec(), with invalid keys kept in place as the point at infinity
+    const size_t count = 37;
+    for (size_t sec_len : {33, 65}) {
+        vector<uint8_t> secs(count * sec_len);
+        vector<string> expected(count);
+        size_t expected_valid = 0;
+        for (size_t i = 0; i < count; ++i) {
+            ECDSAKey((int512_t)12345 + i * 1000003).public_key().get_sec_format(sec_len == 33, &secs[i * sec_len]);
+            if (i % 5 == 3) { secs[i * sec_len + sec_len - 1] ^= 0x01; }
+            try {
+                expected[i] = S256Point::parse_sec(&secs[i * sec_len], sec_len).to_string();
+                ++expected_valid;
+            } catch (const invalid_argument& ia) {}
+        }
+        for (unsigned int threads : {1, 3, 64, 0}) {
+            S256PointArray points;
+            S256Point g = G;
+            points.push_back(g);
+            bool results[count];
+            if (points.append_sec(secs.data(), sec_len, count, results, threads) != expected_valid) return 1;
+            if (points.size() != count + 1) return 1;
+            if (points.memory_usage() < points.size() * 64) return 1;
+            if (points.point(0).to_string() != G.to_string()) return 1;
+            for (size_t i = 0; i < count; ++i) {
+                if (results[i] != !expected[i].empty()) return 1;
+                if (points.get(i + 1).infinity() != expected[i].empty()) return 1;
+                if (!results[i]) continue;
+                if (points.point(i + 1).to_string() != expected[i]) return 1;
+                uint8_t sec[S256Point::SEC_UNCOMPRESSED_LEN];
+                if (points.get_sec_format(i + 1, sec_len == 33, sec) != sec_len) return 1;
+                if (memcmp(sec, &secs[i * sec_len], sec_len) != 0) return 1;
+                if (!(points.xs()[i + 1] == points.affine_coords(i + 1).x)) return 1;
+                if (!(points.ys()[i + 1] == points.affine_coords(i + 1).y)) return 1;
+            }
+        }
+    }
+    S256PointArray points;
+    points.push_back(infinity);
+    if (!points.point(0).infinity()) return 1;
+    uint8_t sec[S256Point::SEC_UNCOMPRESSED_LEN];
+    try {
+        points.get_sec_format(0, true, sec);
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    points.set(0, G.affine_coords());
+    if (points.point(0).to_string() != G.to_string()) return 1;
+    try {
+        points.get(1);
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    // S256Point's constructor from affine coordinates still checks the curve
+    S256AffineCoords off_curve = G.affine_coords();
+    off_curve.y = off_curve.y + S256Field(1);
+    try {
+        S256Point(off_curve).to_string();
+        return 1;
+    } catch (const invalid_argument& ia) {}
+    return 0;
+}
+
 int test_der_sig_format() {
     Signature sig = Signature(
         (int512_t)"0x37206a0610995c58074999cb9767b87af4c4978db68c06e8e6e81d282047a7c6",
@@ -133,6 +282,74 @@ int test_der_sig_format() {
     return 0;
 }
 
+int test_parse_der() {
+    Signature sig = Signature(
+        (int512_t)"0x37206a0610995c58074999cb9767b87af4c4978db68c06e8e6e81d282047a7c6",
+        (int512_t)"0x8ca63759c1157ebeaec0d03cecca119fc9a75bf8e6d0fa65c841c8e2738cdaec"
+    );
+    size_t der_len;
+    uint8_t* der = sig.get_der_format(&der_len);
+    vector<uint8_t> canonical(der, der + der_len);
+    free(der);
+    // Every variant encodes sig's r and s
+    vector<uint8_t> padded = {0x30, 0x46, 0x02, 0x21, 0x00};        // a 0x00 the first byte doesn't need
+    padded.insert(padded.end(), canonical.begin() + 4, canonical.end());
+    vector<uint8_t> long_form = {0x30, 0x81, 0x46, 0x02, 0x81, 0x20}; // long-form lengths
+    long_form.insert(long_form.end(), canonical.begin() + 4, canonical.end());
+    vector<uint8_t> trailing = canonical;                             // garbage after the sequence
+    trailing.push_back(0x01);
+    vector<uint8_t> unpadded = canonical;                             // s without its 0x00, so it reads negative
+    unpadded.erase(unpadded.begin() + 4 + 32 + 2);
+    unpadded[1] -= 1;
+    unpadded[4 + 32 + 1] -= 1;
+    struct {
+        vector<uint8_t> der;
+        bool strict;
+        bool lax;
+    } cases[] = {
+        {canonical, true, true},
+        {padded, false, true},
+        {long_form, false, true},
+        {trailing, false, true},
+        {unpadded, false, true},
+        {vector<uint8_t>(canonical.begin(), canonical.end() - 1), false, false},  // truncated
+        {vector<uint8_t>(canonical.begin() + 1, canonical.end()), false, false},  // no sequence
+        {vector<uint8_t>(), false, false}
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        for (bool strict : {true, false}) {
+            Signature parsed;
+            bool expected = strict ? cases[i].strict : cases[i].lax;
+            if (Signature::parse_der(cases[i].der.data(), cases[i].der.size(), parsed, strict) != expected) return 1;
+            if (expected && (parsed.r() != sig.r() || parsed.s() != sig.s())) return 1;
+        }
+    }
+    // r == n is valid DER, but the signature it parses into must never verify
+    vector<uint8_t> overflow = {0x30, 0x26, 0x02, 0x21, 0x00};
+    uint8_t n_bytes[32];
+    S256Scalar(1).negate().get_bytes(n_bytes);
+    n_bytes[31] += 1;
+    overflow.insert(overflow.end(), n_bytes, n_bytes + 32);
+    overflow.insert(overflow.end(), {0x02, 0x01, 0x01});
+    Signature parsed;
+    if (!Signature::parse_der(overflow.data(), overflow.size(), parsed) || parsed.r() != 0 || parsed.s() != 0) return 1;
+    // sig's s is above n / 2, sign() must only produce the other one
+    if (sig.has_low_s() || !Signature(sig.r(), S256Scalar::order() - sig.s()).has_low_s()) return 1;
+    vector<S256Point> pubkeys;
+    vector<int512_t> msg_hashes;
+    vector<Signature> sigs;
+    makeSignedTriples(16, 12345, 1, pubkeys, msg_hashes, sigs);
+    for (const Signature& signed_sig : sigs) {
+        if (!signed_sig.has_low_s()) return 1;
+        der = signed_sig.get_der_format(&der_len);
+        bool ok = Signature::parse_der(der, der_len, parsed) && parsed.r() == signed_sig.r() &&
+            parsed.s() == signed_sig.s();
+        free(der);
+        if (!ok) return 1;
+    }
+    return 0;
+}
+
 int test_bytes_to_base58() {
     const size_t test_case_size = 6;
     uint8_t inputs[test_case_size][128] = {
@@ -186,6 +403,9 @@ int test_base58_checksum() {
             return 1;
         }
         free(output);
+        char buffer[128];
+        size_t len = encode_base58_checksum(input_bytes[i], input_bytes_len[i], buffer);
+        if (strcmp(buffer, expected_outputs[i]) != 0 || len != strlen(expected_outputs[i])) return 1;
     }
     return 0;
 }
@@ -218,6 +438,145 @@ int test_hash160_address() {
     return 0;
 }
 
+int test_caller_buffer_serialization() {
+    // The caller-buffer and batch versions must produce exactly what the allocating versions do
+    const size_t count = 9;
+    vector<S256Point> points;
+    vector<Signature> sigs;
+    uint8_t msg_hash[SHA256_HASH_SIZE] = {0};
+    for (size_t i = 0; i < count; ++i) {
+        ECDSAKey key = ECDSAKey((int512_t)1 + i * i * 1000003);
+        points.push_back(key.public_key());
+        msg_hash[i] = i;
+        sigs.push_back(key.sign(msg_hash, SHA256_HASH_SIZE));
+    }
+    // Short r and s, and ones that need a 0x00 in front
+    sigs.push_back(Signature(1, (int512_t)"0x80"));
+    sigs.push_back(Signature(0, (int512_t)"0x8ca63759c1157ebeaec0d03cecca119fc9a75bf8e6d0fa65c841c8e2738cdaec"));
+    vector<uint8_t> ders(sigs.size() * Signature::DER_MAX_LEN);
+    vector<size_t> lengths(sigs.size());
+    size_t total = Signature::get_der_format_batch(sigs.data(), sigs.size(), ders.data(), lengths.data());
+    size_t offset = 0;
+    for (size_t i = 0; i < sigs.size(); ++i) {
+        size_t expected_len;
+        uint8_t* expected = sigs[i].get_der_format(&expected_len);
+        uint8_t der[Signature::DER_MAX_LEN];
+        bool ok = sigs[i].get_der_format(der) == expected_len && memcmp(der, expected, expected_len) == 0 &&
+            lengths[i] == expected_len && memcmp(&ders[offset], expected, expected_len) == 0;
+        free(expected);
+        if (!ok) return 1;
+        offset += expected_len;
+    }
+    if (total != offset) return 1;
+
+    for (bool compressed : {true, false}) {
+        const size_t sec_len = compressed ? S256Point::SEC_COMPRESSED_LEN : S256Point::SEC_UNCOMPRESSED_LEN;
+        vector<uint8_t> secs(count * sec_len);
+        S256Point::get_sec_format_batch(points.data(), count, compressed, secs.data());
+        for (bool testnet : {true, false}) {
+            vector<char> addresses(count * (S256Point::ADDRESS_MAX_LEN + 1));
+            S256Point::get_address_batch(points.data(), count, compressed, testnet, addresses.data());
+            for (size_t i = 0; i < count; ++i) {
+                uint8_t* expected_sec = points[i].get_sec_format(compressed);
+                uint8_t sec[S256Point::SEC_UNCOMPRESSED_LEN];
+                char* expected_address = points[i].get_address(compressed, testnet);
+                char address[S256Point::ADDRESS_MAX_LEN + 1];
+                size_t address_len = points[i].get_address(compressed, testnet, address);
+                bool ok = points[i].get_sec_format(compressed, sec) == sec_len &&
+                    memcmp(sec, expected_sec, sec_len) == 0 && memcmp(&secs[i * sec_len], expected_sec, sec_len) == 0 &&
+                    strcmp(address, expected_address) == 0 && address_len == strlen(expected_address) &&
+                    strcmp(&addresses[i * (S256Point::ADDRESS_MAX_LEN + 1)], expected_address) == 0;
+                free(expected_sec);
+                free(expected_address);
+                if (!ok) return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int test_derive_range() {
+    // Starting from 1 walks through G + G, which add_affine() has to double. 600 keys span more than one chunk.
+    const size_t count = 600;
+    const int512_t n = S256Scalar::order();
+    vector<int512_t> starts = {1, n - count};
+    for (const int512_t& start : starts) {
+        uint8_t start_key[32];
+        S256Scalar(start).get_bytes(start_key);
+        vector<S256Point> points;
+        for (size_t i = 0; i < count; ++i) { points.push_back(ECDSAKey(start + i).public_key()); }
+        for (bool compressed : {true, false}) {
+            const size_t sec_len = compressed ? S256Point::SEC_COMPRESSED_LEN : S256Point::SEC_UNCOMPRESSED_LEN;
+            for (unsigned int threads : {1, 3, 0}) {
+                vector<uint8_t> secs(count * sec_len), hashes(count * RIPEMD160_HASH_SIZE);
+                vector<char> addresses(count * (S256Point::ADDRESS_MAX_LEN + 1));
+                s256_derive_range(start_key, count, compressed, start == 1, secs.data(), hashes.data(),
+                    addresses.data(), threads);
+                for (size_t i = 0; i < count; ++i) {
+                    uint8_t sec[S256Point::SEC_UNCOMPRESSED_LEN], hash[RIPEMD160_HASH_SIZE];
+                    char address[S256Point::ADDRESS_MAX_LEN + 1];
+                    points[i].get_sec_format(compressed, sec);
+                    hash160(sec, sec_len, hash);
+                    points[i].get_address(compressed, start == 1, address);
+                    if (memcmp(&secs[i * sec_len], sec, sec_len) != 0 ||
+                        memcmp(&hashes[i * RIPEMD160_HASH_SIZE], hash, RIPEMD160_HASH_SIZE) != 0 ||
+                        strcmp(&addresses[i * (S256Point::ADDRESS_MAX_LEN + 1)], address) != 0) return 1;
+                }
+            }
+        }
+        // Only the addresses are wanted
+        vector<char> addresses(count * (S256Point::ADDRESS_MAX_LEN + 1));
+        s256_derive_range(start_key, count, true, false, nullptr, nullptr, addresses.data(), 2);
+        char address[S256Point::ADDRESS_MAX_LEN + 1];
+        points[count - 1].get_address(true, false, address);
+        if (strcmp(&addresses[(count - 1) * (S256Point::ADDRESS_MAX_LEN + 1)], address) != 0) return 1;
+    }
+
+    // 0, and ranges that run into n
+    for (const int512_t& start : {(int512_t)0, n - count + 1}) {
+        uint8_t start_key[32];
+        S256Scalar(start).get_bytes(start_key);
+        vector<char> addresses(count * (S256Point::ADDRESS_MAX_LEN + 1));
+        try {
+            s256_derive_range(start_key, count, true, false, nullptr, nullptr, addresses.data());
+            return 1;
+        } catch (const invalid_argument& e) {}
+    }
+    uint8_t overflowing_key[32];
+    memset(overflowing_key, 0xFF, sizeof(overflowing_key));
+    try {
+        s256_derive_range(overflowing_key, 1, true, false, nullptr, nullptr, nullptr);
+        return 1;
+    } catch (const invalid_argument& e) {}
+    return 0;
+}
+
+int test_sign_batch() {
+    // Jobs over a handful of keys, in no particular order, the same as signing them one by one
+    const size_t count = 50;
+    vector<ECDSAKey> keys;
+    for (int i = 0; i < 5; ++i) { keys.push_back(ECDSAKey((int512_t)"0x1f2e3d4c5b6a" * (i + 1) + 7)); }
+    vector<uint8_t> msg_hashes(count * SHA256_HASH_SIZE);
+    vector<ECDSASigningJob> jobs(count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < SHA256_HASH_SIZE; ++j) { msg_hashes[i * SHA256_HASH_SIZE + j] = (uint8_t)(i * 31 + j); }
+        jobs[i].key = &keys[(i * 3) % keys.size()];
+        jobs[i].msg_hash = &msg_hashes[i * SHA256_HASH_SIZE];
+    }
+    for (unsigned int threads : {1, 3, 0}) {
+        vector<uint8_t> ders(count * Signature::DER_MAX_LEN);
+        vector<size_t> lengths(count);
+        ECDSAKey::sign_batch(jobs.data(), count, ders.data(), lengths.data(), threads);
+        for (size_t i = 0; i < count; ++i) {
+            uint8_t der[Signature::DER_MAX_LEN];
+            size_t der_len = jobs[i].key->sign(jobs[i].msg_hash, SHA256_HASH_SIZE).get_der_format(der);
+            if (lengths[i] != der_len || memcmp(&ders[i * Signature::DER_MAX_LEN], der, der_len) != 0) return 1;
+        }
+    }
+    ECDSAKey::sign_batch(jobs.data(), 0, nullptr, nullptr, 4);
+    return 0;
+}
+
 int test_privkey_wif_address() {
     ECDSAKey key = ECDSAKey(5003);
     char* addr;
@@ -260,11 +619,18 @@ int main() {
         {"test_uncompressed_sec_format_from_int512()", &test_uncompressed_sec_format_from_int512},
         {"test_compressed_sec_format_from_bytes()", &test_compressed_sec_format_from_bytes},
         {"test_compressed_sec_format_from_int512()", &test_compressed_sec_format_from_int512},
+        {"test_parse_sec()", &test_parse_sec},
+        {"test_parse_sec_batch()", &test_parse_sec_batch},
+        {"test_point_array()", &test_point_array},
         {"test_der_sig_format()", &test_der_sig_format},
+        {"test_parse_der()", &test_parse_der},
         {"test_bytes_to_base58()", &test_bytes_to_base58},
         {"test_base58_checksum()", &test_base58_checksum},
         {"test_hash160_address()", &test_hash160_address},
-        {"test_privkey_wif_address()", &test_privkey_wif_address}
+        {"test_privkey_wif_address()", &test_privkey_wif_address},
+        {"test_caller_buffer_serialization()", &test_caller_buffer_serialization},
+        {"test_derive_range()", &test_derive_range},
+        {"test_sign_batch()", &test_sign_batch}
     };
 
     for (uint32_t i = 0; i < sizeof(test_suites)/sizeof(test_suites[0]); ++i) {
@@ -0,0 +1,38 @@
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "mybitcoin/ecc.h"
+#include "mybitcoin/utils.h"
+
+inline bool isSameAffinePoint(const S256AffineCoords& a, const S256AffineCoords& b) {
+    return a.infinity == b.infinity && (a.infinity || (a.x == b.x && a.y == b.y));
+}
+
+/**
+ * @brief Sign "Programming Bitcoin! #0", "Programming Bitcoin! #1", ... with the keys first_key, first_key + step, ...,
+ * one message per key, and append each key's public key, the message's hash and the signature to pubkeys,
+ * msg_hashes and sigs
+ * @param keys if it isn't nullptr, the keys are appended to it as well
+ * @param msg_hash_bytes if it isn't nullptr, an array of count hashes that the messages' hashes are written to
+ */
+inline void makeSignedTriples(const size_t count, const int512_t& first_key, const int512_t& step,
+    vector<S256Point>& pubkeys, vector<int512_t>& msg_hashes, vector<Signature>& sigs,
+    vector<ECDSAKey>* keys = nullptr, uint8_t (*msg_hash_bytes)[SHA256_HASH_SIZE] = nullptr) {
+    for (size_t i = 0; i < count; ++i) {
+        ECDSAKey key = ECDSAKey(first_key + step * i);
+        string msg = "Programming Bitcoin! #" + to_string(i);
+        uint8_t msg_hash[SHA256_HASH_SIZE];
+        cal_sha256_hash((uint8_t*)msg.c_str(), msg.size(), msg_hash);
+        pubkeys.push_back(key.public_key());
+        msg_hashes.push_back(get_int512_from_bytes(msg_hash, SHA256_HASH_SIZE));
+        sigs.push_back(key.sign(msg_hash, SHA256_HASH_SIZE));
+        if (keys != nullptr) { keys->push_back(key); }
+        if (msg_hash_bytes != nullptr) { memcpy(msg_hash_bytes[i], msg_hash, SHA256_HASH_SIZE); }
+    }
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string.h>
+#include <vector>
+
+#include "derive.h"
+#include "scalar.h"
+#include "utils.h"
+
+using namespace std;
+
+// The number of points converted to affine coordinates with one inversion. Beyond a few hundred, the inversion's
+// share of the cost is negligible and a bigger chunk only takes more memory.
+static const size_t DERIVE_CHUNK_SIZE = 512;
+
+/**
+ * @brief Derive keys [begin, end) of the range, whose key begin is first_key
+ */
+static void derive_share(const S256Scalar& first_key, const size_t begin, const size_t end, const bool compressed,
+    const bool testnet, uint8_t* secs, uint8_t* hashes, char* addresses) {
+    if (begin >= end) { return; }
+    const size_t KEY_SIZE = 32;
+    const size_t sec_len = compressed ? S256Point::SEC_COMPRESSED_LEN : S256Point::SEC_UNCOMPRESSED_LEN;
+    const S256AffineCoords& g = s256_generator();
+    vector<S256JacobianPoint> points(min(DERIVE_CHUNK_SIZE, end - begin));
+    vector<S256AffineCoords> affine(points.size());
+    // The only multiplication of the share. The keys are secrets, so it is the fixed-schedule one.
+    S256JacobianPoint p = s256_multiply_generator_fixed(first_key.limbs());
+    for (size_t chunk = begin; chunk < end; chunk += DERIVE_CHUNK_SIZE) {
+        const size_t len = min(DERIVE_CHUNK_SIZE, end - chunk);
+        for (size_t i = 0; i < len; ++i) {
+            points[i] = p;
+            p = p.add_affine(g);
+        }
+        S256JacobianPoint::batch_to_affine(points.data(), len, affine.data());
+        for (size_t i = 0; i < len; ++i) {
+            const size_t index = chunk + i;
+            uint8_t sec[S256Point::SEC_UNCOMPRESSED_LEN];
+            affine[i].x.get_bytes(sec + 1);
+            if (compressed) {
+                sec[0] = affine[i].y.is_odd() ? 0x03 : 0x02;
+            } else {
+                sec[0] = 0x04;
+                affine[i].y.get_bytes(sec + 1 + KEY_SIZE);
+            }
+            if (secs != nullptr) { memcpy(secs + index * sec_len, sec, sec_len); }
+            if (hashes == nullptr && addresses == nullptr) { continue; }
+            uint8_t hash[RIPEMD160_HASH_SIZE + 1];
+            hash160(sec, sec_len, hash + 1);
+            if (hashes != nullptr) { memcpy(hashes + index * RIPEMD160_HASH_SIZE, hash + 1, RIPEMD160_HASH_SIZE); }
+            if (addresses != nullptr) {
+                hash[0] = testnet ? 0x6f : 0x00;
+                encode_base58_checksum(hash, RIPEMD160_HASH_SIZE + 1,
+                    addresses + index * (S256Point::ADDRESS_MAX_LEN + 1));
+            }
+        }
+    }
+}
+
+void s256_derive_range(const uint8_t* start_key, const size_t count, const bool compressed, const bool testnet,
+    uint8_t* secs, uint8_t* hashes, char* addresses, unsigned int threads) {
+    if (count == 0) { return; }
+    bool overflow = false;
+    S256Scalar first_key = S256Scalar::from_bytes(start_key, &overflow);
+    // None of the keys may be 0 (mod n), whose public key is the point at infinity
+    if (overflow || first_key.is_zero() || first_key.num() + count > S256Scalar::order()) {
+        throw invalid_argument("the key range is empty or doesn't fit in [1, n)");
+    }
+    // Each worker walks one contiguous share of the range on its own
+    run_in_chunks(count, threads, [&](const size_t begin, const size_t end) {
+        derive_share(first_key + S256Scalar((uint64_t)begin), begin, end, compressed, testnet, secs, hashes, addresses);
+    });
+}
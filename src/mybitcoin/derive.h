@@ -0,0 +1,34 @@
+#ifndef DERIVE_H
+#define DERIVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ecc.h"
+
+/**
+ * @brief Derive the public keys, hash160s and/or addresses of count consecutive private keys k, k + 1, ...,
+ * k + count - 1, e.g., to audit or recover keys in a range.
+ * Building an ECDSAKey per key costs a full G * k each, and get_address() an int512_t base58 conversion. Instead,
+ * each worker thread multiplies G once, for the first key of its share of the range, and walks the rest as P + G,
+ * P + 2G, ... in Jacobian coordinates, which is one mixed addition per key. The points are converted to affine
+ * coordinates a chunk at a time, with a single inversion per chunk (see S256JacobianPoint::batch_to_affine()), and
+ * hashed and encoded straight into the output arrays. Any of the output arrays may be nullptr if it isn't needed.
+ * @param start_key k, 32 bytes in big-endian order
+ * @param count the number of keys
+ * @param compressed whether the keys are serialized (and thus hashed) in compressed SEC format
+ * @param testnet whether the addresses are testnet ones
+ * @param secs nullptr, or a pre-allocated buffer of count * S256Point::SEC_COMPRESSED_LEN (or SEC_UNCOMPRESSED_LEN)
+ * bytes, the public keys in SEC format back to back
+ * @param hashes nullptr, or a pre-allocated buffer of count * RIPEMD160_HASH_SIZE bytes, the hash160s of the public
+ * keys back to back
+ * @param addresses nullptr, or a pre-allocated buffer of count * (S256Point::ADDRESS_MAX_LEN + 1) chars, the
+ * null-terminated address of key k + i starts at addresses + i * (S256Point::ADDRESS_MAX_LEN + 1), the same layout
+ * as S256Point::get_address_batch()
+ * @param threads the number of worker threads, including the calling one. 0 means one per hardware thread.
+ * @throw invalid_argument if k is 0, or the range doesn't fit below the order of G
+ */
+void s256_derive_range(const uint8_t* start_key, const size_t count, const bool compressed, const bool testnet,
+  uint8_t* secs, uint8_t* hashes, char* addresses, unsigned int threads = 1);
+
+#endif
@@ -1,37 +1,124 @@
 #include <arpa/inet.h>
 #include <assert.h>
-#include <boost/integer/mod_inverse.hpp>
+#include <atomic>
 #include <float.h>
 #include <limits.h>
 #include <math.h>
-#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "ecc.h"
+#include "int128.h"
+#include "scalar.h"
 #include "utils.h"
 
 using namespace std;
 using namespace boost::multiprecision;
 
+// The largest number FieldContext and FieldElement support, 2^256 - 1
+static constexpr int512_t MAX_256_BIT = ((int512_t)1 << 256) - 1;
+
+FieldContext::FieldContext(const int512_t& prime) {
+    if (prime > MAX_256_BIT) {  // avoid risk of overflow
+        throw invalid_argument("prime [" + prime.str() + "] is longer than 256 bits, which is not supported");
+    }
+    // secp256k1's prime never gets here, get() returns s256_ for it
+    if (fermat_primality_test(prime, 128) == false) {
+        throw invalid_argument("prime [" + prime.str() + "] is not a prime number");
+    }
+    this->prime_ = prime;
+    if (prime < ((int512_t)1 << 63)) {
+        this->small_ = true;
+        this->small_prime_ = (uint64_t)prime;
+        this->bits_ = (int)msb(prime) + 1;
+        // floor(4^k / prime), which is at most 2^(k + 1) and fits in 64 bits as k <= 63
+        this->barrett_mu_ = (uint64_t)(((u128)1 << (2 * this->bits_)) / this->small_prime_);
+    }
+}
+
+const FieldContext* FieldContext::get(const int512_t& prime) {
+    if (prime == S256Field::PRIME) { return FieldContext::s256(); }
+    // Contexts are never destroyed, so the pointers handed out stay valid for the rest of the program.
+    static mutex contexts_mutex;
+    static map<int512_t, unique_ptr<FieldContext>> contexts;
+    lock_guard<mutex> lock(contexts_mutex);
+    auto it = contexts.find(prime);
+    if (it == contexts.end()) {
+        it = contexts.emplace(prime, unique_ptr<FieldContext>(new FieldContext(prime))).first;
+    }
+    return it->second.get();
+}
+
+uint64_t FieldContext::small_multiply(const uint64_t a, const uint64_t b) const {
+    u128 x = (u128)a * b;
+    // x < prime^2 < 2^(2k), so (x >> (k - 1)) < 2^(k + 1) and the product below fits in 128 bits
+    u128 q = ((x >> (this->bits_ - 1)) * this->barrett_mu_) >> (this->bits_ + 1);
+    uint64_t r = (uint64_t)(x - q * this->small_prime_);
+    while (r >= this->small_prime_) { r -= this->small_prime_; }
+    return r;
+}
+
+int512_t FieldContext::add(const int512_t& a, const int512_t& b) const {
+    int512_t result = a + b;
+    if (result >= this->prime_) { result -= this->prime_; }
+    return result;
+}
+
+int512_t FieldContext::subtract(const int512_t& a, const int512_t& b) const {
+    int512_t result = a - b;
+    if (result < 0) { result += this->prime_; }
+    return result;
+}
+
+int512_t FieldContext::multiply(const int512_t& a, const int512_t& b) const {
+    if (this->small_) {
+        return this->small_multiply((uint64_t)a, (uint64_t)b);
+    }
+    return a * b % this->prime_;
+}
+
+int512_t FieldContext::power(const int512_t& base, const int512_t& exponent) const {
+    if (!this->small_) {
+        return powm(base, exponent, this->prime_);
+    }
+    // Left-to-right binary exponentiation, the same as powm() but on native integers
+    uint64_t b = (uint64_t)base;
+    uint64_t result = 1 % this->small_prime_;
+    for (int i = exponent == 0 ? -1 : (int)msb(exponent); i >= 0; --i) {
+        result = this->small_multiply(result, result);
+        if (bit_test(exponent, i)) {
+            result = this->small_multiply(result, b);
+        }
+    }
+    return result;
+}
+
+const FieldContext* FieldElement::default_context() {
+    static const FieldContext* context = FieldContext::get(2);
+    return context;
+}
+
+FieldElement FieldElement::from_reduced(const int512_t& num, const FieldContext* context) {
+    FieldElement result;
+    result.num_ = num;
+    result.context_ = context;
+    return result;
+}
+
 FieldElement::FieldElement(int512_t num, int512_t prime) {
     if (num >= prime) {
         throw invalid_argument("invalid num [" + num.str() + "] is negative or greater than prime [" + prime.str() + "]");
     }
-    if (num > (int512_t)"0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff") { // avoid risk of overflow
+    if (num > MAX_256_BIT) { // avoid risk of overflow
         throw invalid_argument("num [" + num.str() + "] is longer than 256 bits, which is not supported");
     }
-    if (prime > (int512_t)"0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff") {  // avoid risk of overflow
-        throw invalid_argument("prime [" + num.str() + "] is longer than 256 bits, which is not supported");
-    }
-    
-    if (prime != (int512_t)"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f") {
-        if (fermat_primality_test(prime, 128) == false) {
-        throw invalid_argument("prime [" + prime.str() + "] is not a prime number");
-        }
-    }
+    this->context_ = FieldContext::get(prime);
     this->num_ = num;
-    this->prime_ = prime;
 }
 
 FieldElement::FieldElement() {
@@ -41,19 +128,23 @@ FieldElement::FieldElement() {
     // FieldElement(0, 1); seems in C++ we can't call another constructor in a constructor...  
 }
 
-int512_t FieldElement::num() {
+int512_t FieldElement::num() const {
     return this->num_;
 }
 
-int512_t FieldElement::prime() {
-    return this->prime_;
+int512_t FieldElement::prime() const {
+    return this->context_->prime();
+}
+
+const FieldContext* FieldElement::context() const {
+    return this->context_;
 }
 
 bool FieldElement::operator==(const FieldElement& other) const
 {
     // ICYW: This is overloading, not overriding lol. One point to note is that while operator==() is supposed to be a
     // member method of this, it can  access private members of other as well.
-    return this->prime_ == other.prime_ && this->num_ == other.num_;
+    return this->context_ == other.context_ && this->num_ == other.num_;
 }
 
 bool FieldElement::operator!=(const FieldElement& other) const
@@ -62,39 +153,37 @@ bool FieldElement::operator!=(const FieldElement& other) const
     return !(*this == other);
 }
 
-FieldElement FieldElement::operator+(const FieldElement& other)
+FieldElement FieldElement::operator+(const FieldElement& other) const
 {
     // ICYW: This is overloading, not overriding lol
-    if (this->prime_ != other.prime_) {
+    if (this->context_ != other.context_) {
         throw std::invalid_argument("prime numbers are different");
     }
-    return FieldElement((this->num_ + other.num_) % this->prime_, this->prime_);
+    return FieldElement::from_reduced(this->context_->add(this->num_, other.num_), this->context_);
 }
 
-FieldElement FieldElement::operator-(const FieldElement& other)
+FieldElement FieldElement::operator-(const FieldElement& other) const
 {
     // ICYW: This is overloading, not overriding lol
-    if (this->prime_ != other.prime_) {
+    if (this->context_ != other.context_) {
         throw std::invalid_argument("prime numbers are different");
     }
-    int512_t result = (this->num_ - other.num_) % this->prime_;
-    if (result < 0) { result += this->prime_; }
-    return FieldElement((int512_t)result, this->prime_);
+    return FieldElement::from_reduced(this->context_->subtract(this->num_, other.num_), this->context_);
 }
 
-FieldElement FieldElement::operator*(const FieldElement& other)
+FieldElement FieldElement::operator*(const FieldElement& other) const
 {
-    if (this->prime_ != other.prime_) {
+    if (this->context_ != other.context_) {
         throw std::invalid_argument("prime numbers are different");
     }
-    return FieldElement((this->num_ * other.num_) % this->prime_, this->prime_);
+    return FieldElement::from_reduced(this->context_->multiply(this->num_, other.num_), this->context_);
 }
 
-FieldElement FieldElement::operator*(const int512_t other)
+FieldElement FieldElement::operator*(const int512_t other) const
 {
     // This implementation is inspired by FieldElementPoint FieldElementPoint::operator*(const int other)
     int512_t coef = other;
-    FieldElement result = FieldElement(0, this->prime());
+    FieldElement result = FieldElement::from_reduced(0, this->context_);
     FieldElement curr = FieldElement(*this);
     while (coef > 0) {
         if (coef & 1) {
@@ -106,46 +195,45 @@ FieldElement FieldElement::operator*(const int512_t other)
     return result;
 }
 
-FieldElement FieldElement::operator/(const FieldElement& other)
+FieldElement FieldElement::operator/(const FieldElement& other) const
 {
-    if (this->prime_ != other.prime_) {
+    if (this->context_ != other.context_) {
         throw std::invalid_argument("prime numbers are different");
     }
-    int512_t tmp = FieldElement(other.num_, other.prime_).power(other.prime_-2).num_;
-    return FieldElement(
-        (this->num_ * tmp) % this->prime_,
-        this->prime_
-    );
+    int512_t tmp = this->context_->power(other.num_, this->context_->prime() - 2);
+    return FieldElement::from_reduced(this->context_->multiply(this->num_, tmp), this->context_);
 }
 
-FieldElement FieldElement::power(int512_t exponent)
+FieldElement FieldElement::power(int512_t exponent) const
 {
     if (exponent >= 0) {
         // exponent == 0 seems still undefined, but Jimmy's book doesn't touch this,
         // so this is not handled at the moment.
-        return FieldElement(powm(this->num_, exponent, this->prime_), this->prime_);
+        return FieldElement::from_reduced(this->context_->power(this->num_, exponent), this->context_);
     } else {
-        return FieldElement(powm(this->num_, this->prime_ - 1 + exponent, this->prime_), this->prime_);
+        return FieldElement::from_reduced(
+            this->context_->power(this->num_, this->context_->prime() - 1 + exponent), this->context_
+        );
     }
 }
 
-string FieldElement::to_string(bool inHex) {
+string FieldElement::to_string(bool inHex) const {
     stringstream ss;
     if (inHex) { ss << std::hex; }
-    ss << this->num_ << " (" << this->prime_ << ")";
+    ss << this->num_ << " (" << this->context_->prime() << ")";
     return ss.str();
 }
 
 
 
 FieldElementPoint::FieldElementPoint(FieldElement x, FieldElement y, FieldElement a, FieldElement b) {
-    if (x.prime() == y.prime() && y.prime() == a.prime() && a.prime() == b.prime()) { /*good*/ }
+    if (x.context() == y.context() && y.context() == a.context() && a.context() == b.context()) { /*good*/ }
     else { throw invalid_argument("prime numbers are different"); }
 
-    this->x_ = FieldElement(x.num(), x.prime());
-    this->y_ = FieldElement(y.num(), y.prime());
-    this->a_ = FieldElement(a.num(), a.prime());
-    this->b_ = FieldElement(b.num(), b.prime());
+    this->x_ = x;
+    this->y_ = y;
+    this->a_ = a;
+    this->b_ = b;
 
     if (this->y_.power(2) != this->x_.power(3) + (this->a_ * this->x_) + this->b_) {    
         throw invalid_argument("Point (" + this->x_.to_string() + ", " + this->y_.to_string() +") not on the curve");
@@ -153,16 +241,14 @@ FieldElementPoint::FieldElementPoint(FieldElement x, FieldElement y, FieldElemen
 }
 
 FieldElementPoint::FieldElementPoint(FieldElement a, FieldElement b) {
-    if (a.prime() == b.prime()) { /*good*/ }
+    if (a.context() == b.context()) { /*good*/ }
     else { throw invalid_argument("prime numbers are different"); }
 
     this->infinity_ = true;
-    this->a_ = FieldElement(a.num(), a.prime());
-    this->b_ = FieldElement(b.num(), b.prime());  
+    this->a_ = a;
+    this->b_ = b;
 }
 
-FieldElementPoint::~FieldElementPoint() {}
-
 bool FieldElementPoint::operator==(const FieldElementPoint& other) const
     {
     // ICYW: This is overloading, not overriding. An interesting point to note is that a,b,x,y are private members
@@ -175,7 +261,7 @@ bool FieldElementPoint::operator==(const FieldElementPoint& other) const
     return this->a_ == other.a_ && this->b_ == other.b_ && xyEqual;
 }
 
-FieldElementPoint FieldElementPoint::operator+(const FieldElementPoint& other)
+FieldElementPoint FieldElementPoint::operator+(const FieldElementPoint& other) const
 {  
     // ICYW: This is overloading, not overriding lol. An interesting point to note is that a,b,x,y are private members
     // of other, but still we can access them.
@@ -191,7 +277,7 @@ FieldElementPoint FieldElementPoint::operator+(const FieldElementPoint& other)
         return FieldElementPoint(this->a_, this->b_);
     }
 
-    if (*this == other && this->y_ == FieldElement(0, this->y_.prime())) {
+    if (*this == other && this->y_.num() == 0) {
         // It means p1 == p2 and tangent is a vertical line. Visualization: ./assets/fig_02-19.png
         return FieldElementPoint(this->a_, this->b_);
     }  
@@ -219,7 +305,7 @@ FieldElementPoint FieldElementPoint::operator+=(const FieldElementPoint& other)
     return *this;
 }
 
-FieldElementPoint FieldElementPoint::operator*(const int512_t other)
+FieldElementPoint FieldElementPoint::operator*(const int512_t other) const
 {
     // The current implementation is called "binary expansion". It reduces the time complexity from O(n) to Olog(n).
     // Essentially, we scan coef bit by bit and add the number to result if a bit is 1.
@@ -248,7 +334,7 @@ FieldElementPoint FieldElementPoint::operator*(const int512_t other)
     return result;
 }
 
-string FieldElementPoint::to_string(bool inHex) {
+string FieldElementPoint::to_string(bool inHex) const {
     stringstream ss;
     if (inHex) { ss << std::hex; }
     if (this->infinity_) {
@@ -260,112 +346,258 @@ string FieldElementPoint::to_string(bool inHex) {
     return ss.str();
 }
 
-bool FieldElementPoint::infinity() {
+bool FieldElementPoint::infinity() const {
     return this->infinity_;
 }
 
-FieldElement FieldElementPoint::x() {
+FieldElement FieldElementPoint::x() const {
     if (this->infinity_) {
         throw invalid_argument("Point is at infinity, does not have x coordinate");
     }
     return this->x_;
 }
 
-FieldElement FieldElementPoint::y() {
+FieldElement FieldElementPoint::y() const {
     if (this->infinity_) {
         throw invalid_argument("Point is at infinity, does not have y coordinate");
     }
     return this->y_;
 }
 
-FieldElement FieldElementPoint::a() {
+FieldElement FieldElementPoint::a() const {
     return this->a_;
 }
 
-FieldElement FieldElementPoint::b() {
+FieldElement FieldElementPoint::b() const {
     return this->b_;
 }
 
 
 
-const int512_t S256Element::s256_prime_ = (int512_t)"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f";
+S256Element S256Element::operator+(const S256Element& other) const {
+    return S256Element(this->fe() + other.fe());
+}
 
-S256Element::S256Element(int512_t num): FieldElement(num, S256Element::s256_prime_) {}
+S256Element S256Element::operator-(const S256Element& other) const {
+    return S256Element(this->fe() - other.fe());
+}
 
-string S256Element::to_string() {
+S256Element S256Element::operator*(const S256Element& other) const {
+    return S256Element(this->fe() * other.fe());
+}
+
+S256Element S256Element::operator/(const S256Element& other) const {
+    return S256Element(this->fe() * other.fe().inverse());
+}
+
+string S256Element::to_string() const {
     return FieldElement::to_string(true);
 }
 
-int512_t S256Element::s256_prime() {
+int512_t S256Element::s256_prime() const {
     return this->s256_prime_;
 }
 
-S256Element S256Element::power(const int512_t exponent) {
-    return S256Element(powm(this->num_, exponent, this->prime_));
+S256Element S256Element::power(const int512_t exponent) const {
+    // Per Fermat's little theorem, num^(p-1) == 1, so the exponent can always be brought to [0, p-1)
+    int512_t e = exponent % (S256Element::s256_prime_ - 1);
+    if (e < 0) { e += S256Element::s256_prime_ - 1; }
+    uint64_t e_limbs[4];
+    for (int i = 0; i < 4; ++i) {
+        e_limbs[i] = (uint64_t)((e >> (64 * i)) & 0xFFFFFFFFFFFFFFFFULL);
+    }
+    if (e == 0 && this->num_ == 0) {
+        // powm() defines 0^0 as 1, let's keep it that way
+        return S256Element(S256Field(1));
+    }
+    return S256Element(this->fe().power(e_limbs));
+}
+
+S256Element S256Element::sqrt() const {
+    return S256Element(this->fe().sqrt());
 }
 
-S256Element S256Element::sqrt() {
-    return this->power((this->prime() + 1) / 4);  
+S256Field S256Element::fe() const {
+    return S256Field(this->num_);
 }
 
 
 
 
-const S256Element S256Point::a_ = S256Element(0);
-const S256Element S256Point::b_ = S256Element(7);
-const int512_t S256Point::order_ = (int512_t)"0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141";
+S256Point::S256Point(S256Element x, S256Element y): FieldElementPoint(S256Point::a_, S256Point::b_) {
+    // Same check as FieldElementPoint's constructor, but on S256Field. a is 0 so the ax term is dropped.
+    S256Field fx = x.fe();
+    S256Field fy = y.fe();
+    if (fy.square() != fx.square() * fx + S256Field(7)) {
+        throw invalid_argument("Point (" + x.to_string() + ", " + y.to_string() +") not on the curve");
+    }
+    this->infinity_ = false;
+    this->x_ = x;
+    this->y_ = y;
+    this->coords_.x = fx;
+    this->coords_.y = fy;
+    this->coords_.infinity = false;
+}
 
-S256Point::S256Point(S256Element x, S256Element y): FieldElementPoint(x, y, S256Point::a_, S256Point::b_) {}
 S256Point::S256Point(): FieldElementPoint(S256Point::a_, S256Point::b_) {}
 
-int512_t S256Point::s256_prime() {
+S256Point::S256Point(const S256AffineCoords& coords): FieldElementPoint(S256Point::a_, S256Point::b_) {
+    if (coords.infinity) { return; }
+    if (coords.y.square() != coords.x.square() * coords.x + S256Field(7)) {
+        throw invalid_argument("Point (" + S256Element(coords.x).to_string() + ", " + S256Element(coords.y).to_string() +
+            ") not on the curve");
+    }
+    this->infinity_ = false;
+    this->x_ = S256Element(coords.x);
+    this->y_ = S256Element(coords.y);
+    this->coords_ = coords;
+}
+
+int512_t S256Point::s256_prime() const {
     assert (this->x_.prime() == this->y_.prime());
     return this->x_.prime();
 }
 
-int512_t S256Point::order() {
+int512_t S256Point::order() const {
     return S256Point::order_;
 }
 
-S256Element S256Point::a() {
+S256Element S256Point::a() const {
     return S256Point::a_;
 }
 
-S256Element S256Point::b() {
+S256Element S256Point::b() const {
     return S256Point::b_;
 }
 
-bool S256Point::verify(int512_t msg_hash, Signature sig) {
+S256Scalar S256Point::get_scalar_from_hash(const int512_t& msg_hash) {
+    // Hashes are 256-bit, so usually this is one conditional subtraction on limbs; anything else goes through
+    // int512_t's `%`.
+    if (msg_hash < 0 || msg_hash >> 256 != 0) {
+        int512_t reduced = msg_hash % S256Scalar::order();
+        if (reduced < 0) { reduced += S256Scalar::order(); }
+        return S256Scalar(reduced);
+    }
+    uint64_t limbs[4];
+    for (int i = 0; i < 4; ++i) {
+        limbs[i] = (uint64_t)((msg_hash >> (64 * i)) & 0xFFFFFFFFFFFFFFFFULL);
+    }
+    return S256Scalar::from_limbs(limbs);
+}
 
-    int512_t sigInv = boost::integer::mod_inverse(sig.s(), this->order());
-    int512_t u = msg_hash * sigInv % this->order();
-    int512_t v = sig.r() * sigInv % this->order();
+bool S256Point::verify(const int512_t& msg_hash, const Signature& sig) const {
+    return S256Point::verify_with_inverse(
+        this->affine_coords(), S256Point::get_scalar_from_hash(msg_hash), sig.r_scalar(), sig.s_scalar().inverse()
+    );
+}
 
-    S256Point total = G * u + *this * v;
-    return total.x().num() == sig.r();
+bool S256Point::verify(const int512_t& msg_hash, const Signature& sig, const S256PointTable& table) const {
+    S256Scalar s_inv = sig.s_scalar().inverse();
+    if (sig.r_scalar().is_zero() || s_inv.is_zero()) {
+        return false;
+    }
+    S256Scalar u = S256Point::get_scalar_from_hash(msg_hash) * s_inv;
+    S256Scalar v = sig.r_scalar() * s_inv;
+    S256JacobianPoint total = s256_multiply_generator(u.limbs()).add(table.multiply(v.limbs()));
+    if (total.infinity()) {
+        return false;
+    }
+    return total.has_affine_x(S256Field::from_limbs(sig.r_scalar().limbs()));
 }
 
-S256Point S256Point::operator*(const int512_t other) {
-    FieldElementPoint temp = FieldElementPoint::operator*(other);
-    if (temp.infinity()) {
-        return S256Point();
+bool S256Point::verify_with_inverse(const S256AffineCoords& pubkey, const S256Scalar& msg_hash, const S256Scalar& r,
+    const S256Scalar& s_inv) {
+    // s_inv is zero if and only if s is
+    if (r.is_zero() || s_inv.is_zero()) {
+        return false;
     }
-    else {
-        return S256Point(S256Element(temp.x().num()), S256Element(temp.y().num()));
+    S256Scalar u = msg_hash * s_inv;
+    S256Scalar v = r * s_inv;
+    // G * u + this * v in one pass, which stays in Jacobian coordinates so that only one inversion is needed.
+#ifdef USE_GLV_ENDOMORPHISM
+    S256JacobianPoint total = s256_multiply_joint_glv(u.limbs(), pubkey, v.limbs());
+#else
+    S256JacobianPoint total = s256_multiply_joint(u.limbs(), pubkey, v.limbs());
+#endif
+    if (total.infinity()) {
+        return false;
     }
-} 
+    // Compare x coordinates projectively, which saves the inversion that converting total to affine would take.
+    // r < n < p, so it is a valid S256Field as it is.
+    return total.has_affine_x(S256Field::from_limbs(r.limbs()));
+}
+
+void S256Point::verify_batch(const S256Point* pubkeys, const int512_t* msg_hashes, const Signature* sigs,
+    const size_t count, bool* results, unsigned int threads) {
+    // Each worker verifies one contiguous chunk on its own, so they share nothing but the read-only tables of G.
+    run_in_chunks(count, threads, [&](const size_t begin, const size_t end) {
+        // Invert all s with a single modular inversion. An s ≡ 0 stays 0 and fails the verification, the same as in
+        // verify().
+        vector<S256Scalar> s_inv(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            s_inv[i - begin] = sigs[i].s_scalar();
+        }
+        S256Scalar::batch_inverse(s_inv.data(), s_inv.size());
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = S256Point::verify_with_inverse(pubkeys[i].affine_coords(),
+                S256Point::get_scalar_from_hash(msg_hashes[i]), sigs[i].r_scalar(), s_inv[i - begin]);
+        }
+    });
+}
+
+S256AffineCoords S256Point::affine_coords() const {
+    return this->coords_;
+}
 
-S256Point S256Point::operator+(const S256Point other) {
-    FieldElementPoint temp = (FieldElementPoint)(*this) + (FieldElementPoint)(other);
-    if (temp.infinity()) {
+S256Point S256Point::from_jacobian(const S256JacobianPoint& p) {
+    S256AffineCoords coords = p.to_affine();
+    if (coords.infinity) {
         return S256Point();
     }
-    else {
-        return S256Point(S256Element(temp.x().num()), S256Element(temp.y().num()));
+    return S256Point(coords.x, coords.y);
+}
+
+void S256Point::get_scalar_limbs(const int512_t coef, uint64_t limbs[4]) {
+    // Every point on secp256k1 has order n (the cofactor is 1), so the scalar can be reduced modulo n first.
+    int512_t scalar = coef % S256Point::order_;
+    if (scalar < 0) { scalar += S256Point::order_; }
+    for (int i = 0; i < 4; ++i) {
+        limbs[i] = (uint64_t)((scalar >> (64 * i)) & 0xFFFFFFFFFFFFFFFFULL);
+    }
+}
+
+S256Point S256Point::operator*(const int512_t other) const {
+    uint64_t scalar[4];
+    S256Point::get_scalar_limbs(other, scalar);
+    S256AffineCoords coords = this->affine_coords();
+    const S256AffineCoords& generator = s256_generator();
+    if (!coords.infinity && coords.x == generator.x && coords.y == generator.y) {
+        // G * k is what key generation and signing do, it has a precomputed table.
+        return S256Point::from_jacobian(s256_multiply_generator(scalar));
     }
+#ifdef USE_GLV_ENDOMORPHISM
+    return S256Point::from_jacobian(s256_multiply_glv(coords, scalar));
+#else
+    return S256Point::from_jacobian(s256_multiply(coords, scalar));
+#endif
 }
 
-string S256Point::to_string() {
+S256Point S256Point::multiply_fixed(const int512_t coef) const {
+    uint64_t scalar[4];
+    S256Point::get_scalar_limbs(coef, scalar);
+    S256AffineCoords coords = this->affine_coords();
+    const S256AffineCoords& generator = s256_generator();
+    if (!coords.infinity && coords.x == generator.x && coords.y == generator.y) {
+        return S256Point::from_jacobian(s256_multiply_generator_fixed(scalar));
+    }
+    return S256Point::from_jacobian(s256_multiply_fixed(coords, scalar));
+}
+
+S256Point S256Point::operator+(const S256Point& other) const {
+    return S256Point::from_jacobian(S256JacobianPoint(this->affine_coords()).add_affine(other.affine_coords()));
+}
+
+string S256Point::to_string() const {
     stringstream ss;
     ss << std::hex;
     if (this->infinity_) {
@@ -379,64 +611,287 @@ string S256Point::to_string() {
     return ss.str();
 }
 
-uint8_t* S256Point::get_sec_format(const bool compressed = true) {
-    // we can't use sizeof(int256_t) instead of KEY_SIZE = 32--sizeof(int256_t) is 48, not 32
-    const int KEY_SIZE = 32;
-    uint8_t* sec_bytes;
-    assert (this->x().num() <= (int512_t)"0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
-    assert (this->y().num() <= (int512_t)"0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
-    
-    uint8_t x_[KEY_SIZE];
-    uint8_t y_[KEY_SIZE];
+uint8_t* S256Point::get_sec_format(const bool compressed = true) const {
+    uint8_t* sec_bytes = (uint8_t*)calloc(compressed ? SEC_COMPRESSED_LEN : SEC_UNCOMPRESSED_LEN, 1);
+    this->get_sec_format(compressed, sec_bytes);
+    return sec_bytes;
+}
 
-    get_bytes_from_int256((int256_t)this->x().num(), true, x_);
-    get_bytes_from_int256((int256_t)this->y().num(), true, y_);
+size_t S256Point::get_sec_format(const bool compressed, uint8_t* output) const {
+    const size_t KEY_SIZE = 32;
+    // S256Field writes the big-endian bytes directly, without going through int256_t
+    this->coords_.x.get_bytes(output + 1);
+    if (compressed) {
+        output[0] = this->coords_.y.is_odd() ? 0x03 : 0x02;
+        return SEC_COMPRESSED_LEN;
+    }
+    output[0] = 0x04;
+    this->coords_.y.get_bytes(output + 1 + KEY_SIZE);
+    return SEC_UNCOMPRESSED_LEN;
+}
 
-    if (compressed == false) {
-        sec_bytes = (uint8_t*)calloc(1 + KEY_SIZE * 2, 1);
-        sec_bytes[0] = 0x04;
+void S256Point::get_sec_format_batch(const S256Point* points, const size_t count, const bool compressed,
+    uint8_t* output) {
+    const size_t sec_len = compressed ? SEC_COMPRESSED_LEN : SEC_UNCOMPRESSED_LEN;
+    for (size_t i = 0; i < count; ++i) {
+        points[i].get_sec_format(compressed, output + i * sec_len);
+    }
+}
 
-        memcpy(sec_bytes + 1, x_, KEY_SIZE);
-        memcpy(sec_bytes + 1 + KEY_SIZE, y_, KEY_SIZE);
+/**
+ * @brief The part of S256Point::parse_sec() that works on S256Field, without throwing
+ * @returns false if sec is not a valid SEC key
+ */
+static bool parse_sec_coords(const uint8_t* sec, const size_t sec_len, S256Field& x, S256Field& y) {
+    const size_t KEY_SIZE = 32;
+    if (sec_len == 1 + KEY_SIZE * 2 && sec[0] == 0x04) {
+        x = S256Field::from_bytes(sec + 1);
+        y = S256Field::from_bytes(sec + 1 + KEY_SIZE);
+    } else if (sec_len == 1 + KEY_SIZE && (sec[0] == 0x02 || sec[0] == 0x03)) {
+        x = S256Field::from_bytes(sec + 1);
+        // y^2 = x^3 + 7 has two roots, y and p - y, one even and one odd
+        y = (x.square() * x + S256Field(7)).sqrt();
+        if (y.is_odd() != (sec[0] == 0x03)) { y = y.negate(); }
     } else {
-        sec_bytes = (uint8_t*)calloc(1 + KEY_SIZE, 1);
-        sec_bytes[0] = this->y().num() % 2 == 0 ? 0x02 : 0x03;    
-        memcpy(sec_bytes + 1, x_, KEY_SIZE);
+        return false;
     }
-    return sec_bytes;
+    // from_bytes() reduces x and y modulo p, so the bytes are compared back to reject non-canonical encodings
+    uint8_t bytes[KEY_SIZE];
+    x.get_bytes(bytes);
+    if (memcmp(bytes, sec + 1, KEY_SIZE) != 0) { return false; }
+    if (sec[0] == 0x04) {
+        y.get_bytes(bytes);
+        if (memcmp(bytes, sec + 1 + KEY_SIZE, KEY_SIZE) != 0) { return false; }
+    }
+    // For a compressed key, this also catches an x whose x^3 + 7 has no square root
+    return y.square() == x.square() * x + S256Field(7);
+}
+
+S256Point S256Point::parse_sec(const uint8_t* sec, const size_t sec_len) {
+    S256Field x, y;
+    if (!parse_sec_coords(sec, sec_len, x, y)) {
+        throw invalid_argument("sec is not a valid SEC public key");
+    }
+    return S256Point(x, y);
+}
+
+bool S256Point::parse_sec(const uint8_t* sec, const size_t sec_len, S256AffineCoords& coords) {
+    S256Field x, y;
+    if (!parse_sec_coords(sec, sec_len, x, y)) { return false; }
+    coords.x = x;
+    coords.y = y;
+    coords.infinity = false;
+    return true;
 }
 
-char* S256Point::get_address(bool compressed, bool testnet) {
-    const size_t sec_len = compressed ? (1 + 32) : (1 + 32 * 2);
-    uint8_t* sec_bytes = this->get_sec_format(compressed);
+void S256Point::parse_sec_batch(const uint8_t* secs, const size_t sec_len, const size_t count, S256Point* points,
+    bool* results, unsigned int threads) {
+    run_in_chunks(count, threads, [&](const size_t begin, const size_t end) {
+        S256Field x, y;
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = parse_sec_coords(secs + i * sec_len, sec_len, x, y);
+            if (results[i]) { points[i] = S256Point(x, y); }
+        }
+    });
+}
+
+char* S256Point::get_address(bool compressed, bool testnet) const {
+    char* address = (char*)malloc(ADDRESS_MAX_LEN + 1);
+    this->get_address(compressed, testnet, address);
+    return address;
+}
+
+size_t S256Point::get_address(const bool compressed, const bool testnet, char* output) const {
+    uint8_t sec_bytes[SEC_UNCOMPRESSED_LEN];
+    const size_t sec_len = this->get_sec_format(compressed, sec_bytes);
     uint8_t hash[RIPEMD160_HASH_SIZE+1];
     hash160(sec_bytes, sec_len, hash+1);
-    free(sec_bytes);
     hash[0] = testnet ? 0x6f : 0x00;
-    return encode_base58_checksum(hash, RIPEMD160_HASH_SIZE+1);
+    return encode_base58_checksum(hash, RIPEMD160_HASH_SIZE+1, output);
+}
+
+void S256Point::get_address_batch(const S256Point* points, const size_t count, const bool compressed,
+    const bool testnet, char* output) {
+    for (size_t i = 0; i < count; ++i) {
+        points[i].get_address(compressed, testnet, output + i * (ADDRESS_MAX_LEN + 1));
+    }
+}
+
+
+Signature::Signature(int512_t r, int512_t s): r_(S256Scalar(r)), s_(S256Scalar(s)) {}
+
+Signature::Signature() {}
+
+Signature::Signature(const S256Scalar& r, const S256Scalar& s): r_(r), s_(s) {}
+
+/**
+ * @brief Convert a big-endian unsigned integer of any length to a scalar
+ * @param overflow set to true if the integer is not smaller than n, it is left unchanged otherwise
+ */
+static S256Scalar get_scalar_from_der_integer(const uint8_t* bytes, size_t len, bool& overflow) {
+    const size_t INT256_SIZE = 32;
+    while (len > 0 && bytes[0] == 0x00) {
+        ++bytes;
+        --len;
+    }
+    if (len > INT256_SIZE) {
+        overflow = true;
+        return S256Scalar();
+    }
+    uint8_t padded[INT256_SIZE] = {0};
+    memcpy(padded + INT256_SIZE - len, bytes, len);
+    bool reduced = false;
+    S256Scalar result = S256Scalar::from_bytes(padded, &reduced);
+    overflow |= reduced;
+    return result;
 }
 
+/**
+ * @brief BIP66's IsValidSignatureEncoding(), minus the sighash type byte
+ * @param r_pos set to where r's bytes start, r is r_len bytes long. The same for s.
+ */
+static bool parse_der_strict(const uint8_t* der, const size_t der_len, size_t& r_pos, size_t& r_len, size_t& s_pos,
+    size_t& s_len) {
+    // 0x30 [total length] 0x02 [r length] [r] 0x02 [s length] [s], with r and s at least a byte each and at most
+    // 33 bytes (a 0x00 in front of a 32-byte number)
+    if (der_len < 8 || der_len > 72) { return false; }
+    if (der[0] != 0x30 || der[1] != der_len - 2) { return false; }
+    r_len = der[3];
+    if (der[2] != 0x02 || r_len == 0 || 5 + r_len >= der_len) { return false; }
+    s_len = der[5 + r_len];
+    if (der[4 + r_len] != 0x02 || s_len == 0 || r_len + s_len + 6 != der_len) { return false; }
+    r_pos = 4;
+    s_pos = 6 + r_len;
+    for (size_t pos : {r_pos, s_pos}) {
+        size_t len = pos == r_pos ? r_len : s_len;
+        // Negative numbers aren't allowed, and a 0x00 in front is only allowed if the next byte would make the number
+        // negative without it
+        if (der[pos] & 0x80) { return false; }
+        if (len > 1 && der[pos] == 0x00 && !(der[pos + 1] & 0x80)) { return false; }
+    }
+    return true;
+}
 
-Signature::Signature(int512_t r, int512_t s) {
-    this->r_ = r;
-    this->s_ = s;
+/**
+ * @brief Bitcoin Core's ecdsa_signature_parse_der_lax(), which accepts what OpenSSL's DER parser did
+ */
+static bool parse_der_lax(const uint8_t* der, const size_t der_len, size_t& r_pos, size_t& r_len, size_t& s_pos,
+    size_t& s_len) {
+    size_t pos = 0;
+    // The sequence: its length is read (in short or long form) but not checked against anything
+    if (pos == der_len || der[pos] != 0x30) { return false; }
+    ++pos;
+    if (pos == der_len) { return false; }
+    size_t len_byte = der[pos++];
+    if (len_byte & 0x80) {
+        len_byte -= 0x80;
+        if (len_byte > der_len - pos) { return false; }
+        pos += len_byte;
+    }
+    for (int i = 0; i < 2; ++i) {
+        size_t& int_pos = i == 0 ? r_pos : s_pos;
+        size_t& int_len = i == 0 ? r_len : s_len;
+        if (pos == der_len || der[pos] != 0x02) { return false; }
+        ++pos;
+        if (pos == der_len) { return false; }
+        len_byte = der[pos++];
+        if (len_byte & 0x80) {
+            // Long form, with any number of leading zeros, but the length itself has to fit in three bytes
+            len_byte -= 0x80;
+            if (len_byte > der_len - pos) { return false; }
+            while (len_byte > 0 && der[pos] == 0x00) {
+                ++pos;
+                --len_byte;
+            }
+            if (len_byte >= 4) { return false; }
+            int_len = 0;
+            while (len_byte > 0) {
+                int_len = (int_len << 8) + der[pos++];
+                --len_byte;
+            }
+        } else {
+            int_len = len_byte;
+        }
+        if (int_len > der_len - pos) { return false; }
+        int_pos = pos;
+        pos += int_len;
+    }
+    // Whatever follows s is ignored
+    return true;
 }
 
-string Signature::to_string() {
+bool Signature::parse_der(const uint8_t* der, const size_t der_len, Signature& sig, const bool strict) {
+    size_t r_pos, r_len, s_pos, s_len;
+    if (strict ? !parse_der_strict(der, der_len, r_pos, r_len, s_pos, s_len) :
+                 !parse_der_lax(der, der_len, r_pos, r_len, s_pos, s_len)) {
+        return false;
+    }
+    bool overflow = false;
+    sig.r_ = get_scalar_from_der_integer(der + r_pos, r_len, overflow);
+    sig.s_ = get_scalar_from_der_integer(der + s_pos, s_len, overflow);
+    if (overflow) {
+        sig.r_ = S256Scalar();
+        sig.s_ = S256Scalar();
+    }
+    return true;
+}
+
+bool Signature::has_low_s() const {
+    return !this->s_.is_high();
+}
+
+string Signature::to_string() const {
     stringstream ss;
-    ss << hex << "Signature(" << this->r_ << ", " << this->s_ << ")";
+    ss << hex << "Signature(" << this->r_.num() << ", " << this->s_.num() << ")";
     return ss.str();
 }
 
-int512_t Signature::r() {
+int512_t Signature::r() const {
+    return this->r_.num();
+}
+
+int512_t Signature::s() const {
+    return this->s_.num();
+}
+
+const S256Scalar& Signature::r_scalar() const {
     return this->r_;
 }
 
-int512_t Signature::s() {
+const S256Scalar& Signature::s_scalar() const {
     return this->s_;
 }
 
-uint8_t* Signature::get_der_format(size_t* output_len) {
+uint8_t* Signature::get_der_format(size_t* output_len) const {
+    uint8_t der[DER_MAX_LEN];
+    *output_len = this->get_der_format(der);
+    uint8_t* results = (uint8_t*)malloc(*output_len);
+    memcpy(results, der, *output_len);
+    return results;
+}
+
+/**
+ * @brief Write a scalar as a DER integer: the 0x02 marker, its length and its big-endian bytes with leading zeros
+ * stripped, plus a 0x00 in front if the first byte would otherwise make it negative
+ * @returns the number of bytes written
+ */
+static size_t get_der_integer(const S256Scalar& num, uint8_t* output) {
+    const size_t INT256_SIZE = 32;
+    // bytes[0] is for the possible 0x00 prepending
+    uint8_t bytes[INT256_SIZE + 1] = {0};
+    num.get_bytes(bytes + 1);
+    size_t pos = 1;
+    // Zero is encoded as a single 0x00
+    while (pos < INT256_SIZE && bytes[pos] == 0x00) { pos++; }
+    if (bytes[pos] >> 7 == 1) { --pos; }
+    const size_t len = INT256_SIZE + 1 - pos;
+    output[0] = 0x02;
+    output[1] = len;
+    memcpy(output + 2, bytes + pos, len);
+    return 2 + len;
+}
+
+size_t Signature::get_der_format(uint8_t* output) const {
     /*
     * DER format explained:
     * [30][45][02][20][37206a0610995c58074999cb9767b87af4c4978db68c06e8e6e81d282047a7c6][02][21][008ca63759c1157ebeaec0d03cecca119fc9a75bf8e6d0fa65c841c8e2738cdaec]
@@ -449,62 +904,35 @@ uint8_t* Signature::get_der_format(size_t* output_len) {
     * [21]       - s value length
     * [00....ec] - s value
     */
+    size_t len = 2;
+    len += get_der_integer(this->r_, output + len);
+    len += get_der_integer(this->s_, output + len);
+    output[0] = 0x30;
+    output[1] = len - 2; // output[0] and output[1] are not considered a part of the "results"..
+    return len;
+}
 
-    const size_t INT256_SIZE = 32;
-
-    size_t r_pos = 1;
-    size_t s_pos = 1;
-    uint8_t* r_bytes = (uint8_t*)calloc(INT256_SIZE + 1, sizeof(uint8_t));
-    uint8_t* s_bytes = (uint8_t*)calloc(INT256_SIZE + 1, sizeof(uint8_t));
-    // the extra 1 byte is reserved for the possible prepending of 0x00
-
-    get_bytes_from_int256((int256_t)this->r(), true, r_bytes + 1);
-    get_bytes_from_int256((int256_t)this->s(), true, s_bytes + 1);
-    // r_bytes[0]/s_bytes[0] is for the possible 0x00 prepending
-    while (r_bytes[r_pos] == 0x00) { r_pos ++; }
-    while (s_bytes[s_pos] == 0x00) { s_pos ++; }
-
-    if (r_bytes[r_pos] >> 7 == 1) { r_bytes[--r_pos] = 0x00; }
-    if (s_bytes[s_pos] >> 7 == 1) { s_bytes[--s_pos] = 0x00; }
-    size_t r_bytes_stripped_len = INT256_SIZE + 1 - r_pos;
-    size_t s_bytes_stripped_len = INT256_SIZE + 1 - s_pos;
-    
-    uint8_t* r_bytes_stripped = (uint8_t*)calloc(r_bytes_stripped_len, sizeof(uint8_t));
-    uint8_t* s_bytes_stripped = (uint8_t*)calloc(s_bytes_stripped_len, sizeof(uint8_t));
-    memcpy(r_bytes_stripped, r_bytes + r_pos, r_bytes_stripped_len);
-    memcpy(s_bytes_stripped, s_bytes + s_pos, s_bytes_stripped_len);
-
-    size_t results_len = 2 + 2 + r_bytes_stripped_len + 2 + s_bytes_stripped_len;
-    uint8_t* results = (uint8_t*)calloc(results_len, sizeof(uint8_t));
-
-    results[0] = 0x30;
-    results[1] = results_len - 2; // results[0] and results[1] are not considered a part of the "results"..
-
-    results[2] = 0x02;
-    results[3] = r_bytes_stripped_len;
-    // Here we don't - 2 as results[1], because r_bytes_stripped_len is defined as the length of the r_bytes only
-    memcpy(results + 4, r_bytes_stripped, r_bytes_stripped_len);
-    
-    results[4 + r_bytes_stripped_len] = 0x02;
-    results[5 + r_bytes_stripped_len] = s_bytes_stripped_len;
-    memcpy(results + 2 + 2 + r_bytes_stripped_len + 2, s_bytes_stripped, s_bytes_stripped_len);
-    
-    free(r_bytes);
-    free(r_bytes_stripped);
-    free(s_bytes);
-    free(s_bytes_stripped);
-    *output_len = results_len;
-
-    return results;
+size_t Signature::get_der_format_batch(const Signature* sigs, const size_t count, uint8_t* output, size_t* lengths) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        lengths[i] = sigs[i].get_der_format(output + total);
+        total += lengths[i];
+    }
+    return total;
 }
 
 
 
-S256Point G = S256Point(
-    S256Element((int512_t)"0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"),
-    S256Element((int512_t)"0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8")
+// (0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798,
+//  0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8), evaluated by the compiler, so G is in the
+// binary's data and ready before any code runs. Its curve check is in the tests instead.
+constexpr S256Point S256Point::generator_ = S256Point(
+    S256Field(0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL, 0x79BE667EF9DCBBACULL),
+    S256Field(0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL)
 );
 
+const S256Point G = S256Point::generator();
+
 ECDSAKey::ECDSAKey(const uint8_t* private_key_bytes, const size_t private_key_length, bool reverse_byte_order) {
     assert (private_key_length <= SHA256_HASH_SIZE);
     memset(this->privkey_bytes_, 0, SHA256_HASH_SIZE);
@@ -512,13 +940,22 @@ ECDSAKey::ECDSAKey(const uint8_t* private_key_bytes, const size_t private_key_le
     // Note the below lines are the same as ECDSAKey::ECDSAKey(const int512_t private_key);
     // But in C++ we cant call another constructor within a constructor easily.
     this->privkey_int_ = get_int512_from_bytes(this->privkey_bytes_, SHA256_HASH_SIZE, !reverse_byte_order);
-    this->public_key_ = G * privkey_int_;  
+    this->public_key_ = G.multiply_fixed(privkey_int_);  
+    this->privkey_ = S256Scalar((int512_t)(this->privkey_int_ % S256Scalar::order()));
+    // RFC 6979 hashes int2octets(x), the big-endian bytes of the reduced key, whatever order the key was given in
+    uint8_t privkey_octets[SHA256_HASH_SIZE];
+    this->privkey_.get_bytes(privkey_octets);
+    this->rfc6979_ = RFC6979Generator(privkey_octets);
 }
 
 ECDSAKey::ECDSAKey(const int512_t private_key) {
     this->privkey_int_ = private_key;
     get_bytes_from_int256((int256_t)private_key, true, this->privkey_bytes_);
-    this->public_key_ = G * privkey_int_;
+    this->public_key_ = G.multiply_fixed(privkey_int_);
+    this->privkey_ = S256Scalar((int512_t)(this->privkey_int_ % S256Scalar::order()));
+    uint8_t privkey_octets[SHA256_HASH_SIZE];
+    this->privkey_.get_bytes(privkey_octets);
+    this->rfc6979_ = RFC6979Generator(privkey_octets);
 }
 
 ECDSAKey::~ECDSAKey() {
@@ -527,78 +964,70 @@ ECDSAKey::~ECDSAKey() {
     }*/
 }
 
-string ECDSAKey::to_string() {
+string ECDSAKey::to_string() const {
     stringstream ss;
     ss << hex << this->privkey_int_ << endl;
     return ss.str();
 }
 
-Signature ECDSAKey::sign(uint8_t* msgHashBytes, size_t msgHashLen) {
-    int512_t k = this->get_deterministic_k(msgHashBytes, msgHashLen);
-    int512_t r = (G * k).x().num();
-    int512_t kInv = boost::integer::mod_inverse(k, G.order());
-    int512_t sig = (int512_t)((int1024_t)(get_int512_from_bytes(msgHashBytes, msgHashLen) + this->privkey_int_ * r) * kInv % G.order());
-    // (msg_hash + this->privkey_int_ * r) * kInv may exceed the size of int512_t!
-    if (sig > G.order() / 2) {
-        sig = G.order() - sig;
+Signature ECDSAKey::sign(const uint8_t* msgHashBytes, size_t msgHashLen, const uint8_t* extra_entropy,
+    const size_t extra_entropy_len) const {
+    assert (msgHashLen == SHA256_HASH_SIZE);
+    S256Scalar k = this->rfc6979_.generate(msgHashBytes, extra_entropy, extra_entropy_len);
+    // r is R's x reduced modulo n, which only makes a difference for the few x in [n, p)
+    S256Scalar r = S256Scalar::from_limbs(s256_multiply_generator_fixed(k.limbs()).to_affine().x.limbs());
+    // s = (msg_hash + privkey * r) / k (mod n) on fixed-width limbs, see scalar.h
+    S256Scalar z = S256Scalar::from_bytes(msgHashBytes);
+    S256Scalar s = (z + this->privkey_ * r) * k.inverse();
+    if (s.is_high()) {
+        s = s.negate();
     }
-    return Signature(r, sig);
+    return Signature(r, s);
 }
 
-int512_t ECDSAKey::get_deterministic_k(uint8_t* msgHashBytes, size_t msgHashLen) {
-    assert (msgHashLen == SHA256_HASH_SIZE);
-    uint8_t kBytes[] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-    uint8_t vBytes[] = {
-        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01
-    };
-    assert (sizeof(vBytes) == SHA256_HASH_SIZE && sizeof(kBytes) == SHA256_HASH_SIZE);
-    int512_t msgHashInt = get_int512_from_bytes(msgHashBytes, SHA256_HASH_SIZE);
-    if (msgHashInt > G.order()) {
-        msgHashInt -= G.order();
-    }
-
-    unsigned short int dataLen = (SHA256_HASH_SIZE + 1 + SHA256_HASH_SIZE + SHA256_HASH_SIZE) * sizeof(uint8_t);
-    uint8_t* data = (uint8_t*)malloc(dataLen * sizeof(uint8_t));
-    memcpy(data, vBytes, SHA256_HASH_SIZE);
-    data[SHA256_HASH_SIZE] = 0x00;
-    memcpy(data + SHA256_HASH_SIZE + 1, this->privkey_bytes_, SHA256_HASH_SIZE);
-    memcpy(data + SHA256_HASH_SIZE + 1 + SHA256_HASH_SIZE, msgHashBytes, SHA256_HASH_SIZE);
-
-    hmac_sha256(kBytes, SHA256_HASH_SIZE, data, dataLen, kBytes);
-    hmac_sha256(kBytes, SHA256_HASH_SIZE, vBytes, SHA256_HASH_SIZE, vBytes);
-
-    memcpy(data, vBytes, SHA256_HASH_SIZE);
-    data[SHA256_HASH_SIZE] = 0x01;
-    memcpy(data + SHA256_HASH_SIZE + 1, this->privkey_bytes_, SHA256_HASH_SIZE);
-    memcpy(data + SHA256_HASH_SIZE + 1 + SHA256_HASH_SIZE, msgHashBytes, SHA256_HASH_SIZE);
-    
-    hmac_sha256(kBytes, SHA256_HASH_SIZE, data, dataLen, kBytes);  
-    hmac_sha256(kBytes, SHA256_HASH_SIZE, vBytes, SHA256_HASH_SIZE, vBytes);
-    while (true) {
-        hmac_sha256(kBytes, SHA256_HASH_SIZE, vBytes, SHA256_HASH_SIZE, vBytes);
-        int512_t candidate = get_int512_from_bytes(vBytes, SHA256_HASH_SIZE);
-        if (candidate >= 1 && candidate < G.order()) {
-        free(data);
-        return candidate;
+// The number of jobs a sign_batch() worker takes at a time. Signing takes tens of microseconds, so the shared
+// counter is touched rarely enough even at 1, but a few at a time keeps a worker on the same cache lines.
+static const size_t SIGNING_JOBS_PER_TAKE = 4;
+
+void ECDSAKey::sign_batch(const ECDSASigningJob* jobs, const size_t count, uint8_t* ders, size_t* lengths,
+    unsigned int threads) {
+    if (threads == 0) {
+        threads = max(thread::hardware_concurrency(), 1u);
+    }
+    threads = (unsigned int)min((size_t)threads, (count + SIGNING_JOBS_PER_TAKE - 1) / SIGNING_JOBS_PER_TAKE);
+    atomic<size_t> next_job(0);
+    auto sign_jobs = [&]() {
+        while (true) {
+            const size_t begin = next_job.fetch_add(SIGNING_JOBS_PER_TAKE, memory_order_relaxed);
+            if (begin >= count) { return; }
+            const size_t end = min(begin + SIGNING_JOBS_PER_TAKE, count);
+            for (size_t i = begin; i < end; ++i) {
+                Signature sig = jobs[i].key->sign(jobs[i].msg_hash, SHA256_HASH_SIZE);
+                lengths[i] = sig.get_der_format(ders + i * Signature::DER_MAX_LEN);
+            }
         }
-        cout << "\n\n\n=====WARNING=====\nThis is a route that seldom tested, result may well be wrong!!\n\n\n" << endl;
-        memcpy(data, vBytes, SHA256_HASH_SIZE);
-        data[SHA256_HASH_SIZE] = 0x00;
-        hmac_sha256(kBytes, SHA256_HASH_SIZE, data, SHA256_HASH_SIZE + 1, kBytes);
-        // Here we only pass a part of data to the function!
-        hmac_sha256(kBytes, SHA256_HASH_SIZE, vBytes, SHA256_HASH_SIZE, vBytes);
+    };
+    vector<thread> workers;
+    for (unsigned int i = 1; i < threads; ++i) {
+        workers.emplace_back(sign_jobs);
+    }
+    sign_jobs();
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
     }
 }
 
-S256Point ECDSAKey::public_key() {
+int512_t ECDSAKey::get_deterministic_k(const uint8_t* msgHashBytes, size_t msgHashLen, const uint8_t* extra_entropy,
+    const size_t extra_entropy_len) const {
+    assert (msgHashLen == SHA256_HASH_SIZE);
+    return this->rfc6979_.generate(msgHashBytes, extra_entropy, extra_entropy_len).num();
+}
+
+S256Point ECDSAKey::public_key() const {
   return this->public_key_;
 }
 
-char* ECDSAKey::get_wif_private_key(bool compressed, bool testnet) {
+char* ECDSAKey::get_wif_private_key(bool compressed, bool testnet) const {
     const size_t input_len = (compressed ? 34 : 33);
     uint8_t input[34] = {0};
     input[0] = (testnet ? 0xef : 0x80);
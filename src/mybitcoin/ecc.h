@@ -1,14 +1,76 @@
 #ifndef ECC_H
 #define ECC_H
 
+#include <stdexcept>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <mycrypto/sha256.h>
 #include <mycrypto/hmac.h>
 #include <mycrypto/misc.h>
 
+#include "group.h"
+#include "rfc6979.h"
+#include "scalar.h"
+
 using namespace std;
 using namespace boost::multiprecision;
 
+/**
+ * @brief Everything about a finite field that only depends on its prime: the validated prime itself and constants
+ * that speed up reductions modulo it.
+ * Validating a prime takes a Fermat primality test (128 modular exponentiations), so contexts are created once per
+ * prime by get() and live for the rest of the program, and FieldElements only keep a pointer to theirs.
+ */
+class FieldContext {
+protected:
+  int512_t prime_;
+  // Primes shorter than 64 bits (e.g., those of the small curves in Jimmy's book) are reduced with native 128-bit
+  // arithmetic and Barrett's method instead of int512_t's division: with k = bit length of the prime,
+  // x mod prime = x - q * prime, where q = ((x >> (k - 1)) * barrett_mu_) >> (k + 1) is off by at most 2.
+  bool small_ = false;
+  uint64_t small_prime_ = 0;
+  uint64_t barrett_mu_ = 0;
+  int bits_ = 0;
+  // The context of secp256k1's prime. It is constant-initialized, so it is there before any dynamic initialization,
+  // including that of other translation units' static S256Elements.
+  static const FieldContext s256_;
+  FieldContext(const int512_t& prime);
+  /**
+   * @brief Initialize the context of secp256k1's prime, which is known to be a prime and not small, so unlike the
+   * constructor above it needs no check and can be evaluated at compile time
+   */
+  constexpr FieldContext() : prime_(S256Field::PRIME) {}
+  uint64_t small_multiply(const uint64_t a, const uint64_t b) const;
+public:
+  /**
+   * @brief Get the context of a prime, creating and validating it on the first call for that prime. Thread-safe.
+   * @throw invalid_argument if prime is longer than 256 bits or is not a prime number
+   */
+  static const FieldContext* get(const int512_t& prime);
+  /**
+   * @brief Get the context of secp256k1's prime, the same as get(S256Field::PRIME) but without the look-up
+   */
+  static constexpr const FieldContext* s256() { return &FieldContext::s256_; }
+  constexpr const int512_t& prime() const { return this->prime_; }
+  /**
+   * @brief Get (a + b) % prime, where a and b are in [0, prime)
+   */
+  int512_t add(const int512_t& a, const int512_t& b) const;
+  /**
+   * @brief Get (a - b) % prime, where a and b are in [0, prime)
+   */
+  int512_t subtract(const int512_t& a, const int512_t& b) const;
+  /**
+   * @brief Get (a * b) % prime, where a and b are in [0, prime)
+   */
+  int512_t multiply(const int512_t& a, const int512_t& b) const;
+  /**
+   * @brief Get (base ^ exponent) % prime, where base is in [0, prime) and exponent is non-negative
+   */
+  int512_t power(const int512_t& base, const int512_t& exponent) const;
+};
+
+inline constexpr FieldContext FieldContext::s256_ = FieldContext();
+
 // Represent an integer in a finite field. Given the application of the field in this context, it is defined by:
 // ** a prime number as order (i.e., size) of the field
 // ** a non-negative integer an element of the field. The integer has to be smaller than order of the field.
@@ -20,14 +82,34 @@ protected:
   // We make the initial value valid so that we can have an empty default constructor.
   // Note that in Python we prepend underscores, in C++ it is recommended to append underscores as variables
   // start with an underscore or double underscore are reserved for the C++ implementers
-  int512_t num_ = 0, prime_ = 2;
+  int512_t num_ = 0;
+  // The field's prime and its precomputed constants. Contexts are unique per prime, so two elements are in the same
+  // field if and only if their context_ pointers are equal.
+  const FieldContext* context_ = FieldElement::default_context();
+  static const FieldContext* default_context();
+  /**
+   * @brief Initialize an element from a num that is already known to be in [0, prime), e.g., the result of an
+   * arithmetic operation, so that no check is needed.
+   */
+  static FieldElement from_reduced(const int512_t& num, const FieldContext* context);
 public:
   /**
    * @brief Initialize an element of a finite field
    * @param num the number of such element
-   * @param prime the order of the finite field
+   * @param prime the order of the finite field. Its context is looked up (or created on the first use of this
+   * prime) with FieldContext::get().
    */
   FieldElement(int512_t num, int512_t prime);
+  /**
+   * @brief Initialize an element of a finite field whose context is already at hand, which saves the look-up
+   * @param num the number of such element
+   * @param context the field's context from FieldContext::get()
+   */
+  constexpr FieldElement(int512_t num, const FieldContext* context) : num_(num), context_(context) {
+    if (num >= context->prime()) {
+      throw invalid_argument("invalid num [" + num.str() + "] is negative or greater than prime [" + context->prime().str() + "]");
+    }
+  }
   /**
    * @brief A dummy constructor needed by C++'s syntax. Directly calling it may 
    * cause undefined behaviors.
@@ -35,26 +117,27 @@ public:
   FieldElement();    
   bool operator==(const FieldElement& other) const;
   bool operator!=(const FieldElement& other) const;
-  FieldElement operator+(const FieldElement& other);
-  FieldElement operator-(const FieldElement& other);
-  FieldElement operator*(const FieldElement& other);
-  FieldElement operator*(const int512_t other);
-  FieldElement operator/(const FieldElement& other);
+  FieldElement operator+(const FieldElement& other) const;
+  FieldElement operator-(const FieldElement& other) const;
+  FieldElement operator*(const FieldElement& other) const;
+  FieldElement operator*(const int512_t other) const;
+  FieldElement operator/(const FieldElement& other) const;
   /**
    * @brief Apply the exponentiation operation to the FieldElement object, using the object as base
    * @param exponent
    * @return 
   */
-  FieldElement power(int512_t exponent);
-  string to_string(bool inHex=false);
+  FieldElement power(int512_t exponent) const;
+  string to_string(bool inHex=false) const;
   /**
    * @brief Get the number of the element. For the purpose of Bitcoin application, the number must be:
    * 1. At most 512-bit long (in contrast, the long long type in C is 64-bit long)
    * 2. A non-negative number smaller than the order (i.e. pre-defined prime) of the finite field   * 
    * @return the number of the field element 
    */
-  int512_t num();
-  int512_t prime();
+  int512_t num() const;
+  int512_t prime() const;
+  const FieldContext* context() const;
 };
 
 
@@ -80,6 +163,12 @@ protected:
   FieldElement y_;
   // We need to have a default constructor FieldElement() defined to make this work.
   bool infinity_ = false;
+  /**
+   * @brief Initialize a point from members that are already known to be consistent, without any check. Unlike
+   * the public constructors, it can be evaluated at compile time.
+   */
+  constexpr FieldElementPoint(const FieldElement& x, const FieldElement& y, const FieldElement& a,
+    const FieldElement& b, const bool infinity) : a_(a), b_(b), x_(x), y_(y), infinity_(infinity) {}
 public:
   /**
    * @brief Initialize a field element point on curve y^2 = x^3 + ax + b
@@ -98,30 +187,29 @@ public:
    * @throw invalid_argument if a and b are not in the same finite field (i.e., their prime numbers are different)
    */
   FieldElementPoint(FieldElement a, FieldElement b);
-  ~FieldElementPoint();
   bool operator==(const FieldElementPoint& other) const;
-  FieldElementPoint operator+(const FieldElementPoint& other);
+  FieldElementPoint operator+(const FieldElementPoint& other) const;
   FieldElementPoint operator+=(const FieldElementPoint& other);
-  FieldElementPoint operator*(const int512_t coef);
-  string to_string(bool inHex=false);
+  FieldElementPoint operator*(const int512_t coef) const;
+  string to_string(bool inHex=false) const;
   /**
    * @brief Check if the FieldElementPoint is at Infinity
    */
-  bool infinity();
+  bool infinity() const;
   /**
    * @brief Get the x coordinate of the point 
    * @return FieldElement 
    * @throw invalid_argument if the point is at infinity
    */
-  FieldElement x();
+  FieldElement x() const;
   /**
    * @brief Get the y coordinate of the point 
    * @return FieldElement 
    * @throw invalid_argument if the point is at infinity
    */
-  FieldElement y();
-  FieldElement a();
-  FieldElement b();
+  FieldElement y() const;
+  FieldElement a() const;
+  FieldElement b() const;
 };
 
 /**
@@ -132,7 +220,8 @@ public:
 class S256Element : public FieldElement
 {
 private:
-  static const int512_t s256_prime_; // the value is defined in ecc.cpp
+  static constexpr int512_t s256_prime_ = S256Field::PRIME;
+  static constexpr const FieldContext* s256_context() { return FieldContext::s256(); }
 public:
   /**
    * @brief Initialize a S256Element by passing an integer. Order of the finite field is not needed as it is hardcoded
@@ -140,17 +229,35 @@ public:
    * 2^256 - 2^32 - 2^9 - 2^8 - 2^7 - 2^6 - 2^4 - 1
    * @param num the integer of the finite field element
    */
-  S256Element(int512_t num);
-  string to_string();
-  int512_t s256_prime();
-  S256Element power(const int512_t exponent);
-  S256Element sqrt();
+  constexpr S256Element(int512_t num) : FieldElement(num, S256Element::s256_context()) {}
+  /**
+   * @brief Initialize a S256Element from its fixed-width representation
+   */
+  constexpr explicit S256Element(const S256Field& fe) : FieldElement(fe.num(), S256Element::s256_context()) {}
+  // Arithmetic between two S256Elements is done on S256Field instead of int512_t. Operations mixing in a generic
+  // FieldElement still go to FieldElement's version.
+  using FieldElement::operator+;
+  using FieldElement::operator-;
+  using FieldElement::operator*;
+  using FieldElement::operator/;
+  S256Element operator+(const S256Element& other) const;
+  S256Element operator-(const S256Element& other) const;
+  S256Element operator*(const S256Element& other) const;
+  S256Element operator/(const S256Element& other) const;
+  string to_string() const;
+  int512_t s256_prime() const;
+  S256Element power(const int512_t exponent) const;
+  S256Element sqrt() const;
+  /**
+   * @brief Get the fixed-width representation of the element
+   */
+  S256Field fe() const;
 };
 
 class Signature {
 private:
-  int512_t r_ = -1;
-  int512_t s_ = -1;
+  S256Scalar r_;
+  S256Scalar s_;
 public:
   /**
    * @brief Initialize a Signature object
@@ -160,24 +267,79 @@ public:
    *  msg_hash, private_key_bytes, r, k_inverse and the order of the generator point G.
    *  The purpose of having s is that we want to derive a number from the private key and prove we know the private key
    *  by revealing only this number (i.e., s) to other people, keeping private key, well, private.
+   * @throw invalid_argument if r or s is negative or not smaller than the order of G
    */
   Signature(int512_t r, int512_t s);
-  string to_string();
+  /**
+   * @brief Initialize a Signature object with r and s set to zero, e.g., for parse_der() to write into. It never
+   * verifies.
+   */
+  Signature();
+  /**
+   * @brief Initialize a Signature object from r and s that are already reduced modulo the order of G
+   */
+  Signature(const S256Scalar& r, const S256Scalar& s);
+  /**
+   * @brief Parse a DER-encoded signature, the reverse of get_der_format(), without allocating or throwing, so that it
+   * can run on every signature of the blockchain
+   * @param der the DER bytes, without the sighash type byte that follows them in a script
+   * @param der_len the length of der in bytes
+   * @param sig set to the parsed signature if der is accepted. An r or s that is not smaller than the order of G is
+   * accepted but sets both to zero, which makes the signature fail verification, the same as Bitcoin Core does.
+   * @param strict true to accept strict DER only, as BIP66 requires of every signature since block 363,725:
+   * minimal lengths, no excess zero padding, no negative numbers and nothing after the sequence. false to accept
+   * what OpenSSL did before it, which a lot of signatures in early blocks depend on: long-form lengths, any
+   * padding, numbers read as unsigned and trailing garbage.
+   * @returns false if der is not a signature in the chosen mode
+   */
+  static bool parse_der(const uint8_t* der, const size_t der_len, Signature& sig, const bool strict = true);
+  /**
+   * @brief Check if s is the lower of the two valid values s and n - s, which BIP146 requires of standard
+   * transactions. sign() only produces such signatures.
+   */
+  bool has_low_s() const;
+  string to_string() const;
   // r the x-coordinate of a random point R from k * G where G is the generator point and k is a random integer
-  int512_t r();
+  int512_t r() const;
   /*
    * the signature proof from a formula involving 
    * msg_hash, private_key_bytes, r, k_inverse and the order of the generator point G.
    * The purpose of having s is that we want to derive a number from the private key and prove we know the private key
    * by revealing only this number (i.e., s) to other people, keeping private key, well, private.
    */
-  int512_t s();
+  int512_t s() const;
+  /**
+   * @brief Get r as an S256Scalar, which is what verification works on
+   */
+  const S256Scalar& r_scalar() const;
+  /**
+   * @brief Get s as an S256Scalar, which is what verification works on
+   */
+  const S256Scalar& s_scalar() const;
   /*
    * @brief Get the DER format serialization of a Signature
    * @param output_len pointer to memory where the method writes the length of the output DER hex string.
    * @returns a hex string representing the Signature in DER format
    */
-  uint8_t* get_der_format(size_t* output_len);
+  uint8_t* get_der_format(size_t* output_len) const;
+  // The longest a DER signature can be: 6 bytes of markers and lengths, plus r and s of up to 33 bytes each
+  static const size_t DER_MAX_LEN = 72;
+  /**
+   * @brief The same as get_der_format() above, but written to a caller-provided buffer, with no heap allocation
+   * @param output a pre-allocated buffer of at least DER_MAX_LEN bytes
+   * @returns the length of the DER signature written to output, in bytes
+   */
+  size_t get_der_format(uint8_t* output) const;
+  /**
+   * @brief Serialize many signatures to DER at once, back to back in one buffer
+   * @param sigs an array of count signatures
+   * @param count the number of signatures
+   * @param output a pre-allocated buffer of at least count * DER_MAX_LEN bytes. The DER of sigs[i] starts right
+   * after that of sigs[i - 1].
+   * @param lengths a pre-allocated array of count lengths, lengths[i] is set to the length of sigs[i]'s DER
+   * @returns the total length written to output, in bytes
+   */
+  static size_t get_der_format_batch(const Signature* sigs, const size_t count, uint8_t* output, size_t* lengths);
 };
 
 /**
@@ -185,19 +347,49 @@ public:
  */
 class S256Point : public FieldElementPoint
 {
-  /* 
-   * Note that it is not easy to make a, b, and order public--they are const members of the class,
-   * but some of their member functions are non-const. Calling non-constant member from const member
-   * seems to cause issues in C++.
+  /*
+   * Like every class in this file, S256Point is a value: its const members read nothing but the object itself,
+   * constant data (the field contexts, G and its precomputed tables) and one process-wide variable, and write only
+   * to their return values and output parameters. So a point, e.g., G or a public key, can be shared by any number
+   * of threads as long as none of them assigns to it, and the static batch methods are reentrant.
+   * The variable is active_kernel in kernel.cpp, the kernel set every field and scalar multiplication goes through
+   * (see kernel.h). It is set on first use and s256_select_kernel() may switch it at any time, even while other
+   * threads are multiplying. That is safe: it is a std::atomic pointer to one of the constant kernel sets, so each
+   * multiplication runs entirely on either the old set or the new one, and all the sets give identical results.
    */
 protected:
   // The a as defined in y^2 = x^3 + ax + b. It is a FieldElement constant whose value is 0
-  static const S256Element a_;
+  static constexpr S256Element a_ = S256Element(0);
   // The b as defined in y^2 = x^3 + ax + b. It is a FieldElement constant whose value is 7
-  static const S256Element b_;
+  static constexpr S256Element b_ = S256Element(7);
   // The number of elements (i.e. size) of the finite field used by this S256Point.
   // It is a constant whose value is 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141;
-  static const int512_t order_;
+  static constexpr int512_t order_ = S256Scalar::ORDER;
+  // secp256k1's generator, see generator(). It is defined, at compile time, in ecc.cpp.
+  static const S256Point generator_;
+  // The same point as x_ and y_, in S256Field, which is what all the point arithmetic and serialization works on, so
+  // that they don't convert x_ and y_ from int512_t every time
+  S256AffineCoords coords_;
+  /**
+   * @brief Initialize a point from coordinates that are already known to be on the curve, e.g., results of point
+   * addition, so that the curve check is skipped.
+   */
+  constexpr S256Point(const S256Field& x, const S256Field& y)
+      : FieldElementPoint(S256Element(x), S256Element(y), S256Point::a_, S256Point::b_, false), coords_{x, y, false} {}
+  /**
+   * @brief Convert a point in Jacobian coordinates, usually the result of a chain of arithmetic, back to an
+   * S256Point. This is where the only inversion of the chain takes place.
+   */
+  static S256Point from_jacobian(const S256JacobianPoint& p);
+  /**
+   * @brief Reduce a scalar modulo the order of the group and split it into four little-endian 64-bit limbs.
+   */
+  static void get_scalar_limbs(const int512_t coef, uint64_t limbs[4]);
+  /**
+   * @brief The part of verify() after the inverse of s is known, shared by verify() and verify_batch().
+   */
+  static bool verify_with_inverse(const S256AffineCoords& pubkey, const S256Scalar& msg_hash, const S256Scalar& r,
+    const S256Scalar& s_inv);
 public:
   /**
    * @brief Initialize a field element point on the secp256k1 curve (y^2 = x^3 + 7). To initialize a point at infinity,
@@ -210,6 +402,22 @@ public:
    * @brief Initialize a field element point at infinity on the secp256k1 curve (y^2 = x^3 + 7).
    */
   S256Point();
+  /**
+   * @brief Initialize a point from its affine coordinates, the reverse of affine_coords(), e.g., to get an S256Point
+   * of a key kept as an S256CompactPoint
+   * @throw invalid_argument if the point is not on the curve
+   */
+  explicit S256Point(const S256AffineCoords& coords);
+  /**
+   * @brief Get secp256k1's generator point, a compile-time constant unlike G, which can be used in constant
+   * expressions
+   */
+  static constexpr const S256Point& generator() { return S256Point::generator_; }
+  /**
+   * @brief Reduce a message hash modulo the order of the group, which is the message verify() checks a signature
+   * against: hashes that are congruent modulo n, e.g., h and h + n, are the same message to it.
+   */
+  static S256Scalar get_scalar_from_hash(const int512_t& msg_hash);
   /**
    * @brief Interpreting this S256Point instance as a public key, verify if a signature if generated by the private 
    *        counterpart of this public key.
@@ -218,18 +426,48 @@ public:
    * @param sig the Signature object generated (or, signed, if you wish) from the private key by calling the
    *        ECDSAKey object's sign() method.
    */
-  bool verify(int512_t msg_hash, Signature sig);
-  int512_t s256_prime();
-  S256Point operator+(const S256Point other);
-  S256Point operator*(const int512_t coef);
+  bool verify(const int512_t& msg_hash, const Signature& sig) const;
+  /**
+   * @brief The same as verify() above, but with a precomputed table of this point, so that both G * u and this * v
+   * are table lookups and mixed additions with no doublings, see S256PointTable
+   * @param table S256PointTable(this->affine_coords())
+   */
+  bool verify(const int512_t& msg_hash, const Signature& sig, const S256PointTable& table) const;
+  /**
+   * @brief Get the point's coordinates in S256Field, which is what all the point arithmetic works on, e.g., to
+   * build an S256PointTable of the point.
+   */
+  S256AffineCoords affine_coords() const;
+  /**
+   * @brief Verify many (public key, message hash, signature) triples at once. Compared with calling verify() in a
+   * loop, the inverses of all s are computed with a single modular inversion per worker thread, and the work is
+   * spread over multiple threads.
+   * @param pubkeys an array of count public keys
+   * @param msg_hashes an array of count message hashes, msg_hashes[i] is the one signed by sigs[i]
+   * @param sigs an array of count signatures, sigs[i] is verified against pubkeys[i]
+   * @param count the number of triples
+   * @param results a pre-allocated array of count bools, results[i] is set to what pubkeys[i].verify(msg_hashes[i],
+   * sigs[i]) would return
+   * @param threads the number of worker threads, including the calling one. 0 means one per hardware thread.
+   */
+  static void verify_batch(const S256Point* pubkeys, const int512_t* msg_hashes, const Signature* sigs,
+    const size_t count, bool* results, unsigned int threads = 1);
+  int512_t s256_prime() const;
+  S256Point operator+(const S256Point& other) const;
+  S256Point operator*(const int512_t coef) const;
+  /**
+   * @brief The same as operator*, but with a fixed schedule whose run time doesn't depend on the bits of coef, see
+   * s256_multiply_fixed(). Use it whenever coef is a secret, e.g., a private key or a signing nonce. ECDSAKey does.
+   */
+  S256Point multiply_fixed(const int512_t coef) const;
   // Get a as defined in y^2 = x^3 + ax + b. It is a FieldElement constant whose value is 0
-  S256Element a();
+  S256Element a() const;
   // Get b as defined in y^2 = x^3 + ax + b. It is a FieldElement constant whose value is 7
-  S256Element b();
+  S256Element b() const;
   // Get the number of elements (i.e. size) of the finite field used by this S256Point.
   // It is a constant whose value is 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141;
-  int512_t order();
-  string to_string();
+  int512_t order() const;
+  string to_string() const;
   /**
    * @brief Get an S256Point's representation in Standards for Efficient Cryptography (SEC) format
    * @param compressed Should the SEC's uncompressed or compressed version be returned. Compressed SEC format
@@ -239,21 +477,93 @@ public:
    * If compression is enabled, the array is 33-byte long; otherwise it is 65-byte long.
    * Users are reminded to free() the pointer after use.
    */
-  uint8_t* get_sec_format(const bool compressed);
+  uint8_t* get_sec_format(const bool compressed) const;
+  static const size_t SEC_COMPRESSED_LEN = 33;
+  static const size_t SEC_UNCOMPRESSED_LEN = 65;
+  /**
+   * @brief The same as get_sec_format() above, but written to a caller-provided buffer, with no heap allocation
+   * @param output a pre-allocated buffer of at least SEC_COMPRESSED_LEN or SEC_UNCOMPRESSED_LEN bytes
+   * @returns the number of bytes written to output
+   */
+  size_t get_sec_format(const bool compressed, uint8_t* output) const;
+  /**
+   * @brief Serialize many points to SEC at once, back to back in one buffer, which is the layout parse_sec_batch()
+   * reads
+   * @param output a pre-allocated buffer of at least count * SEC_COMPRESSED_LEN or count * SEC_UNCOMPRESSED_LEN bytes
+   */
+  static void get_sec_format_batch(const S256Point* points, const size_t count, const bool compressed, uint8_t* output);
+  /**
+   * @brief Parse a public key in SEC format, the reverse of get_sec_format()
+   * @param sec either 33 bytes, 0x02 or 0x03 (the parity of y) followed by x, or 65 bytes, 0x04 followed by x and y
+   * @param sec_len the length of sec in bytes
+   * @throw invalid_argument if sec is not a valid SEC key: the length doesn't match the prefix, x or y is not smaller
+   * than p, or the point is not on the curve
+   */
+  static S256Point parse_sec(const uint8_t* sec, const size_t sec_len);
+  /**
+   * @brief The same as parse_sec() above, but to affine coordinates and without throwing
+   * @returns whether sec is a valid SEC key. coords is left unchanged if it isn't.
+   */
+  static bool parse_sec(const uint8_t* sec, const size_t sec_len, S256AffineCoords& coords);
+  /**
+   * @brief Parse many SEC public keys at once, e.g., all the keys of a block's inputs. Compared with calling
+   * parse_sec() in a loop, nothing throws or allocates per key and the work is spread over multiple threads, which
+   * matters for compressed keys, as each of them takes a square root to recover y.
+   * @param secs count keys of sec_len bytes each, back to back
+   * @param sec_len 33 (compressed) or 65 (uncompressed), the same for all keys
+   * @param count the number of keys
+   * @param points a pre-allocated array of count points, points[i] is set to the key in secs[i]
+   * @param results a pre-allocated array of count bools, results[i] is set to whether secs[i] is valid. points[i] is
+   * left unchanged if it isn't.
+   * @param threads the number of worker threads, including the calling one. 0 means one per hardware thread.
+   */
+  static void parse_sec_batch(const uint8_t* secs, const size_t sec_len, const size_t count, S256Point* points,
+    bool* results, unsigned int threads = 1);
   /**
    * @brief A detailed comment is not provided because it is still not sure about the purpose of this method...
    * @returns Pointer to a null-terminated string. Users are reminded to free() the pointer after use.
    */
-  char* get_address(bool compressed, bool testnet);
+  char* get_address(bool compressed, bool testnet) const;
+  // The longest a P2PKH address can be, not counting the null terminator
+  static const size_t ADDRESS_MAX_LEN = 35;
+  /**
+   * @brief The same as get_address() above, but written to a caller-provided buffer, with no heap allocation
+   * @param output a pre-allocated buffer of at least ADDRESS_MAX_LEN + 1 chars, where the null-terminated address is
+   * delivered
+   * @returns the length of the address, not counting the null terminator
+   */
+  size_t get_address(const bool compressed, const bool testnet, char* output) const;
+  /**
+   * @brief Get the addresses of many points at once
+   * @param output a pre-allocated buffer of at least count * (ADDRESS_MAX_LEN + 1) chars. The null-terminated address
+   * of points[i] starts at output + i * (ADDRESS_MAX_LEN + 1).
+   */
+  static void get_address_batch(const S256Point* points, const size_t count, const bool compressed, const bool testnet,
+    char* output);
 };
 
 // The constant generator point of secp256k1.
-extern S256Point G;
+extern const S256Point G;
+
+class ECDSAKey;
+
+/**
+ * @brief One signature for ECDSAKey::sign_batch() to create: msg_hash signed with key
+ */
+struct ECDSASigningJob {
+  const ECDSAKey* key;
+  // SHA256_HASH_SIZE bytes
+  const uint8_t* msg_hash;
+};
 
 class ECDSAKey {
 protected:
   uint8_t privkey_bytes_[32] = {0};
   int512_t privkey_int_ = -1;
+  // The private key as signing uses it, and its RFC 6979 generator, which hashes what doesn't depend on the message
+  // once, here
+  S256Scalar privkey_;
+  RFC6979Generator rfc6979_;
   /**
    * The public key in an ECDSA key pair. It is generated from G * private_key.
    * As an S256Point object, it has a verify() method to verify if a Signature
@@ -277,26 +587,48 @@ public:
    */
   ECDSAKey(const int512_t private_key);
   ~ECDSAKey();
-  string to_string();
+  string to_string() const;
   /**
    * @brief Generate an ECDSA signature with the private key as defined in this instance
    * @param msg_hash a pointer pointing to an array of bytes as the value from hashing
    *        the original message twice with SHA256 algorithm
    * @param msg_hash_len length of the double SHA256 hash, it should always be equal to SHA256_HASH_SIZE.
+   * @param extra_entropy nullptr, or additional data mixed into K, see get_deterministic_k()
+   * @param extra_entropy_len length of extra_entropy
    * @returns a Signature object
    */
-  Signature sign(uint8_t* msg_hash, size_t msg_hash_len);
+  Signature sign(const uint8_t* msg_hash, size_t msg_hash_len, const uint8_t* extra_entropy = nullptr,
+    const size_t extra_entropy_len = 0) const;
+  /**
+   * @brief Create many signatures, e.g., one per input of a transaction, possibly with different keys, on several
+   * threads, and serialize them to DER.
+   * The workers take jobs off a shared counter a few at a time, so a slow thread doesn't hold the others back. A
+   * job only reads its key, and each worker signs on its own stack and writes to the jobs' own slots of ders and
+   * lengths, so nothing mutable is shared. The same key may appear in any number of jobs.
+   * @param jobs an array of count jobs
+   * @param count the number of jobs
+   * @param ders a pre-allocated buffer of count * Signature::DER_MAX_LEN bytes. The DER signature of jobs[i] starts
+   * at ders + i * Signature::DER_MAX_LEN, whatever order the jobs are done in.
+   * @param lengths a pre-allocated array of count lengths, lengths[i] is set to the length of jobs[i]'s signature
+   * @param threads the number of worker threads, including the calling one. 0 means one per hardware thread.
+   */
+  static void sign_batch(const ECDSASigningJob* jobs, const size_t count, uint8_t* ders, size_t* lengths,
+    unsigned int threads = 1);
   /**
    * @brief Get a deterministic (instead of a random) K for ECDSA signature creation per RFC 6979
    * @param msg_hash an uint8_t pointer pointing to the message in bytes
    * @param msg_hash_len length of the message
+   * @param extra_entropy nullptr, or additional data k' (section 3.6 of RFC 6979), e.g., 32 random bytes. K is then
+   * a function of the key, the message and extra_entropy.
+   * @param extra_entropy_len length of extra_entropy
    * @return the deterministic K
    */
-  int512_t get_deterministic_k(uint8_t* msg_hash, size_t msg_hash_len);
+  int512_t get_deterministic_k(const uint8_t* msg_hash, size_t msg_hash_len, const uint8_t* extra_entropy = nullptr,
+    const size_t extra_entropy_len = 0) const;
   /**
    * @brief Get the public key of this ECDSAKey instance
    */
-  S256Point public_key();
+  S256Point public_key() const;
   /**
    * @brief Get the private key of this ECDSAKey instance in Wallet Import Format (WIF format)
    * @param compressed If the private key is compressed? (But we are not using SEC, what's the difference?)
@@ -304,7 +636,7 @@ public:
    * @returns Pointer to a null-terminated string containing the private key in WIF format.
    * Users are reminded to free() the pointer after use.
    */
-  char* get_wif_private_key(bool compressed, bool testnet);
+  char* get_wif_private_key(bool compressed, bool testnet) const;
   
 };
 
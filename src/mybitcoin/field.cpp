@@ -0,0 +1,215 @@
+#include <stdexcept>
+#include <vector>
+
+#include "field.h"
+#include "field_reduce.h"
+#include "int128.h"
+#include "kernel.h"
+#include "modinv.h"
+
+using namespace std;
+using namespace boost::multiprecision;
+
+static const uint64_t S256_P[4] = {
+    0xFFFFFFFEFFFFFC2FULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL
+};
+
+S256Field::S256Field(const uint64_t num) {
+    this->n_[0] = num;
+    s256_field_reduce_once(this->n_);
+}
+
+S256Field::S256Field(const int512_t& num) {
+    if (num < 0 || num >= S256Field::prime()) {
+        throw invalid_argument("num [" + num.str() + "] is negative or not smaller than secp256k1's prime");
+    }
+    for (int i = 0; i < 4; ++i) {
+        this->n_[i] = (uint64_t)((num >> (64 * i)) & 0xFFFFFFFFFFFFFFFFULL);
+    }
+}
+
+const int512_t& S256Field::prime() {
+    return S256Field::PRIME;
+}
+
+S256Field S256Field::from_limbs(const uint64_t limbs[4]) {
+    S256Field result;
+    for (int i = 0; i < 4; ++i) { result.n_[i] = limbs[i]; }
+    s256_field_reduce_once(result.n_);
+    return result;
+}
+
+S256Field S256Field::from_bytes(const uint8_t* input_bytes) {
+    uint64_t limbs[4] = {0};
+    for (int i = 0; i < 32; ++i) {
+        limbs[3 - i / 8] = (limbs[3 - i / 8] << 8) | input_bytes[i];
+    }
+    return S256Field::from_limbs(limbs);
+}
+
+void S256Field::get_bytes(uint8_t* output_bytes) const {
+    for (int i = 0; i < 32; ++i) {
+        output_bytes[i] = (uint8_t)(this->n_[3 - i / 8] >> (56 - 8 * (i % 8)));
+    }
+}
+
+const uint64_t* S256Field::limbs() const {
+    return this->n_;
+}
+
+bool S256Field::operator==(const S256Field& other) const {
+    return this->n_[0] == other.n_[0] && this->n_[1] == other.n_[1] &&
+           this->n_[2] == other.n_[2] && this->n_[3] == other.n_[3];
+}
+
+bool S256Field::operator!=(const S256Field& other) const {
+    return !(*this == other);
+}
+
+S256Field S256Field::operator+(const S256Field& other) const {
+    S256Field result;
+    u128 acc = 0;
+    for (int i = 0; i < 4; ++i) {
+        acc += (u128)this->n_[i] + other.n_[i];
+        result.n_[i] = (uint64_t)acc; acc >>= 64;
+    }
+    // Both operands are smaller than p, so if the sum overflows 2^256, we only need to fold the carry once.
+    if (acc) {
+        acc = (u128)result.n_[0] + S256_C;
+        result.n_[0] = (uint64_t)acc; acc >>= 64;
+        for (int i = 1; i < 4 && acc; ++i) {
+            acc += result.n_[i];
+            result.n_[i] = (uint64_t)acc; acc >>= 64;
+        }
+    } else {
+        s256_field_reduce_once(result.n_);
+    }
+    return result;
+}
+
+S256Field S256Field::operator-(const S256Field& other) const {
+    S256Field result;
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 diff = (u128)this->n_[i] - other.n_[i] - borrow;
+        result.n_[i] = (uint64_t)diff;
+        borrow = (uint64_t)(diff >> 64) & 1;
+    }
+    // this - other + 2^256 is at least 2^256 - p + 1, so subtracting S256_C gets back this - other + p without
+    // borrowing beyond 256 bits.
+    if (borrow) {
+        borrow = S256_C;
+        for (int i = 0; i < 4 && borrow; ++i) {
+            u128 diff = (u128)result.n_[i] - borrow;
+            result.n_[i] = (uint64_t)diff;
+            borrow = (uint64_t)(diff >> 64) & 1;
+        }
+    }
+    return result;
+}
+
+S256Field S256Field::operator*(const S256Field& other) const {
+    S256Field result;
+    s256_kernel().field_multiply(this->n_, other.n_, result.n_);
+    return result;
+}
+
+S256Field S256Field::square() const {
+    S256Field result;
+    s256_kernel().field_square(this->n_, result.n_);
+    return result;
+}
+
+S256Field S256Field::negate() const {
+    if (this->is_zero()) { return *this; }
+    S256Field result;
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 diff = (u128)S256_P[i] - this->n_[i] - borrow;
+        result.n_[i] = (uint64_t)diff;
+        borrow = (uint64_t)(diff >> 64) & 1;
+    }
+    return result;
+}
+
+S256Field S256Field::power(const uint64_t exponent[4]) const {
+    // Left-to-right binary exponentiation
+    S256Field result = S256Field(1);
+    for (int i = 255; i >= 0; --i) {
+        result = result.square();
+        if ((exponent[i / 64] >> (i % 64)) & 1) {
+            result = result * (*this);
+        }
+    }
+    return result;
+}
+
+S256Field S256Field::inverse() const {
+    S256Field result;
+    s256_field_inverse(this->n_, result.n_);
+    return result;
+}
+
+void S256Field::batch_inverse(S256Field* elements, const size_t count) {
+    if (count == 0) { return; }
+    // prefix[i] is the product of all non-zero elements[0..i]
+    vector<S256Field> prefix(count);
+    S256Field product = S256Field(1);
+    for (size_t i = 0; i < count; ++i) {
+        if (!elements[i].is_zero()) { product = product * elements[i]; }
+        prefix[i] = product;
+    }
+    // inv is the inverse of prefix[i] at the start of each iteration, so inv * prefix[i - 1] is the inverse of
+    // elements[i]
+    S256Field inv = product.inverse();
+    for (size_t i = count; i-- > 0;) {
+        if (elements[i].is_zero()) { continue; }
+        S256Field element = elements[i];
+        elements[i] = i > 0 ? inv * prefix[i - 1] : inv;
+        inv = inv * element;
+    }
+}
+
+/**
+ * @brief a^(2^times)
+ */
+static S256Field square_times(S256Field a, const int times) {
+    for (int i = 0; i < times; ++i) { a = a.square(); }
+    return a;
+}
+
+S256Field S256Field::sqrt() const {
+    // (p + 1) / 4 in binary is 223 ones, a zero, 22 ones, four zeros, 2 ones and two zeros. Raising to it with
+    // power() takes 256 squarings and ~250 multiplications; the addition chain below builds the runs of ones
+    // (x_k = a^(2^k - 1)) from shorter ones, taking 253 squarings and 13 multiplications.
+    const S256Field& a = *this;
+    S256Field x2 = a.square() * a;
+    S256Field x3 = x2.square() * a;
+    S256Field x6 = square_times(x3, 3) * x3;
+    S256Field x9 = square_times(x6, 3) * x3;
+    S256Field x11 = square_times(x9, 2) * x2;
+    S256Field x22 = square_times(x11, 11) * x11;
+    S256Field x44 = square_times(x22, 22) * x22;
+    S256Field x88 = square_times(x44, 44) * x44;
+    S256Field x176 = square_times(x88, 88) * x88;
+    S256Field x220 = square_times(x176, 44) * x44;
+    S256Field x223 = square_times(x220, 3) * x3;
+    S256Field t = square_times(x223, 23) * x22;
+    t = square_times(t, 6) * x2;
+    return square_times(t, 2);
+}
+
+void S256Field::conditional_assign(const S256Field& other, const bool flag) {
+    uint64_t mask = -(uint64_t)flag;
+    for (int i = 0; i < 4; ++i) {
+        this->n_[i] = (this->n_[i] & ~mask) | (other.n_[i] & mask);
+    }
+}
+
+bool S256Field::is_zero() const {
+    return (this->n_[0] | this->n_[1] | this->n_[2] | this->n_[3]) == 0;
+}
+
+bool S256Field::is_odd() const {
+    return this->n_[0] & 1;
+}
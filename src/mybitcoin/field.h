@@ -0,0 +1,126 @@
+#ifndef FIELD_H
+#define FIELD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace std;
+using namespace boost::multiprecision;
+
+// secp256k1's constants as int512_t literals. The using-directive for the literal operator stays in this namespace,
+// out of the scope of whatever includes this header.
+namespace s256_constants {
+using namespace boost::multiprecision::literals;
+constexpr int512_t PRIME = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppi512;
+}
+
+/**
+ * @brief An element of secp256k1's base field, i.e., an integer modulo
+ * p = 2^256 - 2^32 - 977, stored in four 64-bit limbs.
+ * Compared with FieldElement, which is generic over any prime but relies on
+ * int512_t and a `%` by prime after every operation, S256Field is fixed-width:
+ * products are computed limb by limb and reduced by folding the upper 256
+ * bits back with 2^256 ≡ 2^32 + 977 (mod p). Multiplication and squaring go
+ * through the kernel set picked for the CPU at run time, see kernel.h.
+ * @note The value is always kept fully reduced, i.e., in [0, p).
+ */
+class S256Field {
+protected:
+  // Little-endian limbs: n_[0] holds the least significant 64 bits.
+  uint64_t n_[4] = {0, 0, 0, 0};
+public:
+  // p as an int512_t, a compile-time constant
+  static constexpr int512_t PRIME = s256_constants::PRIME;
+  /**
+   * @brief Initialize the element to zero.
+   */
+  constexpr S256Field() {}
+  /**
+   * @brief Initialize the element from a small integer.
+   */
+  explicit S256Field(const uint64_t num);
+  /**
+   * @brief Initialize the element from an int512_t
+   * @param num the number of the element, it has to be in [0, p)
+   * @throw invalid_argument if num is negative or not smaller than p
+   */
+  explicit S256Field(const int512_t& num);
+  /**
+   * @brief Initialize the element from four little-endian 64-bit limbs at compile time, e.g., a curve constant or
+   * an entry of a precomputed table. Unlike from_limbs(), the limbs are not reduced, they have to be in [0, p).
+   */
+  constexpr S256Field(const uint64_t n0, const uint64_t n1, const uint64_t n2, const uint64_t n3)
+      : n_{n0, n1, n2, n3} {}
+  /**
+   * @brief Get p as an int512_t
+   */
+  static const int512_t& prime();
+  /**
+   * @brief Initialize the element from four little-endian 64-bit limbs.
+   * The value is reduced modulo p if it is not smaller than p.
+   */
+  static S256Field from_limbs(const uint64_t limbs[4]);
+  /**
+   * @brief Initialize the element from a 32-byte big-endian byte array.
+   * The value is reduced modulo p if it is not smaller than p.
+   */
+  static S256Field from_bytes(const uint8_t* input_bytes);
+  /**
+   * @brief Write the element to a pre-allocated, 32-byte long array in
+   * big-endian order.
+   */
+  void get_bytes(uint8_t* output_bytes) const;
+  constexpr int512_t num() const {
+    int512_t result = 0;
+    for (int i = 3; i >= 0; --i) {
+      result <<= 64;
+      result |= this->n_[i];
+    }
+    return result;
+  }
+  const uint64_t* limbs() const;
+
+  bool operator==(const S256Field& other) const;
+  bool operator!=(const S256Field& other) const;
+  S256Field operator+(const S256Field& other) const;
+  S256Field operator-(const S256Field& other) const;
+  S256Field operator*(const S256Field& other) const;
+  S256Field negate() const;
+  S256Field square() const;
+  /**
+   * @brief Raise the element to a 256-bit exponent, given as four
+   * little-endian 64-bit limbs.
+   */
+  S256Field power(const uint64_t exponent[4]) const;
+  /**
+   * @brief Get the multiplicative inverse of the element with the constant-time
+   * safegcd algorithm, see modinv.h. The inverse of zero is defined to be zero.
+   */
+  S256Field inverse() const;
+  /**
+   * @brief Invert many elements at once with Montgomery's trick: the product of all elements is inverted once, and
+   * each element's inverse is peeled off it with 3 multiplications in total, which is much cheaper than one
+   * inverse() per element once there are more than a few of them.
+   * @param elements an array of count elements, each of them is replaced by its inverse in place. Zeros stay zero,
+   * the same as inverse().
+   * @param count the number of elements
+   */
+  static void batch_inverse(S256Field* elements, const size_t count);
+  /**
+   * @brief Get a square root of the element, i.e., num^((p+1)/4). This works
+   * because p % 4 == 3. The result is meaningful only if the element is a
+   * quadratic residue--callers may square the result to check. The power is
+   * raised with a fixed addition chain (253 squarings, 13 multiplications).
+   */
+  S256Field sqrt() const;
+  /**
+   * @brief Set the element to other if flag is true, otherwise leave it unchanged. Unlike an if, this takes the
+   * same time and memory accesses either way, so it can be used on secrets.
+   */
+  void conditional_assign(const S256Field& other, const bool flag);
+  bool is_zero() const;
+  bool is_odd() const;
+};
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef FIELD_REDUCE_H
+#define FIELD_REDUCE_H
+
+#include <stdint.h>
+
+#include "int128.h"
+
+// p = 2^256 - S256_C, so 2^256 ≡ S256_C (mod p)
+static const uint64_t S256_C = 0x1000003D1ULL;
+
+/**
+ * @brief Bring a 256-bit value that may be in [p, 2^256) back to [0, p). It is the final step of every reduction,
+ * shared by S256Field (field.cpp) and the multiplication kernels (kernel.cpp).
+ * r >= p if and only if r + S256_C overflows 2^256, in which case the truncated sum is exactly r - p.
+ */
+inline void s256_field_reduce_once(uint64_t r[4]) {
+    uint64_t t[4];
+    u128 acc = (u128)r[0] + S256_C;
+    t[0] = (uint64_t)acc; acc >>= 64;
+    for (int i = 1; i < 4; ++i) {
+        acc += r[i];
+        t[i] = (uint64_t)acc; acc >>= 64;
+    }
+    if (acc) {
+        for (int i = 0; i < 4; ++i) { r[i] = t[i]; }
+    }
+}
+
+#endif
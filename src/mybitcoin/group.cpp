@@ -0,0 +1,627 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "group.h"
+#include "int128.h"
+#include "kernel.h"
+#include "precomputed.h"
+#include "scalar.h"
+
+using namespace std;
+
+// Number of scalar bits consumed by each lookup into the generator table
+static const int GENERATOR_WINDOW_BITS = 4;
+static const int GENERATOR_WINDOWS = 256 / GENERATOR_WINDOW_BITS;
+// Window value 0 contributes nothing, so only 1..15 * 16^i * G are stored
+static const int GENERATOR_WINDOW_SIZE = (1 << GENERATOR_WINDOW_BITS) - 1;
+// Width of the signed odd digits used by the fixed-schedule multiplications
+static const int FIXED_WINDOW_BITS = 4;
+static const int FIXED_WINDOWS = 256 / FIXED_WINDOW_BITS;
+// Digits are odd and in [-15, 15], so there are 8 odd multiples (1, 3, ..., 15) to choose from
+static const int FIXED_WINDOW_SIZE = 1 << (FIXED_WINDOW_BITS - 1);
+// wNAF widths used by s256_multiply_joint(). G's odd multiples are compiled in, so it can afford a wider
+// window (fewer additions) than the arbitrary point, whose odd multiples are computed on every call.
+static const int JOINT_GENERATOR_WNAF_WIDTH = 8;
+static const int JOINT_POINT_WNAF_WIDTH = 5;
+
+static_assert(S256_GENERATOR_WINDOW_TABLE_SIZE == GENERATOR_WINDOWS * GENERATOR_WINDOW_SIZE,
+    "precomputed.cpp doesn't match GENERATOR_WINDOW_BITS");
+static_assert(S256_GENERATOR_ODD_MULTIPLES_SIZE == 1 << (JOINT_GENERATOR_WNAF_WIDTH - 2),
+    "precomputed.cpp doesn't match JOINT_GENERATOR_WNAF_WIDTH");
+static_assert(S256_GENERATOR_FIXED_TABLE_SIZE == FIXED_WINDOWS * FIXED_WINDOW_SIZE + 1,
+    "precomputed.cpp doesn't match FIXED_WINDOW_BITS");
+
+static constexpr S256AffineCoords S256_GENERATOR = {
+    S256Field(0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL, 0x79BE667EF9DCBBACULL),
+    S256Field(0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL),
+    false
+};
+static constexpr S256Field S256_BETA = S256Field(
+    0xC1396C28719501EEULL, 0x9CF0497512F58995ULL, 0x6E64479EAC3434E9ULL, 0x7AE96A2B657C0710ULL
+);
+
+static_assert(sizeof(S256CompactPoint) == 64, "S256CompactPoint has padding");
+
+S256CompactPoint S256CompactPoint::from_affine(const S256AffineCoords& p) {
+    S256CompactPoint result;
+    if (!p.infinity) {
+        result.x = p.x;
+        result.y = p.y;
+    }
+    return result;
+}
+
+S256AffineCoords S256CompactPoint::to_affine() const {
+    S256AffineCoords result;
+    if (!this->infinity()) {
+        result.x = this->x;
+        result.y = this->y;
+        result.infinity = false;
+    }
+    return result;
+}
+
+bool S256CompactPoint::infinity() const {
+    return this->x.is_zero() && this->y.is_zero();
+}
+
+S256JacobianPoint::S256JacobianPoint() {}
+
+S256JacobianPoint::S256JacobianPoint(const S256AffineCoords& p) {
+    this->infinity_ = p.infinity;
+    if (!p.infinity) {
+        this->x_ = p.x;
+        this->y_ = p.y;
+        this->z_ = S256Field(1);
+    }
+}
+
+S256JacobianPoint S256JacobianPoint::double_point() const {
+    // The tangent is a vertical line if y == 0. Visualization: ./assets/fig_02-19.png
+    if (this->infinity_ || this->y_.is_zero()) { return S256JacobianPoint(); }
+    S256JacobianPoint result;
+    result.infinity_ = false;
+    S256Field a = this->x_.square();
+    S256Field b = this->y_.square();
+    S256Field c = b.square();
+    S256Field d = (this->x_ + b).square() - a - c;
+    d = d + d;
+    S256Field e = a + a + a;
+    S256Field f = e.square();
+    result.x_ = f - d - d;
+    S256Field c8 = c + c;
+    c8 = c8 + c8;
+    c8 = c8 + c8;
+    result.y_ = e * (d - result.x_) - c8;
+    result.z_ = this->y_ * this->z_;
+    result.z_ = result.z_ + result.z_;
+    return result;
+}
+
+S256JacobianPoint S256JacobianPoint::add(const S256JacobianPoint& other) const {
+    // Point at infinity is defined as I where point A + I = A. Visualization: ./assets/fig_02-15.png
+    if (this->infinity_) { return other; }
+    if (other.infinity_) { return *this; }
+    S256Field z1z1 = this->z_.square();
+    S256Field z2z2 = other.z_.square();
+    S256Field u1 = this->x_ * z2z2;
+    S256Field u2 = other.x_ * z1z1;
+    S256Field s1 = this->y_ * other.z_ * z2z2;
+    S256Field s2 = other.y_ * this->z_ * z1z1;
+    S256Field h = u2 - u1;
+    S256Field r = s2 - s1;
+    if (h.is_zero()) {
+        // Same x: either the same point (the tangent case) or A + (-A) = I
+        if (r.is_zero()) { return this->double_point(); }
+        return S256JacobianPoint();
+    }
+    S256Field i = (h + h).square();
+    S256Field j = h * i;
+    r = r + r;
+    S256Field v = u1 * i;
+    S256JacobianPoint result;
+    result.infinity_ = false;
+    result.x_ = r.square() - j - v - v;
+    S256Field s1j = s1 * j;
+    result.y_ = r * (v - result.x_) - s1j - s1j;
+    result.z_ = ((this->z_ + other.z_).square() - z1z1 - z2z2) * h;
+    return result;
+}
+
+S256JacobianPoint S256JacobianPoint::add_affine(const S256AffineCoords& other) const {
+    if (this->infinity_) { return S256JacobianPoint(other); }
+    if (other.infinity) { return *this; }
+    S256Field z1z1 = this->z_.square();
+    S256Field u2 = other.x * z1z1;
+    S256Field s2 = other.y * this->z_ * z1z1;
+    S256Field h = u2 - this->x_;
+    S256Field r = s2 - this->y_;
+    if (h.is_zero()) {
+        if (r.is_zero()) { return this->double_point(); }
+        return S256JacobianPoint();
+    }
+    S256Field hh = h.square();
+    S256Field i = hh + hh;
+    i = i + i;
+    S256Field j = h * i;
+    r = r + r;
+    S256Field v = this->x_ * i;
+    S256JacobianPoint result;
+    result.infinity_ = false;
+    result.x_ = r.square() - j - v - v;
+    S256Field y1j = this->y_ * j;
+    result.y_ = r * (v - result.x_) - y1j - y1j;
+    result.z_ = (this->z_ + h).square() - z1z1 - hh;
+    return result;
+}
+
+S256JacobianPoint S256JacobianPoint::negate() const {
+    S256JacobianPoint result = *this;
+    result.y_ = this->y_.negate();
+    return result;
+}
+
+S256AffineCoords S256JacobianPoint::to_affine() const {
+    S256AffineCoords result;
+    if (this->infinity_) { return result; }
+    S256Field z_inv = this->z_.inverse();
+    S256Field z_inv_sq = z_inv.square();
+    result.infinity = false;
+    result.x = this->x_ * z_inv_sq;
+    result.y = this->y_ * z_inv_sq * z_inv;
+    return result;
+}
+
+void S256JacobianPoint::batch_to_affine(const S256JacobianPoint* points, const size_t count,
+    S256AffineCoords* output) {
+    const S256Kernel& kernel = s256_kernel();
+    if (kernel.batch_to_affine != nullptr) {
+        // The SIMD kernel converts the points that aren't at infinity as X, Y and Z limbs, 12 per point
+        vector<uint64_t> xyz;
+        xyz.reserve(count * 12);
+        for (size_t i = 0; i < count; ++i) {
+            if (points[i].infinity_) { continue; }
+            for (const S256Field* coord : {&points[i].x_, &points[i].y_, &points[i].z_}) {
+                xyz.insert(xyz.end(), coord->limbs(), coord->limbs() + 4);
+            }
+        }
+        kernel.batch_to_affine(xyz.data(), xyz.size() / 12);
+        const uint64_t* limbs = xyz.data();
+        for (size_t i = 0; i < count; ++i) {
+            output[i] = S256AffineCoords();
+            if (points[i].infinity_) { continue; }
+            output[i].infinity = false;
+            output[i].x = S256Field(limbs[0], limbs[1], limbs[2], limbs[3]);
+            output[i].y = S256Field(limbs[4], limbs[5], limbs[6], limbs[7]);
+            limbs += 12;
+        }
+        return;
+    }
+    // Points at infinity keep Z == 0, which batch_inverse() skips.
+    vector<S256Field> z_inv(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (!points[i].infinity_) { z_inv[i] = points[i].z_; }
+    }
+    S256Field::batch_inverse(z_inv.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        output[i] = S256AffineCoords();
+        if (points[i].infinity_) { continue; }
+        S256Field z_inv_sq = z_inv[i].square();
+        output[i].infinity = false;
+        output[i].x = points[i].x_ * z_inv_sq;
+        output[i].y = points[i].y_ * z_inv_sq * z_inv[i];
+    }
+}
+
+bool S256JacobianPoint::has_affine_x(const S256Field& x) const {
+    return !this->infinity_ && this->x_ == x * this->z_.square();
+}
+
+void S256JacobianPoint::conditional_assign(const S256JacobianPoint& other, const bool flag) {
+    this->x_.conditional_assign(other.x_, flag);
+    this->y_.conditional_assign(other.y_, flag);
+    this->z_.conditional_assign(other.z_, flag);
+    this->infinity_ = (this->infinity_ & !flag) | (other.infinity_ & flag);
+}
+
+bool S256JacobianPoint::infinity() const {
+    return this->infinity_;
+}
+
+S256JacobianPoint s256_multiply(const S256AffineCoords& p, const uint64_t scalar[4]) {
+    // Scan the scalar from the most significant bit, so that the addend is always the original point p, which
+    // stays affine and allows the cheaper mixed addition.
+    S256JacobianPoint result;
+    for (int i = 255; i >= 0; --i) {
+        result = result.double_point();
+        if ((scalar[i / 64] >> (i % 64)) & 1) {
+            result = result.add_affine(p);
+        }
+    }
+    return result;
+}
+
+const S256AffineCoords& s256_generator() {
+    return S256_GENERATOR;
+}
+
+/**
+ * @brief Get the table of S256PointTable for p, j * 16^i * p at index i * GENERATOR_WINDOW_SIZE + j - 1, the same
+ * layout as S256_GENERATOR_WINDOW_TABLE's
+ */
+static vector<S256AffineCoords> build_window_table(const S256AffineCoords& p) {
+    vector<S256JacobianPoint> multiples(GENERATOR_WINDOWS * GENERATOR_WINDOW_SIZE);
+    S256JacobianPoint base = S256JacobianPoint(p);
+    for (int i = 0; i < GENERATOR_WINDOWS; ++i) {
+        // base == 16^i * p
+        S256JacobianPoint multiple = base;
+        for (int j = 0; j < GENERATOR_WINDOW_SIZE; ++j) {
+            multiples[i * GENERATOR_WINDOW_SIZE + j] = multiple;
+            multiple = multiple.add(base);
+        }
+        for (int j = 0; j < GENERATOR_WINDOW_BITS; ++j) {
+            base = base.double_point();
+        }
+    }
+    vector<S256AffineCoords> table(multiples.size());
+    S256JacobianPoint::batch_to_affine(multiples.data(), multiples.size(), table.data());
+    return table;
+}
+
+static S256JacobianPoint multiply_with_window_table(const S256AffineCoords* table, const uint64_t scalar[4]) {
+    S256JacobianPoint result;
+    for (int i = 0; i < GENERATOR_WINDOWS; ++i) {
+        int bit = i * GENERATOR_WINDOW_BITS;
+        int window = (scalar[bit / 64] >> (bit % 64)) & GENERATOR_WINDOW_SIZE;
+        if (window != 0) {
+            result = result.add_affine(table[i * GENERATOR_WINDOW_SIZE + window - 1]);
+        }
+    }
+    return result;
+}
+
+S256JacobianPoint s256_multiply_generator(const uint64_t scalar[4]) {
+    return multiply_with_window_table(S256_GENERATOR_WINDOW_TABLE, scalar);
+}
+
+S256PointTable::S256PointTable(const S256AffineCoords& p) {
+    // The point at infinity times anything is itself, which an empty table stands for
+    if (!p.infinity) {
+        this->table_ = build_window_table(p);
+    }
+}
+
+S256JacobianPoint S256PointTable::multiply(const uint64_t scalar[4]) const {
+    if (this->table_.empty()) { return S256JacobianPoint(); }
+    return multiply_with_window_table(this->table_.data(), scalar);
+}
+
+size_t S256PointTable::memory_usage() const {
+    return sizeof(*this) + this->table_.capacity() * sizeof(S256AffineCoords);
+}
+
+/**
+ * @brief Get the width-w non-adjacent form of a scalar, i.e., digits naf[i] such that scalar = sum(naf[i] * 2^i),
+ * where each non-zero digit is odd, in (-2^(w-1), 2^(w-1)), and followed by at least w - 1 zero digits.
+ * @param naf an array of at least 257 digits
+ * @returns the number of digits, i.e., the index of the highest non-zero digit plus one
+ */
+static int get_wnaf(const uint64_t scalar[4], const int w, int naf[257]) {
+    // One extra limb, as rounding a negative digit up may carry past bit 255
+    uint64_t k[5] = {scalar[0], scalar[1], scalar[2], scalar[3], 0};
+    const uint64_t mask = (1ULL << w) - 1;
+    int len = 0;
+    for (int i = 0; i < 257; ++i) {
+        naf[i] = 0;
+        if ((k[0] | k[1] | k[2] | k[3] | k[4]) == 0) { continue; }
+        if (k[0] & 1) {
+            int digit = (int)(k[0] & mask);
+            k[0] &= ~mask;
+            if (digit >= (1 << (w - 1))) {
+                // k - digit == (k with its low w bits cleared) + 2^w
+                digit -= (1 << w);
+                uint64_t carry = 1ULL << w;
+                for (int j = 0; j < 5 && carry; ++j) {
+                    k[j] += carry;
+                    carry = k[j] < carry ? 1 : 0;
+                }
+            }
+            naf[i] = digit;
+            len = i + 1;
+        }
+        for (int j = 0; j < 4; ++j) {
+            k[j] = (k[j] >> 1) | (k[j + 1] << 63);
+        }
+        k[4] >>= 1;
+    }
+    return len;
+}
+
+/**
+ * @brief Fill table[i] with (2i + 1) * p for the 2^(JOINT_POINT_WNAF_WIDTH - 2) odd multiples a wNAF digit can pick
+ */
+static void build_point_odd_multiples(const S256AffineCoords& p, S256JacobianPoint table[]) {
+    table[0] = S256JacobianPoint(p);
+    S256JacobianPoint p2 = table[0].double_point();
+    for (int i = 1; i < (1 << (JOINT_POINT_WNAF_WIDTH - 2)); ++i) {
+        table[i] = table[i - 1].add(p2);
+    }
+}
+
+/**
+ * @brief Add digit * P to result, where table[i] == (2i + 1) * P and digit is an odd wNAF digit or 0
+ */
+static void add_wnaf_digit(S256JacobianPoint& result, const int digit, const S256AffineCoords* table) {
+    if (digit == 0) { return; }
+    const S256AffineCoords& addend = table[abs(digit) / 2];
+    if (digit > 0) {
+        result = result.add_affine(addend);
+    } else {
+        S256AffineCoords negated = addend;
+        negated.y = addend.y.negate();
+        result = result.add_affine(negated);
+    }
+}
+
+static void add_wnaf_digit(S256JacobianPoint& result, const int digit, const S256JacobianPoint* table) {
+    if (digit == 0) { return; }
+    const S256JacobianPoint& addend = table[abs(digit) / 2];
+    result = result.add(digit > 0 ? addend : addend.negate());
+}
+
+S256JacobianPoint s256_multiply_joint(
+    const uint64_t g_scalar[4], const S256AffineCoords& p, const uint64_t p_scalar[4]
+) {
+    int g_naf[257], p_naf[257];
+    int g_len = get_wnaf(g_scalar, JOINT_GENERATOR_WNAF_WIDTH, g_naf);
+    int p_len = p.infinity ? 0 : get_wnaf(p_scalar, JOINT_POINT_WNAF_WIDTH, p_naf);
+    S256JacobianPoint p_table[1 << (JOINT_POINT_WNAF_WIDTH - 2)];
+    if (p_len > 0) { build_point_odd_multiples(p, p_table); }
+
+    // Both scalars are scanned from the top together, so they share one chain of doublings.
+    S256JacobianPoint result;
+    for (int i = max(g_len, p_len) - 1; i >= 0; --i) {
+        result = result.double_point();
+        if (i < g_len) { add_wnaf_digit(result, g_naf[i], S256_GENERATOR_ODD_MULTIPLES); }
+        if (i < p_len) { add_wnaf_digit(result, p_naf[i], p_table); }
+    }
+    return result;
+}
+
+S256JacobianPoint S256JacobianPoint::endomorphism() const {
+    S256JacobianPoint result = *this;
+    if (!this->infinity_) {
+        result.x_ = this->x_ * s256_beta();
+    }
+    return result;
+}
+
+const S256Field& s256_beta() {
+    return S256_BETA;
+}
+
+/**
+ * @brief round(k * g / 2^384) for the 256-bit k and g, where the result is known to fit in 128 bits
+ */
+static void multiply_shift_384(const uint64_t k[4], const uint64_t g[4], uint64_t r[4]) {
+    uint64_t product[8];
+    s256_kernel().multiply_wide(k, g, product);
+    // Bit 383 rounds
+    u128 acc = (u128)product[6] + (product[5] >> 63);
+    r[0] = (uint64_t)acc; acc >>= 64;
+    acc += product[7];
+    r[1] = (uint64_t)acc;
+    r[2] = r[3] = 0;
+}
+
+void s256_split_scalar(const uint64_t scalar[4], uint64_t k1[4], bool& k1_negative, uint64_t k2[4],
+    bool& k2_negative) {
+    // A short basis (a1, b1), (a2, b2) of the lattice {(x, y): x + y * lambda ≡ 0 (mod n)}, see "Guide to Elliptic
+    // Curve Cryptography", section 3.5. Rounding k's coordinates in this basis gives the closest lattice vector
+    // (c1 * a1 + c2 * a2, c1 * b1 + c2 * b2), and k's distance from it is (k1, k2).
+    // c1 = round(b2 * k / n) and c2 = round(-b1 * k / n) are computed as round(k * g / 2^384), with
+    // g1 = round(2^384 * b2 / n) and g2 = round(2^384 * -b1 / n), which is exact enough to keep k1 and k2 within
+    // 128 bits and takes a multiplication and a shift instead of a 512-bit division.
+    static const uint64_t g1[4] = {
+        0xE893209A45DBB031ULL, 0x3DAA8A1471E8CA7FULL, 0xE86C90E49284EB15ULL, 0x3086D221A7D46BCDULL
+    };
+    static const uint64_t g2[4] = {
+        0x1571B4AE8AC47F71ULL, 0x221208AC9DF506C6ULL, 0x6F547FA90ABFE4C4ULL, 0xE4437ED6010E8828ULL
+    };
+    static const uint64_t minus_b1[4] = {0x6F547FA90ABFE4C3ULL, 0xE4437ED6010E8828ULL, 0, 0};
+    // -b2 mod n
+    static const uint64_t minus_b2[4] = {
+        0xD765CDA83DB1562CULL, 0x8A280AC50774346DULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL
+    };
+    static const uint64_t lambda[4] = {
+        0xDF02967C1B23BD72ULL, 0x122E22EA20816678ULL, 0xA5261C028812645AULL, 0x5363AD4CC05C30E0ULL
+    };
+    uint64_t c1[4], c2[4], t[4], r1[4], r2[4];
+    multiply_shift_384(scalar, g1, c1);
+    multiply_shift_384(scalar, g2, c2);
+    // k2 = -c1 * b1 - c2 * b2 and, as a1 ≡ -b1 * lambda and a2 ≡ -b2 * lambda, k1 = k - c1 * a1 - c2 * a2 ≡
+    // k - k2 * lambda (mod n)
+    s256_scalar_multiply(c1, minus_b1, r2);
+    s256_scalar_multiply(c2, minus_b2, t);
+    s256_scalar_add(r2, t, r2);
+    s256_scalar_multiply(r2, lambda, t);
+    s256_scalar_negate(t, t);
+    s256_scalar_add(scalar, t, r1);
+    // Both are short, so either they or their negations are, and the negative ones are those above n / 2
+    k1_negative = S256Scalar::from_limbs(r1).is_high();
+    k2_negative = S256Scalar::from_limbs(r2).is_high();
+    s256_scalar_negate(r1, t);
+    for (int i = 0; i < 4; ++i) { k1[i] = k1_negative ? t[i] : r1[i]; }
+    s256_scalar_negate(r2, t);
+    for (int i = 0; i < 4; ++i) { k2[i] = k2_negative ? t[i] : r2[i]; }
+}
+
+/**
+ * @brief Get the wNAF of one half of a split scalar, with the digits negated if the half is negative
+ */
+static int get_split_wnaf(const uint64_t half[4], const bool negative, const int w, int naf[257]) {
+    int len = get_wnaf(half, w, naf);
+    if (negative) {
+        for (int i = 0; i < len; ++i) { naf[i] = -naf[i]; }
+    }
+    return len;
+}
+
+S256JacobianPoint s256_multiply_glv(const S256AffineCoords& p, const uint64_t scalar[4]) {
+    if (p.infinity) { return S256JacobianPoint(); }
+    uint64_t k1[4], k2[4];
+    bool k1_negative, k2_negative;
+    s256_split_scalar(scalar, k1, k1_negative, k2, k2_negative);
+
+    int naf1[257], naf2[257];
+    int len1 = get_split_wnaf(k1, k1_negative, JOINT_POINT_WNAF_WIDTH, naf1);
+    int len2 = get_split_wnaf(k2, k2_negative, JOINT_POINT_WNAF_WIDTH, naf2);
+    // The odd multiples of lambda * p come almost for free: lambda * (X : Y : Z) == (beta * X : Y : Z)
+    S256JacobianPoint p_table[1 << (JOINT_POINT_WNAF_WIDTH - 2)], lambda_p_table[1 << (JOINT_POINT_WNAF_WIDTH - 2)];
+    build_point_odd_multiples(p, p_table);
+    for (int i = 0; i < (1 << (JOINT_POINT_WNAF_WIDTH - 2)); ++i) {
+        lambda_p_table[i] = p_table[i].endomorphism();
+    }
+
+    S256JacobianPoint result;
+    for (int i = max(len1, len2) - 1; i >= 0; --i) {
+        result = result.double_point();
+        if (i < len1) { add_wnaf_digit(result, naf1[i], p_table); }
+        if (i < len2) { add_wnaf_digit(result, naf2[i], lambda_p_table); }
+    }
+    return result;
+}
+
+S256JacobianPoint s256_multiply_joint_glv(
+    const uint64_t g_scalar[4], const S256AffineCoords& p, const uint64_t p_scalar[4]
+) {
+    uint64_t u1[4], u2[4], v1[4], v2[4];
+    bool u1_negative, u2_negative, v1_negative, v2_negative;
+    s256_split_scalar(g_scalar, u1, u1_negative, u2, u2_negative);
+    s256_split_scalar(p_scalar, v1, v1_negative, v2, v2_negative);
+
+    int u1_naf[257], u2_naf[257], v1_naf[257], v2_naf[257];
+    int u1_len = get_split_wnaf(u1, u1_negative, JOINT_GENERATOR_WNAF_WIDTH, u1_naf);
+    int u2_len = get_split_wnaf(u2, u2_negative, JOINT_GENERATOR_WNAF_WIDTH, u2_naf);
+    int v1_len = 0, v2_len = 0;
+    S256JacobianPoint p_table[1 << (JOINT_POINT_WNAF_WIDTH - 2)], lambda_p_table[1 << (JOINT_POINT_WNAF_WIDTH - 2)];
+    if (!p.infinity) {
+        v1_len = get_split_wnaf(v1, v1_negative, JOINT_POINT_WNAF_WIDTH, v1_naf);
+        v2_len = get_split_wnaf(v2, v2_negative, JOINT_POINT_WNAF_WIDTH, v2_naf);
+        build_point_odd_multiples(p, p_table);
+        for (int i = 0; i < (1 << (JOINT_POINT_WNAF_WIDTH - 2)); ++i) {
+            lambda_p_table[i] = p_table[i].endomorphism();
+        }
+    }
+
+    // Four ~128-bit scalars now share a chain of ~128 doublings, half as many as s256_multiply_joint() needs.
+    S256JacobianPoint result;
+    for (int i = max(max(u1_len, u2_len), max(v1_len, v2_len)) - 1; i >= 0; --i) {
+        result = result.double_point();
+        if (i < u1_len) { add_wnaf_digit(result, u1_naf[i], S256_GENERATOR_ODD_MULTIPLES); }
+        if (i < u2_len) { add_wnaf_digit(result, u2_naf[i], S256_LAMBDA_GENERATOR_ODD_MULTIPLES); }
+        if (i < v1_len) { add_wnaf_digit(result, v1_naf[i], p_table); }
+        if (i < v2_len) { add_wnaf_digit(result, v2_naf[i], lambda_p_table); }
+    }
+    return result;
+}
+
+/**
+ * @brief Recode a scalar into signed odd digits for the fixed-schedule multiplications, in constant time.
+ * An even scalar k is replaced by the odd n - k, as (n - k) * P == -(k * P), and the caller negates the result.
+ * The odd scalar is then rewritten as 16^64 + sum(digits[i] * 16^i), each digit odd and in [-15, 15].
+ * @param scalar the scalar as four little-endian 64-bit limbs, it has to be smaller than n
+ * @param digits an array of FIXED_WINDOWS digits
+ * @returns whether the scalar was even, i.e., the result has to be negated
+ */
+static bool get_regular_digits(const uint64_t scalar[4], int digits[FIXED_WINDOWS]) {
+    static const uint64_t n[4] = {
+        0xBFD25E8CD0364141ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL
+    };
+    bool even = !(scalar[0] & 1);
+    uint64_t mask = -(uint64_t)even;
+    uint64_t k[4];
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 diff = (u128)n[i] - scalar[i] - borrow;
+        borrow = (uint64_t)(diff >> 64) & 1;
+        k[i] = ((uint64_t)diff & mask) | (scalar[i] & ~mask);
+    }
+    for (int i = 0; i < FIXED_WINDOWS; ++i) {
+        // k is odd, so k mod 32 - 16 is odd and in [-15, 15], and k - digit is an odd multiple of 16
+        int digit = (int)(k[0] & 31) - 16;
+        digits[i] = digit;
+        // k = (k - digit) / 16, where -digit is added as a sign-extended 256-bit number
+        uint64_t addend = (uint64_t)(int64_t)(-digit);
+        uint64_t extension = (uint64_t)((int64_t)addend >> 63);
+        u128 acc = (u128)k[0] + addend;
+        k[0] = (uint64_t)acc; acc >>= 64;
+        for (int j = 1; j < 4; ++j) {
+            acc += (u128)k[j] + extension;
+            k[j] = (uint64_t)acc; acc >>= 64;
+        }
+        for (int j = 0; j < 3; ++j) {
+            k[j] = (k[j] >> FIXED_WINDOW_BITS) | (k[j + 1] << (64 - FIXED_WINDOW_BITS));
+        }
+        k[3] >>= FIXED_WINDOW_BITS;
+    }
+    // What remains of k is 1, the implicit top digit
+    return even;
+}
+
+/**
+ * @brief Pick digit * P from table[i] == (2i + 1) * P without branching on or indexing by the secret digit
+ */
+static S256AffineCoords lookup_fixed(const S256AffineCoords* table, const int digit) {
+    int index = (digit < 0 ? -digit : digit) / 2;
+    S256AffineCoords result = table[0];
+    for (int i = 1; i < FIXED_WINDOW_SIZE; ++i) {
+        result.x.conditional_assign(table[i].x, i == index);
+        result.y.conditional_assign(table[i].y, i == index);
+    }
+    result.y.conditional_assign(result.y.negate(), digit < 0);
+    return result;
+}
+
+static S256JacobianPoint lookup_fixed(const S256JacobianPoint* table, const int digit) {
+    int index = (digit < 0 ? -digit : digit) / 2;
+    S256JacobianPoint result = table[0];
+    for (int i = 1; i < FIXED_WINDOW_SIZE; ++i) {
+        result.conditional_assign(table[i], i == index);
+    }
+    result.conditional_assign(result.negate(), digit < 0);
+    return result;
+}
+
+S256JacobianPoint s256_multiply_fixed(const S256AffineCoords& p, const uint64_t scalar[4]) {
+    if (p.infinity) { return S256JacobianPoint(); }
+    int digits[FIXED_WINDOWS];
+    bool negate = get_regular_digits(scalar, digits);
+    // The same odd multiples as the wNAF of width 5 uses
+    S256JacobianPoint table[FIXED_WINDOW_SIZE];
+    build_point_odd_multiples(p, table);
+
+    // Start from the implicit top digit 1, i.e., p itself
+    S256JacobianPoint result = table[0];
+    for (int i = FIXED_WINDOWS - 1; i >= 0; --i) {
+        for (int j = 0; j < FIXED_WINDOW_BITS; ++j) {
+            result = result.double_point();
+        }
+        result = result.add(lookup_fixed(table, digits[i]));
+    }
+    result.conditional_assign(result.negate(), negate);
+    return result;
+}
+
+S256JacobianPoint s256_multiply_generator_fixed(const uint64_t scalar[4]) {
+    const S256AffineCoords* table = S256_GENERATOR_FIXED_TABLE;
+    int digits[FIXED_WINDOWS];
+    bool negate = get_regular_digits(scalar, digits);
+    S256JacobianPoint result = S256JacobianPoint(table[FIXED_WINDOWS * FIXED_WINDOW_SIZE]);
+    for (int i = 0; i < FIXED_WINDOWS; ++i) {
+        result = result.add_affine(lookup_fixed(&table[i * FIXED_WINDOW_SIZE], digits[i]));
+    }
+    result.conditional_assign(result.negate(), negate);
+    return result;
+}
@@ -0,0 +1,210 @@
+#ifndef GROUP_H
+#define GROUP_H
+
+#include <vector>
+
+#include "field.h"
+
+/**
+ * @brief Affine coordinates (x, y) of a point on secp256k1 (y^2 = x^3 + 7) in S256Field.
+ * The point at infinity has no coordinates, infinity is set instead.
+ */
+struct S256AffineCoords {
+  S256Field x;
+  S256Field y;
+  bool infinity = true;
+};
+
+/**
+ * @brief A point in 64 bytes, its affine x and y and nothing else, for keeping many points in memory.
+ * S256AffineCoords pads its infinity flag to 72 bytes, and an S256Point, with its four int512_t-based
+ * FieldElements and its S256AffineCoords, takes 464. (0, 0) is not on the curve (0 != 0^3 + 7), so it stands for
+ * the point at infinity.
+ */
+struct S256CompactPoint {
+  S256Field x;
+  S256Field y;
+  static S256CompactPoint from_affine(const S256AffineCoords& p);
+  S256AffineCoords to_affine() const;
+  bool infinity() const;
+};
+
+/**
+ * @brief A point on secp256k1 in Jacobian coordinates (X : Y : Z), which represents the affine point
+ * (X / Z^2, Y / Z^3).
+ * Adding or doubling affine points needs a modular inversion to get the slope, which costs about as much as a
+ * hundred multiplications. Jacobian coordinates carry the denominator in Z instead, so that a whole chain of
+ * additions and doublings only needs one inversion at the end, in to_affine().
+ */
+class S256JacobianPoint {
+protected:
+  S256Field x_;
+  S256Field y_;
+  S256Field z_;
+  bool infinity_ = true;
+public:
+  /**
+   * @brief Initialize the point at infinity
+   */
+  S256JacobianPoint();
+  /**
+   * @brief Initialize from affine coordinates, i.e., (x : y : 1)
+   */
+  explicit S256JacobianPoint(const S256AffineCoords& p);
+  /**
+   * @brief Get 2 * this, using the "dbl-2009-l" formulas for a = 0 curves (2M + 5S)
+   */
+  S256JacobianPoint double_point() const;
+  /**
+   * @brief Get this + other, using the "add-2007-bl" formulas (11M + 5S)
+   */
+  S256JacobianPoint add(const S256JacobianPoint& other) const;
+  /**
+   * @brief Get this + other where other is in affine coordinates (i.e., Z = 1), using the "madd-2007-bl"
+   * formulas (7M + 4S). This is the addition used by scalar multiplications as their addends can be kept affine.
+   */
+  S256JacobianPoint add_affine(const S256AffineCoords& other) const;
+  S256JacobianPoint negate() const;
+  /**
+   * @brief Get lambda * this, where lambda is a cube root of unity modulo n. On secp256k1 this is simply
+   * (beta * X : Y : Z), where beta is a cube root of unity modulo p, i.e., one multiplication.
+   */
+  S256JacobianPoint endomorphism() const;
+  /**
+   * @brief Convert the point back to affine coordinates. This costs one field inversion.
+   */
+  S256AffineCoords to_affine() const;
+  /**
+   * @brief Convert many points to affine coordinates at once, with S256Field::batch_inverse() inverting all the Z
+   * coordinates for the cost of a single inversion. If the kernel set in use has a SIMD kernel for it, e.g.,
+   * "avx512_ifma", the conversion runs eight points at a time, see S256Kernel::batch_to_affine.
+   * @param points an array of count points
+   * @param count the number of points
+   * @param output a pre-allocated array of count affine coordinates, output[i] is set to points[i].to_affine()
+   */
+  static void batch_to_affine(const S256JacobianPoint* points, const size_t count, S256AffineCoords* output);
+  /**
+   * @brief Check if the point's affine x coordinate equals x, without the inversion to_affine() needs, i.e.,
+   * X == x * Z^2. The point at infinity has no x coordinate, so it equals nothing.
+   */
+  bool has_affine_x(const S256Field& x) const;
+  /**
+   * @brief Set the point to other if flag is true, otherwise leave it unchanged, in constant time, see
+   * S256Field::conditional_assign()
+   */
+  void conditional_assign(const S256JacobianPoint& other, const bool flag);
+  bool infinity() const;
+};
+
+/**
+ * @brief Multiply a point by a scalar with left-to-right double-and-add in Jacobian coordinates
+ * @param p the point to be multiplied
+ * @param scalar the scalar as four little-endian 64-bit limbs
+ */
+S256JacobianPoint s256_multiply(const S256AffineCoords& p, const uint64_t scalar[4]);
+
+/**
+ * @brief Get secp256k1's generator point G
+ */
+const S256AffineCoords& s256_generator();
+
+/**
+ * @brief Multiply the generator point G by a scalar with a precomputed table.
+ * The table holds j * 16^i * G for each of the 64 4-bit windows i of a scalar and each non-zero window value j,
+ * so G * k is the sum of one table entry per window: 64 mixed additions and no doublings at all. The table
+ * (960 affine points) is compiled in, see precomputed.h.
+ * @param scalar the scalar as four little-endian 64-bit limbs
+ */
+S256JacobianPoint s256_multiply_generator(const uint64_t scalar[4]);
+
+/**
+ * @brief The window table of s256_multiply_generator() for an arbitrary point P, i.e., j * 16^i * P for each of the
+ * 64 4-bit windows i and each non-zero window value j, for a point that is multiplied often enough to pay for it,
+ * such as a public key that verifies many signatures. Building one takes about as long as 4 multiplications, after
+ * which P * k is 64 mixed additions and no doublings.
+ */
+class S256PointTable {
+protected:
+  std::vector<S256AffineCoords> table_;
+public:
+  explicit S256PointTable(const S256AffineCoords& p);
+  /**
+   * @param scalar the scalar as four little-endian 64-bit limbs
+   */
+  S256JacobianPoint multiply(const uint64_t scalar[4]) const;
+  /**
+   * @brief The number of bytes the table takes
+   */
+  size_t memory_usage() const;
+};
+
+/**
+ * @brief Multiply a point by a scalar with a fixed schedule, for secret scalars such as private keys and nonces.
+ * The scalar is recoded into 64 signed odd 4-bit digits (Joye and Tunstall's regular recoding), none of which is 0,
+ * so every call does exactly 256 doublings and 64 additions, and each addend is picked from the table of odd
+ * multiples by scanning the whole table with masks. The run time therefore doesn't depend on the scalar's bits,
+ * which removes both the latency jitter and the timing side channel of s256_multiply().
+ * @param p the point to be multiplied
+ * @param scalar the scalar as four little-endian 64-bit limbs, it has to be smaller than n
+ * @note The addition formulas still branch on exceptional cases (an operand at infinity, or both operands having
+ * the same x), which a partial sum only reaches with negligible probability for a scalar in [1, n).
+ */
+S256JacobianPoint s256_multiply_fixed(const S256AffineCoords& p, const uint64_t scalar[4]);
+
+/**
+ * @brief Multiply the generator point G by a scalar with a fixed schedule, the s256_multiply_fixed() counterpart of
+ * s256_multiply_generator(): its table holds the odd multiples (1, 3, ..., 15) * 16^i * G for each window i, so
+ * every call does exactly 64 mixed additions and no doublings, with every table lookup scanning all 8 entries.
+ * @param scalar the scalar as four little-endian 64-bit limbs, it has to be smaller than n
+ */
+S256JacobianPoint s256_multiply_generator_fixed(const uint64_t scalar[4]);
+
+/**
+ * @brief Get G * g_scalar + p * p_scalar with Strauss-Shamir's trick, i.e., both scalars are recoded into wNAF and
+ * scanned together from the most significant digit, so that the two multiplications share a single chain of 256
+ * doublings instead of doing one chain each. This is the shape of the computation in ECDSA verification.
+ * @param g_scalar the scalar of the generator point G as four little-endian 64-bit limbs
+ * @param p the other point
+ * @param p_scalar the scalar of p as four little-endian 64-bit limbs
+ */
+S256JacobianPoint s256_multiply_joint(
+  const uint64_t g_scalar[4], const S256AffineCoords& p, const uint64_t p_scalar[4]
+);
+
+/**
+ * @brief Get beta, the cube root of unity modulo p such that lambda * (x, y) == (beta * x, y)
+ */
+const S256Field& s256_beta();
+
+/**
+ * @brief Split a scalar k into k1 + k2 * lambda (mod n), where k1 and k2 are both about 128 bits long, so that
+ * p * k == p * k1 + (lambda * p) * k2 can be computed with half as many doublings.
+ * @param scalar k as four little-endian 64-bit limbs, it has to be smaller than n
+ * @param k1 |k1| as four little-endian 64-bit limbs
+ * @param k1_negative set to true if k1 is negative
+ * @param k2 |k2| as four little-endian 64-bit limbs
+ * @param k2_negative set to true if k2 is negative
+ */
+void s256_split_scalar(const uint64_t scalar[4], uint64_t k1[4], bool& k1_negative, uint64_t k2[4],
+  bool& k2_negative);
+
+/**
+ * @brief The same as s256_multiply(), but accelerated by secp256k1's GLV endomorphism: the scalar is split with
+ * s256_split_scalar() and both halves are scanned together in wNAF.
+ * @param p the point to be multiplied
+ * @param scalar the scalar as four little-endian 64-bit limbs, it has to be smaller than n
+ */
+S256JacobianPoint s256_multiply_glv(const S256AffineCoords& p, const uint64_t scalar[4]);
+
+/**
+ * @brief The same as s256_multiply_joint(), but accelerated by secp256k1's GLV endomorphism: each scalar is split
+ * into two halves, so that four ~128-bit scalars share one chain of ~128 doublings.
+ * @param g_scalar the scalar of G as four little-endian 64-bit limbs, it has to be smaller than n
+ * @param p the other point
+ * @param p_scalar the scalar of p as four little-endian 64-bit limbs, it has to be smaller than n
+ */
+S256JacobianPoint s256_multiply_joint_glv(
+  const uint64_t g_scalar[4], const S256AffineCoords& p, const uint64_t p_scalar[4]
+);
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef INT128_H
+#define INT128_H
+
+/**
+ * @brief 128-bit integers for the limb arithmetic, e.g., a 64x64-bit product with its carry. __int128 is a GCC/Clang
+ * extension, and __extension__ keeps -pedantic quiet about it.
+ */
+__extension__ typedef unsigned __int128 u128;
+__extension__ typedef __int128 i128;
+
+#endif
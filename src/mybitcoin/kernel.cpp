@@ -0,0 +1,592 @@
+#include <algorithm>
+#include <atomic>
+#include <string.h>
+#include <vector>
+
+#include "field_reduce.h"
+#include "int128.h"
+#include "kernel.h"
+#include "modinv.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define S256_MULX_KERNEL
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Reduce a 512-bit product modulo p.
+ * @param in the product in eight little-endian limbs
+ * @param r the reduced result in four little-endian limbs
+ */
+static void reduce_512(const uint64_t in[8], uint64_t r[4]) {
+    // First fold: in = hi * 2^256 + lo ≡ hi * S256_C + lo, which fits in 256 + 34 bits
+    u128 acc = 0;
+    for (int i = 0; i < 4; ++i) {
+        acc += (u128)in[4 + i] * S256_C + in[i];
+        r[i] = (uint64_t)acc; acc >>= 64;
+    }
+    // Second fold: the top limb (at most 34 bits long) is folded back the same way
+    acc = (u128)(uint64_t)acc * S256_C + r[0];
+    r[0] = (uint64_t)acc; acc >>= 64;
+    for (int i = 1; i < 4; ++i) {
+        acc += r[i];
+        r[i] = (uint64_t)acc; acc >>= 64;
+    }
+    // If it overflows again r must be tiny, so adding S256_C once more can't overflow
+    if (acc) {
+        acc = (u128)r[0] + S256_C;
+        r[0] = (uint64_t)acc; acc >>= 64;
+        for (int i = 1; i < 4 && acc; ++i) {
+            acc += r[i];
+            r[i] = (uint64_t)acc; acc >>= 64;
+        }
+    }
+    s256_field_reduce_once(r);
+}
+
+static void multiply_wide_portable(const uint64_t a[4], const uint64_t b[4], uint64_t product[8]) {
+    for (int i = 0; i < 8; ++i) { product[i] = 0; }
+    for (int i = 0; i < 4; ++i) {
+        u128 acc = 0;
+        for (int j = 0; j < 4; ++j) {
+            acc += (u128)a[i] * b[j] + product[i + j];
+            product[i + j] = (uint64_t)acc; acc >>= 64;
+        }
+        product[i + 4] = (uint64_t)acc;
+    }
+}
+
+static void field_multiply_portable(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]) {
+    uint64_t product[8];
+    multiply_wide_portable(a, b, product);
+    reduce_512(product, r);
+}
+
+static void field_square_portable(const uint64_t a[4], uint64_t r[4]) {
+    // Cross products a[i] * a[j] (i < j) are computed once and then doubled
+    uint64_t product[8] = {0};
+    for (int i = 0; i < 3; ++i) {
+        u128 acc = 0;
+        for (int j = i + 1; j < 4; ++j) {
+            acc += (u128)a[i] * a[j] + product[i + j];
+            product[i + j] = (uint64_t)acc; acc >>= 64;
+        }
+        product[i + 4] = (uint64_t)acc;
+    }
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; ++i) {
+        uint64_t next_carry = product[i] >> 63;
+        product[i] = (product[i] << 1) | carry;
+        carry = next_carry;
+    }
+    u128 acc = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 sq = (u128)a[i] * a[i];
+        acc += (u128)product[2 * i] + (uint64_t)sq;
+        product[2 * i] = (uint64_t)acc; acc >>= 64;
+        acc += (u128)product[2 * i + 1] + (uint64_t)(sq >> 64);
+        product[2 * i + 1] = (uint64_t)acc; acc >>= 64;
+    }
+    reduce_512(product, r);
+}
+
+static const S256Kernel portable_kernel = {
+    "portable", field_multiply_portable, field_square_portable, multiply_wide_portable, nullptr
+};
+
+#ifdef S256_MULX_KERNEL
+
+/*
+ * The MULX/ADX kernels are written in inline assembly: compilers don't keep ADCX's and ADOX's carries in separate
+ * flags when given _addcarryx_u64(), they serialize both chains through CF with SETC in between, which ends up
+ * slower than the portable kernels. MULX leaves the flags alone, so products can be computed between the additions
+ * of either chain.
+ */
+
+/**
+ * @brief Schoolbook 4x4 multiplication, one row per limb of a. In each row the low halves of the partial products
+ * are added with one carry chain (ADCX) and the high halves, one limb further up, with the other (ADOX). Only five
+ * limbs of the product are being accumulated at any time, so they rotate through five registers and each limb is
+ * stored as soon as it is final.
+ */
+static inline void multiply_wide_mulx(const uint64_t a[4], const uint64_t b[4], uint64_t product[8]) {
+    uint64_t r0, r1, r2, r3, r4, t0, t1, zero;
+    __asm__ volatile (
+        // Row 0: limbs 0-4 in r0-r4
+        "movq 0(%[a]), %%rdx\n\t"
+        "xorl %k[zero], %k[zero]\n\t"
+        "mulxq 0(%[b]), %[r0], %[r1]\n\t"
+        "mulxq 8(%[b]), %[t0], %[r2]\n\t"
+        "adcxq %[t0], %[r1]\n\t"
+        "mulxq 16(%[b]), %[t0], %[r3]\n\t"
+        "adcxq %[t0], %[r2]\n\t"
+        "mulxq 24(%[b]), %[t0], %[r4]\n\t"
+        "adcxq %[t0], %[r3]\n\t"
+        "adcxq %[zero], %[r4]\n\t"
+        "movq %[r0], 0(%[product])\n\t"
+        // Row 1: limbs 1-5 in r1-r4, r0
+        "movq 8(%[a]), %%rdx\n\t"
+        "xorl %k[t0], %k[t0]\n\t"
+        "mulxq 0(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r1]\n\t"
+        "adoxq %[t1], %[r2]\n\t"
+        "mulxq 8(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r2]\n\t"
+        "adoxq %[t1], %[r3]\n\t"
+        "mulxq 16(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r3]\n\t"
+        "adoxq %[t1], %[r4]\n\t"
+        "mulxq 24(%[b]), %[t0], %[r0]\n\t"
+        "adcxq %[t0], %[r4]\n\t"
+        "adoxq %[zero], %[r0]\n\t"
+        "adcxq %[zero], %[r0]\n\t"
+        "movq %[r1], 8(%[product])\n\t"
+        // Row 2: limbs 2-6 in r2-r4, r0, r1
+        "movq 16(%[a]), %%rdx\n\t"
+        "xorl %k[t0], %k[t0]\n\t"
+        "mulxq 0(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r2]\n\t"
+        "adoxq %[t1], %[r3]\n\t"
+        "mulxq 8(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r3]\n\t"
+        "adoxq %[t1], %[r4]\n\t"
+        "mulxq 16(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r4]\n\t"
+        "adoxq %[t1], %[r0]\n\t"
+        "mulxq 24(%[b]), %[t0], %[r1]\n\t"
+        "adcxq %[t0], %[r0]\n\t"
+        "adoxq %[zero], %[r1]\n\t"
+        "adcxq %[zero], %[r1]\n\t"
+        "movq %[r2], 16(%[product])\n\t"
+        // Row 3: limbs 3-7 in r3, r4, r0-r2
+        "movq 24(%[a]), %%rdx\n\t"
+        "xorl %k[t0], %k[t0]\n\t"
+        "mulxq 0(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r3]\n\t"
+        "adoxq %[t1], %[r4]\n\t"
+        "mulxq 8(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r4]\n\t"
+        "adoxq %[t1], %[r0]\n\t"
+        "mulxq 16(%[b]), %[t0], %[t1]\n\t"
+        "adcxq %[t0], %[r0]\n\t"
+        "adoxq %[t1], %[r1]\n\t"
+        "mulxq 24(%[b]), %[t0], %[r2]\n\t"
+        "adcxq %[t0], %[r1]\n\t"
+        "adoxq %[zero], %[r2]\n\t"
+        "adcxq %[zero], %[r2]\n\t"
+        "movq %[r3], 24(%[product])\n\t"
+        "movq %[r4], 32(%[product])\n\t"
+        "movq %[r0], 40(%[product])\n\t"
+        "movq %[r1], 48(%[product])\n\t"
+        "movq %[r2], 56(%[product])\n\t"
+        : [r0] "=&r" (r0), [r1] "=&r" (r1), [r2] "=&r" (r2), [r3] "=&r" (r3), [r4] "=&r" (r4),
+          [t0] "=&r" (t0), [t1] "=&r" (t1), [zero] "=&r" (zero)
+        : [a] "r" (a), [b] "r" (b), [product] "r" (product)
+        : "rdx", "cc", "memory"
+    );
+}
+
+/**
+ * @brief The cross products a[i] * a[j] (i < j) once, doubled, plus the squares a[i]^2 on the diagonal
+ */
+static inline void square_wide_mulx(const uint64_t a[4], uint64_t product[8]) {
+    uint64_t t1, t2, t3, t4, t5, t6, t7, x, y, zero;
+    __asm__ volatile (
+        // a[0] * a[1..3] in t1-t4
+        "movq 0(%[a]), %%rdx\n\t"
+        "xorl %k[zero], %k[zero]\n\t"
+        "mulxq 8(%[a]), %[t1], %[t2]\n\t"
+        "mulxq 16(%[a]), %[x], %[t3]\n\t"
+        "adcxq %[x], %[t2]\n\t"
+        "mulxq 24(%[a]), %[x], %[t4]\n\t"
+        "adcxq %[x], %[t3]\n\t"
+        "adcxq %[zero], %[t4]\n\t"
+        // a[1] * a[2..3] added to t3-t5
+        "movq 8(%[a]), %%rdx\n\t"
+        "mulxq 16(%[a]), %[x], %[y]\n\t"
+        "adcxq %[x], %[t3]\n\t"
+        "adoxq %[y], %[t4]\n\t"
+        "mulxq 24(%[a]), %[x], %[t5]\n\t"
+        "adcxq %[x], %[t4]\n\t"
+        "adoxq %[zero], %[t5]\n\t"
+        "adcxq %[zero], %[t5]\n\t"
+        // a[2] * a[3] added to t5-t6
+        "movq 16(%[a]), %%rdx\n\t"
+        "mulxq 24(%[a]), %[x], %[t6]\n\t"
+        "adcxq %[x], %[t5]\n\t"
+        "adcxq %[zero], %[t6]\n\t"
+        // Double the cross products
+        "movq %[zero], %[t7]\n\t"
+        "addq %[t1], %[t1]\n\t"
+        "adcq %[t2], %[t2]\n\t"
+        "adcq %[t3], %[t3]\n\t"
+        "adcq %[t4], %[t4]\n\t"
+        "adcq %[t5], %[t5]\n\t"
+        "adcq %[t6], %[t6]\n\t"
+        "adcq %[zero], %[t7]\n\t"
+        // Add the squares, limb 0 is just the low half of a[0]^2
+        "movq 0(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %[x], %[y]\n\t"
+        "movq %[x], 0(%[product])\n\t"
+        "addq %[y], %[t1]\n\t"
+        "movq 8(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %[x], %[y]\n\t"
+        "adcq %[x], %[t2]\n\t"
+        "adcq %[y], %[t3]\n\t"
+        "movq 16(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %[x], %[y]\n\t"
+        "adcq %[x], %[t4]\n\t"
+        "adcq %[y], %[t5]\n\t"
+        "movq 24(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %[x], %[y]\n\t"
+        "adcq %[x], %[t6]\n\t"
+        "adcq %[y], %[t7]\n\t"
+        "movq %[t1], 8(%[product])\n\t"
+        "movq %[t2], 16(%[product])\n\t"
+        "movq %[t3], 24(%[product])\n\t"
+        "movq %[t4], 32(%[product])\n\t"
+        "movq %[t5], 40(%[product])\n\t"
+        "movq %[t6], 48(%[product])\n\t"
+        "movq %[t7], 56(%[product])\n\t"
+        : [t1] "=&r" (t1), [t2] "=&r" (t2), [t3] "=&r" (t3), [t4] "=&r" (t4), [t5] "=&r" (t5), [t6] "=&r" (t6),
+          [t7] "=&r" (t7), [x] "=&r" (x), [y] "=&r" (y), [zero] "=&r" (zero)
+        : [a] "r" (a), [product] "r" (product)
+        : "rdx", "cc", "memory"
+    );
+}
+
+/**
+ * @brief Reduce a 512-bit product modulo p, the same folding as reduce_512() but with MULX and without branches
+ */
+static inline void reduce_512_mulx(const uint64_t in[8], uint64_t r[4]) {
+    uint64_t s0, s1, s2, s3, h0, h1, top, zero;
+    __asm__ volatile (
+        // First fold: s = in_lo + in_hi * S256_C, the products' low and high halves added in two passes
+        "movabsq $0x1000003D1, %%rdx\n\t"
+        "xorl %k[zero], %k[zero]\n\t"
+        "mulxq 32(%[in]), %[s0], %[h0]\n\t"
+        "mulxq 40(%[in]), %[s1], %[h1]\n\t"
+        "adcxq %[h0], %[s1]\n\t"
+        "mulxq 48(%[in]), %[s2], %[h0]\n\t"
+        "adcxq %[h1], %[s2]\n\t"
+        "mulxq 56(%[in]), %[s3], %[top]\n\t"
+        "adcxq %[h0], %[s3]\n\t"
+        "adcxq %[zero], %[top]\n\t"
+        "addq 0(%[in]), %[s0]\n\t"
+        "adcq 8(%[in]), %[s1]\n\t"
+        "adcq 16(%[in]), %[s2]\n\t"
+        "adcq 24(%[in]), %[s3]\n\t"
+        "adcq %[zero], %[top]\n\t"
+        // Second fold: the top limb (at most 34 bits long) is folded back the same way
+        "mulxq %[top], %[h0], %[h1]\n\t"
+        "addq %[h0], %[s0]\n\t"
+        "adcq %[h1], %[s1]\n\t"
+        "adcq %[zero], %[s2]\n\t"
+        "adcq %[zero], %[s3]\n\t"
+        // If it overflows again s must be tiny, so adding S256_C once more can't overflow
+        "movq %[zero], %[h0]\n\t"
+        "cmovcq %%rdx, %[h0]\n\t"
+        "addq %[h0], %[s0]\n\t"
+        "adcq %[zero], %[s1]\n\t"
+        "adcq %[zero], %[s2]\n\t"
+        "adcq %[zero], %[s3]\n\t"
+        // Subtract p once if s >= p, i.e., take s + S256_C if it overflows 2^256
+        "movq %[s0], %[h0]\n\t"
+        "addq %%rdx, %[h0]\n\t"
+        "movq %[s1], %[h1]\n\t"
+        "adcq %[zero], %[h1]\n\t"
+        "movq %[s2], %[top]\n\t"
+        "adcq %[zero], %[top]\n\t"
+        "movq %[s3], %%rdx\n\t"
+        "adcq %[zero], %%rdx\n\t"
+        "cmovcq %[h0], %[s0]\n\t"
+        "cmovcq %[h1], %[s1]\n\t"
+        "cmovcq %[top], %[s2]\n\t"
+        "cmovcq %%rdx, %[s3]\n\t"
+        "movq %[s0], 0(%[r])\n\t"
+        "movq %[s1], 8(%[r])\n\t"
+        "movq %[s2], 16(%[r])\n\t"
+        "movq %[s3], 24(%[r])\n\t"
+        : [s0] "=&r" (s0), [s1] "=&r" (s1), [s2] "=&r" (s2), [s3] "=&r" (s3), [h0] "=&r" (h0), [h1] "=&r" (h1),
+          [top] "=&r" (top), [zero] "=&r" (zero)
+        : [in] "r" (in), [r] "r" (r)
+        : "rdx", "cc", "memory"
+    );
+}
+
+static void multiply_wide_mulx_kernel(const uint64_t a[4], const uint64_t b[4], uint64_t product[8]) {
+    multiply_wide_mulx(a, b, product);
+}
+
+static void field_multiply_mulx(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]) {
+    uint64_t product[8];
+    multiply_wide_mulx(a, b, product);
+    reduce_512_mulx(product, r);
+}
+
+static void field_square_mulx(const uint64_t a[4], uint64_t r[4]) {
+    uint64_t product[8];
+    square_wide_mulx(a, product);
+    reduce_512_mulx(product, r);
+}
+
+static const S256Kernel mulx_kernel = {
+    "mulx_adx", field_multiply_mulx, field_square_mulx, multiply_wide_mulx_kernel, nullptr
+};
+
+static bool cpu_supports_mulx() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+}
+
+/*
+ * The AVX-512 IFMA kernels are compiled for their instruction set with a target attribute, function by function,
+ * rather than with -mavx512ifma for the whole file: inline functions and templates instantiated here could otherwise
+ * be picked by the linker for the rest of the library and run on CPUs without AVX-512.
+ */
+#define S256_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+static const uint64_t LIMB_MASK_52 = 0xFFFFFFFFFFFFFULL;
+// 2^260 ≡ S256_C * 2^4 (mod p)
+static const uint64_t S256_C_260 = S256_C << 4;
+
+/**
+ * @brief Eight field elements, one per 64-bit lane, in five 52-bit limbs: v[i] holds bits [52 * i, 52 * i + 52) of
+ * each element. The elements are not fully reduced, v[0..3] are below 2^52 and v[4] is at most 2^48, i.e., an element
+ * is below 2^256 + 2^208, as lanes_multiply() reduces only that far.
+ */
+struct S256Lanes {
+    __m512i v[5];
+};
+
+/**
+ * @brief x >> count and x << count, lane by lane. These are _mm512_srli_epi64() and _mm512_slli_epi64() with every
+ * lane selected: GCC 12 warns about the undefined vector those pass as the unselected lanes' source.
+ */
+static inline S256_IFMA_TARGET __m512i lanes_shift_right(const __m512i x, const unsigned int count) {
+    return _mm512_maskz_srli_epi64((__mmask8)0xFF, x, count);
+}
+
+static inline S256_IFMA_TARGET __m512i lanes_shift_left(const __m512i x, const unsigned int count) {
+    return _mm512_maskz_slli_epi64((__mmask8)0xFF, x, count);
+}
+
+/**
+ * @brief Propagate the carries of t[0..4] up, leaving t[0..3] below 2^52
+ */
+static inline S256_IFMA_TARGET void lanes_carry(__m512i t[5]) {
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK_52);
+    for (int i = 0; i < 4; ++i) {
+        t[i + 1] = _mm512_add_epi64(t[i + 1], lanes_shift_right(t[i], 52));
+        t[i] = _mm512_and_si512(t[i], mask);
+    }
+}
+
+/**
+ * @brief r = a * b mod p, lane by lane. r may be the same as a or b.
+ */
+static inline S256_IFMA_TARGET void lanes_multiply(const S256Lanes& a, const S256Lanes& b, S256Lanes& r) {
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK_52);
+    const __m512i c_260 = _mm512_set1_epi64(S256_C_260);
+    // Column i + j gets the low 52 bits of a[i] * b[j], column i + j + 1 the high 52 bits. No column exceeds 2^56.
+    // The low and high halves are summed separately, which halves the chains of dependent additions.
+    __m512i t[10], high[10];
+    for (int i = 0; i < 10; ++i) { t[i] = high[i] = _mm512_setzero_si512(); }
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], a.v[i], b.v[j]);
+            high[i + j + 1] = _mm512_madd52hi_epu64(high[i + j + 1], a.v[i], b.v[j]);
+        }
+    }
+    for (int i = 1; i < 10; ++i) { t[i] = _mm512_add_epi64(t[i], high[i]); }
+    // Carry t[4..8] up so that t[5..9], the part at and above 2^260, is in 52-bit limbs. t[9] stays below 2^45, as
+    // a[4] and b[4] are at most 2^48.
+    for (int i = 4; i < 9; ++i) {
+        t[i + 1] = _mm512_add_epi64(t[i + 1], lanes_shift_right(t[i], 52));
+        t[i] = _mm512_and_si512(t[i], mask);
+    }
+    // Fold it back with 2^260 ≡ S256_C_260: t[5 + i] * S256_C_260 is added to limbs i and i + 1. The high half of
+    // t[9]'s product lands at 2^260 again and is folded once more, it is below 2^30.
+    for (int i = 0; i < 4; ++i) {
+        t[i] = _mm512_madd52lo_epu64(t[i], t[5 + i], c_260);
+        t[i + 1] = _mm512_madd52hi_epu64(t[i + 1], t[5 + i], c_260);
+    }
+    t[4] = _mm512_madd52lo_epu64(t[4], t[9], c_260);
+    const __m512i over = _mm512_madd52hi_epu64(_mm512_setzero_si512(), t[9], c_260);
+    t[0] = _mm512_madd52lo_epu64(t[0], over, c_260);
+    t[1] = _mm512_madd52hi_epu64(t[1], over, c_260);
+    // The sum is below 2^262 now. The bits at and above 2^256 are folded back with 2^256 ≡ S256_C, which leaves
+    // t[4] at most 2^48 after the last carries.
+    lanes_carry(t);
+    const __m512i top = lanes_shift_right(t[4], 48);
+    t[4] = _mm512_and_si512(t[4], _mm512_set1_epi64(0xFFFFFFFFFFFFULL));
+    t[0] = _mm512_madd52lo_epu64(t[0], top, _mm512_set1_epi64(S256_C));
+    lanes_carry(t);
+    for (int i = 0; i < 5; ++i) { r.v[i] = t[i]; }
+}
+
+/**
+ * @brief The offsets, in limbs, of eight elements that are stride limbs apart, for gathers and scatters
+ */
+static inline S256_IFMA_TARGET __m512i lanes_index(const size_t stride) {
+    const long long s = (long long)stride;
+    return _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+}
+
+/**
+ * @brief Load count (at most 8) elements in four little-endian 64-bit limbs, stride limbs apart, into lanes
+ * [0, count). The remaining lanes are set to fill.
+ */
+static inline S256_IFMA_TARGET void lanes_load(const uint64_t* elements, const size_t stride, const size_t count,
+    const uint64_t fill, S256Lanes& r) {
+    const __mmask8 lanes = (__mmask8)((1u << count) - 1);
+    const __m512i index = lanes_index(stride);
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK_52);
+    __m512i n[4];
+    n[0] = _mm512_mask_i64gather_epi64(_mm512_set1_epi64(fill), lanes, index, elements, 8);
+    for (int i = 1; i < 4; ++i) {
+        n[i] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), lanes, index, elements + i, 8);
+    }
+    r.v[0] = _mm512_and_si512(n[0], mask);
+    r.v[1] = _mm512_and_si512(_mm512_or_si512(lanes_shift_right(n[0], 52), lanes_shift_left(n[1], 12)), mask);
+    r.v[2] = _mm512_and_si512(_mm512_or_si512(lanes_shift_right(n[1], 40), lanes_shift_left(n[2], 24)), mask);
+    r.v[3] = _mm512_and_si512(_mm512_or_si512(lanes_shift_right(n[2], 28), lanes_shift_left(n[3], 36)), mask);
+    r.v[4] = lanes_shift_right(n[3], 16);
+}
+
+/**
+ * @brief Store lanes [0, count) of a, fully reduced, as four little-endian 64-bit limbs, stride limbs apart
+ */
+static inline S256_IFMA_TARGET void lanes_store(const S256Lanes& a, const size_t count, uint64_t* elements,
+    const size_t stride) {
+    const __m512i mask_48 = _mm512_set1_epi64(0xFFFFFFFFFFFFULL);
+    const __m512i c = _mm512_set1_epi64(S256_C);
+    __m512i t[5], u[5];
+    for (int i = 0; i < 5; ++i) { t[i] = a.v[i]; }
+    // Bit 256 is folded back with 2^256 ≡ S256_C. If it is set, the bits below 2^208 are all that is left, so this
+    // brings t below 2^256.
+    const __m512i top = lanes_shift_right(t[4], 48);
+    t[4] = _mm512_and_si512(t[4], mask_48);
+    t[0] = _mm512_madd52lo_epu64(t[0], top, c);
+    lanes_carry(t);
+    // t >= p if and only if t + S256_C reaches 2^256, in which case t + S256_C - 2^256 is t - p
+    u[0] = _mm512_add_epi64(t[0], c);
+    for (int i = 1; i < 5; ++i) { u[i] = t[i]; }
+    lanes_carry(u);
+    const __mmask8 reduce = _mm512_test_epi64_mask(u[4], _mm512_set1_epi64(1ULL << 48));
+    u[4] = _mm512_and_si512(u[4], mask_48);
+    for (int i = 0; i < 5; ++i) { t[i] = _mm512_mask_blend_epi64(reduce, t[i], u[i]); }
+    __m512i n[4];
+    n[0] = _mm512_or_si512(t[0], lanes_shift_left(t[1], 52));
+    n[1] = _mm512_or_si512(lanes_shift_right(t[1], 12), lanes_shift_left(t[2], 40));
+    n[2] = _mm512_or_si512(lanes_shift_right(t[2], 24), lanes_shift_left(t[3], 28));
+    n[3] = _mm512_or_si512(lanes_shift_right(t[3], 36), lanes_shift_left(t[4], 16));
+    const __mmask8 lanes = (__mmask8)((1u << count) - 1);
+    const __m512i index = lanes_index(stride);
+    for (int i = 0; i < 4; ++i) { _mm512_mask_i64scatter_epi64(elements + i, lanes, index, n[i], 8); }
+}
+
+/**
+ * @brief Montgomery's trick (see S256Field::batch_inverse()) in eight chains, one per lane: lane l inverts the Z of
+ * points l, l + 8, l + 16, ... so that all the multiplications, 3 per point for the inversion and 4 for the
+ * conversion, are done eight at a time. The products of the eight chains are inverted with one scalar inversion.
+ */
+static S256_IFMA_TARGET void batch_to_affine_ifma(uint64_t* xyz, const size_t count) {
+    const size_t POINT_LIMBS = 12;
+    const size_t slots = (count + 7) / 8;
+    // prefix[s] is the product of the Zs of slots [0, s], five vectors per slot
+    vector<uint64_t> prefix(slots * 5 * 8);
+    S256Lanes acc, z, z_inv, z_inv_sq, coord;
+    acc.v[0] = _mm512_set1_epi64(1);
+    for (int i = 1; i < 5; ++i) { acc.v[i] = _mm512_setzero_si512(); }
+    for (size_t s = 0; s < slots; ++s) {
+        lanes_load(xyz + s * 8 * POINT_LIMBS + 8, POINT_LIMBS, min((size_t)8, count - s * 8), 1, z);
+        lanes_multiply(acc, z, acc);
+        for (int i = 0; i < 5; ++i) { _mm512_storeu_si512(&prefix[(s * 5 + i) * 8], acc.v[i]); }
+    }
+    uint64_t products[8][4], chain[8][4], inverses[8][4], inv[4];
+    lanes_store(acc, 8, products[0], 4);
+    memcpy(chain[0], products[0], sizeof(chain[0]));
+    for (int l = 1; l < 8; ++l) { field_multiply_mulx(chain[l - 1], products[l], chain[l]); }
+    s256_field_inverse(chain[7], inv);
+    for (int l = 7; l > 0; --l) {
+        field_multiply_mulx(inv, chain[l - 1], inverses[l]);
+        field_multiply_mulx(inv, products[l], inv);
+    }
+    memcpy(inverses[0], inv, sizeof(inv));
+    // acc is the inverse of prefix[s] at the start of each iteration, the same as in S256Field::batch_inverse()
+    lanes_load(inverses[0], 4, 8, 1, acc);
+    for (size_t s = slots; s-- > 0;) {
+        uint64_t* points = xyz + s * 8 * POINT_LIMBS;
+        const size_t lanes = min((size_t)8, count - s * 8);
+        lanes_load(points + 8, POINT_LIMBS, lanes, 1, z);
+        if (s > 0) {
+            S256Lanes previous;
+            for (int i = 0; i < 5; ++i) { previous.v[i] = _mm512_loadu_si512(&prefix[((s - 1) * 5 + i) * 8]); }
+            lanes_multiply(acc, previous, z_inv);
+        } else {
+            z_inv = acc;
+        }
+        lanes_multiply(acc, z, acc);
+        lanes_multiply(z_inv, z_inv, z_inv_sq);
+        lanes_load(points, POINT_LIMBS, lanes, 0, coord);
+        lanes_multiply(coord, z_inv_sq, coord);
+        lanes_store(coord, lanes, points, POINT_LIMBS);
+        lanes_multiply(z_inv_sq, z_inv, z_inv_sq);
+        lanes_load(points + 4, POINT_LIMBS, lanes, 0, coord);
+        lanes_multiply(coord, z_inv_sq, coord);
+        lanes_store(coord, lanes, points + 4, POINT_LIMBS);
+    }
+}
+
+static const S256Kernel ifma_kernel = {
+    "avx512_ifma", field_multiply_mulx, field_square_mulx, multiply_wide_mulx_kernel, batch_to_affine_ifma
+};
+
+static bool cpu_supports_ifma() {
+    return cpu_supports_mulx() && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+}
+
+#endif
+
+static const S256Kernel* detect_kernel() {
+#ifdef S256_MULX_KERNEL
+    if (cpu_supports_ifma()) { return &ifma_kernel; }
+    if (cpu_supports_mulx()) { return &mulx_kernel; }
+#endif
+    return &portable_kernel;
+}
+
+// A pointer constant-initialized to nullptr doesn't depend on the order of static initialization, so the kernels can
+// be used by other translation units' static objects, e.g., G.
+static atomic<const S256Kernel*> active_kernel(nullptr);
+
+const S256Kernel& s256_kernel() {
+    const S256Kernel* kernel = active_kernel.load(memory_order_relaxed);
+    if (kernel == nullptr) {
+        // Threads racing here all detect and store the same kernel
+        kernel = detect_kernel();
+        active_kernel.store(kernel, memory_order_relaxed);
+    }
+    return *kernel;
+}
+
+bool s256_select_kernel(const char* name) {
+    if (strcmp(name, portable_kernel.name) == 0) {
+        active_kernel.store(&portable_kernel, memory_order_relaxed);
+        return true;
+    }
+#ifdef S256_MULX_KERNEL
+    if (strcmp(name, mulx_kernel.name) == 0 && cpu_supports_mulx()) {
+        active_kernel.store(&mulx_kernel, memory_order_relaxed);
+        return true;
+    }
+    if (strcmp(name, ifma_kernel.name) == 0 && cpu_supports_ifma()) {
+        active_kernel.store(&ifma_kernel, memory_order_relaxed);
+        return true;
+    }
+#endif
+    return false;
+}
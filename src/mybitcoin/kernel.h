@@ -0,0 +1,55 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief A set of 256-bit multiplication kernels, i.e., the innermost loops of S256Field's multiplication and
+ * squaring and of the scalar arithmetic modulo n.
+ * Two sets are built: "portable", plain __int128 limb arithmetic that runs everywhere, and, on x86-64, "mulx_adx",
+ * which uses BMI2's MULX (a multiplication that leaves the flags alone) and ADX's ADCX/ADOX (two independent carry
+ * chains) so that the partial products of a row can be accumulated without serializing on a single carry flag. The
+ * latter needs Broadwell/Zen or later, so which set is used is decided by CPUID at run time instead of at compile
+ * time, and one binary runs at full speed on old and new hosts alike.
+ * A third set, "avx512_ifma", adds AVX-512 IFMA (VPMADD52LUQ/VPMADD52HUQ) kernels for bulk work on top of the MULX/ADX
+ * ones: they multiply eight field elements at once, in radix 2^52, one per 64-bit lane of a ZMM register.
+ */
+struct S256Kernel {
+  const char* name;
+  /**
+   * @brief r = a * b mod p, where a, b and r are four little-endian 64-bit limbs, a and b are in [0, p) and so is r
+   */
+  void (*field_multiply)(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]);
+  /**
+   * @brief r = a * a mod p, the same as field_multiply(a, a, r) but with the cross products computed once
+   */
+  void (*field_square)(const uint64_t a[4], uint64_t r[4]);
+  /**
+   * @brief The full 512-bit product of a and b in eight little-endian 64-bit limbs, without any reduction
+   */
+  void (*multiply_wide)(const uint64_t a[4], const uint64_t b[4], uint64_t product[8]);
+  /**
+   * @brief Convert count Jacobian points to affine coordinates in place, i.e., X = X / Z^2 and Y = Y / Z^3 mod p
+   * @param xyz count points, each as X, Y and Z in four little-endian 64-bit limbs (12 limbs per point). Z must not
+   * be zero. X and Y are overwritten by x and y, Z is left unchanged.
+   * @note nullptr unless the set has a SIMD kernel for it, S256JacobianPoint::batch_to_affine() does the conversion
+   * with field_multiply() otherwise
+   */
+  void (*batch_to_affine)(uint64_t* xyz, const size_t count);
+};
+
+/**
+ * @brief Get the kernel set in use. Unless s256_select_kernel() is called first, the fastest set the CPU supports is
+ * picked the first time this is called.
+ */
+const S256Kernel& s256_kernel();
+
+/**
+ * @brief Use the kernel set with the given name, mainly for tests and benchmarks that compare the sets
+ * @param name "portable", "mulx_adx" or "avx512_ifma"
+ * @returns false, leaving the kernel set in use unchanged, if there is no such set or the CPU doesn't support it
+ */
+bool s256_select_kernel(const char* name);
+
+#endif
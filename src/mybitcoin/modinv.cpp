@@ -0,0 +1,191 @@
+#include "int128.h"
+#include "modinv.h"
+
+static const uint64_t M62 = UINT64_MAX >> 2;
+
+/**
+ * @brief A signed number in five 62-bit limbs, i.e., v[0] + v[1] * 2^62 + ... + v[4] * 2^248. The limbs are
+ * signed, so intermediate values can go negative without any carry handling until they are normalized.
+ */
+struct Signed62 {
+    int64_t v[5];
+};
+
+/**
+ * @brief A modulus and its inverse modulo 2^62, which update_de() uses to keep d and e divisible by 2^62
+ */
+struct ModInfo {
+    Signed62 modulus;
+    uint64_t modulus_inv62;
+};
+
+static const ModInfo S256_PRIME_INFO = {
+    {{0x3FFFFFFEFFFFFC2FLL, 0x3FFFFFFFFFFFFFFFLL, 0x3FFFFFFFFFFFFFFFLL, 0x3FFFFFFFFFFFFFFFLL, 0xFF}},
+    0x27C7F6E22DDACACFULL
+};
+
+static const ModInfo S256_ORDER_INFO = {
+    {{0x3FD25E8CD0364141LL, 0x2ABB739ABD2280EELL, 0x3FFFFFFFFFFFFFEBLL, 0x3FFFFFFFFFFFFFFFLL, 0xFF}},
+    0x34F20099AA774EC1ULL
+};
+
+/**
+ * @brief The 2x2 transition matrix of a batch of divsteps, scaled by 2^62: [f', g'] = [[u, v], [q, r]] * [f, g]
+ * / 2^62.
+ */
+struct Transition {
+    int64_t u, v, q, r;
+};
+
+/**
+ * @brief Run 59 divsteps on the lowest 64 bits of f and g, which are all that 59 divsteps depend on, and get
+ * their combined transition matrix.
+ * @param zeta -(delta + 1/2), where delta is the divstep's state variable
+ * @returns the new zeta
+ */
+static int64_t divsteps_59(int64_t zeta, const uint64_t f0, const uint64_t g0, Transition& t) {
+    // The matrix starts as the identity scaled by 8, so that it ends up scaled by 2^(3 + 59) = 2^62. Its entries
+    // are kept unsigned so that left shifts of negative numbers are well-defined.
+    uint64_t u = 8, v = 0, q = 0, r = 8;
+    uint64_t f = f0, g = g0;
+    for (int i = 3; i < 62; ++i) {
+        // c1: zeta < 0, i.e., delta > 0; c2: g is odd
+        uint64_t c1 = (uint64_t)(zeta >> 63);
+        uint64_t c2 = -(g & 1);
+        // If g is odd, g += (delta > 0 ? -f : f)
+        uint64_t x = (f ^ c1) - c1;
+        uint64_t y = (u ^ c1) - c1;
+        uint64_t z = (v ^ c1) - c1;
+        g += x & c2;
+        q += y & c2;
+        r += z & c2;
+        // If both, f takes g's old value and delta becomes -delta, i.e., zeta becomes -zeta - 2
+        c1 &= c2;
+        zeta = (zeta ^ (int64_t)c1) - 1;
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t.u = (int64_t)u;
+    t.v = (int64_t)v;
+    t.q = (int64_t)q;
+    t.r = (int64_t)r;
+    return zeta;
+}
+
+/**
+ * @brief Apply the transition matrix to f and g: [f, g] = t * [f, g] / 2^62. The division is exact.
+ */
+static void update_fg(Signed62& f, Signed62& g, const Transition& t) {
+    i128 cf = (i128)t.u * f.v[0] + (i128)t.v * g.v[0];
+    i128 cg = (i128)t.q * f.v[0] + (i128)t.r * g.v[0];
+    cf >>= 62;
+    cg >>= 62;
+    for (int i = 1; i < 5; ++i) {
+        cf += (i128)t.u * f.v[i] + (i128)t.v * g.v[i];
+        cg += (i128)t.q * f.v[i] + (i128)t.r * g.v[i];
+        f.v[i - 1] = (int64_t)cf & M62; cf >>= 62;
+        g.v[i - 1] = (int64_t)cg & M62; cg >>= 62;
+    }
+    f.v[4] = (int64_t)cf;
+    g.v[4] = (int64_t)cg;
+}
+
+/**
+ * @brief Apply the transition matrix to d and e modulo the modulus: [d, e] = t * [d, e] / 2^62 (mod m). Multiples
+ * of the modulus are added first to make t * [d, e] divisible by 2^62, so that the division is exact as well.
+ * d and e stay in (-2 * m, m).
+ */
+static void update_de(Signed62& d, Signed62& e, const Transition& t, const ModInfo& info) {
+    const int64_t d0 = d.v[0], e0 = e.v[0];
+    // md and me start as zero, plus [u, q] if d is negative, plus [v, r] if e is negative
+    int64_t sd = d.v[4] >> 63;
+    int64_t se = e.v[4] >> 63;
+    int64_t md = (t.u & sd) + (t.v & se);
+    int64_t me = (t.q & sd) + (t.r & se);
+    i128 cd = (i128)t.u * d0 + (i128)t.v * e0;
+    i128 ce = (i128)t.q * d0 + (i128)t.r * e0;
+    // Correct md and me so that t * [d, e] + m * [md, me] has 62 zero bottom bits
+    md -= (int64_t)((info.modulus_inv62 * (uint64_t)cd + (uint64_t)md) & M62);
+    me -= (int64_t)((info.modulus_inv62 * (uint64_t)ce + (uint64_t)me) & M62);
+    cd += (i128)info.modulus.v[0] * md;
+    ce += (i128)info.modulus.v[0] * me;
+    cd >>= 62;
+    ce >>= 62;
+    for (int i = 1; i < 5; ++i) {
+        cd += (i128)t.u * d.v[i] + (i128)t.v * e.v[i] + (i128)info.modulus.v[i] * md;
+        ce += (i128)t.q * d.v[i] + (i128)t.r * e.v[i] + (i128)info.modulus.v[i] * me;
+        d.v[i - 1] = (int64_t)cd & M62; cd >>= 62;
+        e.v[i - 1] = (int64_t)ce & M62; ce >>= 62;
+    }
+    d.v[4] = (int64_t)cd;
+    e.v[4] = (int64_t)ce;
+}
+
+/**
+ * @brief Carry each limb's bits above the 62nd into the next one, bringing limbs 0..3 back to [0, 2^62)
+ */
+static void propagate_carries(int64_t r[5]) {
+    for (int i = 0; i < 4; ++i) {
+        r[i + 1] += r[i] >> 62;
+        r[i] &= M62;
+    }
+}
+
+/**
+ * @brief Bring r from (-2 * m, m) to [0, m), negating it (modulo m) if sign is negative. Conditions are applied
+ * with masks so that this is constant-time as well.
+ */
+static void normalize(Signed62& r, const int64_t sign, const ModInfo& info) {
+    // Add m if r is negative, then negate r if requested, which brings r to (-m, m)
+    int64_t cond_add = r.v[4] >> 63;
+    for (int i = 0; i < 5; ++i) { r.v[i] += info.modulus.v[i] & cond_add; }
+    int64_t cond_negate = sign >> 63;
+    for (int i = 0; i < 5; ++i) { r.v[i] = (r.v[i] ^ cond_negate) - cond_negate; }
+    propagate_carries(r.v);
+    // Add m again if r is still negative, which brings r to [0, m)
+    cond_add = r.v[4] >> 63;
+    for (int i = 0; i < 5; ++i) { r.v[i] += info.modulus.v[i] & cond_add; }
+    propagate_carries(r.v);
+}
+
+static void modinv(const uint64_t num[4], uint64_t inverse[4], const ModInfo& info) {
+    // d and e track the coefficients with d * num ≡ f and e * num ≡ g (mod m), scaled by the powers of 2 the
+    // divsteps divide f and g by.
+    Signed62 d = {{0, 0, 0, 0, 0}};
+    Signed62 e = {{1, 0, 0, 0, 0}};
+    Signed62 f = info.modulus;
+    Signed62 g = {{
+        (int64_t)(num[0] & M62),
+        (int64_t)(((num[0] >> 62) | (num[1] << 2)) & M62),
+        (int64_t)(((num[1] >> 60) | (num[2] << 4)) & M62),
+        (int64_t)(((num[2] >> 58) | (num[3] << 6)) & M62),
+        (int64_t)(num[3] >> 56)
+    }};
+    // zeta = -(delta + 1/2), delta starts at 1/2
+    int64_t zeta = -1;
+    // 590 divsteps are enough for g to reach 0 for any 256-bit input, at which point f is ±gcd(m, num) = ±1 and d
+    // is ±num's inverse.
+    for (int i = 0; i < 10; ++i) {
+        Transition t;
+        zeta = divsteps_59(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], t);
+        update_de(d, e, t, info);
+        update_fg(f, g, t);
+    }
+    normalize(d, f.v[4], info);
+    inverse[0] = (uint64_t)d.v[0] | ((uint64_t)d.v[1] << 62);
+    inverse[1] = ((uint64_t)d.v[1] >> 2) | ((uint64_t)d.v[2] << 60);
+    inverse[2] = ((uint64_t)d.v[2] >> 4) | ((uint64_t)d.v[3] << 58);
+    inverse[3] = ((uint64_t)d.v[3] >> 6) | ((uint64_t)d.v[4] << 56);
+}
+
+void s256_field_inverse(const uint64_t num[4], uint64_t inverse[4]) {
+    modinv(num, inverse, S256_PRIME_INFO);
+}
+
+void s256_scalar_inverse(const uint64_t num[4], uint64_t inverse[4]) {
+    modinv(num, inverse, S256_ORDER_INFO);
+}
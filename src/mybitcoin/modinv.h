@@ -0,0 +1,30 @@
+#ifndef MODINV_H
+#define MODINV_H
+
+#include <stdint.h>
+
+/**
+ * @brief Modular inverses modulo secp256k1's prime p and group order n with Bernstein and Yang's "safegcd"
+ * algorithm (https://gcd.cr.yp.to/safegcd-20190413.pdf).
+ * Inverting by Fermat's little theorem (num^(m-2)) takes ~256 squarings plus ~128 multiplications, and
+ * boost::integer::mod_inverse()'s extended Euclidean algorithm branches on the data. safegcd instead runs a fixed
+ * 590 "divsteps", 59 at a time on 64-bit words, with masks instead of branches, so it is both several times
+ * faster and constant-time, i.e., its timing doesn't leak the (possibly secret) input.
+ * @note The inverse of 0 (or of anything divisible by the modulus) is 0.
+ */
+
+/**
+ * @brief Get the inverse of num modulo p
+ * @param num a number in [0, p) as four little-endian 64-bit limbs
+ * @param inverse the inverse in [0, p) as four little-endian 64-bit limbs. It may point to the same array as num.
+ */
+void s256_field_inverse(const uint64_t num[4], uint64_t inverse[4]);
+
+/**
+ * @brief Get the inverse of num modulo n
+ * @param num a number in [0, n) as four little-endian 64-bit limbs
+ * @param inverse the inverse in [0, n) as four little-endian 64-bit limbs. It may point to the same array as num.
+ */
+void s256_scalar_inverse(const uint64_t num[4], uint64_t inverse[4]);
+
+#endif
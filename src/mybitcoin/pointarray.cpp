@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#include "pointarray.h"
+#include "utils.h"
+
+S256PointArray::S256PointArray() {}
+
+void S256PointArray::reserve(const size_t count) {
+    this->x_.reserve(count);
+    this->y_.reserve(count);
+}
+
+size_t S256PointArray::size() const {
+    return this->x_.size();
+}
+
+size_t S256PointArray::memory_usage() const {
+    return sizeof(*this) + (this->x_.capacity() + this->y_.capacity()) * sizeof(S256Field);
+}
+
+void S256PointArray::push_back(const S256AffineCoords& p) {
+    this->push_back(S256CompactPoint::from_affine(p));
+}
+
+void S256PointArray::push_back(const S256CompactPoint& p) {
+    this->x_.push_back(p.x);
+    this->y_.push_back(p.y);
+}
+
+void S256PointArray::push_back(const S256Point& p) {
+    this->push_back(p.affine_coords());
+}
+
+size_t S256PointArray::append_sec(const uint8_t* secs, const size_t sec_len, const size_t count, bool* results,
+    unsigned int threads) {
+    const size_t offset = this->x_.size();
+    // The new points start out as (0, 0), i.e., at infinity, which is what invalid keys are left as
+    this->x_.resize(offset + count);
+    this->y_.resize(offset + count);
+    atomic<size_t> valid(0);
+    run_in_chunks(count, threads, [&](const size_t begin, const size_t end) {
+        // Counted locally, so that the workers touch the shared counter once each
+        size_t chunk_valid = 0;
+        S256AffineCoords coords;
+        for (size_t i = begin; i < end; ++i) {
+            bool result = S256Point::parse_sec(secs + i * sec_len, sec_len, coords);
+            if (result) {
+                this->x_[offset + i] = coords.x;
+                this->y_[offset + i] = coords.y;
+                ++chunk_valid;
+            }
+            if (results != nullptr) { results[i] = result; }
+        }
+        valid += chunk_valid;
+    });
+    return valid;
+}
+
+void S256PointArray::set(const size_t i, const S256AffineCoords& p) {
+    if (i >= this->x_.size()) {
+        throw invalid_argument("index [" + std::to_string(i) + "] is out of range");
+    }
+    S256CompactPoint compact = S256CompactPoint::from_affine(p);
+    this->x_[i] = compact.x;
+    this->y_[i] = compact.y;
+}
+
+S256CompactPoint S256PointArray::get(const size_t i) const {
+    if (i >= this->x_.size()) {
+        throw invalid_argument("index [" + std::to_string(i) + "] is out of range");
+    }
+    S256CompactPoint result;
+    result.x = this->x_[i];
+    result.y = this->y_[i];
+    return result;
+}
+
+S256AffineCoords S256PointArray::affine_coords(const size_t i) const {
+    return this->get(i).to_affine();
+}
+
+S256Point S256PointArray::point(const size_t i) const {
+    return S256Point(this->affine_coords(i));
+}
+
+size_t S256PointArray::get_sec_format(const size_t i, const bool compressed, uint8_t* output) const {
+    const size_t KEY_SIZE = 32;
+    S256CompactPoint p = this->get(i);
+    if (p.infinity()) {
+        throw invalid_argument("the point at infinity has no SEC format");
+    }
+    p.x.get_bytes(output + 1);
+    if (compressed) {
+        output[0] = p.y.is_odd() ? 0x03 : 0x02;
+        return S256Point::SEC_COMPRESSED_LEN;
+    }
+    output[0] = 0x04;
+    p.y.get_bytes(output + 1 + KEY_SIZE);
+    return S256Point::SEC_UNCOMPRESSED_LEN;
+}
+
+const S256Field* S256PointArray::xs() const {
+    return this->x_.data();
+}
+
+const S256Field* S256PointArray::ys() const {
+    return this->y_.data();
+}
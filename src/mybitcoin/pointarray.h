@@ -0,0 +1,69 @@
+#ifndef POINTARRAY_H
+#define POINTARRAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "ecc.h"
+
+/**
+ * @brief A growable array of points, e.g., all the public keys a block indexer has seen, at 64 bytes per point
+ * instead of an S256Point's 464.
+ * The points are kept in structure-of-arrays layout: all the x coordinates in one contiguous array and all the y
+ * coordinates in another, so a scan that only needs x (or only the parity of y) touches half the memory. Points
+ * are converted to S256AffineCoords, S256CompactPoint or S256Point only when they are read. As in S256CompactPoint,
+ * (0, 0) stands for the point at infinity.
+ */
+class S256PointArray {
+protected:
+  std::vector<S256Field> x_;
+  std::vector<S256Field> y_;
+public:
+  S256PointArray();
+  void reserve(const size_t count);
+  size_t size() const;
+  /**
+   * @brief The number of bytes the array takes, including the capacity reserved for points not added yet
+   */
+  size_t memory_usage() const;
+  void push_back(const S256AffineCoords& p);
+  void push_back(const S256CompactPoint& p);
+  void push_back(const S256Point& p);
+  /**
+   * @brief Append count SEC public keys, see S256Point::parse_sec_batch(). An invalid key is appended as the point
+   * at infinity, so that the key in secs[i] is always at size() + i, where size() is the one before the call.
+   * @param secs count keys of sec_len bytes each, back to back
+   * @param sec_len 33 (compressed) or 65 (uncompressed), the same for all keys
+   * @param count the number of keys
+   * @param results nullptr, or a pre-allocated array of count bools, results[i] is set to whether secs[i] is valid
+   * @param threads the number of worker threads, including the calling one. 0 means one per hardware thread.
+   * @returns the number of valid keys
+   */
+  size_t append_sec(const uint8_t* secs, const size_t sec_len, const size_t count, bool* results,
+    unsigned int threads = 1);
+  // set(), get() and the other accessors of point i throw invalid_argument if i is not smaller than size()
+  void set(const size_t i, const S256AffineCoords& p);
+  S256CompactPoint get(const size_t i) const;
+  S256AffineCoords affine_coords(const size_t i) const;
+  /**
+   * @brief Get point i as an S256Point, e.g., to verify a signature with it
+   */
+  S256Point point(const size_t i) const;
+  /**
+   * @brief Write point i in SEC format to output, see S256Point::get_sec_format()
+   * @returns the number of bytes written to output
+   * @throw invalid_argument if point i is the point at infinity, which has no SEC format
+   */
+  size_t get_sec_format(const size_t i, const bool compressed, uint8_t* output) const;
+  /**
+   * @brief The x coordinates of all the points, size() of them, for scans that don't need y
+   */
+  const S256Field* xs() const;
+  /**
+   * @brief The y coordinates of all the points, size() of them
+   */
+  const S256Field* ys() const;
+};
+
+#endif
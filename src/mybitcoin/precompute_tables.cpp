@@ -0,0 +1,98 @@
+/**
+ * @brief Print precomputed.cpp, the tables of precomputed.h, to stdout. Only the point arithmetic of group.h is
+ * used, never the tables themselves, so the output doesn't depend on the precomputed.cpp that is compiled in.
+ */
+#include <cinttypes>
+#include <stdio.h>
+#include <vector>
+
+#include "precomputed.h"
+
+using namespace std;
+
+static vector<S256AffineCoords> to_affine(const vector<S256JacobianPoint>& points) {
+    vector<S256AffineCoords> table(points.size());
+    S256JacobianPoint::batch_to_affine(points.data(), points.size(), table.data());
+    return table;
+}
+
+static vector<S256AffineCoords> build_window_table() {
+    vector<S256JacobianPoint> multiples;
+    S256JacobianPoint base = S256JacobianPoint(s256_generator());
+    for (int i = 0; i < 64; ++i) {
+        // base == 16^i * G
+        S256JacobianPoint multiple = base;
+        for (int j = 1; j < 16; ++j) {
+            multiples.push_back(multiple);
+            multiple = multiple.add(base);
+        }
+        for (int j = 0; j < 4; ++j) { base = base.double_point(); }
+    }
+    return to_affine(multiples);
+}
+
+static vector<S256AffineCoords> build_odd_multiples() {
+    vector<S256JacobianPoint> multiples;
+    S256JacobianPoint g = S256JacobianPoint(s256_generator());
+    S256JacobianPoint g2 = g.double_point();
+    for (size_t i = 0; i < S256_GENERATOR_ODD_MULTIPLES_SIZE; ++i) {
+        // g == (2i + 1) * G
+        multiples.push_back(g);
+        g = g.add(g2);
+    }
+    return to_affine(multiples);
+}
+
+static vector<S256AffineCoords> build_lambda_odd_multiples() {
+    vector<S256AffineCoords> table = build_odd_multiples();
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i].x = table[i].x * s256_beta();
+    }
+    return table;
+}
+
+static vector<S256AffineCoords> build_fixed_table() {
+    vector<S256JacobianPoint> multiples;
+    S256JacobianPoint base = S256JacobianPoint(s256_generator());
+    for (int i = 0; i < 64; ++i) {
+        // base == 16^i * G
+        S256JacobianPoint base2 = base.double_point();
+        S256JacobianPoint multiple = base;
+        for (int j = 0; j < 8; ++j) {
+            multiples.push_back(multiple);
+            multiple = multiple.add(base2);
+        }
+        for (int j = 0; j < 4; ++j) { base = base.double_point(); }
+    }
+    multiples.push_back(base);
+    return to_affine(multiples);
+}
+
+static void print_field(const S256Field& fe) {
+    const uint64_t* limbs = fe.limbs();
+    printf("S256Field(0x%016" PRIX64 "ULL, 0x%016" PRIX64 "ULL, 0x%016" PRIX64 "ULL, 0x%016" PRIX64 "ULL)", limbs[0],
+        limbs[1], limbs[2], limbs[3]);
+}
+
+static void print_table(const char* name, const char* size, const vector<S256AffineCoords>& table) {
+    printf("\nconstexpr S256AffineCoords %s[%s] = {\n", name, size);
+    for (size_t i = 0; i < table.size(); ++i) {
+        printf("    {");
+        print_field(table[i].x);
+        printf(",\n     ");
+        print_field(table[i].y);
+        printf(", false}%s\n", i + 1 < table.size() ? "," : "");
+    }
+    printf("};\n");
+}
+
+int main() {
+    printf("// Generated by precompute_tables.cpp, do not edit.\n");
+    printf("#include \"precomputed.h\"\n");
+    print_table("S256_GENERATOR_WINDOW_TABLE", "S256_GENERATOR_WINDOW_TABLE_SIZE", build_window_table());
+    print_table("S256_GENERATOR_ODD_MULTIPLES", "S256_GENERATOR_ODD_MULTIPLES_SIZE", build_odd_multiples());
+    print_table("S256_LAMBDA_GENERATOR_ODD_MULTIPLES", "S256_GENERATOR_ODD_MULTIPLES_SIZE",
+        build_lambda_odd_multiples());
+    print_table("S256_GENERATOR_FIXED_TABLE", "S256_GENERATOR_FIXED_TABLE_SIZE", build_fixed_table());
+    return 0;
+}
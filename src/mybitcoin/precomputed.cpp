@@ -0,0 +1,3216 @@
+// Generated by precompute_tables.cpp, do not edit.
+#include "precomputed.h"
+
+constexpr S256AffineCoords S256_GENERATOR_WINDOW_TABLE[S256_GENERATOR_WINDOW_TABLE_SIZE] = {
+    {S256Field(0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL, 0x79BE667EF9DCBBACULL),
+     S256Field(0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL), false},
+    {S256Field(0xABAC09B95C709EE5ULL, 0x5C778E4B8CEF3CA7ULL, 0x3045406E95C07CD8ULL, 0xC6047F9441ED7D6DULL),
+     S256Field(0x236431A950CFE52AULL, 0xF7F632653266D0E1ULL, 0xA3C58419466CEAEEULL, 0x1AE168FEA63DC339ULL), false},
+    {S256Field(0x8601F113BCE036F9ULL, 0xB531C845836F99B0ULL, 0x49344F85F89D5229ULL, 0xF9308A019258C310ULL),
+     S256Field(0x6CB9FD7584B8E672ULL, 0x6500A99934C2231BULL, 0x0FE337E62A37F356ULL, 0x388F7B0F632DE814ULL), false},
+    {S256Field(0x74FA94ABE8C4CD13ULL, 0xCC6C13900EE07584ULL, 0x581E4904930B1404ULL, 0xE493DBF1C10D80F3ULL),
+     S256Field(0xCFE97BDC47739922ULL, 0xD967AE33BFBDFE40ULL, 0x5642E2098EA51448ULL, 0x51ED993EA0D455B7ULL), false},
+    {S256Field(0xCBA8D569B240EFE4ULL, 0xE88B84BDDC619AB7ULL, 0x55B4A7250A5C5128ULL, 0x2F8BDE4D1A072093ULL),
+     S256Field(0xDCA87D3AA6AC62D6ULL, 0xF788271BAB0D6840ULL, 0xD4DBA9DDA6C9C426ULL, 0xD8AC222636E5E3D6ULL), false},
+    {S256Field(0x2F057A1460297556ULL, 0x82F6472F8568A18BULL, 0x20453A14355235D3ULL, 0xFFF97BD5755EEEA4ULL),
+     S256Field(0x3C870C36B075F297ULL, 0xDE80F0F6518FE4A0ULL, 0xF3BE96017F45C560ULL, 0xAE12777AACFBB620ULL), false},
+    {S256Field(0xE92BDDEDCAC4F9BCULL, 0x3D419B7E0330E39CULL, 0xA398F365F2EA7A0EULL, 0x5CBDF0646E5DB4EAULL),
+     S256Field(0xA5082628087264DAULL, 0xA813D0B813FDE7B5ULL, 0xA3178D6D861A54DBULL, 0x6AEBCA40BA255960ULL), false},
+    {S256Field(0x67784EF3E10A2A01ULL, 0x0A1BDD05E5AF888AULL, 0xAFF3843FB70F3C2FULL, 0x2F01E5E15CCA351DULL),
+     S256Field(0xB5DA2CB76CBDE904ULL, 0xC2E213D6BA5B7617ULL, 0x293D082A132D13B4ULL, 0x5C4DA8A741539949ULL), false},
+    {S256Field(0xC35F110DFC27CCBEULL, 0xE09796974C57E714ULL, 0x09AD178A9F559ABDULL, 0xACD484E2F0C7F653ULL),
+     S256Field(0x05CC262AC64F9C37ULL, 0xADD888A4375F8E0FULL, 0x64380971763B61E9ULL, 0xCC338921B0A7D9FDULL), false},
+    {S256Field(0x52A68E2A47E247C7ULL, 0x3442D49B1943C2B7ULL, 0x35477C7B1AE6AE5DULL, 0xA0434D9E47F3C862ULL),
+     S256Field(0x3CBEE53B037368D7ULL, 0x6F794C2ED877A159ULL, 0xA3B6C7E693A24C69ULL, 0x893ABA425419BC27ULL), false},
+    {S256Field(0xBBEC17895DA008CBULL, 0x5649980BE5C17891ULL, 0x5EF4246B70C65AACULL, 0x774AE7F858A9411EULL),
+     S256Field(0x301D74C9C953C61BULL, 0x372DB1E2DFF9D6A8ULL, 0x0243DD56D7B7B365ULL, 0xD984A032EB6B5E19ULL), false},
+    {S256Field(0xC5B0F47070AFE85AULL, 0x687CF4419620095BULL, 0x15C38F004D734633ULL, 0xD01115D548E7561BULL),
+     S256Field(0x6B051B13F4062327ULL, 0x79238C5DD9A86D52ULL, 0xA8B64537E17BD815ULL, 0xA9F34FFDC815E0D7ULL), false},
+    {S256Field(0xDEEDDF8F19405AA8ULL, 0xB075FBC6610E58CDULL, 0xC7D1D205C3748651ULL, 0xF28773C2D975288BULL),
+     S256Field(0x29B5CB52DB03ED81ULL, 0x3A1A06DA521FA91FULL, 0x758212EB65CDAF47ULL, 0x0AB0902E8D880A89ULL), false},
+    {S256Field(0xE49B241A60E823E4ULL, 0x26AA7B63678949E6ULL, 0xFD64E67F07D38E32ULL, 0x499FDF9E895E719CULL),
+     S256Field(0xC65F40D403A13F5BULL, 0x464279C27A3F95BCULL, 0x90F044E4A7B3D464ULL, 0xCAC2F6C4B54E8551ULL), false},
+    {S256Field(0x44ADBCF8E27E080EULL, 0x31E5946F3C85F79EULL, 0x5A465AE3095FF411ULL, 0xD7924D4F7D43EA96ULL),
+     S256Field(0xC504DC9FF6A26B58ULL, 0xEA40AF2BD896D3A5ULL, 0x83842EC228CC6DEFULL, 0x581E2872A86C72A6ULL), false},
+    {S256Field(0xC44EE89E2A6DEC0AULL, 0xB2A31369B87A5AE9ULL, 0x3011AABC21C23E97ULL, 0xE60FCE93B59E9EC5ULL),
+     S256Field(0xE1F32CCE69616821ULL, 0x1296891E44D23F0BULL, 0x9DB99F34F5793710ULL, 0xF7E3507399E59592ULL), false},
+    {S256Field(0x75D0DBD407143E65ULL, 0xDACFFCB89904A61DULL, 0x47B6E054E2F378CEULL, 0xD30199D74FB5A22DULL),
+     S256Field(0x05B3FF1F24106AB9ULL, 0x1F760CC364ED8196ULL, 0xB3D6DEC9E9838065ULL, 0x95038D9D0AE3D5C3ULL), false},
+    {S256Field(0x9BD870AA1118E5C3ULL, 0xFC579B27452BEBC1ULL, 0xB441656EF4E65B4BULL, 0x6ECA335D9645307DULL),
+     S256Field(0x498A2F7805A08668ULL, 0x3A496A3A3BF8EC34ULL, 0x592F579074B875A0ULL, 0xD50123B57A7A0710ULL), false},
+    {S256Field(0xE37918E6F874EF8BULL, 0xFC4C6F1DCDBAFD81ULL, 0x0B1051EAF832823CULL, 0xBF23C1542D16EAB7ULL),
+     S256Field(0x4DC37EFE66831D9FULL, 0xC522FC54811E2F78ULL, 0x7AD928A0BA5392E4ULL, 0x5CB3866FC3300373ULL), false},
+    {S256Field(0x0ECD31E14F87F62EULL, 0x10E6E63863716127ULL, 0x0D7C744ED34659F0ULL, 0xE9623BBEF1BF90ECULL),
+     S256Field(0x53013EAFA44EE737ULL, 0xFE6043C9DD68844EULL, 0xE0FE953A8EDAA929ULL, 0x38A9743B4BC299E9ULL), false},
+    {S256Field(0x43933ACA7F8CB0E3ULL, 0xA22EB53FE1EFE3A4ULL, 0x8FA64E044B2EB72EULL, 0x3F0E80E574456D8FULL),
+     S256Field(0xCB0289E2EA5F404FULL, 0x9501253AA65B53A4ULL, 0xE90B9C08485D01B3ULL, 0xCB66D7D7296CBC91ULL), false},
+    {S256Field(0xEB0AADF82A8D733CULL, 0xFFC274BF62FCA8F9ULL, 0x0884A36F2080D682ULL, 0xBC82DD73E5161DBAULL),
+     S256Field(0x1E786104F47797F0ULL, 0xAE93A0BAE7389730ULL, 0x54A9B4BF719F02DFULL, 0xE5F28C3A044B1CACULL), false},
+    {S256Field(0x647077456769A24EULL, 0xBCF55CD700535655ULL, 0x696C3D09F7D1671CULL, 0x34FF3BE4033F7A06ULL),
+     S256Field(0x8491067A73CC2F1AULL, 0x55DF16C3E8F8B681ULL, 0x3F6619D89832098CULL, 0x5D9D11623A236C55ULL), false},
+    {S256Field(0xD7EFE2315FBC7671ULL, 0x743F1BC852858E32ULL, 0xD20291CE1798F490ULL, 0x8E3D1248C7657211ULL),
+     S256Field(0x7EF1DC6418717DECULL, 0xB9352BAAA63E144AULL, 0xF64480E19393E90EULL, 0x099A48E10ECFCB81ULL), false},
+    {S256Field(0x05EC32AD51B03F6CULL, 0xA4D047122A9B184BULL, 0x2BC776838F73F576ULL, 0x308913A27A52D922ULL),
+     S256Field(0x60AB5EFCE8FE4C67ULL, 0xA8333FEA82BD1F12ULL, 0x91E3531F66C0375DULL, 0xF4A5B09543FEBE5FULL), false},
+    {S256Field(0xF3287432BEB31DB2ULL, 0x8FCAE82788F506A0ULL, 0x896A193ED088A2B6ULL, 0x78A891AA2234A498ULL),
+     S256Field(0x3069D623B9FA4343ULL, 0x54379BCDD800B82DULL, 0xFCF5F25527302DF6ULL, 0x6912A35BEB5035CBULL), false},
+    {S256Field(0xC7B750F733CE1752ULL, 0xE783C797D7CD204EULL, 0x812DDF64D99C9AEAULL, 0xD7A0DA58D01DC635ULL),
+     S256Field(0xBBC027380762CEF4ULL, 0x0BE040A8C062B742ULL, 0xF6F2928340E28465ULL, 0x912770E068008032ULL), false},
+    {S256Field(0x65348F778DB0E595ULL, 0xA7163CB9FBA082BBULL, 0xD7CE3765816076EBULL, 0x7D86781855DB1B17ULL),
+     S256Field(0x99951E3ABC733DE8ULL, 0x2937844E0E25D532ULL, 0x2E562E2BED4F8838ULL, 0xE2B99ADFEC86F877ULL), false},
+    {S256Field(0x609C45706CE6B514ULL, 0x890905C79B357322ULL, 0x8885C35600844D49ULL, 0x08BC89C2F919ED15ULL),
+     S256Field(0x6F63F4CEA8C95157ULL, 0x172D3056112776F0ULL, 0xDE776FEC3B5892C1ULL, 0xD313F3CDD7CDCC16ULL), false},
+    {S256Field(0x008FEF8516060DFCULL, 0x76545F84205E6A2AULL, 0x48494B9DC41AB086ULL, 0xDDC5310F00582AC8ULL),
+     S256Field(0xFB5F8AB6E7820CA8ULL, 0x41DBAFC6ABD04730ULL, 0x0191AB6DCC8F0E90ULL, 0xBA0D2F3AF20D9692ULL), false},
+    {S256Field(0x0646E23FD5F51508ULL, 0xD8C39CABD5AC1CA1ULL, 0xEA2A6E3E172DE238ULL, 0x8282263212C609D9ULL),
+     S256Field(0xD31B6EAFF6E26CAFULL, 0x62D613AC2F7B17BEULL, 0x5E8256E830B60ACEULL, 0x11F8A8098557DFE4ULL), false},
+    {S256Field(0x926E2C00EF34A24DULL, 0x0ADBC968D9E159D0ULL, 0x905A857A9CF918D5ULL, 0x465370B287A79FF3ULL),
+     S256Field(0xA2F8FB20B33887F4ULL, 0x588E09B215D37A10ULL, 0xA4AF8BDAFDEEC2C1ULL, 0x35E531B38368C082ULL), false},
+    {S256Field(0xFCFC0CB9E57E8DFAULL, 0x09809191A3C7E184ULL, 0x0D9A30F8ACA98CA0ULL, 0x8262CF2FF0799C4CULL),
+     S256Field(0x35CFF8D8FBAC376AULL, 0x57B6ED332B14C478ULL, 0x66FEE22EC5B34F34ULL, 0x83FD95E209109E4EULL), false},
+    {S256Field(0xD5B901B2E285131FULL, 0xAAEC6ECDC813B088ULL, 0xD664A18F66AD6240ULL, 0x241FEBB8E23CBD77ULL),
+     S256Field(0xABB3E66F2750026DULL, 0xCD50FD0FBD0CB5AFULL, 0xD6C420BD13981DF8ULL, 0x513378D9FF94F8D3ULL), false},
+    {S256Field(0x9052E48B026BDB6FULL, 0x7CA41BD47B734B94ULL, 0x168105B24CE99C87ULL, 0x19825C8B1DA0DDD5ULL),
+     S256Field(0xB5DF7084C49CFC9BULL, 0xEBE9EECC8CF6D3A6ULL, 0x320261CC94F59F6CULL, 0x6294310F0D4C878FULL), false},
+    {S256Field(0xD17CC1F27C70620CULL, 0x4998C4BEABC288D9ULL, 0xC60DD31A2B671780ULL, 0x1653A8A48D2C236DULL),
+     S256Field(0x6CA2E81D315B32CDULL, 0x012AF748DFD3DC52ULL, 0xEAFA99474EFA701CULL, 0x0338290935AF7F7AULL), false},
+    {S256Field(0x50ED09523D82824CULL, 0xDFA58E345E1534E6ULL, 0x43C5F56EC6C2999EULL, 0x6F12D86C11601914ULL),
+     S256Field(0x8579C34806EB34D0ULL, 0x391C92410854BC5BULL, 0x875994F3FD623769ULL, 0x5C4FF7F44AB3BFA0ULL), false},
+    {S256Field(0xEDCB63069B920471ULL, 0xFC318B85F423DE0DULL, 0xFCE4CC2983D8F8D9ULL, 0x5D1BDB4EA172FA79ULL),
+     S256Field(0x70330666F7B83103ULL, 0x79EB1E9996C56E7BULL, 0x794BB99438A22656ULL, 0x2843826779379E2EULL), false},
+    {S256Field(0x076DDC02DB453629ULL, 0x45CFDCDC0F59E603ULL, 0x14262716A23ABEF6ULL, 0x203A8C6F9A0AAA5DULL),
+     S256Field(0x5971C7853FF89F84ULL, 0x686DEB25C5285ED4ULL, 0x36CC76D15F410612ULL, 0x3B0F0B53DE5DD9B9ULL), false},
+    {S256Field(0xB9446557B147F3D6ULL, 0x553199217AB8CB45ULL, 0x19E6A36324655103ULL, 0x474A4732C294B1E1ULL),
+     S256Field(0xDCEE852828628BA4ULL, 0x11FA7F17010E1300ULL, 0xED2CC30CC3A48AA3ULL, 0x94625E231206F04EULL), false},
+    {S256Field(0x783130DDE46C7ECBULL, 0x9D3AED3FE5BB4CE9ULL, 0xC81EF7334866E1ECULL, 0x6E2ACAEB3D034181ULL),
+     S256Field(0x8449201EEEBC8720ULL, 0xFAC706B91B67512CULL, 0x9D80C4DAF0FB643AULL, 0x9E61A46797EFEE14ULL), false},
+    {S256Field(0x47D42BA6E71DABCDULL, 0x54D3FE4989E5CB4FULL, 0x6098AE3260B5373FULL, 0xD49EE4FB6B63F43CULL),
+     S256Field(0xE66A90CF016603C2ULL, 0x129C509312FF7031ULL, 0xD7C87EA7A61BF356ULL, 0x0531E39209A5490DULL), false},
+    {S256Field(0xEB7018F3F0A4147EULL, 0x2747DD8BF775F201ULL, 0xAF61717E8A490A58ULL, 0xD5A70492E9E9156BULL),
+     S256Field(0x8E4B3CB833FB65FFULL, 0xF4C4D9847967F57FULL, 0xFC490990765E0532ULL, 0x9DB526F5DBAB89C6ULL), false},
+    {S256Field(0x63DA8F68B43841C6ULL, 0x12AA3CC0D343EFBDULL, 0x49BB6B52DCEBF4C2ULL, 0x6CC1109E03DF0899ULL),
+     S256Field(0xB9733A46B954E94DULL, 0xD79B433E2D906CF5ULL, 0x0FFD3D6B0A29FFECULL, 0xAF561AFE9C094B76ULL), false},
+    {S256Field(0x4EDDB46BD8EDCEC6ULL, 0xA1061CC2D3634F45ULL, 0x0523EFC6302CDAC6ULL, 0x38C5119AABE18BA8ULL),
+     S256Field(0x456E0BFB1933DB08ULL, 0x28A16C822B5530A6ULL, 0x668CB2DA275F282FULL, 0xE649DD2285D9732AULL), false},
+    {S256Field(0x73FCE5B551E5B739ULL, 0xE0B93833FD2222EDULL, 0x72F99CC6C6FC846DULL, 0x175E159F728B865AULL),
+     S256Field(0x6EFA6FFEE9FED695ULL, 0xACB5955ADD24345CULL, 0xA4EF97A51FF71F5EULL, 0xD3506E0D9E3C79EBULL), false},
+    {S256Field(0xCE78049E46BC47D6ULL, 0x30FDFEB5C6DA121BULL, 0xA5FFBCC8E139C621ULL, 0x423A013F03FF32D7ULL),
+     S256Field(0xD1236E6D8B548A34ULL, 0x720D8EC3524F009EULL, 0xA1179F7BBAF6B3C7ULL, 0xB91AE00FE1E1D970ULL), false},
+    {S256Field(0x65B7F8F1C5041216ULL, 0x3F7335F6842B836AULL, 0x128B59EFDC2FED52ULL, 0xDA75317B21F7ACF4ULL),
+     S256Field(0xDAED32986E708572ULL, 0xE9AAC07AE77ACEDAULL, 0xDF19E21B342D7FC6ULL, 0x73F8A046BF72D5F0ULL), false},
+    {S256Field(0x302DF6F78416824AULL, 0x49DF662F3B3E2741ULL, 0x08907A7ABCD68776ULL, 0x111D6A45AC1FB905ULL),
+     S256Field(0xA9A111D42108E9D0ULL, 0xF070008996DACA4CULL, 0xB90D48DBFF065952ULL, 0x0696911C478EAFFBULL), false},
+    {S256Field(0xB0143E71E465A930ULL, 0x2587F1C16B1352FDULL, 0x0573C58C4A82EB1EULL, 0x1C71C5B48E9749D7ULL),
+     S256Field(0x1D873F6CC34638B5ULL, 0x79345E3FB7174D47ULL, 0x2713F1F2824BB68CULL, 0x4A91C334E8F5FA0CULL), false},
+    {S256Field(0x9505324F3C62BAC0ULL, 0x19150DDF51F0AB06ULL, 0x1364B7D2C3E8B70EULL, 0x9530F0F9023F469CULL),
+     S256Field(0x478ABDA97618E309ULL, 0xE25B32852F1FDC68ULL, 0x34DD2F7F59B333E0ULL, 0x8F3C305A8F9F21E2ULL), false},
+    {S256Field(0xE318DAE5BADB6EE7ULL, 0x7850DD432744A077ULL, 0x936E837A909B4C9CULL, 0xD84E4AFC1F31A566ULL),
+     S256Field(0x82D556E6D42EBED2ULL, 0xFDD8AC974AA3E649ULL, 0x12A38D58F565DE4DULL, 0xE525809A7C7B79CEULL), false},
+    {S256Field(0xAB5EDDE01BCED775ULL, 0x7290B68A5EF74E56ULL, 0xAD795DBEBCB9DCFFULL, 0x4A4A6DC97AC7C8B8ULL),
+     S256Field(0xB2BF8F68A78DD66DULL, 0x1DE90CDB424742ACULL, 0x943EF9F739C0F457ULL, 0x529911B016631E72ULL), false},
+    {S256Field(0x394E9ECFA49E6D10ULL, 0xF60ADFF3AEAC99D2ULL, 0x41B22B9285FF6ED3ULL, 0xF3D4444BDE66814DULL),
+     S256Field(0x0A038CC05347DA3FULL, 0xFC1ADA50CE9D6C63ULL, 0x4BAB95AC198A4B5BULL, 0x0A4324DFA6F0163DULL), false},
+    {S256Field(0xF5E91B77A547B4B3ULL, 0x356929D1FD665411ULL, 0x1DF82EFEE099522CULL, 0xF006C42F1D8E4F75ULL),
+     S256Field(0xB5EF449FA86AA74BULL, 0x75C933EED6BE7AE1ULL, 0x5C47848A4E4F7D16ULL, 0xF68154D4A666520AULL), false},
+    {S256Field(0x48CB3406E9D33A07ULL, 0x4E72EE08AA39BCABULL, 0xF9085520CDBDF404ULL, 0xAE30652C9D9C1D89ULL),
+     S256Field(0x74870C0F60A0B2A6ULL, 0x1C9C37F5DFD7E95CULL, 0xEFCCE7D33DB8D5CFULL, 0x6CB9D9C38D63FE57ULL), false},
+    {S256Field(0x06704385DC3C9C8FULL, 0xF2816FEE3E4367B2ULL, 0x6F09FF43AAA332B0ULL, 0x67BE02DCBE4298FDULL),
+     S256Field(0x55384998593652D9ULL, 0xCD993BF60B88C2BEULL, 0xA2C945B608291693ULL, 0x7A9B55A73E4DEF84ULL), false},
+    {S256Field(0x759654B90C28CACAULL, 0x1869C7BBCC8281DAULL, 0x15E17E7583388C9AULL, 0xD8DC1B2A5BD5E1C8ULL),
+     S256Field(0xCDB676EA23B3EC7AULL, 0x7D315D2CEC8128F6ULL, 0x8C6D8DA420247D94ULL, 0x8CEC0AD927CEC7D5ULL), false},
+    {S256Field(0xC5C2F974518B01B5ULL, 0xDDCCC88B8710BADAULL, 0xC1A50C45352405B1ULL, 0x0E69B346403DE885ULL),
+     S256Field(0x418EE36878D965C5ULL, 0xCEDF595F3D00683EULL, 0x61DED70AB7D7DD37ULL, 0x0B4EFAC5FCD7E452ULL), false},
+    {S256Field(0x8921FB663BC4416FULL, 0xA7AEFD23F30B0402ULL, 0xD59425A8D032F31DULL, 0x2749E292C5F84ECCULL),
+     S256Field(0x7E98BDE2FC6BBD8EULL, 0xF59E9FB65EE96105ULL, 0x403D94990FCADB3EULL, 0x50CC2D4E37672BC4ULL), false},
+    {S256Field(0x526BAD8F83FF4640ULL, 0x53441C7E55552FFEULL, 0x99CEAC05B6262EE0ULL, 0x363D90D447B00C9CULL),
+     S256Field(0x62003C7F3BEE9DE9ULL, 0x45B9A89008199ECBULL, 0x953B445397F33631ULL, 0x04E273ADFC732221ULL), false},
+    {S256Field(0xD2712A5CAF92C541ULL, 0x0B62FB012EDFB59DULL, 0x553973C6C93B02BFULL, 0x4C1B9866ED9A7E9BULL),
+     S256Field(0x72C4F3FDC68FE020ULL, 0xC652EAD7E43EB1ADULL, 0x7FBCB753CE56E69CULL, 0xC1F792D320BE8A0FULL), false},
+    {S256Field(0x4B891216F6E55DC8ULL, 0x6FF95AB6EACA0439ULL, 0xBA84A440C0509442ULL, 0x4431404790C5FFB2ULL),
+     S256Field(0x31D944AEDBE323B3ULL, 0xA66A29B79EAA2E50ULL, 0xFE99837F5642FED7ULL, 0x96B0C142E65366F8ULL), false},
+    {S256Field(0xE0C8F28CBEAAF3D1ULL, 0x3233EDBC1A28F135ULL, 0x529A2F3C0780B54EULL, 0xA4083877BA83B12BULL),
+     S256Field(0xB12B534DF0B254B9ULL, 0x2001E7576ED1EF90ULL, 0xB8BF83D69361B3E2ULL, 0x40E9F612FEEFBC79ULL), false},
+    {S256Field(0xDFE9485D701B23A8ULL, 0xAB7B7D470A87EE0AULL, 0x126243D5B921089DULL, 0x9E22FE8D866CA87CULL),
+     S256Field(0xF7A413C50884EDAEULL, 0xC0F7C949FB511CECULL, 0x177F3F02099C1533ULL, 0xFD2FF0E9CA122D10ULL), false},
+    {S256Field(0x3EB5E19633F0E9AAULL, 0x68112776B11BD34BULL, 0xB7924AE0D58138D2ULL, 0xE5380FE8575F26ADULL),
+     S256Field(0xC4BA41364082720FULL, 0x6FB94E5DF468318EULL, 0x5B691363924C8E01ULL, 0xB97FD8739087B41DULL), false},
+    {S256Field(0xDD7408BF071A70E4ULL, 0xCD5EE51F5F5CF475ULL, 0x2EDD69E64705306DULL, 0x508DF6D503CE2A8DULL),
+     S256Field(0xDF2E5BF729950984ULL, 0x4EC03228EE8AADFEULL, 0x777304AA733E49C5ULL, 0x154C439B933BC42DULL), false},
+    {S256Field(0x8CD3DB5A7940D33AULL, 0x6E0D880A454203B9ULL, 0x3A4E3E1A2F56C86FULL, 0xA804C641D28CC0B5ULL),
+     S256Field(0x43CE95FA6D46967AULL, 0x1AF18CA89CF736A9ULL, 0x3DEC2842C16047E8ULL, 0x95BE83252B2FA6D0ULL), false},
+    {S256Field(0x6EAFDA76CE1ABE11ULL, 0xDAB921C259CB220FULL, 0x338DF581930125B2ULL, 0xE3DBFF8455109763ULL),
+     S256Field(0x4B49AD549FA8DE63ULL, 0xD3C97D903C6B5C41ULL, 0x6438FA75DB8A8EF3ULL, 0x06F2F9099A341421ULL), false},
+    {S256Field(0xE6929378B63968B6ULL, 0xF4026165ED9E3AB2ULL, 0x43C5A9600890893AULL, 0xF7A4BE3DFC6579FBULL),
+     S256Field(0x494DDA32D0C34882ULL, 0x99702FB8D110105EULL, 0x21D2903038CA52D2ULL, 0xD6DDEF6CE823C615ULL), false},
+    {S256Field(0xDCF1B23603593449ULL, 0xF61B7C12E42A46FFULL, 0x878D9C13A07D014AULL, 0x19ACE064C7DE940DULL),
+     S256Field(0x3A414B93ADF83631ULL, 0xAC710B9F4084068AULL, 0xBFEBD739D9402C46ULL, 0xE37992035268A333ULL), false},
+    {S256Field(0x1AED361BEEBC61D6ULL, 0x8A8FD3A7D9FF42DEULL, 0xC395F0D15D6B1F51ULL, 0x939FF3E4A3ED9AF0ULL),
+     S256Field(0xE75EA466A3F5CB70ULL, 0x980BF26EB78C7F82ULL, 0x9D46FC4EEF016C04ULL, 0xDEAB3BCF08B7A90EULL), false},
+    {S256Field(0xEE3E9892CCBA6B63ULL, 0x0A0FE674FD0B3BB5ULL, 0x108C33228EA88E31ULL, 0xD8740CEC20F87DAAULL),
+     S256Field(0xBEEA36C06934C5F3ULL, 0x40104F5CC381694AULL, 0x378A6EE9903AC37DULL, 0x6472C133C6B932BFULL), false},
+    {S256Field(0xA34ED6E88A8FF2CFULL, 0x38EA755C7B062094ULL, 0x797A98DBA24051A4ULL, 0x019A9E5F1C4CAE30ULL),
+     S256Field(0x3A77E766DB0E4352ULL, 0x0CE7EBEE88486D35ULL, 0xFA9062925012B730ULL, 0x1E661C67EA85AF5EULL), false},
+    {S256Field(0x6194FF2C1B3EC038ULL, 0xD9FD516AE60C6B27ULL, 0x64883E762F290A50ULL, 0x58AC33391B506083ULL),
+     S256Field(0x16EAA3F110246279ULL, 0x0219043C0B4FBBCAULL, 0x78779249E991FE97ULL, 0x9163D706D55C92D9ULL), false},
+    {S256Field(0x69F79A55DFFDF80CULL, 0x43E4A781A15BCD1BULL, 0x8C6244B5B7456388ULL, 0x8B4B5F165DF3C2BEULL),
+     S256Field(0xB3EFF0C65FD4FD36ULL, 0xF9E336546162EE56ULL, 0xB3FBD7813AB0DA04ULL, 0x4AAD0A6F68D308B4ULL), false},
+    {S256Field(0xBB3F26714755E4BEULL, 0x71AF64EE417C997AULL, 0x8CE17C7EC83C6110ULL, 0xED0C5CE4E1329171ULL),
+     S256Field(0x63F9FA6EA07BF42FULL, 0x49D93925763DDAB1ULL, 0xBF3DAD7F5A7EA680ULL, 0x221A9FC7BC2345BDULL), false},
+    {S256Field(0xA0A2A582F55812DDULL, 0x3D446723552D30E2ULL, 0x0B6ABED6C058F78EULL, 0x7029BD7A92FF352FULL),
+     S256Field(0x721CC66B1A2D2927ULL, 0x47DAE84243B2C73CULL, 0x7DD6544AE30683ACULL, 0xB0EEFADAFDE8B3D2ULL), false},
+    {S256Field(0xD4B6E6C807CEC8ABULL, 0xE53254566E0552CEULL, 0xB3B15C3F83F1FAE8ULL, 0xFAECB013C44CE694ULL),
+     S256Field(0x8981DFD9AB155070ULL, 0x9C32B286B85E2E2EULL, 0xFC2E02C6EC2FB13DULL, 0xCC09B5E90E9ECB57ULL), false},
+    {S256Field(0x49CE5683BD486ED1ULL, 0x5745BEBA49565B6AULL, 0x009D4109D8CF7560ULL, 0x9CCFEDCAEAE65C99ULL),
+     S256Field(0x4F6D59ED75E95D8DULL, 0x2421675969592AA2ULL, 0xB6122481200B3411ULL, 0x7C2F4D713D6A32CFULL), false},
+    {S256Field(0xDCDABFF9B181FDC2ULL, 0xDD2F62BB5CC62364ULL, 0x4AA264B818A34E7EULL, 0xF42C102AF47E6E47ULL),
+     S256Field(0x81F00093A485D7FDULL, 0x4C15502D9A2ACF26ULL, 0x78FAD05CB86FE22AULL, 0x57503AB46CFE806CULL), false},
+    {S256Field(0xA206B1A75BD0EACAULL, 0xD0C74576BA2D4AB7ULL, 0x35A8FDE33CA4DF19ULL, 0xCD9A4B8763414143ULL),
+     S256Field(0x6E6FAFB5ABFF4ACCULL, 0x0127B38EED6F634FULL, 0x815488AE933EA08BULL, 0xF0455879A1E8F23EULL), false},
+    {S256Field(0x07F64EAE9AD1B1F7ULL, 0xB3B2DD824F23CD3EULL, 0xC8731A0B37CBCAFDULL, 0x09BB8A132DCAD2F2ULL),
+     S256Field(0x64130627C3811C80ULL, 0x0F54A840F4752D53ULL, 0xB6F9DD284F863E85ULL, 0x945BB2B2AFEEE3B9ULL), false},
+    {S256Field(0xF20953A3C7BC57C6ULL, 0x4903D7A23EB276CBULL, 0x884F2D2E93D63094ULL, 0xAD09882F88ED9BEAULL),
+     S256Field(0xCA32C0EDAE4A0AB8ULL, 0x7B311D373590E2D3ULL, 0xA28186C729DABE5FULL, 0x7243C08C42FBA52BULL), false},
+    {S256Field(0x9E2DAB644F927DC7ULL, 0x37A7A40D63D418A4ULL, 0xE669ED95366A1423ULL, 0xE260A0CC082BA6BBULL),
+     S256Field(0xA45F36F446AEF35DULL, 0xEDBCC0B4462CB82DULL, 0xF073CB3D725BF440ULL, 0x37EE6744B0DA9D67ULL), false},
+    {S256Field(0xEA830C72ABA56302ULL, 0xF506A937AF0F1862ULL, 0x1EADA2D2A9FAD2E0ULL, 0xD9D1290AEB3CA41FULL),
+     S256Field(0xEAADDAFA88291C29ULL, 0x1739AECD9FA74F2AULL, 0x029715C6726386E4ULL, 0x7EB53113EC2D3EEDULL), false},
+    {S256Field(0x3866D47DEEDD7DD6ULL, 0x49376FE265E1968CULL, 0xCA5A7840EE7CFDECULL, 0x32CFCF6A24C7524BULL),
+     S256Field(0x25FD44AEFE08E330ULL, 0x7A0D8CD20349A08BULL, 0x6208096A409F561EULL, 0x21846A34976A7748ULL), false},
+    {S256Field(0xBACD3704F4D1243AULL, 0x02B126023F54A5FDULL, 0x91CD21AC063F5584ULL, 0xBC5079DE539D6CEFULL),
+     S256Field(0xF5C95168855DB68AULL, 0x5F7EE4F5B1F47169ULL, 0x8EEC72B94DFFC8D7ULL, 0x65062A3B3A705CBBULL), false},
+    {S256Field(0x696D03FDF6ABF83DULL, 0xB8F94058FB2D0596ULL, 0x3ECBE68F10D22C02ULL, 0x235CAADDE85AC49FULL),
+     S256Field(0x7F4EC9E90D33E191ULL, 0x3F0518D6323610AEULL, 0xEE4232A5BC93AD89ULL, 0xDC12F9C745FD47EBULL), false},
+    {S256Field(0x08D244E6B74A3F9FULL, 0xC287A665DC098169ULL, 0x913DEAAE7DB2625AULL, 0x4D31A77E505FC7E8ULL),
+     S256Field(0x4FCB0241301E0BA7ULL, 0xCBF6FB51B6E00A75ULL, 0x06B18F38C7802753ULL, 0x22241EC96098575BULL), false},
+    {S256Field(0xCB6115925232FCDAULL, 0xB700DBFFA6C0E77BULL, 0x6BF771C00BD548C7ULL, 0x723CBAA6E5DB996DULL),
+     S256Field(0x01DC069D9EB39F5FULL, 0x2660A06537794948ULL, 0xA921137488824D6EULL, 0x96E867B5595CC498ULL), false},
+    {S256Field(0x1FD383D60CA030D5ULL, 0x2D240A4307984907ULL, 0x343D7DC45773A3C6ULL, 0x57EFA786437B744DULL),
+     S256Field(0xB07AB44274B02F9EULL, 0x689B6D2AE5E9974AULL, 0x893627C928DE03ECULL, 0xD712DB0BD1B48518ULL), false},
+    {S256Field(0x2567E09E80633CB1ULL, 0x575A224B69D02113ULL, 0x00C6273212181FCBULL, 0x6DDE9CF317AACAD4ULL),
+     S256Field(0x57DD49AA67CE6B34ULL, 0x80B27FDACF859EF3ULL, 0x5C99EF86A1BA66A8ULL, 0x9188FBE7A707E41DULL), false},
+    {S256Field(0x7FAFC7770C584DD5ULL, 0x1080577E327B012AULL, 0xA2DF7E9CD5226CB9ULL, 0x264BBD436A28BC42ULL),
+     S256Field(0xE61227937704AB11ULL, 0x6A118243717B8D8DULL, 0xD4F75CE24C33BE22ULL, 0xD87C6FA94EE093B4ULL), false},
+    {S256Field(0x419A518D2933F3C5ULL, 0x085A0F7115F12522ULL, 0x13C4BB7F8E47B850ULL, 0x486FA72CD5B5CDE8ULL),
+     S256Field(0x9AD4A71ACAFB0F53ULL, 0x62D9B783CF0F23B7ULL, 0xE48C48BAECC8F19FULL, 0x62E12319F56BDD43ULL), false},
+    {S256Field(0x4D0BD76A44E5467DULL, 0x40908AB819BBFACEULL, 0x2C21F62E0EC970E9ULL, 0x97D064F0FC69A122ULL),
+     S256Field(0x797300FD1E9CB3FAULL, 0xDA5FB3B854F17CCDULL, 0x03F7C66FA850861FULL, 0x89974F2ED33402CCULL), false},
+    {S256Field(0xEBD594225E99F728ULL, 0x677375FBE6F12204ULL, 0xB664FF27B76A5303ULL, 0x24796974A894AF4FULL),
+     S256Field(0x37A00516EBAAEBFFULL, 0x5ADBF3C09575A2D8ULL, 0xEC52E87E7D8D664AULL, 0xE3D78D44688F3001ULL), false},
+    {S256Field(0x2BF26BD84B2438E8ULL, 0xA78BC61FD5BDEC9DULL, 0xDAC85C056236A79DULL, 0xA94C6524BD40D2BBULL),
+     S256Field(0xC2E2C8DBF18661F4ULL, 0x7E5D3C60A0E39B2BULL, 0xFD79219505019E3AULL, 0xB5201FD992F96280ULL), false},
+    {S256Field(0xC9E0C6D42FB0079AULL, 0x916F9EF723926049ULL, 0x631A59EE76B38324ULL, 0x2F39CBDAA3D55FF0ULL),
+     S256Field(0xFE2297302C5690BAULL, 0x9BFB3FBC882A0230ULL, 0x4DA936D0278DA58BULL, 0xABEADBDE13863983ULL), false},
+    {S256Field(0x5F46F289B98086C8ULL, 0x40C10E34B62663FFULL, 0x289263B70AA8E6FCULL, 0x3E842E5BAA802BDDULL),
+     S256Field(0xF994B5138EE939A9ULL, 0x37B8E576B75E7D4EULL, 0x1B93704631B077C0ULL, 0x89F24FF5FC92E72EULL), false},
+    {S256Field(0x793300B2E4F7AB73ULL, 0x62E3D4EA9D4443A7ULL, 0x56A39E86C534AED2ULL, 0xE5A31D6C327D61BAULL),
+     S256Field(0x3913A3FC70561F42ULL, 0xBF8C4449A80CBA21ULL, 0x0C118A977A4ECE5DULL, 0x37788C3D8D1E9D7AULL), false},
+    {S256Field(0xCCA81CB913613BECULL, 0x8BB5FC9D101CFE67ULL, 0xEDF1B33DC74F972AULL, 0x2DCFCAB8C93937BDULL),
+     S256Field(0x3E7309249A039215ULL, 0x3732CFBAD33F5F38ULL, 0x65F088B7D6F6C6F4ULL, 0x46DBC4DD9474A412ULL), false},
+    {S256Field(0x88F929A3C14DCD86ULL, 0x1FC5D42096BF71B5ULL, 0xDF50DD982051DCF1ULL, 0xCC389D4A0D153447ULL),
+     S256Field(0x68EB6DD9C8F0A873ULL, 0x05C57E18FE7E7874ULL, 0x9B568BDBBEA910CAULL, 0x93AE4FD660F6BBEDULL), false},
+    {S256Field(0x8443D764DFB4F6BEULL, 0xB567D5FF4FA3EB64ULL, 0x8EC4BB0428F0E8B6ULL, 0xA2AE53D1AE758228ULL),
+     S256Field(0xC04225674AEEB9A2ULL, 0x4C0EFA67C3D40436ULL, 0x7C95679C7C1B547CULL, 0x6933594D44B3A098ULL), false},
+    {S256Field(0x24F9C6EB78819311ULL, 0x0B3E1EE210877147ULL, 0x3750A17E0CF5ED1FULL, 0x7F9291C89D71E902ULL),
+     S256Field(0xAA9F9B57AC2EB125ULL, 0x120AAA409C86A174ULL, 0xF5D0DE8C452415B6ULL, 0x9DA00D1063EC3EF0ULL), false},
+    {S256Field(0x9A533ECA0E7DD7FAULL, 0x0947961237A91983ULL, 0xBA5FEEC812C2D3B5ULL, 0xEEBFA4D493BEBF98ULL),
+     S256Field(0xDDFD4FDAE1DE8999ULL, 0x9AE4CDC3A711F712ULL, 0x69EE7EDAF178089DULL, 0x5D9A8CA3970EF0F2ULL), false},
+    {S256Field(0x76BEE90847D297FDULL, 0xC4EA4BC08F6766D6ULL, 0xA61C6031C118495FULL, 0x381C4AD7A7A97BFDULL),
+     S256Field(0x93ACE3187D493FC5ULL, 0xF0451032DB939C00ULL, 0x8F3E5FA709915ECCULL, 0x936AF53B238EEEE4ULL), false},
+    {S256Field(0xF3F678FFBB7CECEBULL, 0x73A59F938897FAF0ULL, 0x36FFB8126F6E6814ULL, 0x437A86204276D450ULL),
+     S256Field(0x7363BCC356C181E1ULL, 0x87220FCFDC8F9782ULL, 0x69B8FEB699D297FFULL, 0x0B916BA13EEAC32FULL), false},
+    {S256Field(0x448D70422EDE454CULL, 0x9CF1D05FEFDD08B2ULL, 0xCCE10831D9538C47ULL, 0xE1EFB9CD05ADC63BULL),
+     S256Field(0xAD9FD233A8913797ULL, 0x464E3244A7A2D4C6ULL, 0xB0154C1FFE477123ULL, 0x0ECB4530D8AF9BE7ULL), false},
+    {S256Field(0xD58D729E097F96F2ULL, 0x35823529D2C8735CULL, 0x83CB7E3B9A3CC273ULL, 0xA9EF9F13E2A489BCULL),
+     S256Field(0xC03D55B056C04BE4ULL, 0xB74F89AF5A9B4702ULL, 0xD956EE160EBB613DULL, 0xE814CCE594559D7CULL), false},
+    {S256Field(0x4C9D9D87DCBF00EBULL, 0x41B4E98BC18D0227ULL, 0x49BE16F6A1A30BC2ULL, 0xB89070AE96EAD4DCULL),
+     S256Field(0x1B7F1BCD1B0E664EULL, 0xCB0D8B06B6B96A67ULL, 0x472294E4C1C4A766ULL, 0x6F24C8C2C8A2D88FULL), false},
+    {S256Field(0xBC0AB5A1350CF77EULL, 0x07DBF57454A8AB0DULL, 0x553827D69FAA0642ULL, 0x66D80541EE1D35BEULL),
+     S256Field(0x2A5F97AFA0EAA3A6ULL, 0x9444B43AB7B1B76DULL, 0xC3F1D420535613F6ULL, 0x51CFDFE732FFFB42ULL), false},
+    {S256Field(0xD33FEEB329EB99A4ULL, 0xC7E5419F33D47B18ULL, 0xC5AC235E9AF475A8ULL, 0x5318F9B1A2697010ULL),
+     S256Field(0x2C726EEEFE91F92DULL, 0xA41F2B40D1E3EC65ULL, 0x5772D93AEBB405E8ULL, 0xF44CCFEB4BEDA419ULL), false},
+    {S256Field(0x9354862887213A5AULL, 0x0B73204A785FA62BULL, 0xBF3508A1C64CC3C8ULL, 0x62AC05E136503FA2ULL),
+     S256Field(0xC10D21C0F46A9E45ULL, 0xE5590901817994EFULL, 0xD395E79E07A92579ULL, 0x236FBDF3A0D1A6E4ULL), false},
+    {S256Field(0xD6B21B3CEFC76AC1ULL, 0x6124C395CA422C05ULL, 0x37E1859A7D53E899ULL, 0x188EF3BFAB103784ULL),
+     S256Field(0x3516032A528F00BCULL, 0xE4D66DE83C763875ULL, 0xD005FB18CF398E38ULL, 0xE6FC997A052FBA99ULL), false},
+    {S256Field(0xC30FD49867BAD12BULL, 0x85D5EA00EAF66E1EULL, 0x5BF613AF5C6F2DB3ULL, 0xCA13C44972448F5BULL),
+     S256Field(0x89699F469723B0F2ULL, 0x6370AB7111A57566ULL, 0xAC15FA64EAADA3D6ULL, 0x83AA098361C287C8ULL), false},
+    {S256Field(0xB9D6FF9AB6FBE7B2ULL, 0x5EADEDC1458D65A3ULL, 0xF336BBB1B2A88460ULL, 0x264887669CB441F8ULL),
+     S256Field(0x932A78BC21BC2A34ULL, 0x5638D9816A0EB603ULL, 0x8F2F2DCAD02DDF18ULL, 0x9E15DAB4B2014498ULL), false},
+    {S256Field(0xDDAEE5F95C80414EULL, 0x14EF8A862D66CF7FULL, 0x5AC11C4F44609E49ULL, 0x1CECB101A7052AE8ULL),
+     S256Field(0xDCAE9492D2169A3BULL, 0x907557E5447231D0ULL, 0x4E5AA32835EDAD16ULL, 0xF343606696097CFBULL), false},
+    {S256Field(0x50D1E4D18B20907DULL, 0x3B15B2D61607851CULL, 0xB002F45894850FF4ULL, 0xF98B5DBC3E54C227ULL),
+     S256Field(0x8351319B5CC926AFULL, 0x41FCD9E025A90E35ULL, 0x42939B706BA9CC9EULL, 0xE2D508BD4F4A13FAULL), false},
+    {S256Field(0xC4F5BC8C4ED810A9ULL, 0x4F889D3F3C700155ULL, 0xC950DAF5F1DF2392ULL, 0x2A69907504D78F9CULL),
+     S256Field(0xCF86B388FA9B4728ULL, 0x667D47E97EC145C7ULL, 0xC3EC586954FB04FCULL, 0x54F9039B6C3DFFDAULL), false},
+    {S256Field(0xEFD7835B39A48DB0ULL, 0x9F1215A29B3C03BFULL, 0x2791D0A09B7BDE45ULL, 0x100F44DA696E7167ULL),
+     S256Field(0x0FBD5CD62BC65A09ULL, 0xB7FF4A18FF5195ACULL, 0x2EC8F3300C090666ULL, 0xCDD9E13192A00B77ULL), false},
+    {S256Field(0x4B05284F1E4DF706ULL, 0xD8D9C8F9237D0808ULL, 0xA8415DFF2B4C4199ULL, 0x8C0989F2CEB5C771ULL),
+     S256Field(0x736AC5A35D72FA98ULL, 0x60DE6BF5156511AAULL, 0xFFD2172CB9DC966CULL, 0xFB4DBD044F432034ULL), false},
+    {S256Field(0x9CB9A13495BC15B4ULL, 0x9275028E465A2EE6ULL, 0xED858EE9CED7CA8DULL, 0x10E90E2E51EEADC9ULL),
+     S256Field(0x34EBE60958AA258DULL, 0x4CA5896302BB6A88ULL, 0x4D57A8C616AD1F75ULL, 0xC68A370380D5E042ULL), false},
+    {S256Field(0xB1E63C33DC47BFFDULL, 0x9C528539BC95BC1BULL, 0xC4A481743262C025ULL, 0xFB8F153C5E266704ULL),
+     S256Field(0x090A45DDD949B095ULL, 0x1DDE1389AC542613ULL, 0x16FA11D9B4BCCD53ULL, 0x6CA27A9DC5E06218ULL), false},
+    {S256Field(0x2DD3FC303FE75269ULL, 0xA377A3CC053D3318ULL, 0x4575B90B714B7DCDULL, 0xF7422F42DA541638ULL),
+     S256Field(0x18980E8717E49BD5ULL, 0x7FB3A237F4A398E0ULL, 0xD18CE7DCB9F63597ULL, 0x406C2F1A3313093FULL), false},
+    {S256Field(0x0F62ABC87A1C0A80ULL, 0x4D625158C65A9C74ULL, 0xB17C9BE7002FF9C3ULL, 0xB6B15A68A614CCA5ULL),
+     S256Field(0xB6CD011041CE0A03ULL, 0x9C9A12B3082E16EEULL, 0xA54E223EEF6536D4ULL, 0xFAE62E14D6CDB61EULL), false},
+    {S256Field(0x653B6696F5A7175FULL, 0xEDB8E771D31CF42AULL, 0x72879A5582D5DEBBULL, 0x2D8CAD0417D43CFFULL),
+     S256Field(0xCF37BB91BB9D592AULL, 0x7A846BFD9CB5E5E0ULL, 0x7BB232FA612C9D37ULL, 0xC73F3B83318CA94AULL), false},
+    {S256Field(0xB8FA1B8B4BB2629AULL, 0x65A02C587737A7B8ULL, 0x5A0CC9F0A7287084ULL, 0xE747333FD75D5175ULL),
+     S256Field(0x9F8D961A6946F6D6ULL, 0xC88376AA6E1A969AULL, 0x4CC43603804C2581ULL, 0xF2AFFE0145070C11ULL), false},
+    {S256Field(0xE34C9BC394B51045ULL, 0xBBC6C896F31C25B3ULL, 0x8AE73D4EB1E8CF73ULL, 0x1ECBFD1DB98A6EA5ULL),
+     S256Field(0x53A6710102C70026ULL, 0xB1900646B436422DULL, 0x447D0BB1849A9B38ULL, 0x1CF6E2308B99C3A6ULL), false},
+    {S256Field(0x4A35B56C6413E439ULL, 0xF92F69EFDDD5EF67ULL, 0xAF8B1BFEB7EDB64AULL, 0x99741BB8B477E296ULL),
+     S256Field(0x3E657D826832CD5BULL, 0xB17C15C9697466E4ULL, 0xE735AA56258E3E7AULL, 0xDE47E9B07BD9C9A5ULL), false},
+    {S256Field(0xF7ACD766E9358533ULL, 0x10A933F9D4FB4B9DULL, 0x83E955A291D32A8CULL, 0x9A0894C5FE577528ULL),
+     S256Field(0xFB3E1C5DC360BA08ULL, 0x65A6E5BDBB80DDADULL, 0x1F917D5F954FC321ULL, 0xA79883C4201B8FC3ULL), false},
+    {S256Field(0xA7CAA50A92B062D4ULL, 0x7A5CE7E59BB6A141ULL, 0x06FB171283EA227AULL, 0x35963EA43256EACAULL),
+     S256Field(0xA10AA4D1BBB25302ULL, 0xD04082B964DE59B1ULL, 0xBFCCE196F9C08A96ULL, 0xF65BE1454951E5C9ULL), false},
+    {S256Field(0x694405D6198EF7F6ULL, 0x5923F3F77A078F9FULL, 0x5BD9C85273B8AEA6ULL, 0x664DD849DB4FD2E3ULL),
+     S256Field(0xE7496FF35D1EAC94ULL, 0xFC3D3AB31B8E6ECEULL, 0xA1448CE5DD0458CFULL, 0xAD51201717F27932ULL), false},
+    {S256Field(0x0D0B66F3119334F0ULL, 0x74728EFB3A0AD1B6ULL, 0xC6A0E82485C29E41ULL, 0xCEBB7B7B02CFC321ULL),
+     S256Field(0x16750BD251E45191ULL, 0x4765A29DB9E036CBULL, 0xBA1EC0F74DD2E370ULL, 0xFE3DF243633B4A32ULL), false},
+    {S256Field(0xE0C0A6B7C3C934B3ULL, 0x2B31F5805B0AE2C4ULL, 0x8231D9669811A702ULL, 0x82113A9377D0B863ULL),
+     S256Field(0x77E5E62AC42C6A0FULL, 0xAA1F7C269A446803ULL, 0x08466CF2B5A0C628ULL, 0x8DA1B8DAC9AE3666ULL), false},
+    {S256Field(0x2C8ACDE6E534FD2DULL, 0xA77F8D4464F3B385ULL, 0x1DC9227A4A04C017ULL, 0xE1031BE262C7ED1BULL),
+     S256Field(0xA44F18F29456A00DULL, 0xF292DD419E1CED79ULL, 0x6BB6A4176597535AULL, 0x9D7061928940405EULL), false},
+    {S256Field(0x84E27E36A95C8356ULL, 0x028A6AC5DE94D857ULL, 0xB9F95DCD0F29B2C9ULL, 0xF4B93F224C8089EAULL),
+     S256Field(0xBD5861B9BE001FD3ULL, 0xC37EF1344915609AULL, 0xB0E5F6A7A40EEE90ULL, 0xA67A92EC062962DFULL), false},
+    {S256Field(0x579623AEEF028D83ULL, 0x6195926DBA743961ULL, 0x6A5ABE5A15DE69DBULL, 0xA7EBF7C4E3C785ECULL),
+     S256Field(0x9640392B99D0BED1ULL, 0x47A389274B053919ULL, 0xCFD9C7377044804BULL, 0x6205152FBFE362D5ULL), false},
+    {S256Field(0x20D62FE17B160E8AULL, 0xD51E8512F97E696CULL, 0xB19622EA025B08B0ULL, 0x09D1ACA1FCE55236ULL),
+     S256Field(0x34E050C57CA04C44ULL, 0x6FE9E0EE9212B5E5ULL, 0x3E56692CE0D8C27EULL, 0x1153188F5101F0C6ULL), false},
+    {S256Field(0xBAE0E40227DD5CFAULL, 0x6A89C5137F09D4B5ULL, 0x1CDC6A5342634633ULL, 0x5B5CA08DCB024F4CULL),
+     S256Field(0xE664A6F99E48E98CULL, 0xBFD067CCAF3269D3ULL, 0xE991F0CEA8869094ULL, 0x3ECCB6F70AA15825ULL), false},
+    {S256Field(0xF28844137BB61EE5ULL, 0xDA4F04E2FB1F0C13ULL, 0x662638CD8974AE6EULL, 0xD4933230CC8721B8ULL),
+     S256Field(0x662DA4D0E5D694A8ULL, 0x1AD12C8C5A438DDCULL, 0xEDCC5E9D1ECAFB5EULL, 0x021C09ABF51A9D23ULL), false},
+    {S256Field(0x2B9528E323531F82ULL, 0xFF51326BB10C2C9FULL, 0xCCEF3E7489C22C29ULL, 0x046F26ACC1114BB5ULL),
+     S256Field(0xA505FC8B0BCEDA07ULL, 0xD025945CDAB55C7FULL, 0xCE2370AC2FC32579ULL, 0x6B804B31635B82EAULL), false},
+    {S256Field(0xE97D7D0475BA7FC2ULL, 0x518B3A93BFC39562ULL, 0x18A2AD793821CDE7ULL, 0xC66C59CC454C2B9EULL),
+     S256Field(0x7EC3C69CF75F5956ULL, 0xF00A60DDB1595597ULL, 0xBEA4F3CEAAC10CB2ULL, 0xD9592FE2BFB30FCFULL), false},
+    {S256Field(0x60B1543710432711ULL, 0xCF140B2FDD916B90ULL, 0x35F96F0F0899645AULL, 0xC11926D931E0EFB5ULL),
+     S256Field(0xE49261E2EFE2610CULL, 0x83AB922CA0F34055ULL, 0x18494BF186CCC6CFULL, 0x8BE1F8CC7D25B689ULL), false},
+    {S256Field(0xF836C6CD22BE316CULL, 0x6BF4043F278E7AD0ULL, 0x2B17CEF5B25EF5F1ULL, 0x559CD5AA4A0B37B3ULL),
+     S256Field(0x1A6AB9C99FE04013ULL, 0x8A389A1D360780E7ULL, 0xF2DBA929874C692FULL, 0xAAD5449C08D44076ULL), false},
+    {S256Field(0xC179874FA1257963ULL, 0x5B018D52C34AA861ULL, 0x6CDBB54B538979C4ULL, 0x690846E9EB688F2EULL),
+     S256Field(0x3A576599466F9835ULL, 0x6CBC3CA821C92B25ULL, 0xB4017024F92FBB7FULL, 0xE2485FCB7F3FEBC5ULL), false},
+    {S256Field(0x530DDCBCEC04554AULL, 0xAADCFFBB4688CFFEULL, 0x474652C27A10A2ECULL, 0x896F37C89873D1A0ULL),
+     S256Field(0xD68F9FE1929138DFULL, 0xE6085B61ACC417DCULL, 0xDA622BB04E811BF1ULL, 0x380423E7224AC4ACULL), false},
+    {S256Field(0x2D11394BDEE23ACEULL, 0xDEC87C65B54DD2FDULL, 0xBBA7552DF4A32915ULL, 0xFB3DF7FB8C9220BAULL),
+     S256Field(0xE09DEF4C9722E8DEULL, 0x9E727142FED27F5EULL, 0x52A251540DBAB58AULL, 0x510E29BC11C73C56ULL), false},
+    {S256Field(0x5F90F1305CD36F89ULL, 0x1E4754C6E700CB92ULL, 0x651D68B872900EE3ULL, 0x482B6F1769155239ULL),
+     S256Field(0x467CA37270A4F423ULL, 0x19EE073442D49A68ULL, 0xCB18C23E6D7FE92EULL, 0xE8C3C11DF9A5CC5AULL), false},
+    {S256Field(0x8607CFEF50272351ULL, 0x70734B3DF99FF109ULL, 0x3EB8A3EB3AB1CD41ULL, 0x6DD85EC24F5C518BULL),
+     S256Field(0x9B07FA2B7FC7664BULL, 0x877C6FF7C3E0817CULL, 0x09D407F9AF5C41B7ULL, 0x16EA67F4121F427EULL), false},
+    {S256Field(0x2D5E688D9094696DULL, 0x5CF8B266A41D6AF5ULL, 0x0AC2839F143BD7ECULL, 0xFEEA6CAE46D55B53ULL),
+     S256Field(0x3155DEBF18090088ULL, 0x981C8957CC41442DULL, 0xB06E4E12BF3ECD5CULL, 0xE57C6B6C97DCE1BAULL), false},
+    {S256Field(0x0AA4040AEE752B08ULL, 0x141ECAE0B331A187ULL, 0xC53261AF9DB2E179ULL, 0x4D000B621ADB87E1ULL),
+     S256Field(0x3E72851F48302CEAULL, 0xCB7DF5F119C7293AULL, 0xCB6D825582D972CCULL, 0x6A0D5B8F18E0D255ULL), false},
+    {S256Field(0x079361BB48DFD587ULL, 0x5EC4BA38C9B02656ULL, 0x34867AAA2CF5A12DULL, 0x5084B41BACF4508BULL),
+     S256Field(0x6E79E97F91470E89ULL, 0x5DB6F5606891F560ULL, 0x619AA6C855292747ULL, 0x34A9631A1D980D31ULL), false},
+    {S256Field(0xF89962FD475C58EFULL, 0xD657A0403E1F1B77ULL, 0xD6AA262114717128ULL, 0x71F570CA203DA05DULL),
+     S256Field(0xF8649A72D35D420EULL, 0xF2445D00C3363E7DULL, 0xD25557345BC95B8DULL, 0xEB42415B95DC880DULL), false},
+    {S256Field(0xD08232617AB34CC6ULL, 0xC80C29767CF30A12ULL, 0x53FB3F1FD18D7128ULL, 0x4F14C03E0642D5EAULL),
+     S256Field(0x25EC252F987E681FULL, 0xB9DE3CCE8E81DD02ULL, 0xC653A70F43A62540ULL, 0x7B53D0A8CAA4E894ULL), false},
+    {S256Field(0x4D05956D6C953FA9ULL, 0x28AB2629F0B8C3DBULL, 0x3A5F485D4BD18C06ULL, 0xA49ED10EAAAB9323ULL),
+     S256Field(0x67B2BD2246FB4C72ULL, 0x5AE87534968E181BULL, 0xE03476C0A0DFDDFBULL, 0xCC72B894660F5398ULL), false},
+    {S256Field(0x342771011241D90DULL, 0xE81CF141DB2444F8ULL, 0xD41436095EDDD363ULL, 0xA74DB87E49C79ED1ULL),
+     S256Field(0xF32518B83F7ADAD4ULL, 0xA9EE509344A0A313ULL, 0x27FDD08A588171C8ULL, 0xF78691CDAF23EEF3ULL), false},
+    {S256Field(0x6048B06043FF8359ULL, 0x46B4821DC65E7651ULL, 0xB7D282B5C21DA014ULL, 0xA2B7B3629F7BD253ULL),
+     S256Field(0xA2397FECFE86FEC2ULL, 0x10D10835046F3835ULL, 0x57A937A3F71E29C9ULL, 0x693038941695122DULL), false},
+    {S256Field(0xA5ECCA2231C1AE1FULL, 0x456E58C68ACD40B2ULL, 0x9ACDCD44EBA35658ULL, 0x6901FA5744BAA2CFULL),
+     S256Field(0x0F833065D22838B0ULL, 0xD79F3BA5E5C77A93ULL, 0x461B5380C29C900DULL, 0x35DE5C882273C212ULL), false},
+    {S256Field(0x34F0901399F1F366ULL, 0x4A79057A3D0076BEULL, 0xA495F216B4994D90ULL, 0x5D134E5C5DA47F7BULL),
+     S256Field(0xE2B0D3E9C4990F2CULL, 0xCF02D61620A88B39ULL, 0x2DBE2A4AE3A82B73ULL, 0x03B1EF4D3E084504ULL), false},
+    {S256Field(0x4B031081B27A4BDBULL, 0x046A6D0435494CACULL, 0xA244B643F1BBA35DULL, 0x8D3CD82D1D438127ULL),
+     S256Field(0xC3D34C7CE69A8A2CULL, 0xD4E3807D370AD296ULL, 0x70CFBF9D0076236EULL, 0x9BD4256180EE41F4ULL), false},
+    {S256Field(0x3C096D3FE7A1D916ULL, 0x315B0A395D1F1F3AULL, 0xBAC6158A65DBB070ULL, 0x650EF9ACB6D59D0CULL),
+     S256Field(0x85849CA67068387BULL, 0x58BB4608A76C26BAULL, 0x70E9C0B9279B82C5ULL, 0x085D11F21162B118ULL), false},
+    {S256Field(0x440CD3C6B4EC1D2DULL, 0xD9099F5C6E7D8F45ULL, 0xAFE9D672967B691FULL, 0xEAF98363D6064739ULL),
+     S256Field(0xFCFE75604C838452ULL, 0xA9F52D5457E84B53ULL, 0x775228A0E6B199AAULL, 0xE518183A7FE78D22ULL), false},
+    {S256Field(0xD42C8E808BD98EE1ULL, 0x579DF37A908992BEULL, 0xFEA7C924A8FBA197ULL, 0x1D770ACE0CEB2183ULL),
+     S256Field(0xF9FB81791D38FFCAULL, 0x37F61CA40E3D57ECULL, 0x78963038B6552A86ULL, 0x278F8805F46EF5DEULL), false},
+    {S256Field(0xBCB35BF7045AE767ULL, 0xC273A9CB9E89771CULL, 0x66F40E052C06E5D8ULL, 0xFB95BD163AEDB634ULL),
+     S256Field(0x1853EA0AFBBF0E11ULL, 0xB816F4718A59F134ULL, 0x52004D9D3682275BULL, 0x664C14D811A8DDBCULL), false},
+    {S256Field(0x33FA978BC1EC6CB1ULL, 0xFEED657D808583DEULL, 0xB367BE4BE6FFCA3CULL, 0xDA67A91D91049CDCULL),
+     S256Field(0x7E9EA8E27A68BE1DULL, 0xDEC7ADC508F740A1ULL, 0x41F463F7EC9780E5ULL, 0x9BACAA35481642BCULL), false},
+    {S256Field(0x5EE3CC821FE741C9ULL, 0x8BBD9F35CCEA5A83ULL, 0x7C0C0CFAAF00D871ULL, 0x4DBACD365FA1EF58ULL),
+     S256Field(0x60BE10F8338EB623ULL, 0x0CC384A09FC0535FULL, 0x7FDCFD59E838299DULL, 0x16C3540E8A51892EULL), false},
+    {S256Field(0x9EFDD06515BC8A44ULL, 0x68410177CBE151A1ULL, 0xD38565A4BA5A5FC7ULL, 0x4D0180583CFCEDA3ULL),
+     S256Field(0x2F1F94C91ADBC09EULL, 0x969420468582DA36ULL, 0x67E9BA8007D63813ULL, 0x3A33C6C18CB4F5D3ULL), false},
+    {S256Field(0x87EDA8BAB4E218DAULL, 0x0F4C85F152686050ULL, 0xE68F17D8FF41C259ULL, 0x13D1FFC481509BEEULL),
+     S256Field(0xE0DB419DDB191C19ULL, 0xA4AD01206D5BD127ULL, 0xCECB9337B1B758BDULL, 0x6008391FA991961DULL), false},
+    {S256Field(0xBC1AB52865DAEB00ULL, 0x5923EB24CE645F76ULL, 0x082CB6A273B6E9D1ULL, 0x2F661507DF5CF957ULL),
+     S256Field(0x12276789833992C0ULL, 0x6ECDEE27195D308CULL, 0x6EF9537A8200ADD0ULL, 0xFD5C12136F52B33FULL), false},
+    {S256Field(0xF52213E4935B4EB8ULL, 0x07F557F1AB8B5A3CULL, 0xF0FF54A3CCAF2DCEULL, 0xC11968E43ADF2256ULL),
+     S256Field(0x7044996D6F911ADDULL, 0x42F8B49412A7149BULL, 0x8379D81FE6766F82ULL, 0xBFF5E6937786458FULL), false},
+    {S256Field(0x182A90A0916AA6D9ULL, 0x3662C8B647702DCFULL, 0x254F174DA1835A38ULL, 0xF594117D05FE47D2ULL),
+     S256Field(0xC7D0696EBF2E50CFULL, 0x7A9277883E6B5B86ULL, 0xCF65DBDAB094BCEBULL, 0xCAA761A56E971B12ULL), false},
+    {S256Field(0x133B40CAA2E96DB8ULL, 0x3CC9D916CE29DBFFULL, 0x7659C79C45B0533BULL, 0x219B4F9CEF6C6000ULL),
+     S256Field(0x27DF01A78D3B6BC7ULL, 0x394F8AC53E905765ULL, 0xF5A44180C0372A6EULL, 0x24D9C605D959EFEAULL), false},
+    {S256Field(0xCAAE03957AC6F4C0ULL, 0xDA4E8DE8CC4BDC4CULL, 0xC4E1C38BE696711DULL, 0x0F2D4D7F1F4D9CDEULL),
+     S256Field(0xE7E7BBAD72339B58ULL, 0x8F6A10A790242656ULL, 0x17FB27FDF381E71EULL, 0x3EC89F857E93DE4DULL), false},
+    {S256Field(0xC56D1F9AF4284327ULL, 0xAC4020B0383A6FACULL, 0xDD43EBDD806A3417ULL, 0x0F6840BDCD64B45CULL),
+     S256Field(0x400D275A45E2AB72ULL, 0xB68DABA7712B9EB7ULL, 0x495E8BFF4B6114AFULL, 0xF304D37F100F1A77ULL), false},
+    {S256Field(0xD855053FDF428CB2ULL, 0x233822FD66A22B55ULL, 0x1EB7A1815958D0F1ULL, 0x1D5DCEC2E2A14BBDULL),
+     S256Field(0x1E5ED100895B189BULL, 0xBD3E912F876044A5ULL, 0x0D078782486F0B88ULL, 0x6E5C4083B142C8C5ULL), false},
+    {S256Field(0x295BA10959DFFC96ULL, 0x9228CDA5AFAC5857ULL, 0xF6F9B395C817EB01ULL, 0x161C6CBEE1483DEAULL),
+     S256Field(0xC93BCF611B492DE4ULL, 0x9B9634C92EAF8621ULL, 0x5BD259391CB18305ULL, 0x8A26CA92A6B9FF98ULL), false},
+    {S256Field(0xFB0EA88FA8381273ULL, 0xD84376960693DAE5ULL, 0x9FDEA9B2CC4126CEULL, 0x89D9A2FD30096743ULL),
+     S256Field(0xA03EB3EED309773DULL, 0x8F61D680AD127324ULL, 0x377AAF2076CF62F5ULL, 0xDFCA25B451D66F50ULL), false},
+    {S256Field(0x4CF6155F810A683FULL, 0x5248BD31BF6EB1BEULL, 0xFE6C7285F189AA8CULL, 0x783D0ECC3F64D4A0ULL),
+     S256Field(0xDFD66CE2E0F54C4CULL, 0xB5DE928872395EE9ULL, 0x016B745727F2D51EULL, 0x200A6D029073F4A3ULL), false},
+    {S256Field(0x1CC32B2CB5C71D91ULL, 0x23945E2E2A894FD2ULL, 0xC52A1C13115AFECEULL, 0x83191B8783A50AE1ULL),
+     S256Field(0x70B9EC08E2148A61ULL, 0x17A11F51750445EEULL, 0x9E06DE13D17CAE8AULL, 0xE0AC7F1573801B70ULL), false},
+    {S256Field(0x57545CCC1A37B7C0ULL, 0xEC08D0F7BB11069FULL, 0xA6E000935EF22151ULL, 0x53904FAA0B334CDDULL),
+     S256Field(0x9DCB096B022771C8ULL, 0x13999981E1443469ULL, 0x88C9ECCAC20D3C1CULL, 0x5BC087D0BC80106DULL), false},
+    {S256Field(0x57CD0F1F38A47CA9ULL, 0x2A6EE7AAAD0F85ADULL, 0x3CF991196316995DULL, 0x01A575AF9D414675ULL),
+     S256Field(0x67C5DF2E77EBCDB7ULL, 0xBDB93C5D9F4D7EA6ULL, 0xCC55FC52E1BB8698ULL, 0x3038F1CB8AB20DC3ULL), false},
+    {S256Field(0x71AC42FE48A2050EULL, 0x742EF557615F8A67ULL, 0x96B769CC6E479B89ULL, 0x673724FD24BC7318ULL),
+     S256Field(0xB90C9A49061D3D70ULL, 0xBE6BACFD43349CC2ULL, 0x203482C09A886B6DULL, 0xE4CF8257896A4A20ULL), false},
+    {S256Field(0xE309D755E315565BULL, 0xD3A61A83D3C20C6EULL, 0xCA71F5C1B76155D6ULL, 0xF5F0E0437621D439ULL),
+     S256Field(0x678430AFDD2ECC82ULL, 0xA5BF61BF3ED7E40AULL, 0xF62189160DF7101AULL, 0x6B9F4E62BE5A052BULL), false},
+    {S256Field(0xCBF6E48382DE63BFULL, 0xE03AF53287261C66ULL, 0x9E598A631F6166A8ULL, 0x4366EFA472DF4C30ULL),
+     S256Field(0x02C6A408E17924CDULL, 0xF33B0C525AAA6D6BULL, 0x2EE2537E130268EAULL, 0x2E7DD909BEE2D7CEULL), false},
+    {S256Field(0x34CF601FA9A78179ULL, 0x6B50E905260D6AFEULL, 0x905A47336209ED9FULL, 0x995CA7F37081B8DCULL),
+     S256Field(0x931FBB4CAFEC1F47ULL, 0xBBCC85569AB64E52ULL, 0xB5E34D880492863AULL, 0xD9A059E95553573AULL), false},
+    {S256Field(0xF10527FF06F96190ULL, 0xD1F02DE907C9525EULL, 0x97BE5569667AA75FULL, 0x7BD753627991AB1FULL),
+     S256Field(0xA3D17204ABDA00F6ULL, 0xCE0FCC5C1E0EA695ULL, 0xD5ED6474943827D6ULL, 0x8336F2B3DBBA6309ULL), false},
+    {S256Field(0xCBE781D9F5362D33ULL, 0x47CBC92146227642ULL, 0x57A7F36D970CA4E3ULL, 0x8F506F0B6C0B6E9AULL),
+     S256Field(0x30487D0C87FA243FULL, 0x48CF925D43BB8EAFULL, 0x9530C5424F1C3368ULL, 0x469F955D2AFA6171ULL), false},
+    {S256Field(0x33B1531556AD41EDULL, 0x0308AC35F4F03524ULL, 0xAFA3419E8918DC92ULL, 0x4F7E927BDDAAD5C1ULL),
+     S256Field(0xDF4357867E642D57ULL, 0x2E7314714EAF775BULL, 0x552980DF53A8F6A6ULL, 0xDFE7745156A88B10ULL), false},
+    {S256Field(0xC1843A1A3E5E6618ULL, 0x166D65F59D8FFCB4ULL, 0x87E017141E412463ULL, 0xFBC2107338B97DBFULL),
+     S256Field(0x0ED54DA02230C860ULL, 0x7F3C4F3F1DCBCCF2ULL, 0xB4960C1A6F39B11DULL, 0x9F9B0859185C9414ULL), false},
+    {S256Field(0xCFA6051267748690ULL, 0x7D57904DD8630B01ULL, 0x94B452B1EDD33D00ULL, 0x2355CB867D291CCCULL),
+     S256Field(0x47C475314C89582BULL, 0x58286858CD1C9391ULL, 0xF55B85EC15AA7C58ULL, 0x21C2F18A5A71E1F8ULL), false},
+    {S256Field(0x13D8D85D849135D3ULL, 0x74203CD012E431FCULL, 0x65C134294130B16AULL, 0x05940BC7EF82A85AULL),
+     S256Field(0xD02D7451962255D2ULL, 0xF1286328C9902391ULL, 0x2F75B0C7AAB6687AULL, 0x90537985EB4FAB61ULL), false},
+    {S256Field(0x6DAEA2160ADE7F16ULL, 0xAE9CBAE93CBE028CULL, 0x013592AB6C275D24ULL, 0x0B66825B9B3DA56CULL),
+     S256Field(0xD944426848C56217ULL, 0xB7243C0DF3E7CD2BULL, 0xEF3A76BA8B57A97FULL, 0xA1FBA0B818E09B3FULL), false},
+    {S256Field(0xC633070164D2374DULL, 0xDCF38A9684CFEB2BULL, 0x5DA5A9F71B3FF6A4ULL, 0x16EE8ED8B5E5C9D2ULL),
+     S256Field(0x80E5BCB4FC865998ULL, 0x0755130EE6D4DDD9ULL, 0x8A26B843E5B6FF62ULL, 0xF500E7F0546FF110ULL), false},
+    {S256Field(0x2906B02299060D5BULL, 0x904613B11C3A3A7CULL, 0xB6109B2FD9F951CBULL, 0xF602043CF0BD022CULL),
+     S256Field(0x76F6F50B1AF88F13ULL, 0x37AA56D2B7DD1A3FULL, 0x881A8F64AC4F7BEAULL, 0xF036B706C1F0CF19ULL), false},
+    {S256Field(0xEFF959F43AD86047ULL, 0x79B53A043A9B8BCAULL, 0x719CCA7764CA9067ULL, 0x8E7BCD0BD35983A7ULL),
+     S256Field(0xEA10047E8460372AULL, 0x79E88E2E47FD68B3ULL, 0x940310420CA95145ULL, 0x10B7770B2A3DA4B3ULL), false},
+    {S256Field(0x77D2808BF13F0351ULL, 0x3BC15B8D3D0389E7ULL, 0xC350F319996950DFULL, 0x33B35BAA195E729DULL),
+     S256Field(0x2BC503CCCB8D7418ULL, 0xAA6560EFBC889B70ULL, 0xF9464036248D52BCULL, 0xA58A0185640ABF87ULL), false},
+    {S256Field(0xFFE8879A041EAD4BULL, 0x3A75EDFB691B03C1ULL, 0xC714734EFAFE76BEULL, 0xBFC90C0C8C8F337EULL),
+     S256Field(0x7452C6F086FEDAEDULL, 0xFB468EFF32E0AE3EULL, 0x4DBA718DD5042D36ULL, 0x7A9481B1E09CDED2ULL), false},
+    {S256Field(0xD71DC7B24414BB36ULL, 0x56F6E109CAD7BCA6ULL, 0x5CB83AD2071F7E22ULL, 0x374DEEAE22C93F95ULL),
+     S256Field(0x7875BEA98DAF734AULL, 0x3828D66300E54321ULL, 0x16032C06F806F729ULL, 0x171165B64FCD4F99ULL), false},
+    {S256Field(0x26E7BD0775BB3B3EULL, 0x50753617EF9F73CBULL, 0xDCA5993E8C2D3F5BULL, 0x732DF11CBE3FAAA4ULL),
+     S256Field(0xCC577E1ED7366693ULL, 0xE69DAD6D64C58436ULL, 0xCB7E255840253916ULL, 0x7F41903EDE8F9977ULL), false},
+    {S256Field(0x694C856EE5B7AD0DULL, 0x76EE767CA9D0D1D3ULL, 0xC2D0D8A496D16C44ULL, 0x3A55690DABB5E00DULL),
+     S256Field(0xD6C98790B2E8C407ULL, 0x01CACB8ACAC31218ULL, 0xFB21FBAC97EF99F3ULL, 0xC3E28E1975A0657BULL), false},
+    {S256Field(0xC5F5B3C1888DC3B9ULL, 0x19A66924E9774C99ULL, 0x28DA8840CC97EF60ULL, 0x4CE094B9603947B4ULL),
+     S256Field(0x2C14F7B6E5C0DE52ULL, 0x16205B20C9EA0650ULL, 0xD57B4D80CA76ACA2ULL, 0x05390FBABF1A9B3EULL), false},
+    {S256Field(0x5E8A64AD6AE7D616ULL, 0x944DBAF2B62A9F0CULL, 0x7C46E07395AEB0DCULL, 0x2380C09C7F3AEAE5ULL),
+     S256Field(0x0099BE48161BBC1AULL, 0x93AF92148F846756ULL, 0xF1598AEFD509B09AULL, 0x6F8E86193464956AULL), false},
+    {S256Field(0x4C375E0B0AAAFE5AULL, 0xE25470B3A509AEDDULL, 0x96D8A6A95B023FD0ULL, 0x9A968EB76FC667DEULL),
+     S256Field(0xCE6BFD424ED975C0ULL, 0xE7B5880A65E70CC0ULL, 0x54FC66D03D861D0EULL, 0xABF6FB07A6D3BA29ULL), false},
+    {S256Field(0x8D962D14EFA32402ULL, 0x5E659C613C66A534ULL, 0xE0F7DB3BB038034EULL, 0x180A4ECED74CEAABULL),
+     S256Field(0x3203780DC4894B4EULL, 0xA602C5937FDCD18BULL, 0xADBBFC2F24FEBE85ULL, 0x498A4D5747BAD7E2ULL), false},
+    {S256Field(0x3751CBF9F34C6397ULL, 0x07DD3DB50074CD09ULL, 0x4F0AEF802536B221ULL, 0xD3C6FBED01716195ULL),
+     S256Field(0xB1FC8D0568CB3F9CULL, 0x8A0C7708905E0E00ULL, 0x9458394D92EAB646ULL, 0x4A0DD2C55E5E2AF1ULL), false},
+    {S256Field(0x927A47B099B2DF82ULL, 0xEC5E7A1647104FB1ULL, 0xCC92D18ECCE32C04ULL, 0x405A645C62BFB92CULL),
+     S256Field(0x5DA2834A09307DBFULL, 0x2FFA9DB2CEDC462BULL, 0xF5CACA61E237E712ULL, 0xBC3CB414F44D96E0ULL), false},
+    {S256Field(0x19B825930AC3137EULL, 0xFE925B62A5AF6446ULL, 0xE02F06A76AAB3953ULL, 0x4CBDE398129243B8ULL),
+     S256Field(0xC008F15CEEC02FE6ULL, 0xD193A7AE588EAD60ULL, 0x50092A134B94C370ULL, 0x6CE554608F136159ULL), false},
+    {S256Field(0xC7119E23E50CE56EULL, 0xC8293AF0D77914A3ULL, 0xE68590FCACBE7816ULL, 0xAA6DC4D3CE531AF3ULL),
+     S256Field(0xB9DF3A347DEDD739ULL, 0xC11984DAF8F710A8ULL, 0x6E1F6EDC5E65E663ULL, 0xEBC7998FA241E529ULL), false},
+    {S256Field(0x47A2306CE0FBF84BULL, 0x03C48FCBBC3F0B8AULL, 0xB8BD9C730C14CEBBULL, 0x4B9D333C82B16247ULL),
+     S256Field(0x239EE4B4A36C3C48ULL, 0x6766D543E2F5B5E6ULL, 0x55313D982679B7EBULL, 0xFD7FC7FBE24CC152ULL), false},
+    {S256Field(0x0A841E1599C43862ULL, 0x71A7F4F18397E669ULL, 0xE6D0818689B81BDEULL, 0x385EED34C1CDFF21ULL),
+     S256Field(0xC0458FE5542E5453ULL, 0x6B304EEC2086DC8CULL, 0x6701DE19E9EBF457ULL, 0x283BEBC3E8EA23F5ULL), false},
+    {S256Field(0xDC83A27078F2827CULL, 0x47C82642BEFC1CE2ULL, 0x0456BE134D5F67D1ULL, 0xF6F622083DAF5480ULL),
+     S256Field(0xD15B20B520AAA102ULL, 0xE657CA7448321BF6ULL, 0xAF2C5715B367CEE7ULL, 0x1BCD4E817DE73A0FULL), false},
+    {S256Field(0x14BD306AB6E2D9B3ULL, 0x41DB92831B38D635ULL, 0x5E12EA6139CF8456ULL, 0x19A314F397C705E7ULL),
+     S256Field(0xD552EE25CBAAAF33ULL, 0xA5021D1D2404BE56ULL, 0x234965F887F528B3ULL, 0x6CACD8F5DAC728DDULL), false},
+    {S256Field(0x9D893209715ADCB6ULL, 0xCD91C3CE7D8C6F36ULL, 0xBD70CB3C3D1FC255ULL, 0xFB26E5188F953DE2ULL),
+     S256Field(0x49DBCA3B58BA68F3ULL, 0x16D2CB31B8B7AB54ULL, 0x58E846A719D01769ULL, 0xF3E128811012A34DULL), false},
+    {S256Field(0x7D8587EB12F00480ULL, 0x20358804A100DCEEULL, 0x55DC986364F67219ULL, 0x5840ED4B95A8DAA3ULL),
+     S256Field(0x1592D5E2BE22CF9EULL, 0xBA75225452AE3872ULL, 0x07968DEAA15DD8DAULL, 0x670CDA6B220BF141ULL), false},
+    {S256Field(0x52E737D963A52264ULL, 0xD0ADFC0315400B37ULL, 0xA806E2A9AAE51CFFULL, 0x85FFDC0DE8187FE9ULL),
+     S256Field(0x98C7D29A82DA2082ULL, 0x678182C92B179D04ULL, 0x0BE568F50554706CULL, 0x3FEE30187AE2948DULL), false},
+    {S256Field(0xE484DEE823F54C42ULL, 0x45DC1A3C269A3DC8ULL, 0x1DC58C1F4ECE5325ULL, 0x9F5701A5346918FBULL),
+     S256Field(0x860E1C492FEB6A21ULL, 0x89EE784AB219E527ULL, 0xBFB95B6B5729BFDDULL, 0xCE7B8FB8801D9E57ULL), false},
+    {S256Field(0xED44DB7560788C1EULL, 0xD18C37060E8BD1D7ULL, 0x28F5C6BC763CEAB7ULL, 0x8991225911B9132DULL),
+     S256Field(0x635C42228E8F0EF1ULL, 0x36969C84FDEF9E11ULL, 0x27B8763559B136FAULL, 0xDA8B4D987CC9AC9BULL), false},
+    {S256Field(0x7E9413329522461AULL, 0xBCB30A265BC71832ULL, 0x01BB8701067EF9A0ULL, 0x27F61169235A8CFCULL),
+     S256Field(0x6AA4CAF9C7301A2DULL, 0xE4981B20DA863944ULL, 0xEA48C56127428EE8ULL, 0xE512F1A9900A6AD2ULL), false},
+    {S256Field(0x6DBD9895E6DDD3ACULL, 0x7BF8F633A2F00651ULL, 0x5852D90D6CE2D5A3ULL, 0x96EE53E6732A2E09ULL),
+     S256Field(0xFBF25B36729B6FDEULL, 0xEF0D07976C66DC06ULL, 0xD8C4C9711EBF1E0EULL, 0x39B9CAEAE4B629F2ULL), false},
+    {S256Field(0xCCE2C9B2D14F36B9ULL, 0x2598CABB63B9F390ULL, 0x261BF2F435F4A981ULL, 0x640779856CEEF941ULL),
+     S256Field(0x894B1EE9E4B4B50AULL, 0x8CDA0870499CEEB2ULL, 0xEF90D75FD85A7B6CULL, 0xDA61928F44E56EFAULL), false},
+    {S256Field(0x9C1FF5A4B6A88C9CULL, 0xA37B68663149DF06ULL, 0x8B21D9AC972CAA2AULL, 0x78659081E5479139ULL),
+     S256Field(0x5E05934575A7D19BULL, 0x12CF919B03AB6A15ULL, 0x69E8FA7225E81961ULL, 0x59A2307792A30D2BULL), false},
+    {S256Field(0xCEF63DF994D6B76FULL, 0x7FE5A9FBB4C815DBULL, 0x452F708BC09DFEAEULL, 0xA23750E31C85669FULL),
+     S256Field(0x41D92CCC8DCCA8DAULL, 0xE7707C11FDB848D1ULL, 0xAC32FA3E4D411113ULL, 0xF7339B14A6E7DE6DULL), false},
+    {S256Field(0xD4FCDB13D0C13079ULL, 0x6F3E5A0154DD1688ULL, 0x809FEA76EDAF3016ULL, 0x5E52B50B6E1F0EBBULL),
+     S256Field(0xC103C48E70E1296FULL, 0x4A3829D13D63CE1CULL, 0x9B69878534A03EACULL, 0x199EDEE73A354B0CULL), false},
+    {S256Field(0x12EE9C64FCEEE475ULL, 0xAB6AC82840ED782BULL, 0x5ED3C021F3CAFF41ULL, 0xBBF1AC07A3F2378DULL),
+     S256Field(0x84622A0087FE5067ULL, 0x24EB9D89438B41D6ULL, 0x10883CC836B15FE3ULL, 0xB4BFB8DEEAD460E6ULL), false},
+    {S256Field(0xC606ED86C3FAC3A7ULL, 0x0FDDF84A5947FBC9ULL, 0x637C73A4413DFA18ULL, 0x06F9D9B803ECF191ULL),
+     S256Field(0xD86890603A842160ULL, 0x7EA4DD2F5C281002ULL, 0x69B8E2A30E45C4D4ULL, 0x7C80C68E603059BAULL), false},
+    {S256Field(0x5C9D22744B7FD72DULL, 0xDA1745E5A7E4DA17ULL, 0x1CDC36C284482939ULL, 0xAE86EEEA252B411CULL),
+     S256Field(0x2334CB7A4EEE38BCULL, 0x8D9211551472F728ULL, 0x62AB0ACE589FF0E9ULL, 0x19E993C9707302F9ULL), false},
+    {S256Field(0x24ED75E8D21CE204ULL, 0xB2A7258E426763D5ULL, 0xB8374D859CA6F72FULL, 0x43CA41D162B3C64FULL),
+     S256Field(0xE525044E934A8F6BULL, 0x9AB6C7B33EA4A468ULL, 0x1C650F9218DBA31FULL, 0xDCEA5A82E37023FAULL), false},
+    {S256Field(0x7A1474267C169290ULL, 0x8718BE75CF36F2EEULL, 0xE61D2F8C56DC2C48ULL, 0x2248C9F90BBFFF55ULL),
+     S256Field(0x369D8A12883EA257ULL, 0xE163750235DA2BE2ULL, 0xA506BB55B435BA18ULL, 0xFA0594692D21EED7ULL), false},
+    {S256Field(0x64FCE92CEBE6EFDAULL, 0x922D4FF3F8728059ULL, 0xB666F723785A506DULL, 0x9C3E06EF22892BF5ULL),
+     S256Field(0xDF140F32A7AEFC7DULL, 0xD43BC8687B36FDF7ULL, 0x8AF0B2D44CE26FD5ULL, 0xA7B709E5E762923DULL), false},
+    {S256Field(0x5B3A432014978583ULL, 0xCDD6E9AEF061613FULL, 0x4978419990F92214ULL, 0x30ABF89B9CF23137ULL),
+     S256Field(0x446180351DC75777ULL, 0x63120EA23BB584ACULL, 0xCDF7B4F2D0E1AB80ULL, 0x4B035115477F7498ULL), false},
+    {S256Field(0x79127AB5C6C88BE2ULL, 0xEA2C7820D06EE5E2ULL, 0x3BB72759D830775BULL, 0x5D6F8AA313E20F03ULL),
+     S256Field(0x892E553F0D7AD75DULL, 0xEDAB6F8EA6BF92C2ULL, 0xC71AAF33AB08BC20ULL, 0xADC4B18D8D56D4E8ULL), false},
+    {S256Field(0xFD0DAC4BB50964E3ULL, 0xA99F0877DD1C6F76ULL, 0x4AC11B48D94085D0ULL, 0xE11A6E16E05C4407ULL),
+     S256Field(0x767FBF8B0682BFC8ULL, 0x17ADC6E138318C6FULL, 0xE1AD5E2596F0AF24ULL, 0x87D6065B87A2D430ULL), false},
+    {S256Field(0xF289351B92D1B844ULL, 0xC69C0382C173E484ULL, 0xC86B15C3C1388BC5ULL, 0xF57D35C304A60D5FULL),
+     S256Field(0x464BABBD61266837ULL, 0x7006972030915C6AULL, 0x7904D3F5A9E4634CULL, 0x707F3D9EA98EF4D9ULL), false},
+    {S256Field(0x73971647B21F51D3ULL, 0x11F80D462C39FDF8ULL, 0xCE8D419B9DA10BA8ULL, 0x6A73FB216726A955ULL),
+     S256Field(0x01824DD9A5224B17ULL, 0x2DB482468B60B774ULL, 0x7FEA7D2949721132ULL, 0x4F3CEEFCA1EDF3C2ULL), false},
+    {S256Field(0x234D007F3CC7CB09ULL, 0x3BC7EB68A1D1B435ULL, 0xF596E1FEE3D87146ULL, 0x13E7607A3A6594A5ULL),
+     S256Field(0x1BE75A8A08079160ULL, 0x65EAE2BB66B57641ULL, 0xE325FDD85B34299DULL, 0x284DC88DE8FBB8B1ULL), false},
+    {S256Field(0x39A37E63EC288015ULL, 0x4673F853EEDC99CCULL, 0x681FAC61A05B6AA6ULL, 0xAA014EAAD936DE6FULL),
+     S256Field(0xDF814E6646C1006FULL, 0xEF4B9B0743CECAD9ULL, 0xC3F2A7E43F7B0F63ULL, 0x3DE913C04636BE9AULL), false},
+    {S256Field(0x0060CE1258CDEE05ULL, 0xA8761FB2172EC3B9ULL, 0x2400250B1B06901DULL, 0x29BEA322568182E6ULL),
+     S256Field(0x9E4A0359A62651C8ULL, 0xF9FC31B6C8C698E3ULL, 0xA9009B3FB8705EC7ULL, 0x7C40D9A2690E9A0EULL), false},
+    {S256Field(0x4CF85578F11D45F9ULL, 0xBA4C1CDE6C796614ULL, 0x4EA2EF2C77DB796EULL, 0x36AEE3D35337512BULL),
+     S256Field(0x9D3BAB3F7CFEBAD4ULL, 0x004B35D0AC473606ULL, 0x79CB954707C98F54ULL, 0xCAADDA35CD69609CULL), false},
+    {S256Field(0x11B6C75612F18ADAULL, 0xD460BD93BBDBDBCCULL, 0xD9C36FAFF33D4A59ULL, 0xF521786D238288E7ULL),
+     S256Field(0x1DD68AFD23953516ULL, 0xAA5EF4A36C5BF098ULL, 0xECC26102BCD1D1D6ULL, 0xE0686FBF6038DB57ULL), false},
+    {S256Field(0x13B7E0E742D0E6BDULL, 0xF774D163DB0F5E53ULL, 0x82A2147C104D6ECBULL, 0x3322D401243C4E25ULL),
+     S256Field(0x24F3A2E96C28B2A0ULL, 0x2805F63EA2873AF6ULL, 0xBFB019BC4DDAF9B7ULL, 0x56E70797E9664EF5ULL), false},
+    {S256Field(0xFC696D32C0ADE462ULL, 0x0D4CDDC8EADBCF29ULL, 0x120EF31B04C80CD5ULL, 0x8D26200250CEBDAEULL),
+     S256Field(0xD8E0A8B90F26470CULL, 0x1D4AFB4E72678B3AULL, 0xD31F6F2DC3EE36BAULL, 0xEBED3BB4715BF437ULL), false},
+    {S256Field(0xABD9D3F2059AB499ULL, 0x0B13299C6E73C330ULL, 0x5D2196B3C67F01BCULL, 0x78BAAFF3015C05BAULL),
+     S256Field(0x681D2318FEE097FDULL, 0x91632EEE8D125199ULL, 0xAFCA84E0ED82082EULL, 0xAD4BDCDBDB06C0AFULL), false},
+    {S256Field(0x9164643E1516E633ULL, 0x8ED4930D072D9C8BULL, 0xCE4068A1F594D03BULL, 0x1238C0766EAEBEA9ULL),
+     S256Field(0x05CDB728C77B7805ULL, 0x0946252DCC740228ULL, 0xD6C979E2D1C3DC17ULL, 0x8A9DB02DBB271359ULL), false},
+    {S256Field(0x4493E16CFD06ACE6ULL, 0x23709B36F83A20CAULL, 0xC20B84984929AB1AULL, 0x6F70F211A14AE3D4ULL),
+     S256Field(0x048BED34B602D5DEULL, 0x75329566BE5AC5EEULL, 0x6F95D8F347B99F50ULL, 0x791E8A3094027B73ULL), false},
+    {S256Field(0xC3063330A5CD5379ULL, 0x2DB794385870BCADULL, 0xA782481B8AA4D223ULL, 0x17C072D56BDD1382ULL),
+     S256Field(0xF7CAE051B108CD25ULL, 0x8959AC76265BAD0DULL, 0xE77C1247AF1D034FULL, 0xD901BDF4283DA064ULL), false},
+    {S256Field(0xDC8EE3EE60EE1B40ULL, 0x8CED485B71E96247ULL, 0xF80949F19103CCD4ULL, 0xE1599DB29D6AA415ULL),
+     S256Field(0xE1D6265ED78F93A6ULL, 0xA6363A74BC32999DULL, 0xEFAF894AAA2FC7CFULL, 0x793362232A81D4A0ULL), false},
+    {S256Field(0x19B01552788E7A66ULL, 0xCDDCD7282B0EC216ULL, 0xE7B2EA758A6A11B9ULL, 0x271D5B0770CB9C15ULL),
+     S256Field(0x7A8D7258E03C9727ULL, 0xE2A065E3508A824EULL, 0xE457D09949AC877FULL, 0x5D3AA45834E7F491ULL), false},
+    {S256Field(0xF81DFA2849C00C3EULL, 0xF00E8F03C91208E2ULL, 0x436562D33D451859ULL, 0xBB0B049704406956ULL),
+     S256Field(0x799A982D11955A35ULL, 0xFE67044E905DC90AULL, 0x655D2FA17AB1B052ULL, 0x4067E45853AF9F63ULL), false},
+    {S256Field(0xDA1E87D8A8A923B7ULL, 0xAEF650EED81C5B30ULL, 0x540708AB68338266ULL, 0xAC2ACB9B21999A70ULL),
+     S256Field(0xA2DC124AD7CD20A6ULL, 0x60B0D0BF12D27A4FULL, 0x1C9AFA0DF13D9EB3ULL, 0x7684428511C1724DULL), false},
+    {S256Field(0xE0E75B9C05DD32E6ULL, 0xC663B551B53E5EE7ULL, 0x9B649DBE075A5FBFULL, 0xDC5A41554195789EULL),
+     S256Field(0x80E7DB7A754A99B9ULL, 0x2FF2EE9076E49BCFULL, 0x6DCEA5E201BF5944ULL, 0x4AF3A8A63F9F67A7ULL), false},
+    {S256Field(0x5793C018CA2D8DAEULL, 0xAC32A5F91FD25EA9ULL, 0xBA6B25EF9CB2256EULL, 0x88271C02621192F9ULL),
+     S256Field(0xFB426C0F3E1E77D9ULL, 0xC300876DC717D099ULL, 0x401C8B3AE5ABF5ACULL, 0xD719DD53507176AAULL), false},
+    {S256Field(0x9ED45BAC4544E7CBULL, 0xA1064225B5296035ULL, 0xBE3354A571014E99ULL, 0x156E197039873B9DULL),
+     S256Field(0x6D5392C0AD250A37ULL, 0x9496D58D5EB439CDULL, 0xA939572A63834BE8ULL, 0x6BC08D9F8F31907DULL), false},
+    {S256Field(0x8F5BADC99C89240FULL, 0x74F8C4BAFA2E7B85ULL, 0xE18EE09197E0E176ULL, 0x15B8390D652D7338ULL),
+     S256Field(0x2E2F9EF8E326F04AULL, 0xB30367AB5C1A3335ULL, 0x3ABDD7CCC7A59F99ULL, 0x786CF20C8EFE8D08ULL), false},
+    {S256Field(0xDBFBC29CC59853CAULL, 0x48E9626B9F19BF54ULL, 0x6BCA76A228E71613ULL, 0x4269BCCECB684382ULL),
+     S256Field(0xDA958EF535B8D367ULL, 0xFD3940A5F9E5A8A3ULL, 0x23C84CA9C431A409ULL, 0xED2B1C1A82C016B7ULL), false},
+    {S256Field(0x721D74D28134AB83ULL, 0x741B3F9AF7643397ULL, 0x2BD1770D89665868ULL, 0x85672C7D2DE0B7DAULL),
+     S256Field(0xC8E3094F790313A6ULL, 0xE77F17FCC5298F44ULL, 0x6374049BFA62C2E5ULL, 0x7C481B9B5B43B2EBULL), false},
+    {S256Field(0x998B90BC1F17FC25ULL, 0x3B89EA46DF2E6D96ULL, 0x36C1861215C8A61FULL, 0x534CCF6B740F9EC0ULL),
+     S256Field(0xD71C7F6ECFE86E76ULL, 0x0AE3D277BFDD28DDULL, 0x462AE3DD32D54355ULL, 0xD5715CB09C8B2DDBULL), false},
+    {S256Field(0xFDF0723A83BA9000ULL, 0xC4872F9C6825E8B6ULL, 0x684876075840143DULL, 0xAC3874F9FFF1D8C1ULL),
+     S256Field(0x4DA3C7D96F10CF0AULL, 0x085E350D7F66E9FAULL, 0xB862DDE894117F93ULL, 0xAA65E92308A1C069ULL), false},
+    {S256Field(0xC7170923E8BEE8B6ULL, 0x79020D47ECFBC8D2ULL, 0x081E142018F8AAEDULL, 0xA91D1F5CEE87B7F3ULL),
+     S256Field(0x003D16AA410644C1ULL, 0xF800569F628CB225ULL, 0x5A7189C8DDDAD3B2ULL, 0x748A324EE2DF8EE1ULL), false},
+    {S256Field(0x1A606F66ED06DBD4ULL, 0xEC0E3F8578A20D08ULL, 0x9AD14075E9A3E729ULL, 0x570D5CE7AA687013ULL),
+     S256Field(0x5A65BECEBD1ED495ULL, 0xB683A36DC6460BEDULL, 0x05B66E6711D01BBBULL, 0xA6AE5349420E02F6ULL), false},
+    {S256Field(0xAE5D630B17BA402EULL, 0xC3B81A5C2D042989ULL, 0x58BEAD0C4848E3C3ULL, 0x8E891B5CD18FA02AULL),
+     S256Field(0x8E1B6279C4FAD9E0ULL, 0xAF650C242157A7EEULL, 0x0B38D0E404F2A306ULL, 0xE5D30E0E6A9EC668ULL), false},
+    {S256Field(0x434C1F92092D230EULL, 0xDAEE32A0D2933928ULL, 0xF87C229EE0366EF5ULL, 0x75B5F87028268BB6ULL),
+     S256Field(0x037CBDFBD51570B8ULL, 0x0267A4B00511F8FBULL, 0x63D7874554DDFA8EULL, 0x527CCE21E3A78523ULL), false},
+    {S256Field(0xAA1A1C255984CF74ULL, 0x0735AE45BEF61F10ULL, 0xC1A214DDE2D4383CULL, 0xC15C8C23D90C8E35ULL),
+     S256Field(0xC4A48CD839CCB000ULL, 0x47BF772D50B015A2ULL, 0xC8DC6F45E25FD7BAULL, 0x2BA954D828522235ULL), false},
+    {S256Field(0x47B6BF6AC34FCC0EULL, 0x927F10A42BE3884CULL, 0xB0A5B80E27D259C8ULL, 0x44FC8EFAE1EDDEC2ULL),
+     S256Field(0x9CFF031E719C420AULL, 0x720E94A4BCD0489DULL, 0xE49267E78833D3D7ULL, 0xD2C7DE94BA9B1367ULL), false},
+    {S256Field(0x58413F0E8942DEA9ULL, 0xAB35A98CB8B7F130ULL, 0x7946AD8BA60A87FEULL, 0x1566861334285DB6ULL),
+     S256Field(0xF92546F0367BE3DFULL, 0xDE4828688B23EDCBULL, 0x04E894EFFB20FD22ULL, 0x4F3597AA0E82F051ULL), false},
+    {S256Field(0xD5A481FC8BB69991ULL, 0xFFFB3FA2C3307175ULL, 0x866A16620E02F535ULL, 0xDEA2BA47BACE7BC6ULL),
+     S256Field(0x706742A9F16FE2DFULL, 0x229DCDB3621ED9BCULL, 0xAC5CBFEC84F7B9E7ULL, 0xAE28BFD6D90C28E4ULL), false},
+    {S256Field(0xE61ED61E536BCFE8ULL, 0x0E0C179ED69B7BB3ULL, 0x472CA8F2306B319AULL, 0x1332F8BC1CC6999BULL),
+     S256Field(0x51B0DD2CDAE78402ULL, 0xBA93B424D5A8C214ULL, 0x13F67C4535DC0681ULL, 0xC39DC7EE29602ED7ULL), false},
+    {S256Field(0x8C240D02514FC9CCULL, 0x26D00ABC29A46165ULL, 0xEFC1CF6CC4B8A836ULL, 0x3968FC98A6E168D6ULL),
+     S256Field(0x019394895FAD37DDULL, 0x1A146576FF88F334ULL, 0x1237982D1AAD32C9ULL, 0x789CBBD0DB4B5928ULL), false},
+    {S256Field(0xC023AF3E14CC84BFULL, 0x80BF1D6DEEBA1F27ULL, 0x830E37159C2A4953ULL, 0xB5DD69364E540816ULL),
+     S256Field(0xC785217CE374750CULL, 0x353110DEDD6B1A90ULL, 0x6BD18733C58D4145ULL, 0x4B36EC5853C7CB6BULL), false},
+    {S256Field(0x0AEC2191AE0C85F1ULL, 0xA6A52E53603A3A25ULL, 0x26B25DF0957945D5ULL, 0x6896910698E06A29ULL),
+     S256Field(0x2C7482332DC1DE21ULL, 0x1F40C19DA0D50392ULL, 0x56F305C1D845D72DULL, 0xAEFD3FB4B38C9792ULL), false},
+    {S256Field(0xFFD959AF60C82A0AULL, 0x0F9226C60F668832ULL, 0x6B06C9F1919413B1ULL, 0x0948BF809B1988A4ULL),
+     S256Field(0xD4CB7F88D8C8E589ULL, 0x6D4DFF08C97CD2BEULL, 0xDC6B74C5D1C3418CULL, 0x53A562856DCB6646ULL), false},
+    {S256Field(0x396EB0457E8B000AULL, 0xEF16C1331E825E51ULL, 0x0D5CE4C66291F0B6ULL, 0x26952C7F372E5936ULL),
+     S256Field(0x8C3D401F05EF705AULL, 0xDEBE398F653D6731ULL, 0x62BC893D2D688422ULL, 0xF513EA4C5800A688ULL), false},
+    {S256Field(0x7282FE5FB8C8AC7FULL, 0x641242EE65E2AA52ULL, 0xB5C3396D2056F849ULL, 0x9945B2FBE3822BBCULL),
+     S256Field(0x96D943A169AEA3B0ULL, 0x282F7A23EEDACDFAULL, 0x607DB44FFB28EFF5ULL, 0x3EEFED824B0F282DULL), false},
+    {S256Field(0xF102588976134F96ULL, 0xF521196572D6B0E9ULL, 0xBEF2BE8B131FF243ULL, 0xC62E58E6FC23C5BDULL),
+     S256Field(0x82277ED4D14CF97EULL, 0xBCFB853563731C3EULL, 0x8C3D676753141FC5ULL, 0x4397827D45B1A167ULL), false},
+    {S256Field(0xED1D79E3969E353AULL, 0x10A0440852BBE1F6ULL, 0x235F82227107D5FEULL, 0x2A314C6B205870E6ULL),
+     S256Field(0xC25926E1E5746067ULL, 0x138A54AADB2658BFULL, 0x1A463E476BAA1BA0ULL, 0x15A4AC0BF35A27ACULL), false},
+    {S256Field(0x3BAA499892FCCF64ULL, 0x3BD278DE2581318EULL, 0xB068772C77C95DBFULL, 0x0C7D115C0EB4637DULL),
+     S256Field(0x53F6D3B32878FEE0ULL, 0x48785D83959AE68DULL, 0x7AA424B8478AF145ULL, 0x4AA8747B1925B044ULL), false},
+    {S256Field(0x89E2F49EE9B84966ULL, 0x1B4F4106DD7F3FF9ULL, 0x498B6FAF3A6B6C91ULL, 0x5959A500B703FC2DULL),
+     S256Field(0x40A6632187473A6AULL, 0x9100DCC08CFE2426ULL, 0xF94312820DC82A70ULL, 0x0370E6741F5CA897ULL), false},
+    {S256Field(0x3686F8800B188CBBULL, 0xB81C03200807DE97ULL, 0x1683329A716622B0ULL, 0x107460520EEC5C74ULL),
+     S256Field(0x01D7B6361F272124ULL, 0x242E0D748DCE3DA6ULL, 0x35326B9B9CF54A11ULL, 0xABE5D4C09A21598CULL), false},
+    {S256Field(0x3B0C9B922BC6B173ULL, 0x7DD8623C7EED3FEBULL, 0xE1160C46305B5F9DULL, 0x9EEB313937222FE8ULL),
+     S256Field(0x9539620D9723A71DULL, 0x0EA71ABED0E70C4BULL, 0x952AABFDBBBA1AE3ULL, 0xE121F1E0110ED58DULL), false},
+    {S256Field(0x457E9BC92AD2CF25ULL, 0x7BA49B4DBC927A94ULL, 0x18D1E80BA27B3C2FULL, 0x520D9A9BF3DAA9CBULL),
+     S256Field(0x610B6C83A285181FULL, 0x2BAB0B6511BF70C7ULL, 0x48F0AE71B4BA9706ULL, 0xE526F49B10271EAEULL), false},
+    {S256Field(0x5772443F7EC805F3ULL, 0x7DE40F7509D99591ULL, 0x16EBB238806E9788ULL, 0x39CC4FE4C7F718F5ULL),
+     S256Field(0xD191A0C13A3C48D3ULL, 0xBBB957373FC912E4ULL, 0x151E6693CF42DE7DULL, 0xECB1472C5A46F8F3ULL), false},
+    {S256Field(0x8B5AEBAC548D5622ULL, 0xE1DB07EF7A51BD2EULL, 0xA39586A81BF3381BULL, 0x5FC6C11E61689535ULL),
+     S256Field(0x0D0D840101AC1683ULL, 0x0E05AD08E6C7BF30ULL, 0x9C19BA2DB0367ACBULL, 0x10E80E549AA1D9DBULL), false},
+    {S256Field(0x93D62FB5CE22580EULL, 0xC7132896D2D6F887ULL, 0x6892FFDE64DBD4D2ULL, 0xF94C807466ECDC69ULL),
+     S256Field(0x81E523F67127DB82ULL, 0x9887EC4532371D4EULL, 0x9194BFF6AB5A81F6ULL, 0x5E9C7FDC6785225AULL), false},
+    {S256Field(0x123AB607C0A3D8A5ULL, 0x26D77D684573EF99ULL, 0x3431274A33ED09ADULL, 0x5AA433E5D872D6E9ULL),
+     S256Field(0xFB5F7EF76D3C2BA7ULL, 0x16475CF52D9D6EF4ULL, 0x19A394AEC728A561ULL, 0xDDCEA1FC682AE79AULL), false},
+    {S256Field(0x6BE40BAD10C4F21FULL, 0x5024A9594D03DA7AULL, 0xFCC02068DB1999D2ULL, 0x8CCCB86C6AD5D162ULL),
+     S256Field(0xF7F126EA729DFEA0ULL, 0x4B92DCAC8264BE28ULL, 0x699BEF549C8758A5ULL, 0x57F8965862751C43ULL), false},
+    {S256Field(0xCCECD819F38FD8E8ULL, 0xF1B0E44DFC69752AULL, 0x4F067CE0F02873A8ULL, 0x6260CE7F461801C3ULL),
+     S256Field(0xC1A84E95B2B4AE17ULL, 0xECD292238051C198ULL, 0xA7F09049776A1EF7ULL, 0xBC2DA82B6FA5B571ULL), false},
+    {S256Field(0x0766746F3D477C2DULL, 0x16E65C5196AAD27EULL, 0xDEC8409BE84F1A13ULL, 0x85D8DA4748AD1A73ULL),
+     S256Field(0x2079816FC7D1DD70ULL, 0x94B0A02033C4D5A6ULL, 0x586B536531EFC7BCULL, 0x58948B53665C6690ULL), false},
+    {S256Field(0xBB0BA46541136602ULL, 0x38C46F480D9E3A5BULL, 0x3D058937F2333B3DULL, 0x87D127280482DFC3ULL),
+     S256Field(0x4F683C41D8AF6AACULL, 0x87A884746FD3BF7CULL, 0x926A276CFF677453ULL, 0x71CE24870A5A03DEULL), false},
+    {S256Field(0x4850312D6C0B80D9ULL, 0x4D1E7E100FDC47F0ULL, 0x8C0892E9CC3EE3EEULL, 0x8E2A7166E7EC4B96ULL),
+     S256Field(0x49C61F2AD6B29F50ULL, 0x5297B688D706349AULL, 0x2CEDD29B716A9D48ULL, 0xEADB0BA9AE2CBE59ULL), false},
+    {S256Field(0x5B205D7348C5A916ULL, 0x3F5C440D535610F2ULL, 0x6B0ACC63DAB54AA1ULL, 0xFD5D7D3FE261E974ULL),
+     S256Field(0xB14B37B07ADB8BDAULL, 0xE5D73814BDCF6FAAULL, 0xD2B43CA679C7B52FULL, 0x0DD83ED0EEB55B07ULL), false},
+    {S256Field(0x674A35C8B0E74459ULL, 0xFEF2376387DDB6DDULL, 0x590F4658713C8A91ULL, 0x28DF781D4EC05680ULL),
+     S256Field(0x8DE07CC0EF5E656FULL, 0xA3795BA501AE6F0AULL, 0xCB0DB17890F22794ULL, 0xF1499EA66A130F17ULL), false},
+    {S256Field(0x45D9909635F7529CULL, 0x38765B98B5BD51DDULL, 0x2BA453C32D344381ULL, 0xDE0DD410981C2612ULL),
+     S256Field(0x63C20C02E4CD88FEULL, 0x178924C6889B7740ULL, 0x9B2109822D7A3570ULL, 0xD70A6E9D10A2145FULL), false},
+    {S256Field(0x9921FA3D2C4561BEULL, 0xEE4AB2E81359D90FULL, 0xDC8366ECD78F8950ULL, 0x769BC75842BFF58EULL),
+     S256Field(0xD5920BFFB0D9685FULL, 0x41A177767B7873ADULL, 0xC8DCE4CEF73F5D47ULL, 0x4BF817362FE783BAULL), false},
+    {S256Field(0x3C82F48D38F76D11ULL, 0x1511000FBF851557ULL, 0x69C5BEFC39C292A2ULL, 0xB26C208ADA4CF44EULL),
+     S256Field(0xDC1C00B1E3B7356BULL, 0x050030659D82624BULL, 0xF0C4E87D90CD6433ULL, 0x1F1CF8820949D33CULL), false},
+    {S256Field(0x31239DA0948E129EULL, 0x2BD1DFB2C0289B10ULL, 0xAF0F8DE28E53C2DFULL, 0x66E3FCEFB7B24CF7ULL),
+     S256Field(0x72BBC3602EE7BBEAULL, 0x5FD7D99ED1A53B51ULL, 0x598B5BF34CDF80CBULL, 0x20BF8B4FB770C0F6ULL), false},
+    {S256Field(0xF94E3B06669E22DBULL, 0xAC993FF59F9C8933ULL, 0xA7E3BD29018C294EULL, 0xFCEB14B8FC7FF523ULL),
+     S256Field(0xBF572DB25C2260A1ULL, 0xAD550E793A4EBE4CULL, 0xFCD8A5A7525F0924ULL, 0x64AA6B3A40D6B8D1ULL), false},
+    {S256Field(0x346D9DC529C71143ULL, 0x2E7EADAC44F057EAULL, 0x3CA7CCF90023FA35ULL, 0x0EB45F9622BBEA10ULL),
+     S256Field(0xC8A8CDA20B70B136ULL, 0xD65969EA6A2B1BF4ULL, 0x573601F5901E2857ULL, 0x52C42F585838BD0FULL), false},
+    {S256Field(0x6F084179A38A2755ULL, 0x53721A716549C550ULL, 0x55C175774B507FAAULL, 0x4E909A623CCD5CACULL),
+     S256Field(0xAF7A49F623CCA3DEULL, 0xB6CD5394D229800CULL, 0xCEF246DD507559DBULL, 0xAE56DA878CCE35AEULL), false},
+    {S256Field(0x00CD148D3C07D7C8ULL, 0xE0F19675F829E32FULL, 0x68470411BF3D4899ULL, 0x3CF9208AB230B73DULL),
+     S256Field(0x0C4A91DADA4CEE08ULL, 0x9D4684C8D5B8C59CULL, 0x51ECE6CA65C16720ULL, 0xDE03C64C15AF865DULL), false},
+    {S256Field(0xA8258959983BA64DULL, 0xBDE60F7788C595A3ULL, 0xBFB0A145EB8E40E2ULL, 0xC367455C22E04C03ULL),
+     S256Field(0x614CC8F96A2181FDULL, 0x42626AACA1778F14ULL, 0x080E0E6E84D964C7ULL, 0x3A520AD069CB6033ULL), false},
+    {S256Field(0x2953CC8D2037FA2DULL, 0x043EC8F575BFDC43ULL, 0x3D8348414BBF4103ULL, 0xE5037DE0AFC1D8D4ULL),
+     S256Field(0xE0E5DC841D755BDAULL, 0xBD5F5B03EC481F10ULL, 0xF9F98D09FB990BDDULL, 0x4571534BAA94D3B5ULL), false},
+    {S256Field(0x8C63C8C79E3D34EFULL, 0xC3AB217C792A2DDBULL, 0xF40B6CF7D2D61B3EULL, 0xA5E00DA467FD5494ULL),
+     S256Field(0xB855C5CE2F7ADB4CULL, 0x5B60DCFE790900ACULL, 0x421726FE99BF43D2ULL, 0x098FE5F5E5608555ULL), false},
+    {S256Field(0x388A8A6E177E7775ULL, 0xB5E1559388ED95F6ULL, 0xE58543BACF5291AEULL, 0x9D896A3AFF9633CEULL),
+     S256Field(0xEFCF6D3ABA056691ULL, 0xE899CD7EE299253BULL, 0x94E964ED7250927DULL, 0xDD91A9E43F49BF0BULL), false},
+    {S256Field(0xE6737160D7B91252ULL, 0x6D4AFD2E4477572AULL, 0x3519F4BB1C9BFBC4ULL, 0xA99415F5EF3A2B40ULL),
+     S256Field(0x73A377AC4BEDC264ULL, 0x899A16AD590F4DDDULL, 0xB9E2F10F24F6F6B6ULL, 0x82D0E64CAE81F84BULL), false},
+    {S256Field(0x5FDE04DE3C2A3293ULL, 0x5688B86EE903476CULL, 0xD0EB0A573282F4CDULL, 0x8327B8EE71163792ULL),
+     S256Field(0x6BC854E18E0DF9BDULL, 0x96AFDAB4EE326A41ULL, 0x18BB3EA662797084ULL, 0x04997E266EE0A98EULL), false},
+    {S256Field(0x15957F1E8C904ED3ULL, 0xDF2A745890585784ULL, 0xF97F8E6431272384ULL, 0x00CF8C2D2DB818DFULL),
+     S256Field(0xB009963B796F77C1ULL, 0x22991D79D32F6827ULL, 0x19DD5C1BD51BD811ULL, 0xAAAD000EA781D441ULL), false},
+    {S256Field(0x2421B26C4562C042ULL, 0x092D23234B8DFB1AULL, 0x97D6661D8F9A8ED6ULL, 0x5AE42AAA2A6DB168ULL),
+     S256Field(0xF905CCDF8F79269CULL, 0x94E0DB95107CD8DBULL, 0xAB5C1DDC60389D4AULL, 0x99D93A7C05FF051EULL), false},
+    {S256Field(0xD8C465B66A540F17ULL, 0x4C750D705F0C132BULL, 0x7D8EDDE098F935F8ULL, 0xB56F4E9F9E4FD1FCULL),
+     S256Field(0x46A2FCAE0200102DULL, 0x21D42963CBCCA854ULL, 0xD3DC11ADF0582D1DULL, 0x32E8E53429CCA856ULL), false},
+    {S256Field(0xB34881285E85AF61ULL, 0x4E8ED722DD4AE766ULL, 0x59AEB68FF6C21B0FULL, 0x92C23AE426A1C8EBULL),
+     S256Field(0x4E723669C36A2B09ULL, 0x2D23AD82B6286FEDULL, 0x09F217D5C738D579ULL, 0x414CF88F01551BB4ULL), false},
+    {S256Field(0x280AA48259E5D1B3ULL, 0x48C9B789FD6CAA3EULL, 0xD1E7E4C6F0FCDB30ULL, 0x3ABA5151CAF6483BULL),
+     S256Field(0xA85B678D42F30087ULL, 0xE1846359D2DE6EE6ULL, 0x9064EC8047D72CC9ULL, 0x8C1E7223BFF251D0ULL), false},
+    {S256Field(0xCE2AF1B2C7B5EBA8ULL, 0x2DABEDC7F918EA36ULL, 0x88D0F4176AF8DF42ULL, 0xFEE5608C76AFDF10ULL),
+     S256Field(0x3F515D368D0B9B5CULL, 0xE380FF42BF905479ULL, 0xB11402F99287C14EULL, 0x3807599134FE58AFULL), false},
+    {S256Field(0x1B2B59888CF8CFFDULL, 0x432E6B15B7A45AE6ULL, 0xD45AFB88F79BDD89ULL, 0x00809B7F1FE78C1BULL),
+     S256Field(0xD91D45A18DB5F32FULL, 0x12A340FAD92B9F93ULL, 0x0288C836DE52FDC9ULL, 0xF817E022BF41A863ULL), false},
+    {S256Field(0x81E3BA4B3C63CAF4ULL, 0xA28FF3AB28F53D52ULL, 0x20A113B4C62A6AFCULL, 0x42E544EB92E667E6ULL),
+     S256Field(0x187AEC09969C29C8ULL, 0x73A50E7B6BEFC5F1ULL, 0xF71F220C17415E78ULL, 0x9FF854E0F91CC671ULL), false},
+    {S256Field(0x6C61905EF7ED9EF9ULL, 0xAD2BA5A00EF0C63DULL, 0x41DF784947FC192AULL, 0x32DDE6DDD352D4A7ULL),
+     S256Field(0x1ABB8468031FB871ULL, 0x59EC1B379C98F4B2ULL, 0xE236A4F94D58C1F4ULL, 0x41D17BDC342067BCULL), false},
+    {S256Field(0x80A2BD985E0F09A1ULL, 0xF0A109F1B9403283ULL, 0x83996ED2A4700EFEULL, 0x7AED83B665532CE3ULL),
+     S256Field(0x045D8CDE85857D73ULL, 0xD88B2F300F3F4A54ULL, 0x7DDAFD0AB1032D8EULL, 0xF5B8545F9A31EF7CULL), false},
+    {S256Field(0x25866A0AE4FCE725ULL, 0xE7E8DBD1C6A6C5B7ULL, 0xF5EA905E8F1771B4ULL, 0xE06372B0F4A207ADULL),
+     S256Field(0xB27034F94EEE31DDULL, 0xD7484A7787104870ULL, 0x12A27BB2AD5A488CULL, 0x7A908974BCE18CFEULL), false},
+    {S256Field(0xFE09AEE43ED2FF3EULL, 0x045EBFDB4EC6ED3CULL, 0x9C8DBD304FAD3F3CULL, 0x0EAC134CA2046B8FULL),
+     S256Field(0xE17206207D210988ULL, 0xAC19F696B7F21376ULL, 0x45BF103BF2B11799ULL, 0x49630DBE79359B42ULL), false},
+    {S256Field(0xDBAA8188DA328D6AULL, 0xB24D773A95ADC18BULL, 0xA346899185B08FA7ULL, 0xC663C05BA6234E00ULL),
+     S256Field(0x23B0BB6ABEC9B8C0ULL, 0xDD8551EA512BF9CCULL, 0xD39AFDCF27571317ULL, 0x3331E98D5F721C38ULL), false},
+    {S256Field(0x476706E4DFBFA4DCULL, 0xF5948A7804C85B17ULL, 0x8392119D7ADBB41FULL, 0xD6788590731FEA19ULL),
+     S256Field(0xCA7BCD6BBD3B5406ULL, 0x6206F1C4DDC9A07CULL, 0x940EF5C6D21C13AAULL, 0x28EAA8C89D5063C4ULL), false},
+    {S256Field(0xBC91C8483996DE2FULL, 0x77CEDF2EE0B25114ULL, 0x9CEB30DEEA0FE4E9ULL, 0xD3FC2682DFB86A45ULL),
+     S256Field(0x8C492241D4526F8CULL, 0x4E59B498DF7ABF16ULL, 0xF68B4754D4F781DAULL, 0xC4F0DF99A45F0A18ULL), false},
+    {S256Field(0x6DC35A6562143FB0ULL, 0xA9FB92830BC205DDULL, 0x0CFAFF3394799597ULL, 0x292ADC1C33AF8379ULL),
+     S256Field(0x8A9DB63CE36AD01CULL, 0xD83E662D735E9D4DULL, 0xF3F1968A0CC4ECF6ULL, 0xA072661BCEE0B647ULL), false},
+    {S256Field(0x5C6C48D103E697EAULL, 0x9CE678FB985F83E8ULL, 0x7DCA1FEC9A3FABD1ULL, 0xC17A4B43FEB2C023ULL),
+     S256Field(0x0EE3B87DDEDC6C87ULL, 0x96E1A1B57F9F02ABULL, 0xCAE178F719601FAEULL, 0x39355C2D55AB5954ULL), false},
+    {S256Field(0x7275FB40E48FF9B3ULL, 0xC7B1A6205599B01AULL, 0x4ABF210F12B71D4BULL, 0x6930FCCBD9A04097ULL),
+     S256Field(0xCFDDAB5F8EE96A4EULL, 0x090F9B13E4ACC51AULL, 0xDA30FCDB875F6D78ULL, 0x7F02AE94B94701EAULL), false},
+    {S256Field(0x82D2C3023163DA1BULL, 0x9A0EDEE60F93A311ULL, 0x68C9349D7FC11FDEULL, 0x8F618B7CA26790B4ULL),
+     S256Field(0xC7F3121103BDD76EULL, 0x6450C66A3249B6E7ULL, 0xB5FBDA74D7AC5A42ULL, 0x78233F25F08BEB6EULL), false},
+    {S256Field(0x84FB09B54D0CEC10ULL, 0xBA25F0FCAADED6B0ULL, 0xAEAB0E61B2D3CE72ULL, 0x4D952A9CA3321E69ULL),
+     S256Field(0x8EE36B13BBD06932ULL, 0xBA4AA2DFC84F54DAULL, 0x4542AEC787B5CB4EULL, 0xB178184A66DD279EULL), false},
+    {S256Field(0xEE8590FE0EC8AE90ULL, 0xCFB26B92E8BBC5DEULL, 0xB86D5B8DAC83F1B8ULL, 0x9798C0F15B7A1E6EULL),
+     S256Field(0x7A9AC2EAE52844D3ULL, 0xE2E4965BD03188E2ULL, 0xDD2EC9494F9C73BEULL, 0xBA40E2AA75A42ED3ULL), false},
+    {S256Field(0x89EC1E6C30B90E0BULL, 0xD6FF1D39FB094A45ULL, 0xFEDC804A59C675B3ULL, 0xA43507F9AD5467D3ULL),
+     S256Field(0x3F000B993A1FDC20ULL, 0xDC2A203653599B5AULL, 0x142D07CCB40BE8C0ULL, 0x7C8F2DC94C3FD71AULL), false},
+    {S256Field(0x05A1978F11D66B7FULL, 0x7AA692505187DC81ULL, 0x47CF1B90B8928475ULL, 0xFDFA6EE3FB5A2D67ULL),
+     S256Field(0xDAA8F80678E5178BULL, 0xD846F9DD13D78DE9ULL, 0x93C0C1C9A3DA18C4ULL, 0x4D9CF31E224998DBULL), false},
+    {S256Field(0xB836B58659C0D7ADULL, 0x1DDB64DB7A2B493AULL, 0xEFE11CA1A749E671ULL, 0x72B04ECD4B7BFBBAULL),
+     S256Field(0x2EFE6FF46723CD97ULL, 0x96265D681DC6F4FBULL, 0xCEDD452D6D934D01ULL, 0x6865B3EA0E64A358ULL), false},
+    {S256Field(0xB80757849265BCF0ULL, 0x69CE2B78411C7D30ULL, 0xADDEA9A461CF220EULL, 0xFD58CE38DE229E43ULL),
+     S256Field(0xF33E7A9CEB996292ULL, 0x87261BFE28F1CD1DULL, 0xD5382AB9A485E4FBULL, 0xFFE0A5E53763215BULL), false},
+    {S256Field(0x40AD6908D0559754ULL, 0x04B10BDDE2A3F585ULL, 0x58D0BBF9DC0CE022ULL, 0x213C7A715CD5D453ULL),
+     S256Field(0xDFF2C27534B458F2ULL, 0xBB4850F5F36A7EEDULL, 0x7013AD06245BA190ULL, 0x4B6DAD0B5AE46250ULL), false},
+    {S256Field(0x8993895E0EC87FACULL, 0x0D1AB974622E7CF0ULL, 0x66AE9FED8323480EULL, 0x1C5E548132B49A7FULL),
+     S256Field(0x555D7B3D5FC2D4EFULL, 0xA3DEACEB26FE324CULL, 0x2BB959FA1D4C2AD3ULL, 0x4FFCF60F837F468FULL), false},
+    {S256Field(0x532D80119E05DCCCULL, 0xAE3FA3ED4C19A93EULL, 0x9546E096B953D172ULL, 0xB8CEF6E1753DA030ULL),
+     S256Field(0x3014A0CFCC6D5750ULL, 0xDF757FC36A6B6813ULL, 0x6A4D4A74E4D2BD99ULL, 0x302B8A60A6CC9BBFULL), false},
+    {S256Field(0xE20FCBA1D4531DBCULL, 0x1F901C19FED5C970ULL, 0xDEF6E94210BBC7CEULL, 0x46276D0602C5668DULL),
+     S256Field(0xAF8730099686B8E2ULL, 0x498BADFBFFE1BC99ULL, 0x4A292287570DED99ULL, 0x0E0F7F24D44C75B8ULL), false},
+    {S256Field(0x85BDFEE1373BB31AULL, 0x701F7B6B5FDB97B4ULL, 0xE02A0BDE2EBB5F49ULL, 0x03FB33E779B47385ULL),
+     S256Field(0xE34CBE697D215C9EULL, 0xC65A7C76C47640D4ULL, 0x1E0C161AABBB572BULL, 0xF36AD952548EFE28ULL), false},
+    {S256Field(0x0C4EED01686DF50DULL, 0xCD5E792A1C6F92BDULL, 0xD6FD87442C082060ULL, 0x3A571630935C1F02ULL),
+     S256Field(0xD2158B28E859679BULL, 0xE0AAF81EBB781A11ULL, 0x516F3FF2E570A0DDULL, 0x85E13873B599F32FULL), false},
+    {S256Field(0xA5B515EBDD9A4AB4ULL, 0x717C36C1855BB7C0ULL, 0x61F16F7B4D0F7A36ULL, 0x4B177CD109EC3E11ULL),
+     S256Field(0x8AADDFE4635AB6F7ULL, 0x6E37E255F1741F55ULL, 0xFDA8F67293626B48ULL, 0x3EC966E9A5E2FA65ULL), false},
+    {S256Field(0x6114EF13522F001DULL, 0x6850E0ACDC78D899ULL, 0x4E65EB211C319163ULL, 0xEFEA68ECA7A6C24FULL),
+     S256Field(0xC128419F73BC4415ULL, 0xE413959FB3848771ULL, 0xDA150307A3719A17ULL, 0xAAB847869D583C14ULL), false},
+    {S256Field(0x6F46FB29B01C23A4ULL, 0xC22A415847A49CF5ULL, 0xC2A03829B9B9CD75ULL, 0x5E87035206A27A06ULL),
+     S256Field(0x1217996B10D986F9ULL, 0xA2171D874A4CCFDAULL, 0xE71755D1AE2C6E2DULL, 0x5B96644EFB9C9221ULL), false},
+    {S256Field(0x8B41EF22C291DC6EULL, 0x661FA8A94DF29FBDULL, 0x5C7136C23A3E38F2ULL, 0xCF0BDF47A3F15B24ULL),
+     S256Field(0x9C73C144DB7A8196ULL, 0xB4FC6CFD2BB5F2A9ULL, 0xA4C523B4E57918F6ULL, 0x38C2E01C6E61F511ULL), false},
+    {S256Field(0x1F3F35D2007B0C66ULL, 0x34A7FEE4656C86FBULL, 0x4472244F60ACEB74ULL, 0xE545C301930D680AULL),
+     S256Field(0xD87F57D271F2D470ULL, 0x97E5828E1B5A239DULL, 0x7E5C6FDA3959BCBFULL, 0xE06A340E8C62955EULL), false},
+    {S256Field(0xE2AA2B67F88F7E09ULL, 0xB3A03779BA7D92CDULL, 0xBD8E12E5A45DC0BEULL, 0x5E6A863D4F205FCBULL),
+     S256Field(0xBBD6286748DFCA97ULL, 0xA68E503723B4CFE3ULL, 0xC444A8D1F6940234ULL, 0xC2571A078A388EDFULL), false},
+    {S256Field(0x4A58190B83648BBAULL, 0x82A0F0B069C3C744ULL, 0xA133EE225F01B398ULL, 0xB2A442157A54F580ULL),
+     S256Field(0x246FAB4A00FB6452ULL, 0xC0D855151C9C17BBULL, 0x9E9FBC978FBD7E31ULL, 0xFE4F5FC2B6936661ULL), false},
+    {S256Field(0x679E75E2B304AB91ULL, 0x25A40C1942451557ULL, 0x8A6383063B7811C3ULL, 0x07A1FFEA8FE5114BULL),
+     S256Field(0x35AF463B6797E554ULL, 0x287E5DEA19009D9DULL, 0x6910437C4344A595ULL, 0xE10C0421B0FD7C54ULL), false},
+    {S256Field(0xCF6DD22EEBAB27D0ULL, 0xF70B41FA2C45103FULL, 0x1BA9701918D97007ULL, 0x1B908E0F3D453865ULL),
+     S256Field(0x71E8675E40D3D110ULL, 0xB5BBCA93587E51B5ULL, 0x6F357C91817C4B9AULL, 0x9B6D625EEC466B5EULL), false},
+    {S256Field(0xF0CC3A3B08FBD53CULL, 0xE2838C70ADC62CDDULL, 0x8DBB9352A5419A87ULL, 0x4E7C272A7AF4B34EULL),
+     S256Field(0xE0B3941817DCAAE6ULL, 0x530B9614BFF7DD33ULL, 0xE16FD09F6DEF681BULL, 0x17749C766C9D0B18ULL), false},
+    {S256Field(0xE2821E6E7C6E1B4DULL, 0x9B11F25A1BEF8790ULL, 0x268A269F4E385D9CULL, 0x899017B02696888FULL),
+     S256Field(0x009AEBDAD814AB2BULL, 0xE4E51BC0F932B212ULL, 0xBB45798336358BFAULL, 0x43AE2CDAB5B334F0ULL), false},
+    {S256Field(0xEE298464E521B3FFULL, 0x233C0717E9AA750CULL, 0x75E44D2BE9AE24A5ULL, 0x02484E3010C9455CULL),
+     S256Field(0xCC1AE4B90269DA7EULL, 0xAD7006DE923AC8BBULL, 0x07EC2B3C2B2D0EEBULL, 0x9619D0A0AA23E30DULL), false},
+    {S256Field(0xAF2635A17E5F712FULL, 0x2831F5BF91B583A8ULL, 0xA8F4728E63227F0EULL, 0x67F644F76E905FD4ULL),
+     S256Field(0xD68ACB5E707160E5ULL, 0x5E0E1488F7D36198ULL, 0xF05ADEB7B586CF78ULL, 0xB833D68F66445D04ULL), false},
+    {S256Field(0xF96B79FA804BA7B9ULL, 0x20D6A47030741751ULL, 0xEF79B70D672C954EULL, 0x16C1C526CFB6CE57ULL),
+     S256Field(0x475BE3A51C5BD741ULL, 0xEC755C01BDC9A9CCULL, 0x062627459C8A94DEULL, 0xDB157F7C34031439ULL), false},
+    {S256Field(0x2B26096140692FD1ULL, 0xDCF43C6CCBD90DFEULL, 0x0E0AADEF4B1F190EULL, 0x4E53C8B49901FF80ULL),
+     S256Field(0x934930E7328625E0ULL, 0xA87A50DA57FC9753ULL, 0x186CD709A7219DA1ULL, 0xDD6E3E4F4D41A01EULL), false},
+    {S256Field(0xE836487AA36683FAULL, 0x95821B5380EC0825ULL, 0x87A89CE774527B66ULL, 0x03973CD753F931AFULL),
+     S256Field(0xDF5FB2B77F4A577FULL, 0xD77884E18FE981DEULL, 0x643E12B632B5A26CULL, 0x38CF5A2CC30CA3A3ULL), false},
+    {S256Field(0xC10263ED3B89A762ULL, 0x930DC93012EE6B8DULL, 0xFA80A054968B4712ULL, 0x327F876C93652555ULL),
+     S256Field(0x9C9FD959B9203301ULL, 0x75535070FEBD7DFEULL, 0xB09969255E1997B9ULL, 0xB2D404EAB3524026ULL), false},
+    {S256Field(0x180B3999C0BF6F06ULL, 0x713C133225043B57ULL, 0x1C2C04F4B0205765ULL, 0xBA6A9BBA72ECF151ULL),
+     S256Field(0xE32BEF70781DB551ULL, 0x9E5D14F7AC697AAFULL, 0x32020BF2E558BD8EULL, 0x13771E38B34A11B0ULL), false},
+    {S256Field(0x799F119955637B39ULL, 0x6C52B9985EC75FA2ULL, 0xC3D5B9286C03016AULL, 0x0CF3C5DA6B99AC5CULL),
+     S256Field(0xD247A3D7A2852A40ULL, 0x37ACD30523C25C3CULL, 0x134671ADC18024A5ULL, 0x02CFB52FD9F39B64ULL), false},
+    {S256Field(0xFD1EF9F071231A43ULL, 0x44D514D665AD43B9ULL, 0xD8AED95064DE442FULL, 0x35C5BCCC27CC4DD2ULL),
+     S256Field(0x7DB72E451620C8F6ULL, 0x4CF7A4CC063CF0AEULL, 0x734E5820B6FA589DULL, 0x0E3675723B9746CEULL), false},
+    {S256Field(0x48CE357DB549827BULL, 0xFCC4F7F3E121BD61ULL, 0xA8212E06DE2CE311ULL, 0xCE47D0F5E0D375F3ULL),
+     S256Field(0x43CC9A5FEFAED097ULL, 0x29E6592FF05769DFULL, 0xD589139FE5B9AD0FULL, 0x15C698FB99630D49ULL), false},
+    {S256Field(0xBF40BC56FDD40609ULL, 0xC74190980D81CD76ULL, 0xA122F12FC588356AULL, 0xFD479C245C5586BCULL),
+     S256Field(0x9DE2F1366A64CA53ULL, 0x9113AED7261CA473ULL, 0xF2CAD7A43C9841FDULL, 0x3069CFB52694AFEFULL), false},
+    {S256Field(0xB38FE7157D48BE00ULL, 0xF60682EA1698FE13ULL, 0x4EB0E2207F9543C7ULL, 0x931BF8BD4A8E42F3ULL),
+     S256Field(0x1586A9131F44F452ULL, 0x6A43EE6AB333DDF5ULL, 0xD1B388E61140EBEEULL, 0xF1153BF0489C2083ULL), false},
+    {S256Field(0x4DB702F52B799A7FULL, 0x4F18B6CD53B8E842ULL, 0xBDED8EB9AF2C7D54ULL, 0x6C40002A3ACCD864ULL),
+     S256Field(0x8B5CC82CD3C81E32ULL, 0xC07ABD4C820483F6ULL, 0x690B836A0E1DDCBDULL, 0x95C2DC1530B635BEULL), false},
+    {S256Field(0x32427E2840FB27B6ULL, 0xC76E3DB2BE430576ULL, 0x10F238AD61686AA5ULL, 0xFEA74E3DBE778B1BULL),
+     S256Field(0x701D3DB7F23CB96FULL, 0x126B596B973F7B77ULL, 0x7CF674DECCB6AF93ULL, 0x6E0568DB9B0B1329ULL), false},
+    {S256Field(0x8FD97C961F9756E4ULL, 0xBB570EE5DE373048ULL, 0x180E03D850E8CD0EULL, 0xED9441C8304280FFULL),
+     S256Field(0xFF0E09F93F3ABFAEULL, 0x09F23774FE4DE98BULL, 0xAFA176128B13911EULL, 0x3DBE9E9EFE8BFA19ULL), false},
+    {S256Field(0x5DD81AE9BE889756ULL, 0xF27B64997B004BB2ULL, 0x226CD97B271899F3ULL, 0x762E8BC33211FEA8ULL),
+     S256Field(0x25E259E07CA6B774ULL, 0x1972DB314884FA5EULL, 0x3C7CC4F14982E347ULL, 0xC02894260AF3E97CULL), false},
+    {S256Field(0x15BAD033D51CF119ULL, 0x5B10BDD84FAB4D30ULL, 0xC9FED3F624B48751ULL, 0x29D9698EE67A7C3FULL),
+     S256Field(0x3C88740575056339ULL, 0xB89C940E93A7C296ULL, 0x277A125404F1C96FULL, 0x7FD02C517DC82B45ULL), false},
+    {S256Field(0x26F75E970975D2EAULL, 0x1E52ACFA1014E8EAULL, 0x8E19BDBB2308F4A9ULL, 0xDF077D47DF609534ULL),
+     S256Field(0xAA3C2D9E31936F95ULL, 0x8A1EC5B84FBDD277ULL, 0x24C8425C98A2527CULL, 0xF8617A8800EF7F44ULL), false},
+    {S256Field(0x875580A5A6714560ULL, 0x247F21027E56C6C2ULL, 0x9D47EF64F1A5A85CULL, 0x38B82A75579AD36BULL),
+     S256Field(0xADA87334A774299EULL, 0x7D94F23BEF716284ULL, 0x28BF563461643459ULL, 0xF9D8A6976F261EF4ULL), false},
+    {S256Field(0x5B8491FBBC4C92D7ULL, 0x35DB4D6EE54391B4ULL, 0x2E17DEA8334B1429ULL, 0x9F3E7D758BD3DA03ULL),
+     S256Field(0x6CBBBFCFB14906DDULL, 0x452A2303D694E118ULL, 0x58862B21CBAB1502ULL, 0xECD2841EA77D466BULL), false},
+    {S256Field(0x467C44537F422491ULL, 0xFD453E4A86060CFFULL, 0x6F3FB7BD33580A31ULL, 0x126B57D05013936DULL),
+     S256Field(0xAFA31F199DA3EF84ULL, 0xE148BAC30BF39347ULL, 0xE3C4A3EBA2BF3FB0ULL, 0xC1A7DC13061662C2ULL), false},
+    {S256Field(0x5AE0D732B2A8C483ULL, 0x174B0C88C5040AC3ULL, 0xDC38C3D22EF95281ULL, 0xA0CC795D7B5CCF9EULL),
+     S256Field(0x5096745592CC6BA9ULL, 0x6B348F1BDF693605ULL, 0xE2374FC97231DF78ULL, 0xABC30122F8B3873EULL), false},
+    {S256Field(0x0515623A3AFAF403ULL, 0x38A0AEFB97AD7576ULL, 0x70CFAFFAC8A0B5BFULL, 0x1A241179B9E81F56ULL),
+     S256Field(0x590B6E40E4D79A16ULL, 0x2C8177F4178DF60DULL, 0xC4BF27493905B76CULL, 0x8E1CA0C0A86740C2ULL), false},
+    {S256Field(0x170F1B6BC5DD3AEEULL, 0x13153A8A8F96D2F2ULL, 0xE0E22A9AC6A976CAULL, 0x6D1C50A51553C7CCULL),
+     S256Field(0xFEE354E4FDF597F7ULL, 0x851E310AA8ED53ADULL, 0x977272002287D474ULL, 0xAFFF148E06ABDFDCULL), false},
+    {S256Field(0x7622EB049B720B26ULL, 0x26F2835F98CCFCD0ULL, 0x1F46BBED41390620ULL, 0x3E10C5AE9AC968EEULL),
+     S256Field(0x346E98C7ADD92DB5ULL, 0xE2FF79A4DBE09E43ULL, 0x5A8665B287215E28ULL, 0xC735C6CFFE428891ULL), false},
+    {S256Field(0x678CA9B7E4A6D0BBULL, 0x659D3122F5A1AFDCULL, 0xF311A6D8A8A6418FULL, 0x5E5F1D618B97F9F3ULL),
+     S256Field(0x168384791033EAF9ULL, 0x72555F2E506F653AULL, 0x358F6BCD04E721DAULL, 0xD7B1502B06A7E6F7ULL), false},
+    {S256Field(0xE0083A7D65543CB4ULL, 0x3C4529B6C22D0299ULL, 0x8AB684D0580EA8A0ULL, 0x73F87BAE9734854AULL),
+     S256Field(0x3D2DD872C4856CDDULL, 0x9D5C42F5357F2D7AULL, 0xEEBFBFC11A140289ULL, 0x37C66CF03A87F86FULL), false},
+    {S256Field(0xDDA9B5E44F005E3FULL, 0x5AF68E31BEC39BD2ULL, 0xFFD3CB9ACE01A149ULL, 0xF8138A6B3C16427FULL),
+     S256Field(0x42D7E0202F357EB7ULL, 0xF4EC41BD554BE213ULL, 0xF9D015E57AA5CB51ULL, 0xCA758F3BEFB4EBD9ULL), false},
+    {S256Field(0x52C02A4417BDDE39ULL, 0x1544E179B7604329ULL, 0x10A2570D599968D3ULL, 0x76E64113F677CF0EULL),
+     S256Field(0xB4B1752D1901AC01ULL, 0x5E2A33D2B56D2032ULL, 0x577066D70681F0D3ULL, 0xC90DDF8DEE4E95CFULL), false},
+    {S256Field(0x1CF999A83A1187A5ULL, 0x005D57622C29AE69ULL, 0xEE87C9D88161C810ULL, 0x708A530E9E52C73BULL),
+     S256Field(0x58A4F19B473DB9C0ULL, 0x3ECDA73C6D353E8AULL, 0xFA9656DCBB6D3828ULL, 0x9B884811E1F9A897ULL), false},
+    {S256Field(0x2F05091CC078EE8DULL, 0x4EBF20CE50691944ULL, 0x25FF7263AA9B4FF6ULL, 0xD08E57AD859DA9BEULL),
+     S256Field(0xE997F4DC2DA63E86ULL, 0x123EF7CF9422ED9DULL, 0x2D6172EE757E6DF4ULL, 0x852E97984AB488D7ULL), false},
+    {S256Field(0x2E1B16C6CDE4F5BEULL, 0x9F374B6D86B2B59EULL, 0x19BD648395E462CFULL, 0x19CF034FC48B3BE2ULL),
+     S256Field(0x0A91532B6F321AF2ULL, 0xEF91D1C93F0F1C0CULL, 0xC3B4BE68AB181947ULL, 0x28E32B06A15AB466ULL), false},
+    {S256Field(0x15914670429129ECULL, 0x0CAE3ACF1E482548ULL, 0x5F58BE80ECD31D08ULL, 0x7DA6C085E4D44D27ULL),
+     S256Field(0xEB50AEE2ACD9FF0EULL, 0x0448C08654CA586AULL, 0x511D0207491627BFULL, 0xF498146BB9F41857ULL), false},
+    {S256Field(0xD43AE5430E9C22BCULL, 0x01DA67D691BCC42FULL, 0x765B3444D9BC7BE6ULL, 0x5335CEA5E99EEB23ULL),
+     S256Field(0x3C2C2672CBDACB60ULL, 0xC8C30C236CA1F19BULL, 0xA067F080F0CEB86AULL, 0x3BF8D020769C5224ULL), false},
+    {S256Field(0x4F83D49551654F22ULL, 0xB2F7F394231AAEE9ULL, 0x21BE9001BE69D94FULL, 0x90D090CFF5C1BE6EULL),
+     S256Field(0x0F5DE057601A43E1ULL, 0x6DD635653DA3F874ULL, 0x953F021E06BF7033ULL, 0xCD569A1D2BACF61AULL), false},
+    {S256Field(0xE3ABC209D17CF3E8ULL, 0xEE93BD034BEA2219ULL, 0x7C719C2F8397F576ULL, 0xAF6C44A078CB5F0DULL),
+     S256Field(0xB8ADD0601751BAEAULL, 0xEC362AEA7CA0D435ULL, 0xAF9E73153CB246DFULL, 0x0784096FE85D4B30ULL), false},
+    {S256Field(0x1B6EF651C76B19FAULL, 0xD9D6E06D068819D7ULL, 0xC7322C310821292EULL, 0xDA4798587CF1D1ECULL),
+     S256Field(0x6AA26EEB326F5AF7ULL, 0xA67BD13E9553FC20ULL, 0xD17369077E16569EULL, 0xEBB1D7789BCCAF01ULL), false},
+    {S256Field(0x6D2F91EDD6569044ULL, 0x33C0396CFA0CEEF9ULL, 0x9D42BAFE95C58F30ULL, 0xAA21C60D6F7D6253ULL),
+     S256Field(0xC1924C41C2F37766ULL, 0xEE5ABAC113928334ULL, 0x6D1D26ADD41ADF4EULL, 0xB2AE6886FC4E6AEAULL), false},
+    {S256Field(0xCD92FB65B9135DBDULL, 0xF0C087AF39D8631EULL, 0xD817AAF582E9897CULL, 0xE3E47504A8DDEE6AULL),
+     S256Field(0x6906AF3E4748045DULL, 0xA5A202FF5EC95DA9ULL, 0x0B98C81952B83FFEULL, 0x930A5BF809CBC6C4ULL), false},
+    {S256Field(0x5BC1E6214FF4DE54ULL, 0xA5CABD91E9D3C2BEULL, 0xC3B4031CF14A2858ULL, 0x5716DC355DF202A2ULL),
+     S256Field(0xD3EA4FD550100FA5ULL, 0xEBF3FECCD047E417ULL, 0x91EAA661A99324C5ULL, 0x985F6C400A5B83F3ULL), false},
+    {S256Field(0xCBF0B9E5CDEE455FULL, 0xFF67FFE6E8CE4075ULL, 0xA4745338F80BDB4AULL, 0x7E8C656FE870A9B0ULL),
+     S256Field(0x173DE998171B9CBAULL, 0x4AA2D16746F46627ULL, 0x2A3F760F4803A53BULL, 0xBDDDC632CA30740FULL), false},
+    {S256Field(0x1E61500D9769B57CULL, 0xDA5033BC39E2FC7BULL, 0x5348F1925BE3F04DULL, 0x030651CB592D282BULL),
+     S256Field(0x7FF3A505F33236E3ULL, 0x192A4D18739F7805ULL, 0xAC4E2423E85682C3ULL, 0x25208833BB7AC098ULL), false},
+    {S256Field(0x37796B9B6698B59EULL, 0x0A335925893447A4ULL, 0x5BEB035AB3E3C726ULL, 0x3DF841F891A95EB1ULL),
+     S256Field(0xBCF8E6796B92BAF5ULL, 0x7BFC867B214949F8ULL, 0xDA02BAE8F11CF386ULL, 0xB38FE6DF98B090C1ULL), false},
+    {S256Field(0x3AB150242BCBB891ULL, 0x8F7CC643DF26CBEEULL, 0xE8281BAA743F8F9AULL, 0xC738C56B03B2ABE1ULL),
+     S256Field(0x17E735D9699A84C3ULL, 0x82314EEF7880CFE9ULL, 0x7F718F2EACBFBBBBULL, 0x893FB578951AD253ULL), false},
+    {S256Field(0xDDAAB0784662AB1BULL, 0x647197EA49B8C9E4ULL, 0x35B32A6992E7AA94ULL, 0x5578845ECD7C0374ULL),
+     S256Field(0x316D18F3056F3511ULL, 0xF653A7746A5D64DEULL, 0xCEA6D0A51D2A4053ULL, 0xE61D07978B6DE2C3ULL), false},
+    {S256Field(0x34BAAF338761D58DULL, 0xCA4C9BE408D60E2FULL, 0x10A240A35720DF7AULL, 0xB8C46127823F6146ULL),
+     S256Field(0x638EA0BA9D1051A4ULL, 0x3F7504785E107C5BULL, 0x14A458F697F3C505ULL, 0x8F9ED96C5170E37DULL), false},
+    {S256Field(0x94F869B8948B6C29ULL, 0x22F12354FCE39960ULL, 0x4ABFA3BC1D0CECCDULL, 0x47F3383888A364CCULL),
+     S256Field(0x1EDEE1120E537EF9ULL, 0x18BB499588F994A8ULL, 0x190E48675B416C71ULL, 0x48CA9A8D0F032937ULL), false},
+    {S256Field(0x2DB0B304050B0040ULL, 0xF3F47DB9F0134ADCULL, 0xA350C993FE9A3671ULL, 0x08D56E9F710271F7ULL),
+     S256Field(0xB58E267A5B3FD0A1ULL, 0xF6D7C4720E1782BEULL, 0x1FFD150A8D79B285ULL, 0xA12185AEBD0A9AA2ULL), false},
+    {S256Field(0xA14DEA1A1166FF40ULL, 0xCAEEBF4A41FFF36DULL, 0x7C78125D8E480A2EULL, 0x6B00403318818D2BULL),
+     S256Field(0xEB74130E9D71B847ULL, 0x076883F6E7F3EDE9ULL, 0x968943A0590BF2F0ULL, 0x41CD1B3AE8AAFAC9ULL), false},
+    {S256Field(0xF56563DF13573B7FULL, 0x889A1C5ED30B6270ULL, 0x41E20F977BE65A37ULL, 0xDC13F232D42FCE63ULL),
+     S256Field(0x42ACD2284C1F2BA6ULL, 0x7045547017404B1CULL, 0x3C7410DA84A90A76ULL, 0xC909BA80429E340CULL), false},
+    {S256Field(0xA81A6C8F05FF4ADBULL, 0x14F570D6FCBEF768ULL, 0xE466B4C9C6A5D5F6ULL, 0xC0C01F34AE41B8CFULL),
+     S256Field(0xFC4EFF73AC351065ULL, 0xCDBC43D170D15B85ULL, 0x7C937A0B4075B8CEULL, 0x0B84F5BEE4357F5CULL), false},
+    {S256Field(0xB02F590B87AE9CEBULL, 0x226C21EA70EF2D14ULL, 0x3AF19565DB2119A8ULL, 0x25C02DE601DF7F07ULL),
+     S256Field(0x47090D134BC6E275ULL, 0x37C641DF0A658726ULL, 0x0C884E0DCFAD11D5ULL, 0x8A9FEAD2C812383CULL), false},
+    {S256Field(0x365019D7932C1A1CULL, 0xA2F32B1A022BDD6EULL, 0x3D229EA400B63B93ULL, 0x3A932FBC468ECBDBULL),
+     S256Field(0x84AA92697D343540ULL, 0xC0417E15749A28B6ULL, 0x01C9547D4DC81D0AULL, 0xAD3D80540F3457A8ULL), false},
+    {S256Field(0x1F8098F6EC5A3C34ULL, 0xAECE82C0295949FEULL, 0xE8AB9F4CA7AE3E58ULL, 0xFEDD9D1B2CF8E49CULL),
+     S256Field(0x62B54BF4E13D7714ULL, 0xADAEB54699BF8297ULL, 0xB0BE85312C8F4B00ULL, 0xA52E24C31853B8E0ULL), false},
+    {S256Field(0x0452106B80D6BF1FULL, 0x46BD033E9824FCBBULL, 0xA3521E9276B346B9ULL, 0xC3337343451CB83CULL),
+     S256Field(0xF95E58423CB01F48ULL, 0x98BA36420E266162ULL, 0x13DFF31AF72C3155ULL, 0x2EEFE9391B812CDAULL), false},
+    {S256Field(0x9B4E54D1AAB6A396ULL, 0x73021B91A1136076ULL, 0x2DEE2D7F5E8488B3ULL, 0x3E0E3286BC6EA48CULL),
+     S256Field(0x2EB31E48D980E27EULL, 0x6AB01041F3468F6AULL, 0x4F31FE1DEB453FC6ULL, 0xCA448172FA3B3796ULL), false},
+    {S256Field(0x27BF4C48DAF027E9ULL, 0xD7CA75DBEE54677EULL, 0x3C3C7CD537ED6D17ULL, 0x5A62873D3EA83E25ULL),
+     S256Field(0x3199D905844C68B4ULL, 0x988AF4309CA675FBULL, 0xA76409CFEEC57A43ULL, 0xF6D94479A5BF6AFDULL), false},
+    {S256Field(0xAAF35862341023ECULL, 0x5645D8F76FECF570ULL, 0x4982E0200982B9AFULL, 0x344AB93080C32D28ULL),
+     S256Field(0x04F898291E1EEB87ULL, 0xFC4E976AFC3995D7ULL, 0x73F8F2D1EA514C5FULL, 0x6E1C2B042B24462AULL), false},
+    {S256Field(0x372E9F6588F6C14BULL, 0xD1D72E5F3A925014ULL, 0xE264C7637C972877ULL, 0xD895626548B65B81ULL),
+     S256Field(0x79363ED75D7D991FULL, 0x03428D632BB067E1ULL, 0x728EC60818C340EBULL, 0xFEBFAA38F2BC7EAEULL), false},
+    {S256Field(0xBA5B594B77078424ULL, 0x03ECAF7A0EC40C3FULL, 0x8A3A43622003A267ULL, 0xFD136EEF8971044EULL),
+     S256Field(0xCD61EEEFC671DDF1ULL, 0x7CF2B1F78A2ADFA8ULL, 0x67A1D191B5C5EFA5ULL, 0x218DA834F3C652CCULL), false},
+    {S256Field(0x80BA87FF6127B756ULL, 0x03428BE4ABA09704ULL, 0x72D362DA5060B416ULL, 0x6D8C782F716DF126ULL),
+     S256Field(0x6551F74ABF172571ULL, 0x4E3AA6DA2D7CDCCAULL, 0x1459A82D36D34DAFULL, 0x99AEDF0896FDB911ULL), false},
+    {S256Field(0x5F1D84EC8DB1CB3CULL, 0x1B7003A0D43F024AULL, 0x0E9CCA5367519F86ULL, 0xD99E8E9DD9638D14ULL),
+     S256Field(0xD88A29E36B8637A7ULL, 0x6286FEF8FFC8765CULL, 0xA945BB321BCEBA6EULL, 0x36DC19AD1CC0A3A7ULL), false},
+    {S256Field(0x4DEE1A73758CF17AULL, 0xF1F85DCBA5882352ULL, 0x8D059AEF1B4097F8ULL, 0xEBCABEDD95BF7ACAULL),
+     S256Field(0x446CDC5F5CAA0CCDULL, 0x10FAD212D0ACE95CULL, 0x02C00A1B67C32E6BULL, 0x47D3CE0F8F22B9CBULL), false},
+    {S256Field(0xE4C4B2C551A3C43CULL, 0x0DF701CA8ECEE258ULL, 0x48CC1F2B4AAE6714ULL, 0x56C9DA9467CACD5BULL),
+     S256Field(0x824D8B7D20D7C9EDULL, 0x41D40FF932EDCAA1ULL, 0xF33C7964DDCB6852ULL, 0x38D46ACB42C79EC2ULL), false},
+    {S256Field(0xBCEEE515AC855C5BULL, 0x1185621A017C8AFBULL, 0x45331A369E17FC28ULL, 0xE8DF4D2E4BD4CE24ULL),
+     S256Field(0x59D5E72C2E465650ULL, 0x9663B55F1E1E4D7DULL, 0x4444DB4F59EF32C5ULL, 0x6C57FD70C47F9B26ULL), false},
+    {S256Field(0xFD46F68D3C385172ULL, 0xD203351E0440E636ULL, 0xA1BD8A54E5B09191ULL, 0x03FDF1619A198317ULL),
+     S256Field(0x79AC67F0FCCB9794ULL, 0x5B9B929E90E7232BULL, 0xFE470C7D3C857375ULL, 0x408D02C06E5C12C3ULL), false},
+    {S256Field(0xD08F5BDA52E7E454ULL, 0xFE32EFEF0F0E6150ULL, 0x912486023A981662ULL, 0x4068D3D718ECA832ULL),
+     S256Field(0x779ACDE5D8EF191EULL, 0x988D21ED13C37332ULL, 0xB9EC14597D9D38D1ULL, 0x8CD853B7254A47AAULL), false},
+    {S256Field(0x400C1FF535D8247EULL, 0xCD4780C2511691EBULL, 0x56E101F9AFA0B7A0ULL, 0x33EAC9BBA2C355CEULL),
+     S256Field(0x37216AB0AF3DA9BFULL, 0x84F8CF37B7EA407FULL, 0xD4461F2AFD15EF2DULL, 0x35973173E4E17C41ULL), false},
+    {S256Field(0x0857ADF846C5D939ULL, 0xA475A2877BA933DEULL, 0xB55BF32E60CA027EULL, 0x12550ECDB1D825E0ULL),
+     S256Field(0x92A74FC559E757C9ULL, 0x838B741FECD8D431ULL, 0x5448E43C17724A72ULL, 0x7B8F8334F872D7A7ULL), false},
+    {S256Field(0xB9E249D02DF771C8ULL, 0x335A5211EE094C87ULL, 0x9D32C2B3C01F8750ULL, 0xB71E546D922DC902ULL),
+     S256Field(0x2453A26F93F48C51ULL, 0x26BD522B55BBA286ULL, 0x78912A4CCCE288F4ULL, 0xE7CCEFA8CEC9F900ULL), false},
+    {S256Field(0x38D0AAC656C8A56FULL, 0x85093C5434F37421ULL, 0xC69BB7B53AFAD08FULL, 0x944D671AC3B585D4ULL),
+     S256Field(0xB9F4DC65DA7BE289ULL, 0x67D4C174DD06517EULL, 0x4C143936133AC619ULL, 0xA71065977B501FFFULL), false},
+    {S256Field(0x68F73092D3194444ULL, 0x850FEA94BAA7FEA2ULL, 0x612239666D87A19EULL, 0xFACF5D96BA1526B8ULL),
+     S256Field(0x552BF48844BAD676ULL, 0xBE72B245B947D00BULL, 0x935B7756392DDAC6ULL, 0x7CEB907BB8AD44F6ULL), false},
+    {S256Field(0xAEEB8A18AE08F15AULL, 0xFD69E56DC812900BULL, 0xFE6B03655AD3C305ULL, 0x86A54E91CD099A0CULL),
+     S256Field(0x3524D1E7C1388308ULL, 0x77129D125B35254DULL, 0x3A72A8D06D756867ULL, 0xCFEE614837A78460ULL), false},
+    {S256Field(0x49150A564F676E03ULL, 0xCEFFC73693E84EDDULL, 0xEB0F6433571E8761ULL, 0xB8DA94032A957518ULL),
+     S256Field(0x1488E4E74EFDF6E7ULL, 0x92CC584D95FF3B51ULL, 0xD7C99CC9762808B0ULL, 0x2804DFA44805A1E4ULL), false},
+    {S256Field(0xD413F414C5AF726AULL, 0x469A3E5CB25BF6E6ULL, 0x53F2CB698AB620F9ULL, 0x6D36D105ED8CC5CEULL),
+     S256Field(0xC570491A13F9FC7DULL, 0xDCC59936B4108A35ULL, 0x72D8C66C95C50029ULL, 0xE4BA5C34E377669EULL), false},
+    {S256Field(0xEA19849DC6E1346BULL, 0x5ABE7B10385AF1C5ULL, 0xE54C761F14D152C0ULL, 0x069068FF0982D10BULL),
+     S256Field(0x7BB58A54D7226C13ULL, 0xA4F6893994C6026EULL, 0xDA85DB2BD086442AULL, 0xB863E3E090BFDE26ULL), false},
+    {S256Field(0x86E2A30CA540DB99ULL, 0xEB1309C0534B8122ULL, 0xD06883FA66F0B0E3ULL, 0x3AB6BDE10CD3AC0CULL),
+     S256Field(0xE6873FE31BDA78A3ULL, 0x38D137B0E369C043ULL, 0xFC3117A96A13E99CULL, 0xBACA62079BE871D7ULL), false},
+    {S256Field(0x30E691FCDCA1F6A1ULL, 0x068CBD14348CFF1AULL, 0x5286DC5CB1E86CE1ULL, 0x898C3493CB259761ULL),
+     S256Field(0xA4ADC20F164F647CULL, 0xB2A7CF979F2BD79CULL, 0x9D84542452AC6E93ULL, 0x75F75986AB56A554ULL), false},
+    {S256Field(0x584E2BBC7235C795ULL, 0x0B0D8958EBD541D7ULL, 0x393B05B37D1C89D7ULL, 0x063C462435EF974BULL),
+     S256Field(0x3F32DC095B110258ULL, 0x9E4ACBACFA49A9BDULL, 0x431F660D931C85B6ULL, 0xE27F9BB913038404ULL), false},
+    {S256Field(0xAA69E03C3D1E3998ULL, 0x5E56C8B917A04328ULL, 0x1A5299D7022A274EULL, 0xB213E2FED2918BF0ULL),
+     S256Field(0xEC2CBDC6325FB81EULL, 0xD534165BEBDED175ULL, 0xC3D61EBF83A43BC3ULL, 0x229F8EC20F2D3C12ULL), false},
+    {S256Field(0x7777BF279F1048DAULL, 0xBA2FD4F373DDD3BAULL, 0xFDBA069D9D07BCE2ULL, 0x796634E3F1AD56F0ULL),
+     S256Field(0xE8F9BE24A106CF01ULL, 0x532576D8CFD74862ULL, 0x56DE74735A7927F2ULL, 0x4D8EE2B6CFB20B89ULL), false},
+    {S256Field(0x00BE1FECA25BE234ULL, 0x0E83E3E70DDF3507ULL, 0x5D1D0BA691606E06ULL, 0x4B3B3AD816C7F93EULL),
+     S256Field(0x063B7E03920E8362ULL, 0x41E7FD92CF211B84ULL, 0x7875E96DFD8CC04CULL, 0x5EEC023B85DABC9CULL), false},
+    {S256Field(0xAB209AC9C05201E1ULL, 0xD264CB5AE836B77DULL, 0x852BD55CDEA35F99ULL, 0xC299C6B06E6C78AEULL),
+     S256Field(0xADD3313A50F51BA3ULL, 0xBD74DCF583AC2AE9ULL, 0x38884F24FD774CD7ULL, 0x5AA739923611805BULL), false},
+    {S256Field(0xB96634A7E289F55EULL, 0x2976B0F0E2C76707ULL, 0x020251B0278965BEULL, 0x9F7B88B6DDB04F96ULL),
+     S256Field(0xB3CD3B65FE1E4BDEULL, 0xC0E536E0EB10A2B1ULL, 0xBE3146B4298FC71FULL, 0x32F9F784C70410F7ULL), false},
+    {S256Field(0xFD37A7F16C1CBAABULL, 0x1ACAB879033D564CULL, 0x598AB6C18A70635CULL, 0xD031AE98FB356071ULL),
+     S256Field(0x4C39047F85116B26ULL, 0x6DFB4A4FDBD65FDCULL, 0x8E6E4C06ADCB4DCFULL, 0x415196B4E954584EULL), false},
+    {S256Field(0x16549C8C1DFE1D2BULL, 0xC493F509E56878E5ULL, 0xE76CCADFD3FB73A4ULL, 0xD58A43E9CB7448E3ULL),
+     S256Field(0xFCF2795B8CD50922ULL, 0x54D9BA215CBD6FBFULL, 0x10A729132828276BULL, 0xFC17866BA05883CFULL), false},
+    {S256Field(0x626FBD58447996C0ULL, 0x6E2EED7276BA269AULL, 0x39B979577BEDD0E9ULL, 0x16E85AD86A953564ULL),
+     S256Field(0x4888BC64B8151D48ULL, 0x21B642AD9C569D54ULL, 0xFB217E5CE00ED55AULL, 0x7408B0AEB424493EULL), false},
+    {S256Field(0x124151BE249C795EULL, 0xED4406AA99CE805EULL, 0xCD6D969C3C27EA4EULL, 0x21D2713971118310ULL),
+     S256Field(0xB0012EC399208ECEULL, 0xD671944A4ADFB761ULL, 0x17735B85522BB4C3ULL, 0x94C5F9B4B075ACEAULL), false},
+    {S256Field(0xF1A11778E3C0DF5DULL, 0x2019EFFB5156A792ULL, 0x7D8ADAB9475D7FABULL, 0xE80FEA14441FB33AULL),
+     S256Field(0xFCB4291B6AC9EC78ULL, 0x2D155E80AF322EA9ULL, 0x1E89768CA3CA9447ULL, 0xEED1DE7F638E0077ULL), false},
+    {S256Field(0x2DB0E78B0F83CD58ULL, 0x122DCC3877D2F916ULL, 0x981AC4ED1EFE7A37ULL, 0x440CA1F08EA41265ULL),
+     S256Field(0xB07BC069B88A3F4BULL, 0xA21E4D4269C0A260ULL, 0xAF8954DC9D4E2F02ULL, 0xA6C8B0D2CD5EE122ULL), false},
+    {S256Field(0x2C0359ECD7592D55ULL, 0x06D5B94740E35019ULL, 0x08AFEF69633CE3B1ULL, 0x5D2EC6DBC4A10526ULL),
+     S256Field(0x266E5D0EAF5183A7ULL, 0x0E2A7BCDAD115174ULL, 0x58F710FA268CD695ULL, 0x0A92CDF89C6E45EBULL), false},
+    {S256Field(0xE81BDA2712998B10ULL, 0x9BC70EBCC1B229D9ULL, 0xC5F7F829D3A90781ULL, 0xF694CBAF2B966C1CULL),
+     S256Field(0xF6788B1700F05E51ULL, 0xEB6C64C3183C2A47ULL, 0x633C5FFACC46D82AULL, 0x40A63EBA61BEF03DULL), false},
+    {S256Field(0x991F4B49FE8F9F5CULL, 0x7361F1E159880A51ULL, 0xFE2CAE34215F404DULL, 0xAC371DC3B11BF742ULL),
+     S256Field(0x17A83FF3325A503CULL, 0x22953458EE751E1DULL, 0xFF2101E73254E735ULL, 0xC51616C18709A477ULL), false},
+    {S256Field(0xA744B8F8E55BF84CULL, 0xD964C6ED570D9027ULL, 0xE5DD3C25223CAE4FULL, 0x62782899CEB96CC8ULL),
+     S256Field(0x6F51CFAB5F15FA2AULL, 0x9A020DE7DDD176EDULL, 0x01C5497229726783ULL, 0xD670ACA40911A289ULL), false},
+    {S256Field(0xF4A1C8D519E33446ULL, 0x40893BC452AF385DULL, 0x9348C0BD0222A17AULL, 0x8942003A14F1840CULL),
+     S256Field(0x40D38A00E6387689ULL, 0x6BFD773679E74F98ULL, 0x4D8B2D6D0EFDE4E0ULL, 0xA9FD039595A5077AULL), false},
+    {S256Field(0xF95A13358DD553FDULL, 0x47ABF695C08B6414ULL, 0x50B6D4F439A25950ULL, 0x8B6E862A35566848ULL),
+     S256Field(0xD803DAD33E9BE5EDULL, 0x24AC3C5A183383D0ULL, 0x0D10BC2DF4EB9FA1ULL, 0xEA5E08910ED11CB4ULL), false},
+    {S256Field(0x3D728C95B913CB26ULL, 0x99EB419C013BD6D0ULL, 0xA2CDA44FF5505C98ULL, 0x2770266B30A342A8ULL),
+     S256Field(0xBFE71733F348A7A2ULL, 0xE940C91BCC815BEBULL, 0x5552D24D07F2B324ULL, 0xF649BC5E79B0DB1AULL), false},
+    {S256Field(0x23F4244ACF0C58BDULL, 0x28D49F4DF64464CEULL, 0x32D9E10056AAECF6ULL, 0xD3ADF06E24844C09ULL),
+     S256Field(0xE52E4AB937C89387ULL, 0xAEE3869FA4B98C9CULL, 0xBDFB2FEBCFF638BAULL, 0x57E99DB4FC2A6077ULL), false},
+    {S256Field(0xF0AAA021595E8247ULL, 0x97BFDC455686CD1AULL, 0x78E5E6E01CF8BA90ULL, 0x75E4D0D383CBED21ULL),
+     S256Field(0xCA23FD9D59982D22ULL, 0x7DDAB5B6EA9AD893ULL, 0x741F970EC7B726D4ULL, 0x1FCE42A175410990ULL), false},
+    {S256Field(0x399471D0F39715C2ULL, 0x69006521F98A529AULL, 0xB411F78CEA33FEDDULL, 0x2F189E88F19A3D85ULL),
+     S256Field(0x66A635844171DFEAULL, 0xEB3333E2C36854F0ULL, 0xDF708475ED10F9F7ULL, 0xC91A39F8F3C5D7CFULL), false},
+    {S256Field(0x7479F44DA6333323ULL, 0x9CBBBC1C68F4ABF4ULL, 0x3F020D605984DA84ULL, 0x3ED1B6383361BBF0ULL),
+     S256Field(0x4B13FC48B5D61BA3ULL, 0xA9B728A10B78F729ULL, 0x5D97C989688F929EULL, 0xD84F2DA48B5B4EE7ULL), false},
+    {S256Field(0x87562EDCFA3EB3FCULL, 0x77EE68944D90E398ULL, 0x77E46B40888A6F7EULL, 0xD2CDC8BB0A1B6BB7ULL),
+     S256Field(0x44287DB3DED37564ULL, 0xC1F217B9310B4927ULL, 0x6DDE95362CF926EEULL, 0xC5538AF9E5C56104ULL), false},
+    {S256Field(0xF25057D4B33980BFULL, 0x68A3702E50DD00BAULL, 0xB846FD772348DD43ULL, 0x70FDD2F06A758181ULL),
+     S256Field(0x12EEA8CEA0B75785ULL, 0x0A10358385D74A56ULL, 0x957A410D11EE596BULL, 0x5EDFCAC0D0D58696ULL), false},
+    {S256Field(0xDDC07BBCC4E16070ULL, 0xF2A182031EFD6915ULL, 0x13BA48E51D567543ULL, 0xA301697BDFCD7043ULL),
+     S256Field(0x0C0D1A041E177EA1ULL, 0x1735DBF7C0A11A13ULL, 0x081809FA25D40F9BULL, 0x7370F91CFB67E4F5ULL), false},
+    {S256Field(0x11420316F24BA5AEULL, 0xB43965004C34B5D8ULL, 0xF3E8D2419E0BFF74ULL, 0x27E1E59CFF79F049ULL),
+     S256Field(0x84A5BFEE883A45B3ULL, 0xDF48A1A69AFA63F7ULL, 0xEE1B5E3CFC79DF05ULL, 0x310B26A6C804E209ULL), false},
+    {S256Field(0x67012700138011FCULL, 0x83596A67AD728562ULL, 0x156B133082200A4DULL, 0x6E8313A30815EB11ULL),
+     S256Field(0x6ACB69FA3F15AB7DULL, 0x26AF915AE9C51F9AULL, 0xC1A12DB201DAC304ULL, 0xC147818BDC24F204ULL), false},
+    {S256Field(0x9969175C9CAED7AEULL, 0x5A39ADDE84FBFB4FULL, 0x16588EC3892D7E4FULL, 0xC712E7A5F6864AEEULL),
+     S256Field(0x84D148AA46156294ULL, 0x380D8E544B0CE637ULL, 0x65ED4B82311DD9E5ULL, 0x49644107516363B3ULL), false},
+    {S256Field(0x53A749B8D00E6BA7ULL, 0x3D36EC5B44916F7FULL, 0x2BD1E038A4D9E1B4ULL, 0xF952A9099784851FULL),
+     S256Field(0x8DBAEEE50175E4C1ULL, 0x5557167B4C62A2B9ULL, 0x861376A2E27FA0F6ULL, 0xD8A93A5B08ABCEBFULL), false},
+    {S256Field(0xF9549F5C595B6F7EULL, 0xBEB32B53D38B2021ULL, 0x83A053AAD09876CDULL, 0xA5AC7D1D04CDA30CULL),
+     S256Field(0x48DBB7308AB19C84ULL, 0x99E39160F5818A48ULL, 0x36CC3C9247D9EE1BULL, 0xDF0B8A0AB540F55BULL), false},
+    {S256Field(0x690065A283AA0E93ULL, 0x8F2E3943AEFB1F62ULL, 0x504031A19D9E893AULL, 0x94016D5E31D3FEE7ULL),
+     S256Field(0x38EED26887ADDAC2ULL, 0xF484373BAA57B07AULL, 0x40355D354EEE6FD7ULL, 0x675032EE5C454D96ULL), false},
+    {S256Field(0x1B43E1FE44A6DB03ULL, 0xB2C85D6F58275D79ULL, 0x065C0D426B8675FCULL, 0x0BFC0504A4B3235DULL),
+     S256Field(0x58AC8D1A464B8542ULL, 0x37427197345D4F05ULL, 0x3FB8EC7F94A6C992ULL, 0x1955467A6C34F345ULL), false},
+    {S256Field(0xB0F4862E0266B17BULL, 0x023568A20262BB32ULL, 0x1BB978846A9F09C2ULL, 0xEF22D174D59FB289ULL),
+     S256Field(0x32A6E04379DAC83EULL, 0x3EE7276F71C341B7ULL, 0x68F9CCC3AE34A107ULL, 0xBC5784C97AB24C75ULL), false},
+    {S256Field(0x57F2C542EB4318B5ULL, 0x72ED5C812F5B8456ULL, 0x55788A38DF2057EEULL, 0x9885F5FBE1948D0FULL),
+     S256Field(0x2FE542541599175CULL, 0x7C82ADED676904AFULL, 0x96D2C467768CEB8EULL, 0x135FD6F69EF198F9ULL), false},
+    {S256Field(0x2313015A92D382A0ULL, 0xF28DCBBCE2ECD9AEULL, 0x39CACC780B2DF927ULL, 0xB5F7EFCE4CEB892DULL),
+     S256Field(0xBA2F0ABBA5B4B532ULL, 0x71FB096D29ACF8C5ULL, 0x3C0957C6E0CBDDD3ULL, 0x6843545B51C3F235ULL), false},
+    {S256Field(0xB93A4AE4CE81C1BCULL, 0xD25365E58ABB5B33ULL, 0x5AD815B8D68CE767ULL, 0x03360F05465C0463ULL),
+     S256Field(0x76DD2896566CBEDDULL, 0x231728EB5C811501ULL, 0x4FF69C4251306753ULL, 0x7E48B5F90C575001ULL), false},
+    {S256Field(0x7E692464412CFFA5ULL, 0x89ED4208668CC5C4ULL, 0x408754D8FBD46243ULL, 0x1CDDC3D2B2E71076ULL),
+     S256Field(0xADE6D89CD521954EULL, 0xC41C98426B36B528ULL, 0x3FDB126BF942B08AULL, 0x1E476A0CB2F1F8A6ULL), false},
+    {S256Field(0x1509F734048993F7ULL, 0x96255223F8273CE1ULL, 0x6334FBE1BC8BAE42ULL, 0x0875346A56A38511ULL),
+     S256Field(0x601C2C8172B9DCC2ULL, 0xC9F4D4F1B126018EULL, 0x10E994E6E75FA287ULL, 0x064E6CA8A2EF8B03ULL), false},
+    {S256Field(0xD35FE43934A9F22FULL, 0xCC0819C5217A8E2AULL, 0xF21F8B8B948835B0ULL, 0x2ACCB359F25CE939ULL),
+     S256Field(0x7B75DCB3B75C4927ULL, 0x154BD7BEC5BA550BULL, 0x19213A37EDF0EDF1ULL, 0xD518A4E9588AD2E5ULL), false},
+    {S256Field(0xAB7AC63E3FB04ED4ULL, 0x08CC330B11307FFFULL, 0x463F9D0512678DE2ULL, 0x90AD85B389D6B936ULL),
+     S256Field(0x991D4D48CB6EF150ULL, 0x39AEFABE1582894DULL, 0xAFFDCBD9427222B8ULL, 0x0E507A3620A38261ULL), false},
+    {S256Field(0x2818B0EDA7DC0151ULL, 0x7E125BE646707BADULL, 0xF44B1D1548425E3DULL, 0x7E2CD40EF8C94077ULL),
+     S256Field(0x9A3BC53920721EC7ULL, 0x889BEE40AEEE082CULL, 0x82A61A8B321EF95DULL, 0x905B75082ADCFAB3ULL), false},
+    {S256Field(0x6275DB33B0B7B678ULL, 0xF13C4311BCF63816ULL, 0xA1986BCA426B6C76ULL, 0x186E497334E4231BULL),
+     S256Field(0xA7A076F2F8D91FC1ULL, 0x11077225449535DCULL, 0xAA7FC825C0B7E67EULL, 0xC0D460E49807BD84ULL), false},
+    {S256Field(0x0E103AE41345E597ULL, 0x9C636BF9DB853CF9ULL, 0x21C975BBD1EF52A7ULL, 0xA146F52195BEDACEULL),
+     S256Field(0x7675676AF45A770AULL, 0xEA67A5B221F094B0ULL, 0x9AE95DD2DBB31B40ULL, 0xA5A99B0AB053FEB0ULL), false},
+    {S256Field(0xCF06E5CBB3421FB8ULL, 0x984971F2EF5A55D0ULL, 0xE7E06B34C3B72412ULL, 0x061C8D834F6DBF62ULL),
+     S256Field(0x995EF6684E3CCD80ULL, 0x8067134B3A6FCDD2ULL, 0xBA9392590E05EB5CULL, 0x6DFC6AD99003B4B7ULL), false},
+    {S256Field(0xD08C89B84BB9DC8FULL, 0xABA9E93EF5EDD333ULL, 0x248F7035352787D1ULL, 0xFD9941CEE1C26864ULL),
+     S256Field(0x743EAE53E59780D5ULL, 0x7872B2FDEEFE938DULL, 0x6DE97E05788859E6ULL, 0x7A41EC75BD40E6F4ULL), false},
+    {S256Field(0x7124BE18AF6B35A4ULL, 0x889F37A6AB27FB48ULL, 0xB7363240733A68ADULL, 0xF6A6B63A208EE513ULL),
+     S256Field(0xCAEB6FEC81F422A6ULL, 0x19D5756E75EE1862ULL, 0x1CAD3704F560186FULL, 0x3DF7C8A8002D138BULL), false},
+    {S256Field(0x0CBB53FC4CE45444ULL, 0xDBDE421EFECCC4E2ULL, 0xBCFBF9DAB25A8114ULL, 0xD24C75A1CF1993B9ULL),
+     S256Field(0xCB93246987DD4A57ULL, 0xBF7593F499F1E524ULL, 0xCFCB7D1810E5A78AULL, 0x58FE1D2DE84DC1D1ULL), false},
+    {S256Field(0xB96823E8A6954C11ULL, 0x7FA8A43C1560D018ULL, 0x220D1B0F150778FFULL, 0x87A2FC28C286C376ULL),
+     S256Field(0x756E332E272A8B45ULL, 0xCC48933F2A78124BULL, 0x97B1948DA0D27532ULL, 0x33AD518B45AAECEFULL), false},
+    {S256Field(0xEEB1AFE987A43DDCULL, 0x24282CA1A9956E4AULL, 0xA101EB85EE7BDF55ULL, 0xA8B08B864946AC6DULL),
+     S256Field(0x87001C82DFA2A6B8ULL, 0xA325B4452B1076C3ULL, 0xF31591FFDF0E8EDCULL, 0x7F00FE8BC8A36A01ULL), false},
+    {S256Field(0xAE47472AE2706AB6ULL, 0x3C0B341DD2E53C0DULL, 0x84556EFCBC384CFEULL, 0xE1472E046E7881A6ULL),
+     S256Field(0x36E86A169D58DE05ULL, 0xAA589D55453CD275ULL, 0x83F691978C8621F8ULL, 0x82CD92AA47C58FC6ULL), false},
+    {S256Field(0xE3E9432C3B963645ULL, 0x2DCDB2807E71F1F8ULL, 0x6E74781A2E3132FBULL, 0xC5F0954FB1B8A63EULL),
+     S256Field(0xDBF8874F008BE2DDULL, 0xA330502B0047BE4EULL, 0x18A3CB440260D7E6ULL, 0xD552D31021B0B6FBULL), false},
+    {S256Field(0xEBFAE54207A84FB6ULL, 0xC42368750FA15021ULL, 0xDE8B4D601E48B9EBULL, 0x1CAF92C804F8AEF5ULL),
+     S256Field(0x16B1819027149109ULL, 0xEC1CC1696A2CE676ULL, 0x481A64F8FF101622ULL, 0xBC24B85AC976E53AULL), false},
+    {S256Field(0x53A93123E9C8381FULL, 0x0ED3D6D6383C11A7ULL, 0x34EBEB4634FE1010ULL, 0xDF3ACF55BC6D97CEULL),
+     S256Field(0x1AFFD6962347DE3AULL, 0xB101957E67E389E6ULL, 0xA6099C1DEDACD1EBULL, 0x6B3DD8CA51907A75ULL), false},
+    {S256Field(0xB768CFE14A955911ULL, 0x107E16A260DED52DULL, 0x2589EFE9B3D78397ULL, 0x705BFD69AF09650DULL),
+     S256Field(0x8BB7C693FFD200E4ULL, 0x297F3B522A42E72DULL, 0xA7E63D81F54051FAULL, 0xE14AA4130B73F990ULL), false},
+    {S256Field(0x1B7B444C9EC4C0DAULL, 0xE88C5678723EA335ULL, 0x9239C1AD981F162EULL, 0x8F68B9D2F63B5F33ULL),
+     S256Field(0xF23CBF79501FFF82ULL, 0xBBEA2CFE95510BFDULL, 0xDE1D90C2B6BE215DULL, 0x662A9F2DBA063986ULL), false},
+    {S256Field(0xE6847DF84CF27076ULL, 0xD89858ADE7627EAEULL, 0xFCAFEBE77FD9AF59ULL, 0x4D49AEFD784E8158ULL),
+     S256Field(0x6B90B66203AA781EULL, 0x6E0F2D1A7DF4D846ULL, 0xE723F210359CA6F0ULL, 0xCD32FC59A10DD135ULL), false},
+    {S256Field(0x18E2B8EDD23809FAULL, 0xFD845CB351D954BEULL, 0x8BA93363F2451F08ULL, 0x38381DBE2E509F22ULL),
+     S256Field(0xBD707518331FED52ULL, 0x3681FCCB32D8F24DULL, 0xB09405A5520EB1CCULL, 0xE4A32D0A0FB917DCULL), false},
+    {S256Field(0xE8DBCB5729B62026ULL, 0x8D2A3DE0889D1D4EULL, 0x37D6619E1F5C5AA7ULL, 0x7564539E85D56F85ULL),
+     S256Field(0x4172C8FADACE0CF3ULL, 0x684AACD954B79F33ULL, 0x5231DF524A722925ULL, 0xC1D685413749B3C6ULL), false},
+    {S256Field(0x3EA4264897C2A310ULL, 0xF186AEA540122630ULL, 0xF6921B82AA4699A1ULL, 0x49262724E4372AE6ULL),
+     S256Field(0x0C41B6815E27DED0ULL, 0x6D163612A75FF8CEULL, 0x5A2CFA569714303BULL, 0x1337E773BCA7ABF9ULL), false},
+    {S256Field(0xF8166C1903663DA4ULL, 0xA5A362919F5D0B81ULL, 0x6808A6ED7C44AA2BULL, 0x6A664A356AA5705EULL),
+     S256Field(0xC28313FB33FC22C4ULL, 0x089916127E6C04C9ULL, 0x29F86EC196BF0CD5ULL, 0x449A125954FDE98BULL), false},
+    {S256Field(0x1384B079CEBD2D31ULL, 0x4DCC1A56FF06DB8DULL, 0xD5E253B3E477E2F8ULL, 0xE306568C1A240C90ULL),
+     S256Field(0x692B408392546E44ULL, 0xFFBC8042BE373826ULL, 0x888F2B107F7D0DB6ULL, 0x0EAC6FE378934260ULL), false},
+    {S256Field(0x5364DACD57B4A278ULL, 0x78F61A5F1FF4082BULL, 0x6746FF301AD9CCC8ULL, 0x210A917AD9DF2779ULL),
+     S256Field(0x7F2713FD0C7B2231ULL, 0x3789E61AAFF20BFCULL, 0x7A39BE81F8D6737DULL, 0x670E1B5450B5E57BULL), false},
+    {S256Field(0xC530C39E363136B0ULL, 0x74EBF8D9AAB41DD9ULL, 0x271B0E7623FBD633ULL, 0x3B9E100E2428CEFCULL),
+     S256Field(0x953EC16F6CDBBC8AULL, 0xA2AE28A33AD31F81ULL, 0xDF1533EB8F475B26ULL, 0xFAFB98152D16BB71ULL), false},
+    {S256Field(0xEA98EB53DD90124EULL, 0xC1E802685281C85DULL, 0x77E9A1946DB38156ULL, 0x7AEACA93C06C5541ULL),
+     S256Field(0x3F50781022021E31ULL, 0x59BC1BF9B90A904BULL, 0x4FACAFF046C1D951ULL, 0xDFB29B190C1390F0ULL), false},
+    {S256Field(0x9608F0472F485D3FULL, 0x17CA07688107BEEEULL, 0x2B76CA80F5DEDEF7ULL, 0xBB0AAD49712AC9A9ULL),
+     S256Field(0xE79392503CA2F975ULL, 0x895A5AFA31670BFFULL, 0x8ECD201F7297DA34ULL, 0xEA699C53C5835479ULL), false},
+    {S256Field(0x70F702D505ED815EULL, 0x66F440ABC1C017B4ULL, 0xEBB5FAD219547AD1ULL, 0x5568DAC679F74A32ULL),
+     S256Field(0xD9BBF64C00602DF0ULL, 0xEB05F7EEE2582151ULL, 0x580D6FE01D073F2BULL, 0x7A85F8742788BA64ULL), false},
+    {S256Field(0x4AEED33A36718DC9ULL, 0xE1E58B4DB01123DEULL, 0xD4E8EB197AFE0113ULL, 0x79090AC8E4EEFCC0ULL),
+     S256Field(0x963322B11CFAE7C5ULL, 0xDD36AFB70BA9008BULL, 0x13D816CBCD9AAA56ULL, 0xEAAB722B91905B8FULL), false},
+    {S256Field(0xABEC1BDC2E44A0C8ULL, 0x2C9BE7402EE29932ULL, 0xBC9BAE600C7436C3ULL, 0x601E9E884807943CULL),
+     S256Field(0x54793412BA00E557ULL, 0x424E0C5A6B46E659ULL, 0x714B8CFA9FFABBB1ULL, 0x5A7A22AA6FDC8ECCULL), false},
+    {S256Field(0xA269694C7F60C7D1ULL, 0x8DD71DE7CD775AD2ULL, 0x1C03DBBCE549BA66ULL, 0xE77C81ADE9F97B55ULL),
+     S256Field(0x4EC581F282D72449ULL, 0x631470F71C2986D3ULL, 0xC5FC3B323EA81543ULL, 0x3ACF1478EEF81321ULL), false},
+    {S256Field(0x6686FD5053231E11ULL, 0x1F48E86503681E3EULL, 0x5FF99FF9198C3609ULL, 0xE4F3FB0176AF85D6ULL),
+     S256Field(0x822C38576FEB73BCULL, 0x6CC7E74EC951D1C9ULL, 0x1661A6D0EA02B728ULL, 0x1E63633AD0EF4F1CULL), false},
+    {S256Field(0x3BFEE2233BCDAF2FULL, 0x88531A825BA17295ULL, 0x1EC64110ABDB362FULL, 0x4B30CBB7686773E0ULL),
+     S256Field(0x68033D463D26B5B7ULL, 0x1FDF3C81E4348575ULL, 0x6F9E2C5777C3C4A9ULL, 0x74C6350265BB629BULL), false},
+    {S256Field(0x5399F04E6BF05BD6ULL, 0xA2F56E03212A9946ULL, 0x0832F51FEB470DECULL, 0x900C3241BEE44FE9ULL),
+     S256Field(0xDE52AD3BF00D358BULL, 0xD69853583C4EFB15ULL, 0xF95C7204570B2439ULL, 0x6C31F9E8E8B1F0F5ULL), false},
+    {S256Field(0x2FFE9C29A673059FULL, 0xEC11715050E0FA19ULL, 0xCD15B20B17464817ULL, 0xCBB434AA7AE1700DULL),
+     S256Field(0xB7DA9642227C070CULL, 0x41D45E4F0AD5F845ULL, 0x562D492338B5DFADULL, 0x4A1A200AB4DABD17ULL), false},
+    {S256Field(0x7A7C28CC9F105C50ULL, 0x82E0DEEF7B138525ULL, 0xD628CC3403C233CDULL, 0x5A8D0362AB0590AAULL),
+     S256Field(0x5C9B201838A4CDE9ULL, 0xA605F68A66D013C3ULL, 0x936A6B724143FF74ULL, 0xC059EAB113D4E536ULL), false},
+    {S256Field(0xBE6FB2F7A72E294DULL, 0xF158EBA3F00D0DD5ULL, 0x1A6289EAEDF7EDC6ULL, 0x29DFE4805CD534B9ULL),
+     S256Field(0x44137260EC469B52ULL, 0xD1F1961C3929EE69ULL, 0x9B434E7588A05E4DULL, 0xBF66D826D00672E1ULL), false},
+    {S256Field(0x647E18B9B2D64FEBULL, 0x3772F8A59292292CULL, 0x48EF3A5776CBA4E8ULL, 0xD93F4D031232F60AULL),
+     S256Field(0x7B0FBD5934698359ULL, 0x93E0430BEEC90DA3ULL, 0xA237311C54DC8C4DULL, 0x7925555D45CB2733ULL), false},
+    {S256Field(0x4D4786E106DE12C0ULL, 0x6D9CDAC5874610E9ULL, 0xD06D7B1E7557244CULL, 0xF478056D9C102C1CULL),
+     S256Field(0x69A76CE6CA5361FEULL, 0x26C17EF609AB92D7ULL, 0xE68095E01068694CULL, 0x7F09E610F33E3946ULL), false},
+    {S256Field(0x722204CD439FBC84ULL, 0x7E7062916057A016ULL, 0x1B14E2BC662AC65BULL, 0x2F0769C6E36F2844ULL),
+     S256Field(0x3FB902DE1C201BECULL, 0xCCA79B6A4C4DD5D7ULL, 0xFA5DF007990E2149ULL, 0xB434F3724D73BDDDULL), false},
+    {S256Field(0x928B2FD2D026DEA2ULL, 0x87C84C452C59C5D8ULL, 0xD71A1E26D9A6DD61ULL, 0x1DDCFA48D561BBFBULL),
+     S256Field(0x06F4873D183DE522ULL, 0x666FD68C51C06734ULL, 0x41FEA34D6402C020ULL, 0xC6FA401FA9923A7DULL), false},
+    {S256Field(0xD537EACC86A758EAULL, 0x91188318927F19C4ULL, 0x9586895A15416E39ULL, 0xFE7E6780559E0309ULL),
+     S256Field(0xE4F22D95DB7AB649ULL, 0x3B801707443120D1ULL, 0x88C08E169849251FULL, 0x38AA6967A281DCB9ULL), false},
+    {S256Field(0x3C7F0046C33773F7ULL, 0x50D44FD345B59995ULL, 0x3E1410C009E372A1ULL, 0x355B3226F5DD236DULL),
+     S256Field(0x0053C3FF1887C182ULL, 0x1E25DF78CCE25109ULL, 0x49F10EEDDD21FCB8ULL, 0x08ECA480704703ADULL), false},
+    {S256Field(0xDE7156268CFFFEFAULL, 0x1018044F70651AFAULL, 0xD6DF6F9150C3AF85ULL, 0x91BAF5CA75383127ULL),
+     S256Field(0xC7D36F34DF7F6FAFULL, 0xF4BEF310E6FD303DULL, 0xE5D969F127DD3D92ULL, 0x04E5CF119347BCEBULL), false},
+    {S256Field(0xDD3DF40690785491ULL, 0x5291DE5E4AEAA5D1ULL, 0x5619F43CB2F866B7ULL, 0x92B1E0F17F260BAEULL),
+     S256Field(0x9C98D36058BE555BULL, 0x3985FB77E2288D7BULL, 0xE167C1D1034E5AD0ULL, 0x81EC44028D8D9E63ULL), false},
+    {S256Field(0x2FC0917E8D33C546ULL, 0x82575FB3285EDAF3ULL, 0xCB2C5373E0F5DDD7ULL, 0x44584121CB3F78A7ULL),
+     S256Field(0x60A6D187000B4FD4ULL, 0x852F0A3CFB2CA736ULL, 0x77225EAE391ADA20ULL, 0x308D9377F3F8753AULL), false},
+    {S256Field(0x16FB6EAE20EAE29EULL, 0xC7034F2F0D4E1D07ULL, 0xEB961537A45A4266ULL, 0x8C00FA9B18EBF331ULL),
+     S256Field(0xE7D2A4C66702414BULL, 0xC2FADAFA81E36C54ULL, 0xA9DC343A3736C974ULL, 0xEFA47267FEA521A1ULL), false},
+    {S256Field(0xE84C9AB0C18ADA5FULL, 0xFD7E297F29122FB3ULL, 0xA8BB5BF9636BE1EFULL, 0x24CFC0176DA2B46FULL),
+     S256Field(0x68FA6139978A586BULL, 0xED959CA1A4F814F2ULL, 0x9868714D5DEDA927ULL, 0xEBFF8FBB079C61A6ULL), false},
+    {S256Field(0xC3F95603EBFD913DULL, 0x50A680E6EE54C9EAULL, 0x74D07A084C2A8D20ULL, 0x36362AA7E907DDF8ULL),
+     S256Field(0xC44F9AEAC52E243DULL, 0xD830BB10D6B2FAAFULL, 0x3416244370DA2A82ULL, 0x48F278676CB8AFD5ULL), false},
+    {S256Field(0xF103189594679DA2ULL, 0x16DDD67FC7F057EDULL, 0xEA2DED72A1292EC6ULL, 0x004A7D58D4B9BC82ULL),
+     S256Field(0x4877F484779FFE26ULL, 0x71C3B494963FA28AULL, 0xE6B1D8147EC71B3BULL, 0xB98AC5B76702CB75ULL), false},
+    {S256Field(0x7CABABF9AD132896ULL, 0xFCB1E3BAB7BC6C96ULL, 0xF295AD962DD9200DULL, 0x4487976DF32A1E02ULL),
+     S256Field(0x48C01B12AF685248ULL, 0x06B40D5A6276AA7AULL, 0xEFC9A90774561A33ULL, 0x27BD5860D115AFE1ULL), false},
+    {S256Field(0x859864D3775732C0ULL, 0x202FE5E7233777AAULL, 0x624A5D1B7CB1096EULL, 0x8F3CCF31F8B74B9BULL),
+     S256Field(0xE73BDE5E65B9415BULL, 0xA90E687754858825ULL, 0x89EF46D997CE53D8ULL, 0x67F1CD3E2D39E531ULL), false},
+    {S256Field(0xE08156F6BFA2670CULL, 0x7400F82BA06273E6ULL, 0x8B6A9CAA83350324ULL, 0x4A4D3AC28BCB8378ULL),
+     S256Field(0x808B9FFDD6C1764DULL, 0x4930594CBF29BEEDULL, 0x17E7711DDEF02B9DULL, 0x70ABB91C01845A4FULL), false},
+    {S256Field(0xCCF34EADC87C4B65ULL, 0x96F8808A1E07B2A9ULL, 0xFC76C5E2C066CE49ULL, 0xEE7D69C4CBD001C7ULL),
+     S256Field(0x23E8F44ED136A95AULL, 0xC33E8999BAE942E5ULL, 0x1A192ABF030F2EE2ULL, 0xECC8626EC1A41382ULL), false},
+    {S256Field(0x0D96AFE24CB24AA7ULL, 0x903108C639345C53ULL, 0xC3AE6FD89FF8FE18ULL, 0x5F7B2D190AE91802ULL),
+     S256Field(0x6D7807434A693D7DULL, 0xCE8DEB7093C81D0CULL, 0x30A3F80A3CE67C47ULL, 0x07703600C4FDF2B3ULL), false},
+    {S256Field(0x842632D7FF004130ULL, 0x49FD863381C36B09ULL, 0x266A14E5254CB5AAULL, 0x50D775B5F72D186BULL),
+     S256Field(0x456B8C64DF6E406DULL, 0x2975D945EEF6A4C3ULL, 0xC51724346010063FULL, 0x3401EE3B0F4EA557ULL), false},
+    {S256Field(0x4191BC5F2F7FB8BDULL, 0x7BC464A15FE4090AULL, 0x2AEC24E6D94886D8ULL, 0x51397451339D90D0ULL),
+     S256Field(0x8094AC2D83908C0FULL, 0xFAFC32D3E3F98D5AULL, 0x4B88FEFDAE815C47ULL, 0xFCD7143E47643BF3ULL), false},
+    {S256Field(0xF2A1F83934889F3FULL, 0xC4FEB28B45095DA7ULL, 0x21EA3469B169B0EBULL, 0x87991026F1B21196ULL),
+     S256Field(0x49E2DF9BC3BB792BULL, 0xE932F61BF286037BULL, 0x2132F2CB717F279DULL, 0xDDEAB94CA5A91D96ULL), false},
+    {S256Field(0xE2B74915EE36CA73ULL, 0xEAC864D36BBBF3EDULL, 0xAA429112BF014887ULL, 0xCF8316D62BFBDFB8ULL),
+     S256Field(0x5B4921942EC25534ULL, 0x1C961598D88D710FULL, 0xE384450890DCCA68ULL, 0x09FEB58DEB5D9D73ULL), false},
+    {S256Field(0xAFCD9846BD9C8F0AULL, 0xAF3E9F2C8BD84E64ULL, 0xC3926603BC03A87CULL, 0x6E2114ED297BA44FULL),
+     S256Field(0xBD79148DD16A2C9BULL, 0x090BEC75D0F9595EULL, 0x7DA6D50F80C5D91DULL, 0x05591A0CC26F06E2ULL), false},
+    {S256Field(0x3C8937D6B752F97DULL, 0x5A2EFBC75F347661ULL, 0xE539D28668CFA616ULL, 0x8610DE9A4C4BB49DULL),
+     S256Field(0x8057DCD41F1B1AF2ULL, 0x57AB4D9F545543E0ULL, 0x937CD99B2533F99EULL, 0xD31997A02B630BBCULL), false},
+    {S256Field(0x997FDDFC60CB3E41ULL, 0x143D084F308B92C0ULL, 0x3E10CEC0A9E98ED3ULL, 0xE7A26CE69DD4829FULL),
+     S256Field(0x0E8A9421CF2CFD51ULL, 0xD0A6B2C0420E83E2ULL, 0x471B006A1AAFBB18ULL, 0x2A758E300FA7984BULL), false},
+    {S256Field(0xD97E5B917B4AE861ULL, 0x203C35E4D6E32FA9ULL, 0x0D38BFB6772089F5ULL, 0xF5CAFABA036BF8D0ULL),
+     S256Field(0xCC9C239C0D82239CULL, 0x9B3B2A9C552F05F3ULL, 0x7BFF990464083915ULL, 0x19E83B8A022A6D81ULL), false},
+    {S256Field(0x70F9FD2BFAEE42DBULL, 0xD9BBBC5B4730714AULL, 0xFC7B6EDB91ECBFC1ULL, 0xCC3427E7D9B59150ULL),
+     S256Field(0xC6229C0115D87BDBULL, 0x10E5CBAD8E72422DULL, 0x885E3FD3FB215200ULL, 0xEA249841A521C6A1ULL), false},
+    {S256Field(0x84FD4CD7BD2A9651ULL, 0x8F9E509C494C9820ULL, 0x12DF5156D7E80542ULL, 0xE9389024CEB63F1FULL),
+     S256Field(0xFEFDE2B75E786824ULL, 0x8D7110CEC6770BFEULL, 0xF9287ABAF671AAF1ULL, 0x8648688723726595ULL), false},
+    {S256Field(0xFF4366C67ED4A086ULL, 0xB1D75C158E9C410EULL, 0xEC83C585FBCB5CF4ULL, 0x948F05BACD98445DULL),
+     S256Field(0xA2A1800F9E2BCA4BULL, 0x1C2328A71C3FA2D1ULL, 0x82F450A660113941ULL, 0x864CA89FFB5A2A33ULL), false},
+    {S256Field(0xCB0A71652E96E4F1ULL, 0xFF5F01600AE80030ULL, 0x20177708335EFCCAULL, 0x56BB148F0198197EULL),
+     S256Field(0x5889F019EEB0582EULL, 0x7313D1D2004AF0EBULL, 0xBEB03ED8BE30EA9FULL, 0xA09584A561300A33ULL), false},
+    {S256Field(0xC0CBEA6CB7542C21ULL, 0xAE19F4D28EA64C15ULL, 0x0656FC45451D6D43ULL, 0x2584196292919AC9ULL),
+     S256Field(0x3BEBE319672BFABFULL, 0xF3E3A186E4C2AD7BULL, 0x01E5DAA4CC7513D5ULL, 0xFCB35B1F1CDB2448ULL), false},
+    {S256Field(0xCF2D41AE7CDDAB8BULL, 0x9F0E4D1253C68E6FULL, 0xED116900D82D0C37ULL, 0x264559D87829256BULL),
+     S256Field(0xC9F64B45001DE473ULL, 0x7A8631AF39CAF1E6ULL, 0xEF7BC637034072D7ULL, 0x79E5BD1926D3512CULL), false},
+    {S256Field(0x43C461F40C1ECBF8ULL, 0x6489F0DE9AEED7CAULL, 0x22A9754CC1E8421FULL, 0x7E12CDC41373C525ULL),
+     S256Field(0x9D45B8CDB0BED615ULL, 0xC969F61D8FE1D9F5ULL, 0x143F94DABE4D1259ULL, 0x71284F88888DC837ULL), false},
+    {S256Field(0xE2DA28FB898A26C1ULL, 0x9A954FA17393B04AULL, 0x6EA351579C26E1C5ULL, 0xB6A0C8FD373B52BBULL),
+     S256Field(0xF5550EDA8A78217CULL, 0xFC94A5E858AB5A06ULL, 0x9A901E3FEBDA7FACULL, 0x5EF193BFDA037494ULL), false},
+    {S256Field(0x17E6651C14557D86ULL, 0x1CFEEC478E667FF4ULL, 0x772B91CA7A05A6CFULL, 0x4B8EC2FF2A3742A6ULL),
+     S256Field(0xBDD9B191B5167EB9ULL, 0x28D5F2EF0FC3F692ULL, 0x14A4072DE527AC5FULL, 0xFDE6C3FF04C157ABULL), false},
+    {S256Field(0xA4C57F5981F23D1FULL, 0xB6B25FD720C036D8ULL, 0xBD3D489E1FD8A0A6ULL, 0xB398E8153D670BBBULL),
+     S256Field(0x1583EBFF832FF3FCULL, 0xEA791D8AD26156CDULL, 0x07F7FEB2FB00BA52ULL, 0x69F59C22572DF47FULL), false},
+    {S256Field(0x52B82D3B4780763CULL, 0x5F8A6D5E9265691DULL, 0x532436DC697AC07EULL, 0xFCD5C10733963A42ULL),
+     S256Field(0xB54E742038E851CBULL, 0xB119B22E716463A4ULL, 0x3B720DB35F72E38CULL, 0x18DDABE2E5522C46ULL), false},
+    {S256Field(0x2B1C47A633E9FC8DULL, 0x48B84809824F28ADULL, 0xA6CD0B2054631A73ULL, 0x634A0DC1BB425DFFULL),
+     S256Field(0x9587F30B273F87B6ULL, 0x519AD5A18ED5C616ULL, 0xAFE05A657DE4A9CFULL, 0xD75BE21FE75A4B6CULL), false},
+    {S256Field(0xBCE3BE305D8EF686ULL, 0xF68E48F402272E66ULL, 0x2238A5DAF8266E53ULL, 0x900F2CEE5843CBE5ULL),
+     S256Field(0x073A4967E121A8CFULL, 0x596CDFF43C9156D5ULL, 0xD61C551B1349D110ULL, 0x732AC155EC60425AULL), false},
+    {S256Field(0x3CF29EB3DE6B80EFULL, 0x71CBCB967D79424FULL, 0xD23540C223BCBDC5ULL, 0xB6459E0EE3662EC8ULL),
+     S256Field(0xF30BF0B61A71BA45ULL, 0xC4B3AE6D48E35B2FULL, 0xE1DADF16E5661DB3ULL, 0x067C876D06F3E06DULL), false},
+    {S256Field(0x253EF375033EB51FULL, 0xB6890576BE79C211ULL, 0xE4D36F7301F41593ULL, 0xE5D8E8F0D9823C88ULL),
+     S256Field(0x79D5BD965A62A2D9ULL, 0xE509DC46D9F0F549ULL, 0xABB16A57D8FEEEF0ULL, 0x4DC1E9B7861E3E04ULL), false},
+    {S256Field(0x439CF279319888E9ULL, 0x3D12BA6BF2448A8BULL, 0xDDE60D3029668167ULL, 0x1F90EA773AC3A6E2ULL),
+     S256Field(0x56FDFC97EF113B79ULL, 0x213751FEE59522E6ULL, 0x958153D271EB96A8ULL, 0x89BE367C15DAA10EULL), false},
+    {S256Field(0x37A676480F155E64ULL, 0xAB66BE4FA8A30117ULL, 0xC56B0F7321BAE0DDULL, 0xA9CA27F77DBC8C3DULL),
+     S256Field(0x1F3F333C561B3297ULL, 0x875D41821BCAF0AEULL, 0xD197D2246C02D004ULL, 0xF4BB335678FB14D4ULL), false},
+    {S256Field(0x085EFB6F3562222CULL, 0xDE03447991E6F2C6ULL, 0x6E702BAD334B52BAULL, 0x13A4E54DEDFFE0ADULL),
+     S256Field(0x8CB1668CA8200145ULL, 0xD4F9C577ADC904C0ULL, 0xB2CAC2F81D609A52ULL, 0xC9D67D4E5816E813ULL), false},
+    {S256Field(0x93EAB3DDC1BF6C42ULL, 0xF7793D9B11988753ULL, 0xEE74654816CEE74EULL, 0xD02E1B3CD6C105C7ULL),
+     S256Field(0x1336328F87BC54CCULL, 0xBCA5879B931B6AACULL, 0x12732270D0D24526ULL, 0x9A0B74F3CA8E2258ULL), false},
+    {S256Field(0x437E4DC0F43B46BBULL, 0x12ED3A63FAC92525ULL, 0x1D407C05D8455DBDULL, 0x61991EBF233CAADDULL),
+     S256Field(0xF48F5901CC20A848ULL, 0x1CA8729CA52ECD8EULL, 0x952F387166FBADF1ULL, 0x01C5E308F3FDE492ULL), false},
+    {S256Field(0x6D4BC629D6EE247CULL, 0x1F478E847F51CEE0ULL, 0x5EBA105611CFE759ULL, 0x68FB71800686D7F2ULL),
+     S256Field(0xAE1F822D1A01865DULL, 0x9A8D580B04C73C9DULL, 0x73735427501B0C07ULL, 0xCD12D23462DD9636ULL), false},
+    {S256Field(0x7E5BE3DDD21ADD3BULL, 0x8B9A944F45727D8FULL, 0x49039CDB0D162611ULL, 0xEA27AEA4B787D387ULL),
+     S256Field(0x1B5E291DB68CE7DDULL, 0x78B212D68E4E1BE7ULL, 0x5723CEB2325C2F62ULL, 0xC70FF1E6E42A17DEULL), false},
+    {S256Field(0x9345ABDBE2DA1F54ULL, 0x1B2B52C2231425DFULL, 0x987550AB19345116ULL, 0x7137F7B23DF260EBULL),
+     S256Field(0x4AF8D436CDC3EDBCULL, 0xEBF081D546CFDBB8ULL, 0xE5CDACB17F2600A7ULL, 0x5FE78AD804358074ULL), false},
+    {S256Field(0x6E8AF8BB611FF757ULL, 0x9B4CE9741C4C226EULL, 0xBA9010F8B6E2B6DAULL, 0x594651356B7FFD54ULL),
+     S256Field(0x28A66ECA894D031AULL, 0x961BBC7B7FBFFE3BULL, 0x042038D015C406F9ULL, 0x3611360CE5DF2750ULL), false},
+    {S256Field(0xA1EF47F18F6C15C2ULL, 0x3DE76414C8F38F1CULL, 0xEA17398139D14348ULL, 0x8456A852BCA1757FULL),
+     S256Field(0xFF1EFC328B174134ULL, 0x4CC90F09856FB671ULL, 0xFD349EC371079E7FULL, 0xE1B9DA46D4842CDEULL), false},
+    {S256Field(0x676258A3636160B5ULL, 0xCCC53F2470E7EBC0ULL, 0xE843AF7970091EC0ULL, 0x16B26E3915F73290ULL),
+     S256Field(0x14625FBF58A1DC0EULL, 0xE1363AAC70BA3EF8ULL, 0xB6364352463654D4ULL, 0x060F565A6302EF8BULL), false},
+    {S256Field(0x3D61DE938E1B793EULL, 0xD36AEEA2B0D2E518ULL, 0x5C02ECCF2CFAAE4DULL, 0x4F15157C98351CE6ULL),
+     S256Field(0xB4FCC1FDC3BA9889ULL, 0xC0DAFF4B354A47AAULL, 0xFC9DA9DB9CD4A0CEULL, 0xC094E366079DB939ULL), false},
+    {S256Field(0x3964D28937B32DB8ULL, 0xC91ED749F647791FULL, 0x1BEA143C842CEA85ULL, 0x024B5295C4559F93ULL),
+     S256Field(0x59454FAAAA64F760ULL, 0x62AB6811205B81A9ULL, 0x7B6E2821CC5E5BE8ULL, 0x609FEF8F5BFF309CULL), false},
+    {S256Field(0xDEDA0F5B496943E8ULL, 0x1D6F1FC67E73C5A5ULL, 0x793234AA118F0623ULL, 0xD68A80C8280BB840ULL),
+     S256Field(0x294C84266B133120ULL, 0x5B0E7B8F7845295AULL, 0x0C4B1F9177B0E28BULL, 0xDB8BA9FFF4B586D0ULL), false},
+    {S256Field(0x8BDA222CA412B6FDULL, 0xACED053C6F702B82ULL, 0x402F8EFB3752373CULL, 0xF16A409C677A40BEULL),
+     S256Field(0x268DAE77ECA052DAULL, 0x16540659249EBCA4ULL, 0xD7A6A75A74E30E4EULL, 0x2A41311714532799ULL), false},
+    {S256Field(0x35B42AA18CA1C4F9ULL, 0x4F4EFE34CAB7E282ULL, 0x4C40B83DA61F16F4ULL, 0x7815F78F22BD728CULL),
+     S256Field(0x9AB1EA36B778BC15ULL, 0x5CB42DE61577D1E1ULL, 0x7DD93CF31458C35DULL, 0xC1C601E8CD39AF6AULL), false},
+    {S256Field(0x5C1A0B6E326DD4E4ULL, 0xB89F4F2F6BED9832ULL, 0xFBE37F699976F84DULL, 0x4154B506AB766F42ULL),
+     S256Field(0x6C859295075DED1CULL, 0x414EA9D9D1E22DD4ULL, 0x94C6E44D61025FF6ULL, 0x23AD075043C59888ULL), false},
+    {S256Field(0x6D26E1C3EE8C8530ULL, 0x512DF681EF8F4D8EULL, 0x6E377C64016A6C6DULL, 0xC39273CDA0EC4017ULL),
+     S256Field(0xC4030F0F798446C7ULL, 0x50EDFCBDA2EED715ULL, 0x9D01D39441C31998ULL, 0x8C41BE4257433C8EULL), false},
+    {S256Field(0xBDE4CE8B43ED5996ULL, 0x6831FE599360AF53ULL, 0x492FBC903281B924ULL, 0x1A46B7E9FE99A4EAULL),
+     S256Field(0x2EE4ED11E8C85CAEULL, 0x508794A9EF52745CULL, 0x0E3EE084A063EBF5ULL, 0x683CE81EA3F1DC57ULL), false},
+    {S256Field(0x31F240BB237A26C1ULL, 0x166C6E58C0DBF6A5ULL, 0x27522431C1D03B25ULL, 0xDA317447F58411B0ULL),
+     S256Field(0xF51836ECECF74D6FULL, 0xD36836C5D7A81525ULL, 0xD2384167C259D8B7ULL, 0x753B97B87F5D8C69ULL), false},
+    {S256Field(0x4C51A7A63F7F0246ULL, 0x93E86E49FC727DDFULL, 0x080A8D4D0B5956EAULL, 0xB73C652769CC95C1ULL),
+     S256Field(0x597E5164EA2A407BULL, 0x1A0D72E4C6E554E5ULL, 0x4B535893C5B6C1EAULL, 0x9A67DB107174CA9DULL), false},
+    {S256Field(0xD2B628A93739DC49ULL, 0x239392DA66F55603ULL, 0x1064AC508BFF231AULL, 0x6A4BE6CB02AF0E6CULL),
+     S256Field(0x3E6A2B9DF2EDD5CFULL, 0xAB7E2B4CB14A4A4DULL, 0x7DC166E360FA8058ULL, 0xF15D8FAA2A890759ULL), false},
+    {S256Field(0x8AD9BF9DD8F8FB8CULL, 0x4CDC2B9BAA5BDE14ULL, 0x9512FACB5C730111ULL, 0x3659BA7060D8200CULL),
+     S256Field(0x75E46B8C7CC8A3D1ULL, 0x1E142ED4E44BB135ULL, 0x139725F8EC74987FULL, 0x4EE7A9E806E01A17ULL), false},
+    {S256Field(0x98BE8A0C46987FACULL, 0x8BC90F8640A86F67ULL, 0x44E982603EC98A3CULL, 0x01F7C69F13AE7F13ULL),
+     S256Field(0x3F91E73819174C68ULL, 0xCB7F5DE219F6BC26ULL, 0xE5B1036E329AB6F9ULL, 0x9D4ECC3F36FDA22DULL), false},
+    {S256Field(0x1F4D359CEE2E607BULL, 0x88AA1EEC6C0F36AAULL, 0x20D111F5657FDD2BULL, 0x07733F67FD31772CULL),
+     S256Field(0x6A2F311DCC614763ULL, 0x89E3BDE05BE017D2ULL, 0xEAE63A8C5BB156F4ULL, 0xFD9FE8FBAC178285ULL), false},
+    {S256Field(0x1D33A1BD76DABA4DULL, 0x9C65FB0E20319626ULL, 0xCB7062EDD8FA2BCBULL, 0x557E9401761FD381ULL),
+     S256Field(0x51374A1BB7A52316ULL, 0xC5E9B8F5FA43590AULL, 0x46D35CFA15CCBC86ULL, 0x7A7E8F3A601FA7E0ULL), false},
+    {S256Field(0x6E22D9CD3C05FBDDULL, 0x79589D5274E48139ULL, 0x38920654B6AFA032ULL, 0xE3E4750A00310C48ULL),
+     S256Field(0xCBA2231D1535B883ULL, 0xB46587BFC5CFAFFBULL, 0x05235049961A1204ULL, 0x0FA79701ABAD2590ULL), false},
+    {S256Field(0x038F52FF29F5341AULL, 0x9CC7A32C669636B8ULL, 0x3B29D40EA7B10141ULL, 0x3ADADA82199885A9ULL),
+     S256Field(0xB51580936586C6CCULL, 0xE9D6D2E5B45E8FBCULL, 0x552E35BF36AB1017ULL, 0xBFEA1E228999369FULL), false},
+    {S256Field(0x4095980FC28D3D5DULL, 0x9612AEB973449CEAULL, 0x52DC0270907A30B0ULL, 0x324AED7DF65C8042ULL),
+     S256Field(0x967224AF96AB7C84ULL, 0x19213B0C7E332843ULL, 0xF130C0C35AEC1F4FULL, 0x648A365774B61F2FULL), false},
+    {S256Field(0xA8F38381B2919749ULL, 0xF72B3E4A8DE0DB1FULL, 0x28D32681880D7203ULL, 0x32C9331EA26F4902ULL),
+     S256Field(0x631E97B0F290B5E3ULL, 0x268A4ABDAE39AB09ULL, 0x695A2F02B6F3DBB8ULL, 0xD7CD272B34209CB5ULL), false},
+    {S256Field(0xF5C917582FD53ED3ULL, 0x163F74FB9DA56CCEULL, 0x5B8F60B931DF7C49ULL, 0x20840BD5996772ADULL),
+     S256Field(0x87143FE51A7A7132ULL, 0x5487C47394E70899ULL, 0x487BD476A6BAFAC2ULL, 0xF2993497CEC18243ULL), false},
+    {S256Field(0x1E1C22527B9795E4ULL, 0x69C161B6E1846B8EULL, 0x4A02F6A70FEC6B1CULL, 0xEB292F3B3B983785ULL),
+     S256Field(0x5B7E9D2FAE53A0FEULL, 0x57131D7509111C6FULL, 0x1696634AF145835BULL, 0x8C43C25A96EEBE80ULL), false},
+    {S256Field(0xDBD2CBB588A35B35ULL, 0x1AB5D88A5C0A121EULL, 0xBD13D029E588EBFDULL, 0xE6B6BFF60EB339BBULL),
+     S256Field(0xC57293DB9C1007BDULL, 0xFE3B6C9D3BE999C7ULL, 0x266F43E3835961DDULL, 0x1A5FF2BD3300D2F3ULL), false},
+    {S256Field(0xC48B8E292032F9A2ULL, 0xCE566F50FA1FC6CCULL, 0xED2374CB31FF8F63ULL, 0x25AAC6BD9A6B2640ULL),
+     S256Field(0xE76230A12B51D4F0ULL, 0x559883BBC419F3D9ULL, 0x16F32F54F4F190F6ULL, 0xF5A6C63BA644546CULL), false},
+    {S256Field(0x0D4EF8D2C0360DD3ULL, 0x47A8A836D850E209ULL, 0x88B0B8086E0CE3BBULL, 0xE05317745BE499B2ULL),
+     S256Field(0xB2AECD913C24F87BULL, 0x61B987DE98103DC2ULL, 0xCD809582B5B6A014ULL, 0xDC1C3B71A5D92F39ULL), false},
+    {S256Field(0xAEA39D5789303FDDULL, 0x4D71457F19D1ED35ULL, 0xE620D4310049FBE1ULL, 0xA65A3A01DF3B5EF2ULL),
+     S256Field(0xDAD44A8D02E68703ULL, 0x86861D024FAED3CAULL, 0xB8F43D8D90ED2C76ULL, 0x798EA0940CFF5C6FULL), false},
+    {S256Field(0x7C146662D098DFEAULL, 0xFADCB3C92EA67879ULL, 0xE018E5D2A83A5E57ULL, 0xA8153B3A77886C59ULL),
+     S256Field(0x8A49A9DF6E6D892FULL, 0xB1B5E0F742DAF415ULL, 0x53D8DB9C57853E03ULL, 0x2A47396461D060FCULL), false},
+    {S256Field(0x61630D52D24C9489ULL, 0xC0AEF4E6E14E4A98ULL, 0x9A27887FF6E9D528ULL, 0x6281BB15D9D567C2ULL),
+     S256Field(0x9187F26B9DF42BC6ULL, 0x45FD964DD321B3ADULL, 0x922738F456E9BBF5ULL, 0x2FD3C5A0908DA865ULL), false},
+    {S256Field(0x0A7E77A48BCECFA5ULL, 0x2A0D62DA1B16BB02ULL, 0xDEB4695C638EDA3BULL, 0x4F05C3B30FECADDAULL),
+     S256Field(0x2ECD024A95D37B53ULL, 0x447EE431F01B48CDULL, 0xADD63236159534B9ULL, 0x53A499EA603D426FULL), false},
+    {S256Field(0x90131CBA94445A7AULL, 0xDF9535F081CF1EC5ULL, 0xB12F11B6C601C8D5ULL, 0xF82FEFBC9F06C6BFULL),
+     S256Field(0x963ACE18642A7A98ULL, 0xB51C83B64640D1E5ULL, 0x5503942C1940B4A4ULL, 0x94BB37BDC6FB6B67ULL), false},
+    {S256Field(0x461E7659084B96AAULL, 0xD0298635522ABCCEULL, 0xE26405E1AA3B980EULL, 0xD9309AB99F67A91BULL),
+     S256Field(0xF26C4F37C2B28A86ULL, 0xD3B6C9FBAFCFE978ULL, 0xD7E10F066274CB5FULL, 0x6EF99B2A9B4EC557ULL), false},
+    {S256Field(0xF6FDD42B16B7D2D5ULL, 0x2637B84D1D56EA66ULL, 0xC830F3D322EF502EULL, 0xA285ABAA97834203ULL),
+     S256Field(0xC405D52F9001F99CULL, 0xD8657321B6B753E9ULL, 0x92B952DFE10B2E2AULL, 0xE56E9692CD1B7AC6ULL), false},
+    {S256Field(0xCF7B8D059F8FCF0EULL, 0xD65B6FFDE7C4A6FAULL, 0xBA9C3446DEAA3411ULL, 0x7D587CA138562D35ULL),
+     S256Field(0x501C1A09D8BC9459ULL, 0xC463900AD323780AULL, 0x2723400B6CFD6AD0ULL, 0xA7295C0388304C61ULL), false},
+    {S256Field(0x8E8BD373FD054C96ULL, 0xEEC4143BA8D1CA88ULL, 0x6D51DFDBE5FEE5DCULL, 0x4DF9C14919CDE61FULL),
+     S256Field(0x92EBAC06CAD10D5DULL, 0xB5D506CDC2884901ULL, 0x050974C23A1D85D4ULL, 0x0035EC51092D8728ULL), false},
+    {S256Field(0xC0C6B0FC1DA49E04ULL, 0xE9DE4554E57A8D70ULL, 0xD25317D4E4B87088ULL, 0xED32CAD8D2CC998CULL),
+     S256Field(0xB63120D17C1DB9E0ULL, 0x52DA9FACB49FAB7DULL, 0xA541CA375859D20BULL, 0x129FEF5F1D030204ULL), false},
+    {S256Field(0xF4F225DA5DEF001DULL, 0x21F9BBD6989BA27EULL, 0x20E0BD1C09E3B64BULL, 0xA549A32DB27E2CAFULL),
+     S256Field(0xDD5DB1A7F0624783ULL, 0xEB141E2A62C9705AULL, 0xDF4CC30ED8A59456ULL, 0x799B7A7906D966CBULL), false},
+    {S256Field(0xCB7418D4E883F855ULL, 0x28C36DCB63C34016ULL, 0x8049E4111C70366EULL, 0xE821AB724D6360F1ULL),
+     S256Field(0xED4E0C6A59852DDFULL, 0x8B3B19C614EC23EFULL, 0x67D0D4115416CF59ULL, 0xADEFCBF863F53CE3ULL), false},
+    {S256Field(0x05AEF1E5C52ED4CBULL, 0xC954DEFB3C09EC5AULL, 0x23F08BD983532E6EULL, 0x7E798F30DA07ECD1ULL),
+     S256Field(0x2571660794BB9462ULL, 0xB173571BFF9F37A1ULL, 0x041A9549DEF2F057ULL, 0xD23DCCC4A24DAC83ULL), false},
+    {S256Field(0xA24778AC4206E37AULL, 0x4D8C18948C504731ULL, 0xCF4E83F46B5A274FULL, 0xB526AB87F2868002ULL),
+     S256Field(0xBF3678FFF0C5CCABULL, 0x28CE539B00FA392AULL, 0xD5CAACED60A6F18DULL, 0x641F35D778100D8EULL), false},
+    {S256Field(0xFDF3A0FBD3630834ULL, 0x8463F12863DAC067ULL, 0xAD5B9E96BA8C8108ULL, 0x224FA20031514783ULL),
+     S256Field(0xCD3C4737C47A2272ULL, 0x3D62924EC0A50F75ULL, 0x3C4B70FA391D09F5ULL, 0xBBE54E32BB3EDA5CULL), false},
+    {S256Field(0xFBFF59EEB441742EULL, 0x2F14A547AF3806E9ULL, 0xF455452FBC9693A7ULL, 0x3F0D8994E51AD212ULL),
+     S256Field(0x8C65363BCFECADBEULL, 0x1E205E2C3AD13D95ULL, 0x45E5CB0E847A6E0BULL, 0xFBD76C23F28C3DC4ULL), false},
+    {S256Field(0xB67649D1583C19D7ULL, 0xBBBB5E45AC2CF57BULL, 0x129A25CCE4228EF2ULL, 0xC2D4A0CC600A39E4ULL),
+     S256Field(0x72F28B82C507928DULL, 0x26804A8317345C97ULL, 0xD4183B5F7F41260DULL, 0x65ADA0F9C0806294ULL), false},
+    {S256Field(0xA04541E55D848116ULL, 0x1CC9B100FC9E27BBULL, 0x05072CE10E948454ULL, 0x1693799ABB39D3BEULL),
+     S256Field(0x83DF66C2027198B3ULL, 0xC03193E5C4D992E4ULL, 0x4E6AF60F16C60DEEULL, 0xC49C433B9CB2D8C5ULL), false},
+    {S256Field(0x84C80AD4BC940C9AULL, 0x13CF3CE13AF42330ULL, 0x0E5585E2744DDC21ULL, 0x2EC22A7EC305F319ULL),
+     S256Field(0xCD194FD9851E7A4DULL, 0x12405183D9A35BDAULL, 0x4C2E24F5029C7FEBULL, 0x8B1DA468DE337968ULL), false},
+    {S256Field(0x7E93831EB9D9123FULL, 0x29FC791B1F88BA7DULL, 0x2F95F8ECAFBD1E91ULL, 0x341B538F72AA6A6FULL),
+     S256Field(0x19EA0AAF18BB9A40ULL, 0x72DEE6A7052A26EDULL, 0xBA6F2F041124D9ACULL, 0x5858124719C1C59EULL), false},
+    {S256Field(0xAA70EE5FDD683EEBULL, 0x3E36EB38A08D3133ULL, 0xAB1AF6525084B8F3ULL, 0xAFC669738F9A8CECULL),
+     S256Field(0x91E29CAB30CD4509ULL, 0x570BAB5525EDDFDCULL, 0xBC359C7FCA239C16ULL, 0x002C21976DD22752ULL), false},
+    {S256Field(0xA7D07B1CC7AAD77FULL, 0x6D4EBBDF0F5A7B7FULL, 0x3284AFC3A7699670ULL, 0x4F0EAB3EC68EB8DEULL),
+     S256Field(0xE6C3F11DCCE6EEA8ULL, 0xADAA078D025AC92CULL, 0x5A08DE3062AC2F28ULL, 0xB28EA27176EBB757ULL), false},
+    {S256Field(0xEA201F87B76F4293ULL, 0x10E978B5653C5139ULL, 0x121BC8CF370B282EULL, 0xD2557B5A9F343309ULL),
+     S256Field(0x1DB187A25282740AULL, 0xE34B6838DE405A5FULL, 0x12682F06EB4AD21FULL, 0xA787B34355E427F0ULL), false},
+    {S256Field(0xCBFC99C8AC1F98CDULL, 0x523489054D7F0308ULL, 0xFAED8A9C1CC66021ULL, 0x9C3919A84A474870ULL),
+     S256Field(0xBE7E5E03D4FC599DULL, 0x905326F76C64C8E6ULL, 0x584F044BF260E641ULL, 0xDDB84F0F4A4DDD57ULL), false},
+    {S256Field(0x435EFB7B694A09ECULL, 0x0CD326A53E8535F0ULL, 0x0A42FC69D5C92AA4ULL, 0x2E3C05326255D80FULL),
+     S256Field(0x2534868188C7327EULL, 0xE048A53C707B6651ULL, 0xBDDAE240B82FC1ABULL, 0x001FF891656C6FB5ULL), false},
+    {S256Field(0x17B98D538FB64DB3ULL, 0xA7EDE4CA39DD5384ULL, 0x40BBB83FBE53B8D6ULL, 0xC114239229BDCCB7ULL),
+     S256Field(0xE230CE9FFC0259BEULL, 0xA87580904D4567D1ULL, 0xA5CECDE4FE978BD1ULL, 0x1237F6DC5B486FC2ULL), false},
+    {S256Field(0x205F19A2AB9C7CE6ULL, 0x33710316A1908934ULL, 0xAE15FB7E3E24DDA4ULL, 0xE8E2A24CCFA41587ULL),
+     S256Field(0xB2C01EB68836267CULL, 0x6E09E603B5C27A73ULL, 0x4CAF2B2B3BEE2059ULL, 0x46C983CE0C6F5D1BULL), false},
+    {S256Field(0x1EDED83403081E46ULL, 0x3A52218C554559EAULL, 0x082D9C2C19263471ULL, 0x6C5B4BF831A77224ULL),
+     S256Field(0xED1F9CB80BFBCD70ULL, 0x41D0CF826AC22A62ULL, 0xB2347863CE2BE478ULL, 0xCB0513714926D42FULL), false},
+    {S256Field(0x80832ADDF11349E2ULL, 0x60E3ECF417524C05ULL, 0xE62147E9A41AD78DULL, 0xF8058324C6B9C2E7ULL),
+     S256Field(0x5FAC469E5B2025FCULL, 0x509498B5626DE88DULL, 0xCDE81AA60EA11223ULL, 0x95C60E5A0A8856CDULL), false},
+    {S256Field(0xDCAE5AEC464DCD4BULL, 0x0C30C7D59911C124ULL, 0xB5670665CAB10A45ULL, 0xE1E9A856670CADE4ULL),
+     S256Field(0x2D0B625EBB041F2CULL, 0x7F44D19AACA16B29ULL, 0xB7AC43599B257792ULL, 0x562B0A954455C531ULL), false},
+    {S256Field(0x5B0D39668AC7B3C2ULL, 0x12ACAF92383D5B5FULL, 0xB2F0A38B170032A2ULL, 0xA7549AAC5D8573C2ULL),
+     S256Field(0xFA0C91719287EAEFULL, 0x5D6B5115537116DFULL, 0x335A1D70C1947D2BULL, 0xBD17D1B90D1C2415ULL), false},
+    {S256Field(0x005876FE2BADD73CULL, 0x8FD9CDD902A64B7DULL, 0x778A74E42EDC1420ULL, 0x51B21A57AD11B099ULL),
+     S256Field(0x6F7D4AE1EB36D8D1ULL, 0x6C20130F28C734BAULL, 0xD54A07F01D2C1CFAULL, 0x00793010001FD3E5ULL), false},
+    {S256Field(0xAB7DC996BD7E2C95ULL, 0x6F3F2BA14B878D82ULL, 0xEDD9A12A8AC54157ULL, 0xCA07CBFBB24AD1A5ULL),
+     S256Field(0x05E99BAC8D50DFA2ULL, 0x3AC306F33B7E0CBFULL, 0x4A8A2267BC1066C9ULL, 0xAEDC311032DF0EDFULL), false},
+    {S256Field(0x6D75D0B73B09F34BULL, 0xE58873E608CC66CEULL, 0x61AB6296F3F39D61ULL, 0x9701F3A63B1CB798ULL),
+     S256Field(0xACDC850CC0DF5793ULL, 0x7104BC397FDCC794ULL, 0x5D7031B531568337ULL, 0x3DD44BBB8CAF0ED1ULL), false},
+    {S256Field(0x17371D11AE548418ULL, 0xDCE4887D88983923ULL, 0x2FB072B0537A341AULL, 0x2E6DB0C9E4817E29ULL),
+     S256Field(0xE69792C010A2B918ULL, 0x4B8E1D73E1C3F5F1ULL, 0xA213148978A91164ULL, 0x74EB6A411D776FBFULL), false},
+    {S256Field(0x15CE6223BF1E2F46ULL, 0x5270F71E87277830ULL, 0x445592E040D63C57ULL, 0xA036B41D2C9E66CCULL),
+     S256Field(0xF731E2695EFFB349ULL, 0x0680E282CFF0B1F4ULL, 0x7DF1F6AA479EB08DULL, 0xC3BF91A003E96B3DULL), false},
+    {S256Field(0x0960551603DB2A09ULL, 0xF6314287DC201BBFULL, 0x2BD638800A766DA1ULL, 0xB09DCC04D9C30C35ULL),
+     S256Field(0xAED7DB3A80B1A093ULL, 0x6A951BD4C16AD4E7ULL, 0xF708D1635AEAD00EULL, 0x8A7F306481CF240DULL), false},
+    {S256Field(0xBCD8B9038C4CEA08ULL, 0x654B58BA0E0EA21DULL, 0x6F4A611534004652ULL, 0x6A85FADBAA4E8C50ULL),
+     S256Field(0xA19DECE59862F4F3ULL, 0xB4271A4B43D721B6ULL, 0x531933C148FE6230ULL, 0x00B64604BAE4659DULL), false},
+    {S256Field(0x5A21382120A959E5ULL, 0x91E1493A8B91D4CCULL, 0x8DE05F281D8E06BBULL, 0x6057170B1DD12FDFULL),
+     S256Field(0xE899BE932385A2A8ULL, 0x465152BC3EE24C65ULL, 0xADD9A2DAF71DF262ULL, 0x9A1AF0B26A6A4807ULL), false},
+    {S256Field(0x1899CA5D82FD545CULL, 0x7C133F8DD4A28E66ULL, 0x0394110A46DC85DFULL, 0x6773FD677C52E064ULL),
+     S256Field(0xE8C7F034947EB1AEULL, 0xEAD780F5A1C6CF98ULL, 0x0F0F25C9DD2B246BULL, 0x444EB6D8CD97652FULL), false},
+    {S256Field(0x0D4DA162971C032BULL, 0xFF6B668A17AFDC98ULL, 0x3DD11B5FDFC766C5ULL, 0x71EBA8FCD6E00260ULL),
+     S256Field(0xE7AB5A8E1668359FULL, 0x71931AD1774B4755ULL, 0xEF660516F54CBB7FULL, 0xD2FF12624B61D39DULL), false},
+    {S256Field(0x373C616B0B86F021ULL, 0x0374E43810468050ULL, 0x237C79AACE0C87C2ULL, 0xE0F86D94D17CE565ULL),
+     S256Field(0x3B6B79CCB5BF325AULL, 0x9A80BCC0115FC45BULL, 0x7A91E832F1C89A2CULL, 0x0C571C73730ABCF4ULL), false},
+    {S256Field(0xD06E47452A03A61CULL, 0x507868F469070574ULL, 0x2CA17442BAAA9DD0ULL, 0x855EC305B3249D23ULL),
+     S256Field(0x5DFC6EAAC65DFC07ULL, 0xD332F74EA17E4496ULL, 0xF543CBFF9B42FB4EULL, 0x0DD85D2EC5F01C17ULL), false},
+    {S256Field(0x6DF0D9F73AAA138BULL, 0x63EFBA0BEF786CD6ULL, 0x7943EBC18C4671FFULL, 0x417FE249D3C3AE28ULL),
+     S256Field(0xD1C91B334A1AE869ULL, 0xC19DAFDEC05566AFULL, 0xC20A5D29F0FA9E57ULL, 0x023589D7BCD23E38ULL), false},
+    {S256Field(0xB00C0A481F32D706ULL, 0x0618CCA4746A0678ULL, 0xF150D29A3095BFA2ULL, 0x3CE4486ABAB3FBF1ULL),
+     S256Field(0x40B73637FC7FD9E4ULL, 0xEDD15643CD61E89FULL, 0x88EFD046B1094906ULL, 0xE775408DAAE37852ULL), false},
+    {S256Field(0x8AD0772C02DA6E03ULL, 0x4C277DF908CAD603ULL, 0xCE991E193D696F4FULL, 0x42CA15AB9F245041ULL),
+     S256Field(0x836889FA8C347793ULL, 0xD66E85A68106BEA7ULL, 0x647CE4D1FCB800EEULL, 0x68D2EF26C81C57C9ULL), false},
+    {S256Field(0x6DB40CBB791CD3FBULL, 0x4A2A33FD9729BE68ULL, 0xF02E03218F8844EBULL, 0x11CCC5143F4E37FAULL),
+     S256Field(0xA93716BA55160D86ULL, 0xFA0B1EFD2CDD3472ULL, 0xB528E244938CC239ULL, 0x4AA56B2A902B11DEULL), false},
+    {S256Field(0x108BAF0429583A3EULL, 0xB15205998B156808ULL, 0x57275DBBED94871CULL, 0x5889573F16D0F7E5ULL),
+     S256Field(0x8F1598CB7E5B124FULL, 0x96FE294CD4CC69CFULL, 0x044F5DF8A9A6B4E4ULL, 0x1AFA2862C55856FEULL), false},
+    {S256Field(0x387B9119618F7552ULL, 0xBD41138B98054FACULL, 0x43B97774F82382DDULL, 0x0250BB17E5149C6FULL),
+     S256Field(0x3F0849623510B14DULL, 0xDA006F3C333D6F1EULL, 0x342D7DF75FE9D817ULL, 0x731930FC9BBE8082ULL), false},
+    {S256Field(0x7E158B410307E636ULL, 0xB4A77DE7321611D9ULL, 0x3DDBC29BDA2112C8ULL, 0x2219F16016387644ULL),
+     S256Field(0xE07A1B2D71F15109ULL, 0x6DD7230D3F73AF55ULL, 0x1B806D4F1B8230BDULL, 0x04A984AC5CB6A2F6ULL), false},
+    {S256Field(0x05D13E939F725D12ULL, 0xD94642BBDCB5F475ULL, 0xAB4A39CE0A022FBFULL, 0x1A749C88B3467FD3ULL),
+     S256Field(0x0136514D23AC56E4ULL, 0x607208698990DAA7ULL, 0xF458BE75C2AF3D8FULL, 0x7E91D19573EC0E2CULL), false},
+    {S256Field(0x5D22D670B6C704C0ULL, 0x56044660ECDE394FULL, 0xA167F8A6E3507824ULL, 0xA77AA907C92F2674ULL),
+     S256Field(0xAF8BC7047EDFEA48ULL, 0x4C921FC474159462ULL, 0xF21E188E5C2BD5A9ULL, 0xB8881AE5BF35CFE4ULL), false},
+    {S256Field(0xD61048E529FAE458ULL, 0x8B0A5C42766EC97FULL, 0x109D156A5DFB7B32ULL, 0xC750685BE0F8218CULL),
+     S256Field(0xB01684195757B598ULL, 0x0A5DCA50335951A2ULL, 0xFB52F414C672C7B4ULL, 0xEAD795F8CF921E05ULL), false},
+    {S256Field(0xB1A6973EECB94266ULL, 0x80CEF0FBA7D4DF12ULL, 0x421439A4518DA318ULL, 0xA576DF8E23A08411ULL),
+     S256Field(0xEE8BE11AE1B28EC8ULL, 0x432E10A7F514D9F3ULL, 0xC92B97AFE58CD82CULL, 0x40A6BF20E76640B2ULL), false},
+    {S256Field(0xCEC5725BDA704896ULL, 0x6F3BA063C9ACFB8DULL, 0x546520867BE71BAEULL, 0x9E5DCC62EF3B5A3BULL),
+     S256Field(0x48F2769DCA82C835ULL, 0x79605D186030F512ULL, 0xA5FD3A2154C76122ULL, 0x6FEDD12DDB925F3EULL), false},
+    {S256Field(0xB68AEB58CD9ED6C1ULL, 0xC24E745BC3D593D6ULL, 0x80BFC187705EDD0EULL, 0x0328336DCB74F53EULL),
+     S256Field(0xDEC6EBE6F8FAFEEEULL, 0x265BF4DF25CB494AULL, 0xC46D5943A20D7C8CULL, 0x71A8983812FD9F28ULL), false},
+    {S256Field(0x953ED58744BF7EA0ULL, 0xE33625A05CEF5833ULL, 0xF8D6E9F976F03B20ULL, 0xA7DE08375B8745ADULL),
+     S256Field(0xE04C05539BBCABAAULL, 0x645A47C0FEBC5AA2ULL, 0x2104A0B334888E9AULL, 0xA63D96B057ADA5E5ULL), false},
+    {S256Field(0x919A9A8D3235983AULL, 0xE38A1037013BCEB2ULL, 0xDC63926D70FE1531ULL, 0xCE4F4EAE8B911C54ULL),
+     S256Field(0xECFD6B190D3CDECFULL, 0x526C65228EBF740AULL, 0x3EADE0249E707543ULL, 0xF3C9F973C390FBBBULL), false},
+    {S256Field(0x6B75648A66DA57E4ULL, 0x98C4996EFDCDD9F8ULL, 0xDBDEA2A74631BC1EULL, 0x690CDAE3983918B9ULL),
+     S256Field(0x2B6195B4933F33BBULL, 0xF863D8FBCE95A3D4ULL, 0x7A9FD91BF595894DULL, 0x840ADC79677B79A4ULL), false},
+    {S256Field(0xA6DAAB6655B0E6C9ULL, 0xDB5FF9CF786E4C89ULL, 0x78E28FB36DF8BCBDULL, 0x4DBEBFA54B986222ULL),
+     S256Field(0xE94A78555EB2CC25ULL, 0x589311B2BC504EFAULL, 0xF45A626E6E2229F3ULL, 0x10FEE7B03C913AEDULL), false},
+    {S256Field(0xA9F8FA104AD916FBULL, 0xE68065FDE949E4A3ULL, 0xC13C35AC01CFF4CBULL, 0xC266658E689080C9ULL),
+     S256Field(0x56AEF52BA0887814ULL, 0x6B8FECDFEB611388ULL, 0x0F798170B24627ABULL, 0xE7E8593854E7DAABULL), false},
+    {S256Field(0x64E01A11A5857295ULL, 0x69C8E47F03433F01ULL, 0x8B2E118FCA1CA120ULL, 0xA42A240BFEF45C21ULL),
+     S256Field(0x56B377FECA7EB9C1ULL, 0x27A1C22CD1519395ULL, 0x67A6B22B24DDA4C4ULL, 0x3AA0B3F261005D45ULL), false},
+    {S256Field(0x269BCFD6005C5B40ULL, 0x150B96879BB9FD1EULL, 0xDADED382E8CCC3DFULL, 0xA4B53CC8BF53CD14ULL),
+     S256Field(0xD1F5ED16D1C61BFDULL, 0x199CCA9BF75259E3ULL, 0x4495CA003DFDA587ULL, 0xCEEF08CE83005B80ULL), false},
+    {S256Field(0x2220FF556FCDC098ULL, 0x550AE00F6AE46803ULL, 0x7A7F1F86C0C499C1ULL, 0x34E12B2F96FB2226ULL),
+     S256Field(0x64CB1ADE6A7474E2ULL, 0x04DF5130F19883F6ULL, 0xD974CBC8417972DBULL, 0xA64AC2DDD7B5D322ULL), false},
+    {S256Field(0x5F9898AA5CFB8036ULL, 0x3AD09A92C0DA3508ULL, 0x8AE117DD1FD67E83ULL, 0xCFF62751FB1647B4ULL),
+     S256Field(0x843F3B5A24F59DE0ULL, 0x78A589D8F6032825ULL, 0xC5FE34B5886143C6ULL, 0xCDF4ED26BD542D1AULL), false},
+    {S256Field(0x1CD6EB5E8F173B92ULL, 0x3B7E72F4169FB761ULL, 0x9BE31A218F4D6568ULL, 0x10F4D240D9BB91F2ULL),
+     S256Field(0xC902006D633146C2ULL, 0x90BB769D1486ADB7ULL, 0x211B25A5A33908BAULL, 0x850E2D95091753ADULL), false},
+    {S256Field(0xEE6660EDD04393D7ULL, 0x869DFF2567749DE1ULL, 0x4317F893623573E3ULL, 0xDEA1FC018A78F3B8ULL),
+     S256Field(0xBF97D4EF95710CCDULL, 0xAF6DEF9A2B79CCBDULL, 0xD3BF134FF6D66E03ULL, 0x4F6549CC942E5C50ULL), false},
+    {S256Field(0xEE6FD1D9A8D84958ULL, 0x6A11DEB16CACC5CAULL, 0x49F19B976D40CC86ULL, 0xE846E80B69B677E7ULL),
+     S256Field(0x40C4647B7882CF9FULL, 0xAD51A33671E0C1A6ULL, 0x41DBD9104798B76FULL, 0xA29CB8FC894C7E25ULL), false},
+    {S256Field(0x8F763889BE58AD71ULL, 0xBB30D1F5CF9A3A20ULL, 0x0A05FE9629DE8C38ULL, 0x7778A78C28DEC3E3ULL),
+     S256Field(0x3B513FC1FD9F43ACULL, 0x87B38411FF24AC56ULL, 0xF7098E12F2FF5800ULL, 0x34626D9AB5A5B22FULL), false},
+    {S256Field(0xA7EA1C251073E879ULL, 0x2CF16A5AE104EEA7ULL, 0x632F482D7F0FE393ULL, 0xE7B9796B5CA006D1ULL),
+     S256Field(0x38E71089BAA89D98ULL, 0x9CB5BF25EDA98AF3ULL, 0xDF42102A737CC1CAULL, 0x12B8988C19169E2FULL), false},
+    {S256Field(0x2F7C6EAE3319C869ULL, 0x18A9F95D761EB270ULL, 0xD01839022FCCACDCULL, 0x3018045D98173FC8ULL),
+     S256Field(0xFC0C76C9D2B856F0ULL, 0xCA2A84CA4A3D9A7BULL, 0xF86624320D622E3BULL, 0xAC5FC5782503B7B6ULL), false},
+    {S256Field(0x865D722BF2628F0FULL, 0x65423DAAF2AEE919ULL, 0xC2C915A24BE09A73ULL, 0x071BF01850876203ULL),
+     S256Field(0xB57C5CBD45A1C334ULL, 0x098F9C6A231C80BBULL, 0xE33600BC1C084CE2ULL, 0x527AA15D504DCF4AULL), false},
+    {S256Field(0x4C66986FA5ED29B5ULL, 0xF5830B60712ADD1BULL, 0x43AB67DB9A63C885ULL, 0x322881B61EE57EF3ULL),
+     S256Field(0xEF4F126E7CD15AD2ULL, 0xCA83AEAB94EE7604ULL, 0xB110B19DF41531E1ULL, 0x1677028417A0344EULL), false},
+    {S256Field(0x6477DC9B18953133ULL, 0x7FB3B42A748721AEULL, 0x8812806C0FCCDFA9ULL, 0x0A0B2B4FED0DDD23ULL),
+     S256Field(0x4BC24A3734AF0FC9ULL, 0x6FA384E8B0ED4BA9ULL, 0x03C1C6CA86458C8DULL, 0xCDA1182CFB5ABF2FULL), false},
+    {S256Field(0x3BFA840786C96100ULL, 0xA163011AA6E9C8E6ULL, 0xFB43DD9B2DF3DBCCULL, 0x3F38473AC0FB1B9FULL),
+     S256Field(0xF1E2AC1BF2624707ULL, 0x66571C7C0B75F1BCULL, 0x2534C4462F079CE5ULL, 0x70C69C55F5D40395ULL), false},
+    {S256Field(0x6F6376DFA39620E1ULL, 0x5B1911C850121378ULL, 0x33A32E594C03C39EULL, 0x0218343ACB9BE568ULL),
+     S256Field(0x5E0199F6506998B5ULL, 0x443299A42F43C9ECULL, 0xAF3F24FD602FBFC0ULL, 0xBEA81D48970A50BEULL), false},
+    {S256Field(0x234C6EC6FD22D2ACULL, 0x10DDFE126DCAACE0ULL, 0xCB43C0E09785DF2FULL, 0x288113C5FD27A76DULL),
+     S256Field(0x081EB55F8F42A268ULL, 0xDDC3D44A1548C8FDULL, 0xF20777260C976137ULL, 0xA1A7EB0158FBC5C8ULL), false},
+    {S256Field(0x8C1A13AEFEE515DDULL, 0x9D045323343AA422ULL, 0x0EF5866AB4BDFE2EULL, 0xA2BF9AFEE6EEC182ULL),
+     S256Field(0x5C3A96B006C30212ULL, 0x00F2E3AA9A8E9874ULL, 0x3A0A5E2ABC05EA28ULL, 0x5A11BC71C55CAB7BULL), false},
+    {S256Field(0xD4BA80DD245F8EA8ULL, 0xD17248E3964D2900ULL, 0x553F4D95D7119FE5ULL, 0xF963A200C8463A2AULL),
+     S256Field(0x4BC55FB059BC99EBULL, 0x8BB8F2359D8B6082ULL, 0xA3B722301FF42720ULL, 0x9C8594268C7F83C0ULL), false},
+    {S256Field(0x7EAF0EC0DF0A2A53ULL, 0xD51DCAB3F816611EULL, 0x3A83945743A9B892ULL, 0x6F86518D07C3997CULL),
+     S256Field(0x1139A574733BFEB2ULL, 0xBF54F772EAA05F35ULL, 0x9B776EA95A709968ULL, 0xD50AF616FD4582F2ULL), false},
+    {S256Field(0x9E1A88312606A315ULL, 0x40726072F26963ADULL, 0xF98D8B2A590E097EULL, 0xA5D9224CFF70D9A7ULL),
+     S256Field(0xD35613359E3B68D1ULL, 0xED4D0D347D11A7C9ULL, 0x343306ABD7980DE9ULL, 0x87328B003B20DA5BULL), false},
+    {S256Field(0xAF19EAF4D8D52891ULL, 0x39A0F7D883EB9F52ULL, 0x46644DE90B17FFA7ULL, 0x3BC24BC9CBC58DE3ULL),
+     S256Field(0x386D1E284D05B79CULL, 0x4DA845280A4872D1ULL, 0x7FEBED840BFB48F4ULL, 0xF08E30A48A783D8AULL), false},
+    {S256Field(0x9CDB7B5406231493ULL, 0x96411A830CCC4D46ULL, 0x4EB4E41D00E5E6A4ULL, 0xF1FE982E1B73C360ULL),
+     S256Field(0x196A99A6758848C1ULL, 0xF173FB346E5FF0D0ULL, 0x216D3C205F7D99D3ULL, 0x2E2019EAED9A4DDCULL), false},
+    {S256Field(0xB09EDA9C06D903ACULL, 0xD5F96274E5AD7E5CULL, 0x63729FD30E7AFD2EULL, 0x0928955EE637A844ULL),
+     S256Field(0xC5180E935BCD091FULL, 0xAC3D26EFA8A8D83FULL, 0x27B78A13093A95EEULL, 0xC25621003D3F42A8ULL), false},
+    {S256Field(0x231047A60F59DD9EULL, 0x7CE5E9C55B58F0E7ULL, 0xDAD163B04CB18AD6ULL, 0x4F89BDEE3771D350ULL),
+     S256Field(0x1016AE320156B049ULL, 0x1E4882506638DF5CULL, 0x5C4BAF4C043BB247ULL, 0xCA7952D5227A1F69ULL), false},
+    {S256Field(0x811128757874B839ULL, 0xBE4115B3953D2B41ULL, 0x053DF0DFB230B6AEULL, 0x3E03B81FC0E1E5A8ULL),
+     S256Field(0xA0C1CE567C0594BAULL, 0x7DE5C5F0FDAB5B8DULL, 0xC44F660757198F66ULL, 0xD13AE163DFF07F42ULL), false},
+    {S256Field(0x529C314CFFF01197ULL, 0x94B668F079A245BFULL, 0x0C396BACA2C3C4C9ULL, 0xCB9E8304CAE3C5A8ULL),
+     S256Field(0xC334E0763B989C1DULL, 0x41B2D18C015E0A24ULL, 0x127258CDFF088917ULL, 0x62C7D2801EB80E6AULL), false},
+    {S256Field(0x3A3F78E68357A513ULL, 0xF151BD1345B3023FULL, 0xD62FA283AA2922C5ULL, 0xE662C0B7A2F4492CULL),
+     S256Field(0x192A201CA017D07EULL, 0xD8035CD625538D89ULL, 0x05DAE208A121A419ULL, 0xAB0B193CE6124523ULL), false},
+    {S256Field(0x9BAE90D3B9A7D197ULL, 0x5E83A8C188EA5945ULL, 0x4778FFE0A22C234BULL, 0xC2C58A54280DF639ULL),
+     S256Field(0x4E41CCBF89EEB5E9ULL, 0x0A47EC4545AD8248ULL, 0x573041AB62ED39A6ULL, 0x72EA3288366E0927ULL), false},
+    {S256Field(0x4995F7EFDF37D242ULL, 0xC29FECA6079C14B0ULL, 0x843862C7CBE3587DULL, 0x40BF80B1C94CF6CBULL),
+     S256Field(0x3D1D8279A6405088ULL, 0x74321EBA42BD3558ULL, 0x4F53FE9B1B26FE12ULL, 0xB579DD35D856AAF0ULL), false},
+    {S256Field(0x15F9FFC2508D2CC2ULL, 0x8E0BEED47048C58CULL, 0x3C8CF2A410730DC5ULL, 0xE2F349B0F89C69BDULL),
+     S256Field(0x7E347BD8E0D4C04FULL, 0x42344BE8E09CBDB3ULL, 0x81860AEC760215BAULL, 0x1FEB2F280F827237ULL), false},
+    {S256Field(0xBAF2B364595A3558ULL, 0xAC071F85E234A7F2ULL, 0x806F978138DB59F6ULL, 0x3D14FE97601DCA70ULL),
+     S256Field(0xC6ADB3AC6443DF4CULL, 0x82E0A2E147C1D727ULL, 0x8F29A931DBF56E14ULL, 0x16C6BDD6E84681EFULL), false},
+    {S256Field(0x10FC702414EA4178ULL, 0x782E0354E4C77CD5ULL, 0x680453C6A77494CBULL, 0x0470A872D1756368ULL),
+     S256Field(0x079449F1B8098BD6ULL, 0x19B568706984DAEAULL, 0x676145E9FD39C0CBULL, 0x0899A7A9C1109ACDULL), false},
+    {S256Field(0xEDE9F5AD82B1FC24ULL, 0x2528D81C7E3F7570ULL, 0x1CC1AC4D2C924865ULL, 0xDD6FA540E82E6525ULL),
+     S256Field(0x4A431C460E9B74CAULL, 0xEC10DE6BED732230ULL, 0xE366F1EBF1657E77ULL, 0x67E62B7EB1D3186FULL), false},
+    {S256Field(0xD74DE6D963369217ULL, 0xCA1C3969006611EAULL, 0xA21A278F5404EACDULL, 0x42DC50FFCBA4D624ULL),
+     S256Field(0x1C3097E23E2DBC57ULL, 0xA7A139ECA8E01E84ULL, 0x7ED78F5F160BA853ULL, 0xA5BA9A1F66385B1DULL), false},
+    {S256Field(0x81EA91593DD08E02ULL, 0x108547B7FDADF028ULL, 0x0F869499AA3D1E80ULL, 0x13FA2DA82DE55D78ULL),
+     S256Field(0xDA5541DC3CB03410ULL, 0xE644AFBB19A42B97ULL, 0x313356206BB432C7ULL, 0x136338B04555DA72ULL), false},
+    {S256Field(0x23F1ACE91646A9E9ULL, 0x5DCBB7A7D8AE7B04ULL, 0x7D1F82BB9CCA75DDULL, 0x9582B79C4B0AEF75ULL),
+     S256Field(0xBC4D7493AA56A698ULL, 0x01CBB5C5F13B82FFULL, 0xD4EC6ACEEAF8E6A4ULL, 0x22067D800ED426EEULL), false},
+    {S256Field(0xAC233AB9944EE41AULL, 0x879B56DD3B7D69A6ULL, 0x3F7C10B672C68282ULL, 0xD06C4851D3C70A44ULL),
+     S256Field(0x2F1F84E98B295E6FULL, 0x9B7B84346162EE25ULL, 0xBBB0ACD4F4F63091ULL, 0x5815FD4C0584D0ADULL), false},
+    {S256Field(0x27AAE75163D82751ULL, 0x5645B4A907AD3545ULL, 0x399064F3A0E3B285ULL, 0x85D0FEF3EC6DB109ULL),
+     S256Field(0x82C237A24EB1F962ULL, 0x3E8751E968773315ULL, 0xE29D496E582CF566ULL, 0x1F03648413A38C0BULL), false},
+    {S256Field(0x56356D141D5FCADEULL, 0x68B482E009711FF7ULL, 0xF607A6CFCD11DF04ULL, 0x6B790F4B19A4C4F4ULL),
+     S256Field(0xB6FFF86FC338D3FFULL, 0xA83FA5B47BE26B0AULL, 0xF296661F9CAE09CBULL, 0xD03A981B2FF9EB3EULL), false},
+    {S256Field(0xB9955061ECDE4CF3ULL, 0x9340E535478A066AULL, 0xBE7C2D26D15D9AE7ULL, 0x384DAB4AC11422C3ULL),
+     S256Field(0xB7C796B2252D0566ULL, 0x1F430A339751BA73ULL, 0xBFB4ED6DA2B4C6F0ULL, 0xD6E3C5BCD1B9CA43ULL), false},
+    {S256Field(0xBB0CCDABE3A3E0CBULL, 0x3D2479DE85978BE0ULL, 0xC162C367ACC4F8FEULL, 0x41149B2C2D7EBED3ULL),
+     S256Field(0x70E92E98339033A8ULL, 0xB3EC7805EF490F24ULL, 0x2B415C9B9902CF28ULL, 0xC90D5B92DB7C3054ULL), false},
+    {S256Field(0x98AF3E921E5238C2ULL, 0x40355F5C380ECB8BULL, 0x41B1610B4E82ED48ULL, 0x14F0EC0EB7D415AAULL),
+     S256Field(0x6E86A34792F07922ULL, 0xD25C00D80304939DULL, 0x921FC73E3842747FULL, 0xAB12D53DD4835D80ULL), false},
+    {S256Field(0x8A4366A08A972627ULL, 0xE192160402521E1FULL, 0x8198C1EFCBC441A0ULL, 0x8A31870949BFE15CULL),
+     S256Field(0xE7B47B5646BB8AF9ULL, 0x1744365AC3EFCBCCULL, 0x09577ED28587BAA4ULL, 0x64BB7C8768F7A64DULL), false},
+    {S256Field(0x8F6352EFD543E94DULL, 0xDD1302A756F98E18ULL, 0xC41C34678A5A0DDAULL, 0xEB42F3BB782C287EULL),
+     S256Field(0x40559DE445924D89ULL, 0x4CD8468DE60D6D42ULL, 0xC9A0DD572FCDFB77ULL, 0x234A6D074F25D92DULL), false},
+    {S256Field(0xF8DDDD28E3F3D3FCULL, 0x664A9B8205C29CEBULL, 0xFAEC3DFE2872A7BAULL, 0xD1FAD4FA4E7C849DULL),
+     S256Field(0xED22343C50F3704DULL, 0xBAD37131EFF37326ULL, 0x5473F70E858B7818ULL, 0x8FE19714A348FDFEULL), false},
+    {S256Field(0x0324E5B57E19AAEDULL, 0x459BACDE8C667327ULL, 0xA9EEC02F6E06A920ULL, 0x1CF138CA516820D9ULL),
+     S256Field(0xC136EA5D692F400EULL, 0x479EEF8FEFC77FFBULL, 0x5F4372A66B6DDE17ULL, 0xD6FFDAF3171C6386ULL), false},
+    {S256Field(0x37473BA2E0BA68DDULL, 0xBCA7C9438C7EAD65ULL, 0x7F266838C1DAD312ULL, 0x05CBEAABFE2B7412ULL),
+     S256Field(0x94229F327DD03959ULL, 0x7F3D96705DE533B5ULL, 0xAE9386665506EFA0ULL, 0x13CA23B6FA90156EULL), false},
+    {S256Field(0x5F6C0E9FB6A8AA39ULL, 0x37A6637B4A78FAC5ULL, 0xC875A096849990D9ULL, 0xB58686BE5F40D412ULL),
+     S256Field(0x8FC7935D2B493C1FULL, 0xABBDAF98E6DB347BULL, 0x149478D454C0A91DULL, 0x5632D54324C78C2CULL), false},
+    {S256Field(0x9A544C67CA3A1550ULL, 0x801DA99F8EFFDF27ULL, 0x2DD30976E1F8B751ULL, 0xEBFC69AB34055741ULL),
+     S256Field(0x51F42BF641362F6EULL, 0x7983C818E68C0B19ULL, 0xA3DF199DB7F4FD07ULL, 0xE2FFE8CDB99CB540ULL), false},
+    {S256Field(0xEE91EBE3B03B4CC5ULL, 0x572831BA5A1C77C2ULL, 0x67B5BC4FE7F3A802ULL, 0x5FC19DB06B8BCC2BULL),
+     S256Field(0xA3B39FB865B57C28ULL, 0x9276F503CC087EC4ULL, 0x6EE2138F9A3A5EF4ULL, 0xEC8E84C0EC98C7C6ULL), false},
+    {S256Field(0x48BBF38E5E8D319FULL, 0xE66AA5616D4418E9ULL, 0x1050B65337AAC980ULL, 0x6CE5C350CE93A866ULL),
+     S256Field(0x08AC6BD795CF513FULL, 0x2DA8F2E00EC53783ULL, 0xBED3E3E8CBBE23F1ULL, 0x950D0026E2503C85ULL), false},
+    {S256Field(0xBB4B857D4CB38CB5ULL, 0xE10B7FDF4D388948ULL, 0xDEBA8A40FD3EEA1BULL, 0xB88FB70D42EDE289ULL),
+     S256Field(0x97BFA7565965F3D7ULL, 0x4D4F3E1227AF8C71ULL, 0x6034BB994B35A8E2ULL, 0xD6C736AD46EA3280ULL), false},
+    {S256Field(0x8F5404824526087EULL, 0xFDFB6D8882DA2030ULL, 0xC1C9B6041798B85DULL, 0xFF2B0DCE97EECE97ULL),
+     S256Field(0x2C951E01F0C29907ULL, 0xC7B7ED6FB90E2CEBULL, 0x8AF4C4DC54D07936ULL, 0x493D13FEF524BA18ULL), false},
+    {S256Field(0x3BD3A9AF3149F8EFULL, 0x3DEB5C4EE638B458ULL, 0x78E29EBBECB1BB22ULL, 0x2982DBBC5F366C9FULL),
+     S256Field(0x56E726B016C7A248ULL, 0x095DB99412E3ED84ULL, 0xB9FA5339C7B5BC9DULL, 0xA61B5BE9AF66220AULL), false},
+    {S256Field(0xC59054FE79D681F9ULL, 0x66CE0EEFAC8FEB9FULL, 0x88B7FF25E02C94B0ULL, 0xC745FDF2775F2308ULL),
+     S256Field(0x603173437BBB1247ULL, 0x8CDBD335C67D45C7ULL, 0x8A71394C70E81867ULL, 0x590222F2F6B9E5E7ULL), false},
+    {S256Field(0x85289F612380441BULL, 0x60011F4580E17658ULL, 0xB436EB590497DB58ULL, 0x1A28E5042AF0C0F6ULL),
+     S256Field(0xB05F606A8452AF25ULL, 0x04B3E75B46EE67AEULL, 0x7C78329A8976F0EDULL, 0x55779A7996C59DABULL), false},
+    {S256Field(0x5E04CEED35CD0EA3ULL, 0xB34478E820CAC481ULL, 0x27A59E5EB672E7F2ULL, 0xABB279F3A975050BULL),
+     S256Field(0x470931337C307BCEULL, 0x7C9769059E02F3B6ULL, 0x9FB4BE0C03078ED4ULL, 0x5DEE103BBF17970DULL), false},
+    {S256Field(0xE77FD534649A2115ULL, 0xEC79600917A565EBULL, 0xDD46ACA9D640981AULL, 0xFD73C052B194C6C6ULL),
+     S256Field(0x049CAB7BA6BA6CDAULL, 0x04F601562E9D421FULL, 0x020ABAB026F7D6D9ULL, 0x620768C1C8178844ULL), false},
+    {S256Field(0x5C2E2F3F1BC9EE3EULL, 0xEA9FA1A963E7382CULL, 0x27FAEAA74267ED11ULL, 0x3F81150B59FC6828ULL),
+     S256Field(0x3CEADB0C599AAE06ULL, 0x7623B2DCFCDA8160ULL, 0x4671BEB3C4795662ULL, 0x19C88A68FDBFA82DULL), false},
+    {S256Field(0x2EEF0E39621E30A7ULL, 0x2EDD5EB7985D8324ULL, 0x1D250CC0BD3F2014ULL, 0x0C8B83E9535F3060ULL),
+     S256Field(0xBEBF7BEB9FF688DEULL, 0xAACAD237B987134DULL, 0xB850E3F17EFDC854ULL, 0x0DCC7077065FDAC7ULL), false},
+    {S256Field(0x6171BEFAF8E4A007ULL, 0x15ECEECF08BB358BULL, 0x9594BA33AA56C7ECULL, 0x5CF8132DD0082DE6ULL),
+     S256Field(0xCE63F0909068B883ULL, 0xC8946F96C79C7FE8ULL, 0xF4AD4158848C3DF6ULL, 0xB45AEE5C0D61FA0DULL), false},
+    {S256Field(0x3003EFCC4C3C18E1ULL, 0xBA4AE5FBBAAD7230ULL, 0x9122671104BAC7F4ULL, 0xB3FA054583510D6BULL),
+     S256Field(0xCB11FBEE12AA2B4FULL, 0xAA55A499F10CE542ULL, 0x7BA18298064FE6FDULL, 0xA85C24759340F56BULL), false},
+    {S256Field(0x0956FE7B26C2D4A7ULL, 0x1BC36F933BCFFFB1ULL, 0x653E33973C404ED2ULL, 0xB6D5FE4D0D4BA494ULL),
+     S256Field(0x118DCE7E3AE86371ULL, 0x745B7E4E6F5E3CC8ULL, 0x4DFCF9209DFFFD8EULL, 0x47F373A13ABBD6C1ULL), false},
+    {S256Field(0xFDB86C351B816B2FULL, 0xEE0CB7841228EE11ULL, 0x6E8165FE126C5D5DULL, 0x5A4D46DD65951A67ULL),
+     S256Field(0xAF97AEB873E86C60ULL, 0xB50E6CC5FB3ECCEBULL, 0x0283E27F8F3DFCD6ULL, 0x77C92396CA0E60ABULL), false},
+    {S256Field(0x50933622FC66DD33ULL, 0xEA8FBC8FF1DC76DCULL, 0x06BB1B150029B022ULL, 0x61C8BBC066CF5887ULL),
+     S256Field(0xA3BBA9F3B6F10BFAULL, 0x6A5106EAC2820C8CULL, 0x44669994B985D3FBULL, 0x93599E239E54F703ULL), false},
+    {S256Field(0xFCE648CF335CACBBULL, 0x18AC3028BD635B26ULL, 0x7B977E5BDC622671ULL, 0x4FD699B12C720CCDULL),
+     S256Field(0x33B2EFA88E1AD839ULL, 0xAA998EB2E8223E61ULL, 0xD9479DBFCDB61E2CULL, 0xC6C90EF3F511A0AEULL), false},
+    {S256Field(0x9805B7CCDD6B2FF8ULL, 0x876336C17286C8FAULL, 0x87C9F5373EC3BDF1ULL, 0x94E32BA574267851ULL),
+     S256Field(0xADD485552CE1AF3EULL, 0xB33AF042526BFE13ULL, 0x92F1E488662D9E8CULL, 0x0D1B448B43DA04E1ULL), false},
+    {S256Field(0x780E5E2CF856E241ULL, 0x57F1EE148CD6DD28ULL, 0x9ED2B2E6301B212BULL, 0x827FBBE4B1E880EAULL),
+     S256Field(0xD605B68BAEC293ECULL, 0x7FF7A63186903166ULL, 0x71BEF2C67D1D1268ULL, 0xC60F9C923C727B0BULL), false},
+    {S256Field(0xEF6E44B70CB1815DULL, 0x60470A9218B87461ULL, 0x3E2D7C8D576E6B36ULL, 0xB77F12A7DCE56B97ULL),
+     S256Field(0x6BA3D2BC8E57DBC5ULL, 0x4C42F0F91A44816DULL, 0x3F0CEFB373CC2E65ULL, 0x4B6F85B14F86ACC4ULL), false},
+    {S256Field(0x634485CB3BB80FA7ULL, 0x3AA7DA6BB7041388ULL, 0xC0D1A06BD320819FULL, 0x0857E31F6308C2FBULL),
+     S256Field(0xBD98211F09366B2DULL, 0x172E37043CD7016AULL, 0x92D7CC9D1DCB7147ULL, 0xF64393423AE01720ULL), false},
+    {S256Field(0x0FE5DAD2C45565ECULL, 0xD858D8DF4977C597ULL, 0x47B308B2CB79F956ULL, 0x48973B943018BF12ULL),
+     S256Field(0x3B879075FAED07E9ULL, 0x511B3596580477B8ULL, 0x6437BB3A01445AF1ULL, 0x761F75684F3CDC1BULL), false},
+    {S256Field(0xF5D02C3A09C70E63ULL, 0x9CBB8B78E753D496ULL, 0x3545C655764A672EULL, 0x28AACCEA56BD6004ULL),
+     S256Field(0xB9F03882F057DA4EULL, 0xF5FC59CE444DA1E8ULL, 0x67A89667C768EBB7ULL, 0x2B69322EF81A0E15ULL), false},
+    {S256Field(0x33A00ABE7B6D6CD3ULL, 0x3416611D03893788ULL, 0x81A69B8705652397ULL, 0xEA1266167F2B8184ULL),
+     S256Field(0xAAE62925F4F450BEULL, 0xB1C9752DEBBE1A88ULL, 0xAACE112BF1145E25ULL, 0x21A4E2E5078EE3FDULL), false},
+    {S256Field(0x601DC52F73E674B5ULL, 0x92D8F69CE7060AACULL, 0x45DDB2C9BCEB8A4FULL, 0xA2F3B625A055A661ULL),
+     S256Field(0xB0938C8E0E937941ULL, 0x9222FA317C33FA53ULL, 0x80044A90F32A7C4BULL, 0x620EA159614C68AEULL), false},
+    {S256Field(0xA4D4D742BBFD71FAULL, 0x0B775A265B4527D4ULL, 0x6D6972728A704C17ULL, 0xE931258E8EB5559CULL),
+     S256Field(0x3D9BD0D3174D3307ULL, 0xB3946CE1BB5E35F3ULL, 0xE85EB4169C954B40ULL, 0xFB1E33364C3FDEE0ULL), false},
+    {S256Field(0xC7601631D91EB056ULL, 0xA002EFDB8ECFD386ULL, 0x1D98B5C6A3F515F5ULL, 0x3C4F83C9EAAE5923ULL),
+     S256Field(0x7425893DA05CECABULL, 0x1982B54481CF6B87ULL, 0x33AD6573C3B27880ULL, 0x94479007514A8B6AULL), false},
+    {S256Field(0xE643D8CB548FADF1ULL, 0x00359B87A712DF9DULL, 0x9C365F8DE891817BULL, 0xEDF384387F7F4244ULL),
+     S256Field(0x79C436CF6C415FB6ULL, 0x0F4E8813DEA37D28ULL, 0xDED80235120AA6B7ULL, 0x72D3B5B0A1898500ULL), false},
+    {S256Field(0x19061FDBBD86DFA9ULL, 0xDC38B4A409B993A7ULL, 0xE29C1E03E8103BAAULL, 0xAFF8E1288A9967D4ULL),
+     S256Field(0x07103C36C1D12681ULL, 0xF9116DA94419F9C7ULL, 0xD3D3EBAA1FCF53F4ULL, 0x8D8B4BB321377C3FULL), false},
+    {S256Field(0x77123D425CFF55C5ULL, 0x5F4EFD281A275EC9ULL, 0xA6C12C1E782B4B63ULL, 0xCF36ADFDFB25442CULL),
+     S256Field(0xACA2788521A0228EULL, 0xA7547EC25C0D2706ULL, 0x49C2F58B3BD9F207ULL, 0xD16A12166AE07686ULL), false},
+    {S256Field(0x28F2736B989BA9C1ULL, 0xE40F7CA5A09D338EULL, 0xE8458262AECEE579ULL, 0xD3FB784528DC00B3ULL),
+     S256Field(0x061B88DFEB51B267ULL, 0x341CEDD5C011ADE0ULL, 0xCA7CA05758B70FE6ULL, 0xF894D434EFA6B4E7ULL), false},
+    {S256Field(0xFE8540CBC181F79BULL, 0xE045D8650CE4ADB4ULL, 0xE2DF82E7C6A5CA26ULL, 0x31C80CA26C63DFAEULL),
+     S256Field(0xF0B9E526D5225400ULL, 0x622FF9EAF51125F1ULL, 0x3094E4D368F30D91ULL, 0x92B59EC1202926DFULL), false},
+    {S256Field(0x9DA96C1D0F2BB909ULL, 0x6391027C53598D99ULL, 0xFF47298839187D7FULL, 0x4EC9300E0AC9AA88ULL),
+     S256Field(0xB88A383FA4CF4071ULL, 0xD52E16820DAC3827ULL, 0x5C80DC45184C49BAULL, 0x782BA106BE1B04DCULL), false},
+    {S256Field(0x7F3B58FA2120E2B3ULL, 0x7A58FDCE7F47F9AAULL, 0xE7BE4AE34CE6E521ULL, 0xEAA649F21F51BDBAULL),
+     S256Field(0xD47A5305BA5AD93DULL, 0x01A6B965F13F7E59ULL, 0xC69A80F89879AA5AULL, 0xBE3279ED5BBBB03AULL), false},
+    {S256Field(0x53DBC1CC1FC9B0A8ULL, 0x9E337B5C705F3DB4ULL, 0xC2623EA5002279EAULL, 0x3ADB9DB3BEB997EEULL),
+     S256Field(0x61AE7975F05BBDDAULL, 0xAAD9C8F9870266CCULL, 0x3C774DE07C095FF6ULL, 0x374E2D6DAEE74E71ULL), false},
+    {S256Field(0xF583FD3A3F2E070DULL, 0x29AAB71CC52A6A98ULL, 0xF48731C3B85047E2ULL, 0x4B72A5E9042F4ABFULL),
+     S256Field(0xE44BA82EE96DD780ULL, 0xB0B465DDD2948C3DULL, 0x60277BB36D0F3C10ULL, 0x599E1D4E1D6AE1CFULL), false},
+    {S256Field(0x054E9E0C90AE86F9ULL, 0xFEFDFF56963E7CAFULL, 0x7E10955E56C5FC69ULL, 0x129E53AC428E9CBBULL),
+     S256Field(0x822EFDCD1E89C85DULL, 0xB2A232FD16B3E01BULL, 0xB2DA2115B712183FULL, 0x415ECB958AEE9A29ULL), false},
+    {S256Field(0xE9CE7FD84A02591CULL, 0x3EF54996585125A1ULL, 0x85A6BFBEB5E1FD61ULL, 0xA9FC93FC6539C8E2ULL),
+     S256Field(0x790ADDEF69BEC2DCULL, 0xCA888C415FCF7253ULL, 0x3E84C17A1A9165E5ULL, 0x9C2CE739DC538717ULL), false},
+    {S256Field(0x428700A0F85912ECULL, 0x27F9CA04E4609113ULL, 0x6AB499694AAF0543ULL, 0xAA7121D4E3FB5B78ULL),
+     S256Field(0xB114CB264AE35978ULL, 0xFEE134A8CE056CBDULL, 0xC505266B96A2EDEBULL, 0xC690F077DAD09509ULL), false},
+    {S256Field(0x11006E0E2D968B59ULL, 0x09A28BAE13CBBC2EULL, 0x6A7D7AC1209B0277ULL, 0xC940017C1A6F9F0AULL),
+     S256Field(0xFEFD76408DE572FBULL, 0xE2842CB64390C9C8ULL, 0x13B8A1BFA5B5742CULL, 0x39D922500C9B8620ULL), false},
+    {S256Field(0x922243D5E855B8DAULL, 0xC756267D12894711ULL, 0x5B85ECB6AEE10956ULL, 0x60144494C8F69448ULL),
+     S256Field(0xAD500590F34E4BBDULL, 0x543955C27E3F2A4BULL, 0x9E8BE1FD9132E65BULL, 0x8BB5D669F681E646ULL), false},
+    {S256Field(0xA2873335726B3332ULL, 0x310388D073EE5DE6ULL, 0xEC6793A5F70BF8E0ULL, 0x1F84BB9D7EED0024ULL),
+     S256Field(0x554428A314E8D52EULL, 0xC2BCCE2D436DC3A2ULL, 0x2547C27F75B9EDF0ULL, 0xEE726D072BCA9ECCULL), false},
+    {S256Field(0x9DD95979B1972BCBULL, 0xC2F22E3E241ECCEBULL, 0x8F68E0213EDA1776ULL, 0x3DF2D057C8BB9F02ULL),
+     S256Field(0xB2822CD3D65D09DFULL, 0x1B91449680194771ULL, 0xD6E6B23B046A684BULL, 0xDC7EB1C640C86EEAULL), false},
+    {S256Field(0x5CDAA54ACDEFA98EULL, 0x7248446811AC2799ULL, 0x6CA8157B3991E9C7ULL, 0x0F13E0890945FCD0ULL),
+     S256Field(0xC08A7769BE286767ULL, 0x287E705E16CEACCDULL, 0x35E3F8B0A7B362DBULL, 0xADD521F1764E7C50ULL), false},
+    {S256Field(0x1B806A24FFD292DCULL, 0x775E2680B17714CEULL, 0xBA48070D37BD79D9ULL, 0x4B9915533720F934ULL),
+     S256Field(0x433A5FFE57095CA6ULL, 0x938323C45B376AFDULL, 0x6DFC0A74B5F01F57ULL, 0xE327754961103A22ULL), false},
+    {S256Field(0xA5E1C03BE9F59B6BULL, 0xE9B38C63C1888E2FULL, 0xB3728A1D2D5826D3ULL, 0xDDE191A551DDEC7DULL),
+     S256Field(0xF6AD962926CB1410ULL, 0x8B5738BBE7154FECULL, 0xE0A757D61C52E14EULL, 0x5B2BFB78028275CBULL), false},
+    {S256Field(0xEEED1B3423B43EEBULL, 0x181C9401BF81184FULL, 0x7EA4825FFF359C5CULL, 0x83C403979EB95E93ULL),
+     S256Field(0xAFF34086D484FB51ULL, 0x95B6BFCAB553FB40ULL, 0x0BFC1E46D00D61B2ULL, 0x29575FF2437CEE3DULL), false},
+    {S256Field(0xB68C55FDC9C6B699ULL, 0xA86F57356BE46871ULL, 0x5A16D7BF97B41682ULL, 0x5FAB012EED836F7AULL),
+     S256Field(0xB1732152C1C6C3AAULL, 0x90AB117FEA883519ULL, 0xE9EBB41130D62F7BULL, 0x2D9BFA70A3C3D144ULL), false},
+    {S256Field(0x1E23632DDA34D24FULL, 0x41B6D8F0C9A13740ULL, 0x9391DF6DECF42EE5ULL, 0xE4A42D43C5CF169DULL),
+     S256Field(0x3A7F7131DEBA9414ULL, 0xE886EEDFA8D8E4F1ULL, 0x26FC99CCFB8AD34CULL, 0x4D9F92E716D1C735ULL), false},
+    {S256Field(0x303F2EA33E8F62BBULL, 0x0553C562F7AE4D2AULL, 0x3EF0ACF856C4EF4DULL, 0xFD6451FB84CFB18DULL),
+     S256Field(0xD0AD9086132C0911ULL, 0xFA2AB492D200E83FULL, 0xB6FE7A5C1BC344CCULL, 0xE745CEB2B1871578ULL), false},
+    {S256Field(0x5C8410AF3BEA0C68ULL, 0x09430123677B392BULL, 0x4949BC8E8D396FAFULL, 0x3E419634E156A3A2ULL),
+     S256Field(0xBCBB6FF71A45EDB6ULL, 0x2FA11946303CDA1AULL, 0xF373CBFE37069306ULL, 0x0123C59D924B21F7ULL), false},
+    {S256Field(0xFA1D1FB9D5FE696BULL, 0x0042E2D5DCF3C7A1ULL, 0x716E81A06F9EDBBBULL, 0x1EEE207CB24086BCULL),
+     S256Field(0xBB45670E7429337BULL, 0x7A02062E0AFD694EULL, 0xD2B196D12461C95FULL, 0x652CBD19AEF6269CULL), false},
+    {S256Field(0xAF75D23C939824D7ULL, 0x6EB7B64C351C9897ULL, 0xEED4A3E62F7F0B57ULL, 0x8D9438F5455D7508ULL),
+     S256Field(0x8A004F489366489FULL, 0x8FB9E2B8326B063DULL, 0x2CA60BD31AB6EF6FULL, 0x3261E0734FEE6C2AULL), false},
+    {S256Field(0x9A9814C417D4B84AULL, 0x621DDF48F1F433E6ULL, 0x0C62A492D2850704ULL, 0xF13A99E58DC72FCBULL),
+     S256Field(0x85990FC553FD1C81ULL, 0xB6E37D4710F2D962ULL, 0xAA6B91CD1E3FE06EULL, 0x33C2C8CD0F0BE995ULL), false},
+    {S256Field(0x8E48071A98D713DEULL, 0x9360C2FB7428E620ULL, 0x0D4A912A2FE54543ULL, 0xB72524C558EE5442ULL),
+     S256Field(0x76FFE5259B8350E9ULL, 0x0482D26FE44A5FCBULL, 0x1042D182E9D69415ULL, 0x4C51B39A8A283E45ULL), false},
+    {S256Field(0x08D40F19EF94C0D5ULL, 0xE1C0FC017C572579ULL, 0xD465AB2C346E2111ULL, 0xCC0EA33EA8A9EB14ULL),
+     S256Field(0xDEABE597AF452FE6ULL, 0xF6074F266113F543ULL, 0xB23DD203B5FBE663ULL, 0xF9907A3B711C8A2FULL), false},
+    {S256Field(0x2CC6C293FE3B2CB4ULL, 0x3049F35BF3721040ULL, 0x9ADC76E38121149EULL, 0x3DE45F5A216D1251ULL),
+     S256Field(0xF61E33AC307EB02FULL, 0x823E28E65A87044CULL, 0x50E08AA4A97C9106ULL, 0xBA2A8598405EADDCULL), false},
+    {S256Field(0x9CCBD7512A0C0222ULL, 0x16937EF9C82E8B55ULL, 0x46CA18BFC1700F2CULL, 0x9E4AC64D9CA58A04ULL),
+     S256Field(0x16CF7673A4FDC9BBULL, 0x1C62030F3DAB904EULL, 0x3080E8DF63B300D0ULL, 0xCEA45D1D9FE4E74DULL), false},
+    {S256Field(0x7234766F6CE4E5BFULL, 0x9B67CA86A09005B1ULL, 0xC1E3FCE3748906AEULL, 0x8511F1C68959BE87ULL),
+     S256Field(0x2FC92944C1789C08ULL, 0x2DA87889BC536526ULL, 0x4C1DDF7EC6AA0023ULL, 0xECDFF5CF91BCD487ULL), false},
+    {S256Field(0x5F0C3B144E735A1EULL, 0x4003E0966BE61FA0ULL, 0x46B8CDDAD61202FCULL, 0x678AC7C0799B56CBULL),
+     S256Field(0xA363A5F712F7C055ULL, 0x597FFFB33D371457ULL, 0x7A70FF3D57105E8EULL, 0x08514E33D9A5285BULL), false},
+    {S256Field(0x31B5668A3D3258ABULL, 0x57D242818ABC14DCULL, 0x2CFA1C72EE14AB59ULL, 0x8C5A052E81CF6022ULL),
+     S256Field(0xE57E0853022D0F8FULL, 0x46DAE8F9C0D944ADULL, 0x079A80C7904C08C2ULL, 0x6811DB4BB443BDA1ULL), false},
+    {S256Field(0xD7BE9770822AA9B8ULL, 0x00006E2933506F8EULL, 0xDD66895D9C5AD45FULL, 0x64BA9514D8680F6CULL),
+     S256Field(0xE93D1FB9B6163565ULL, 0x5FEF1B6F68307B35ULL, 0xB7E07728C19BE49EULL, 0x81273F22A6431BDBULL), false},
+    {S256Field(0x158C2A0ABF91BCEEULL, 0xF5CF1D8F1E0C0D84ULL, 0xBDC63CEC556BF137ULL, 0xCEF7F816DEBD3560ULL),
+     S256Field(0x6BB4DA9F81966B33ULL, 0xA63E4B02A172F6ACULL, 0x2463B339C01D245FULL, 0x67E74C8363748701ULL), false},
+    {S256Field(0x47173B9D4300BF19ULL, 0x92B53576A88FEA49ULL, 0x54160FADAB352B6BULL, 0x1EC80FEF360CBDD9ULL),
+     S256Field(0x671CDC1CC107CEFDULL, 0x0146E77F6295A07BULL, 0x2F3A4958A7ABBF5EULL, 0xAEEFE93756B5340DULL), false},
+    {S256Field(0x0DAE805D414FF9E4ULL, 0x8E8462F6EBD89056ULL, 0xCBEEAA0344FC90BBULL, 0x5BE7EA3519F04BC6ULL),
+     S256Field(0x4030B07847E0BDBBULL, 0x0E99C6302119A309ULL, 0x477F890F655AB7FEULL, 0x32F32EC3F638E605ULL), false},
+    {S256Field(0x4B17CBBC52FEA1F9ULL, 0xC4FF0B508C0452B9ULL, 0x3BCFDDAB67106531ULL, 0xA6DC880A55D1F2E8ULL),
+     S256Field(0x3B1C14E47BC345E9ULL, 0x057B89DB7E68F7E6ULL, 0x038683A116ACBC50ULL, 0x7EF1A8547DC367C3ULL), false},
+    {S256Field(0xE3FB545F4DDB7BB8ULL, 0xD50028649F853991ULL, 0x0813FC8698DF7F5CULL, 0x58F099116EAE4E65ULL),
+     S256Field(0xBDEC73582E5B2D6EULL, 0x507EE4062D174302ULL, 0x0D62FF7614638066ULL, 0x7E07002AAFFE111AULL), false},
+    {S256Field(0xC8D40C3F06D6C9B3ULL, 0x8C6C4CE874865637ULL, 0x2BDC229C78A481BAULL, 0xFE6BA93FEA424599ULL),
+     S256Field(0x0C2C788FA948BDFBULL, 0xD980F1BF05C2E9B0ULL, 0xB6BB41B345413B56ULL, 0x7EE918D740539872ULL), false},
+    {S256Field(0x8B613E771C7985C4ULL, 0x134BFC495B9E2B10ULL, 0xE542842802F74C34ULL, 0x2320B5CAF7B59B7CULL),
+     S256Field(0x4FF4F1DF4C2C6D44ULL, 0xD96F10211CD9EB8DULL, 0x18C721B81F9BCA93ULL, 0xC79F943DC88BE943ULL), false},
+    {S256Field(0x422F10730CF95151ULL, 0xB964806E442C4B64ULL, 0xB020C8C2DC08DED1ULL, 0x15D5E2F146FC98BFULL),
+     S256Field(0x482A07CC2FF8ECF2ULL, 0xBB204FB97DD8C0F9ULL, 0x7F90E109789023F9ULL, 0xA5B72E31915FD4ECULL), false},
+    {S256Field(0x413C1606CC9A8E2CULL, 0x823D8D1A4CC1A1C1ULL, 0x33BCC04FD860CB0FULL, 0xB0F9E4B9B29790B6ULL),
+     S256Field(0x6C2066C4DF3D0DB4ULL, 0x3350CC02C171CEE7ULL, 0x41CBB0B906FDE3F0ULL, 0x49E82BF1843ADE6DULL), false},
+    {S256Field(0x3D7810B9296A5658ULL, 0x3814B25241EF6564ULL, 0xD8C7E00927AE29BEULL, 0x84C0E8725688447AULL),
+     S256Field(0x2D96729BD81B80D1ULL, 0xD3A61A981F4F1FD2ULL, 0xA087E3190653725EULL, 0x26598380C16022C4ULL), false},
+    {S256Field(0x5AA02F29D9D6FAD4ULL, 0x94B357CF1C9A124CULL, 0x8FAD04CE213D59F4ULL, 0x56DB6280670A91ECULL),
+     S256Field(0x67A9C0FD359E0836ULL, 0xF5B8B2A1A31E5CC8ULL, 0x50F591016D6830C7ULL, 0xDA0D3B94DB572724ULL), false},
+    {S256Field(0x375BB5C894DC6A0FULL, 0x7443419142FE1575ULL, 0x565264E7A2C077C2ULL, 0xFED6B1C71A93731DULL),
+     S256Field(0xCCB8D72D976FC7E0ULL, 0x1374D5930A3FC409ULL, 0x8479181AE4D3AE23ULL, 0x8DE2ABE6B0FFFF0AULL), false},
+    {S256Field(0x79FE0B0BCA3A809CULL, 0xDAB662F5D798346DULL, 0xBFBCF97E4254A89EULL, 0x125E7EC83933DF56ULL),
+     S256Field(0xDA8C900A949E70D9ULL, 0x1E4E3B2EF07FCA3DULL, 0x887747CAF5721A37ULL, 0xE0D3F6EDE254CB38ULL), false},
+    {S256Field(0xDB3885F118E29355ULL, 0x2F1C8E9339720D86ULL, 0x0FCEF8604023B9D8ULL, 0x2A6A4DD992D3CBC7ULL),
+     S256Field(0x0053E00FB5CC2872ULL, 0xFE905A3A64C4C76CULL, 0x760FDC81E268F90DULL, 0x8677DFBA7C4A7E0CULL), false},
+    {S256Field(0x7F529511E7681028ULL, 0x196E235EAFCB9BB4ULL, 0xBF33CE97DDAF3D8FULL, 0xA1ACB3F1185D20E1ULL),
+     S256Field(0x1F1A463E14A11C9DULL, 0x66EECB271FA0D788ULL, 0x6A047588288F0C5AULL, 0x55A883A61ABBB29BULL), false},
+    {S256Field(0x1F9FA88FE148DABFULL, 0xC1ADD2B9349D78EBULL, 0xD9764EC235FAE735ULL, 0xE42D93026C927546ULL),
+     S256Field(0xD772C756811E1361ULL, 0x3272757019E77EB9ULL, 0xD8B38CEBFDF38530ULL, 0x6413862C6E2D84B0ULL), false},
+    {S256Field(0x9DDB5928366642BEULL, 0xCE3490717D58BA88ULL, 0x91B00AF4680DFA8BULL, 0x146A778C04670C2FULL),
+     S256Field(0xD0B297483D83EFD0ULL, 0x0AAA971D2F7E5ED1ULL, 0xDD669827F9D4B287ULL, 0xB318E0EC3354028AULL), false},
+    {S256Field(0x11B2365579DE5CACULL, 0xEEFC983C7ECB2619ULL, 0xE5670B5C0BCD14CFULL, 0x574EF0CE8A597E24ULL),
+     S256Field(0xAE59AEA6C75A4805ULL, 0x1A260A7BEF10008CULL, 0x3BD6ADA0569B7845ULL, 0x09B99930281F19C7ULL), false},
+    {S256Field(0x9D93873827315443ULL, 0x3D79BBD54AE86729ULL, 0xF42C899820A142A1ULL, 0xFC696C040660935FULL),
+     S256Field(0x7490D60B57D28960ULL, 0x487FF486109BD1B1ULL, 0xBBF0E1CDD69677B5ULL, 0xE0CE27EBF83B5892ULL), false},
+    {S256Field(0x808C2D74260966D3ULL, 0x10A770C1AEFF8645ULL, 0x5D909397B98C835DULL, 0xD3D97E799D8BF9F8ULL),
+     S256Field(0xBDDEB850833C2E52ULL, 0xB5E48711BE8DC4EEULL, 0x6AAA89275D403AD3ULL, 0x8DDBB46376BAC95EULL), false},
+    {S256Field(0xD1BB2F5C16FDB4EBULL, 0x8FA3DD79C62E6A79ULL, 0x1AE56A3562BEB092ULL, 0x974AF221FF4FF2ADULL),
+     S256Field(0x8409C3DFA9F6F484ULL, 0x111C572A3BFFC234ULL, 0x64D1E43D02C090EDULL, 0x5552387D535003CAULL), false},
+    {S256Field(0x7F3615FD7C6B5B56ULL, 0x4185C8AAED888B60ULL, 0xCDF587ED3BF200E5ULL, 0xA0E8865700EF4338ULL),
+     S256Field(0xA16BDE513A1D7518ULL, 0x526B871D70858A51ULL, 0xB99A6B89B853DEADULL, 0xF5BA46839FA9AD50ULL), false},
+    {S256Field(0x73904ADB5D5AEEE3ULL, 0xE8284BC36658C813ULL, 0x09121B3A669270C5ULL, 0x5BAAB59B49DE398BULL),
+     S256Field(0x82D29AFB70F69717ULL, 0x215DDC9DABD31EEDULL, 0x6E5A008661FFDAF7ULL, 0x8A577F617C0F7E85ULL), false},
+    {S256Field(0x0040FB93968C6D4BULL, 0xB2BE78CF8F494C12ULL, 0x7B974E782CBBEE0AULL, 0xB1AA653288B31898ULL),
+     S256Field(0x83D9E62AE891AC51ULL, 0x100A1D909D623CC3ULL, 0x2684AA8E2D63A83BULL, 0x7ED6071C60810D71ULL), false},
+    {S256Field(0x851B1E44F5726890ULL, 0xE59025FEAC837D15ULL, 0x01032FCEBF910A0EULL, 0xFB685FA7EB49C43DULL),
+     S256Field(0x606EA8F3B835783AULL, 0x4FA6CB12E90E79B2ULL, 0x869CA16D9864BA09ULL, 0xD750DF22C98E5E2EULL), false},
+    {S256Field(0xB7EEDAEC62C6E5BBULL, 0x24FDFFEE356CFE6AULL, 0x358AB0B8392A597FULL, 0x25116C4108C7105FULL),
+     S256Field(0x4DC4732A0F7E1321ULL, 0x77C508DF51CC272DULL, 0x1EB7406DC815DD8FULL, 0x60D86913E77177E0ULL), false},
+    {S256Field(0x5464BF13A8BCA48AULL, 0x78B4D5F4E83DF62FULL, 0x0AB27B91C287F71DULL, 0x5DE58FF659E2995AULL),
+     S256Field(0x58794E80D2FD41CDULL, 0x3FE5BD9C4E0F8AA9ULL, 0x309A623C252D3C84ULL, 0x685A3B3D80359B55ULL), false},
+    {S256Field(0x1D765DF750CEDD26ULL, 0x3CC8B99DEA571554ULL, 0x611D8100F9639E2AULL, 0xAF8848372961EBB2ULL),
+     S256Field(0x8B6E7AD3B0E43F7FULL, 0x54549E4867AA4170ULL, 0xD28CBB88EBED2F96ULL, 0xDC57FBF97B167030ULL), false},
+    {S256Field(0xBDE38344E5EF63B6ULL, 0x5AB4D016731B182EULL, 0xAF1B7FDA3B4FC1C8ULL, 0x6F1825CDEAD618BFULL),
+     S256Field(0x12C846CF45C655F3ULL, 0x3C895A64027F9454ULL, 0x98F4204D78333455ULL, 0xFF097E7DD591911BULL), false},
+    {S256Field(0x39F9E5B1FAA50E2DULL, 0xB5A275ECF6AE4BDCULL, 0x5B256E3EA081ADD0ULL, 0x5210D6605B888036ULL),
+     S256Field(0xB029A8935AFDA8EEULL, 0x5A273DCDC642686EULL, 0x39C13C0E7FF6588BULL, 0x35F6674A5DECD301ULL), false},
+    {S256Field(0x7B5047EDF4A63F3BULL, 0x83203B019978F972ULL, 0xB587115F5E76C765ULL, 0xC5ECB895F762A376ULL),
+     S256Field(0xB53F374685005024ULL, 0x8BEB65EE5E30BEE5ULL, 0x74EA4058FF9233ECULL, 0x22252518197881F3ULL), false},
+    {S256Field(0x6D76A8793180EEF9ULL, 0x8D0012209A28B977ULL, 0x7E3ACEBB1AA07B12ULL, 0xFA50C0F61D22E5F0ULL),
+     S256Field(0x38CD8D7D3F4F2811ULL, 0x5E683293A57A213BULL, 0xB72CD2872281A68AULL, 0x6B84C6922397EBA9ULL), false},
+    {S256Field(0x59C5BE23187F5048ULL, 0xE72328D2448386D4ULL, 0x780140FE02E90836ULL, 0x63964EEE619074E0ULL),
+     S256Field(0x383A284D89309DF8ULL, 0x3D580B934DDE6C84ULL, 0xA39FF9B1C34BFBC9ULL, 0x3B6CFB3A6B89CF41ULL), false},
+    {S256Field(0x71EE0E3391DA5E12ULL, 0xA9C60A4015CACB29ULL, 0xCDA329F93A1CA2B6ULL, 0xF7502E3C4379E31BULL),
+     S256Field(0x7A4B9C5E8385F4EBULL, 0x7B86D32EF725CEBCULL, 0x59970945C3D67204ULL, 0x3C57F5EDD67CFAFDULL), false},
+    {S256Field(0xF814BA1EBADB2A65ULL, 0xAFD7F12AD3CBDA31ULL, 0x2D1469DDF0FC9F75ULL, 0x5A3CE25B4D15B7E2ULL),
+     S256Field(0xD8B170CF1D327F1DULL, 0x3EE28BC3D825FE8EULL, 0x873A6DBFBF3F99AFULL, 0x8B34125B92E05F63ULL), false},
+    {S256Field(0x2074933110B7D105ULL, 0xF4CA5C4B94E57C9FULL, 0xA3A4F6624E3455B3ULL, 0x12FE78F983AE5862ULL),
+     S256Field(0x458AC6FB9F794A60ULL, 0x1DECE265D6EE90B8ULL, 0x786B5AA199A7CB77ULL, 0x2062F1A338D6BCF7ULL), false},
+    {S256Field(0x237312073E32478EULL, 0x24AB318F2A9BA7EDULL, 0x0FEC6B7F3F332B20ULL, 0xD42011D601061388ULL),
+     S256Field(0x1CE05681D04E88D4ULL, 0x6FB24B2F35508CC3ULL, 0x1B2D5F5F44BF847BULL, 0xBAE5D4E9A37D4E0CULL), false},
+    {S256Field(0xF621D8339E0C5D05ULL, 0x480E6C50AA572DAFULL, 0x58C4BB1028084B1AULL, 0x76AAC31347DF473DULL),
+     S256Field(0x556619B751ECE63EULL, 0x4B1225CF015E6EE3ULL, 0xABEF32C83202625FULL, 0xEF5576EF0D5C70EFULL), false},
+    {S256Field(0x16A733754A9F44D0ULL, 0x85DBCB6E69A8FA00ULL, 0x6910BE34F0DE41FFULL, 0x5CE605AF98F93EDAULL),
+     S256Field(0xC0D05F3489D30105ULL, 0xAB3CB1BFA32ECCC6ULL, 0x7BA56BD031C76C58ULL, 0x4CDDCF9BEC226BFEULL), false},
+    {S256Field(0x9E26F485FC53C086ULL, 0xC6B55C349C9A1AECULL, 0x87E60C3145E88104ULL, 0xA663FE5BBE5C5CCCULL),
+     S256Field(0xE69C5032A5016201ULL, 0x991ECCA573994FC0ULL, 0x5D1B102C89823DC3ULL, 0xB541997F6B211FBFULL), false},
+    {S256Field(0xAA20D691C9F40840ULL, 0xA71DF4429E55359EULL, 0xFE4EAA23938A4347ULL, 0xE0346D21121FF741ULL),
+     S256Field(0xC39A1AAFF3D7CE72ULL, 0x269CD39A6EBD33EDULL, 0xD756D4A97EE7BA2AULL, 0x3EE683713C998956ULL), false},
+    {S256Field(0x9AD801ED4B758574ULL, 0xD8326689434F9C6EULL, 0x5B7CA1027AE2BDF3ULL, 0xDE95527A0206CD82ULL),
+     S256Field(0x4B7DF1FCFB67232AULL, 0xBAE6A105155A2DEBULL, 0x4E21DC847F169ED7ULL, 0x4CD3E056AC93D14EULL), false},
+    {S256Field(0x56A7237BA16DDCD3ULL, 0x044B110021EA0035ULL, 0xF7B5BEB6CB8761AFULL, 0x1AE1AD36F64E99EDULL),
+     S256Field(0x7CC4619D2E7EB2B7ULL, 0x59616ADDFCBB613CULL, 0x59C74F7752104489ULL, 0x7016054987A09220ULL), false},
+    {S256Field(0xD779B8ABFD85474FULL, 0x894C4A2B89634668ULL, 0xBFEDCCBE44785AEAULL, 0x8DA6BCE066D32ADDULL),
+     S256Field(0x5FDF9C7D3D7B4EF7ULL, 0x0B1CC59305DBDD7AULL, 0x84FDDF5D071DFFF1ULL, 0x13FC6C6AF31ED4FFULL), false},
+    {S256Field(0x80FFFF890A9DE533ULL, 0x2A9BB56702356E3CULL, 0x20E979F6A6471274ULL, 0x1138AD12333790F9ULL),
+     S256Field(0x6A8B7094FD332573ULL, 0xF679BD0B454A4000ULL, 0x86F0DC3E9F95A7DFULL, 0xB35525B758751D94ULL), false},
+    {S256Field(0x6B5D42567DD042EAULL, 0xEBFA26A6458EAFD0ULL, 0xB1BD6649E33C93BEULL, 0x7329ACC7CFB3BA39ULL),
+     S256Field(0xADA8CFEC2F5C94A1ULL, 0x184897731DFAB4F0ULL, 0x89284E794FAB68EEULL, 0x9272493541B76F14ULL), false},
+    {S256Field(0x0E53D32B5F067EC2ULL, 0x1A288AB5D5BBA522ULL, 0xB1A5BF6B7D88E842ULL, 0xDA1D61D0CA721A11ULL),
+     S256Field(0x655FBA0F1AD836F1ULL, 0x66A73899D279B48AULL, 0x79C0766161C91E29ULL, 0x8157F55A7C99306CULL), false},
+    {S256Field(0xB3C210D22CD3C369ULL, 0x23605483E1F8E934ULL, 0xDF85D5F61DC1283AULL, 0x9C7BE00B4EF4C444ULL),
+     S256Field(0x29EE3FEBA2329515ULL, 0x3E31153A16769CBDULL, 0x52A26D455CE40148ULL, 0x9220C0DE74B20D20ULL), false},
+    {S256Field(0x15D87732FA95A8DBULL, 0xB83EC0C4479D36F6ULL, 0x19E96646991B1723ULL, 0xE3E90DA46303DD04ULL),
+     S256Field(0x1016CF7F1B0D1CF9ULL, 0xFBB1EF97CC984D3DULL, 0xB00FAA90C702E76AULL, 0xFBE53BC0056C178BULL), false},
+    {S256Field(0x76BCD92D7BB8C9E3ULL, 0x74DD06A70541178EULL, 0xB55664B238CCC491ULL, 0x0FCD83F42825263BULL),
+     S256Field(0xE86D55FBDF4AA9ADULL, 0xADBEAECDF1627BF4ULL, 0xD1D8232DE5FDB683ULL, 0x6C0BC1CFEAC5FBCEULL), false},
+    {S256Field(0x17AAFD64112EE214ULL, 0x782A4E9795931540ULL, 0xA8B650DFD5C0C01CULL, 0x9F4FFEC732E3D775ULL),
+     S256Field(0x3EF442225085F37AULL, 0x9719B6930BC88028ULL, 0x60E96682FD75C69DULL, 0x639CE2E1318E2F2EULL), false},
+    {S256Field(0xF4FC3DCB541D0CE6ULL, 0x748992A2CF598D41ULL, 0x2EE14CCE33A05FB2ULL, 0x14295A2937F1A941ULL),
+     S256Field(0x52A81A8AD738BB86ULL, 0x310895601B5D241AULL, 0x1B031C44844083B1ULL, 0xFEA75363DF115071ULL), false},
+    {S256Field(0xF8B681451F61A0A5ULL, 0x4B1253E1B3C14E3EULL, 0xB171A0A41F440B2CULL, 0x431F622D41134AC1ULL),
+     S256Field(0x46B7B7FE78CEF899ULL, 0x41BAAA0435565772ULL, 0x6D6DE6519723AA72ULL, 0xA298327FE7AA438FULL), false},
+    {S256Field(0x5CF39944B26B64F1ULL, 0xB7EDCF28F5476D99ULL, 0xD4CDA4C62511E59DULL, 0x7175407F1B58F010ULL),
+     S256Field(0x426E7EFAB24234D5ULL, 0xB01FE8B774471D2AULL, 0xF36D3401134CC86EULL, 0x43B4554344E3D550ULL), false},
+    {S256Field(0xCAC267D567748503ULL, 0x0E6E0E47731328E7ULL, 0x6CB62EF39F8A12ACULL, 0x993DBADDECE78FB8ULL),
+     S256Field(0x9BA736137EB0CEE2ULL, 0x17F87BF69B8ADAA4ULL, 0x785F784787A1F51AULL, 0xA521A9EE8569EEEBULL), false},
+    {S256Field(0xE464DBA997421E21ULL, 0x3ACA86A23CEFE2F4ULL, 0xBA8289212418CFACULL, 0x0C20E86B84E51772ULL),
+     S256Field(0xDFC83D64A1AA6A45ULL, 0x86EE76F65BD09349ULL, 0x1A1237A11E19A5B7ULL, 0xF561E9BF76D0ADACULL), false},
+    {S256Field(0x8DEA2275A6D23D80ULL, 0xE10BD11F26474D47ULL, 0xA339431CB90962C0ULL, 0x75F17ABA06AD5EA5ULL),
+     S256Field(0x986A85B0280DD57EULL, 0x372FFBEDBB4EA590ULL, 0xC7FC7D0BF19B6292ULL, 0xA07A62FE15639A80ULL), false},
+    {S256Field(0xC718CF9C4B344F7FULL, 0xEE8B89FD48CE60C4ULL, 0x0E97E32CBD26D410ULL, 0x354CC84BD972E0AEULL),
+     S256Field(0x7E4B11AEA5DB82D6ULL, 0x8E36C6018602E0ECULL, 0x6750B493F9BA8855ULL, 0x9C04BF29291C6B5DULL), false},
+    {S256Field(0xAE2B9B6D61AD3413ULL, 0x8DB9C0040327D684ULL, 0xA6E95F485CB87B7AULL, 0x6678555E11D9F4A0ULL),
+     S256Field(0x124810207EBCA672ULL, 0xA6CE2D153ADC6660ULL, 0x925266D927CBDF9EULL, 0x510DDA3DE278F646ULL), false},
+    {S256Field(0x7487B5F83502B4B1ULL, 0xC4AF2554D6C08A44ULL, 0x40486C0F262213A9ULL, 0xACEF1418DA0F9428ULL),
+     S256Field(0x6F81FA7966E85BFCULL, 0x2A3F6290ADF1878CULL, 0xE04017B53D8971CDULL, 0xC4D3559FD7E87A4DULL), false},
+    {S256Field(0xAC00AF5B06CC8563ULL, 0x9224DF5BFFE101EAULL, 0xADAC82BD81963688ULL, 0xEBDC4A362CDA7748ULL),
+     S256Field(0x49B17BCEA394CCFAULL, 0xBEC4079249204F92ULL, 0x9B1EE35E6CDD4F07ULL, 0x659A3144E856D35FULL), false},
+    {S256Field(0x2A73B0610D064E13ULL, 0x15311DE0446F1E06ULL, 0x7215FF98E8FD4166ULL, 0xA8E282FF0C970690ULL),
+     S256Field(0xCEF7C73111F4CC0CULL, 0x8B679A3E50DD6BD6ULL, 0xABFB7F3C5B251588ULL, 0x7F97355B8DB81C09ULL), false},
+    {S256Field(0xC15EB9EA7F7653A1ULL, 0xEFBE9EAA753D67C1ULL, 0xCB876F805EA66E63ULL, 0xCAC6F2E7E27FAECBULL),
+     S256Field(0x68C10AD0FEC5E556ULL, 0x81E83AE5688103A0ULL, 0x4CDB65D9A42A3450ULL, 0xF7D416E5E2AA6F19ULL), false},
+    {S256Field(0x22A199B0BA3979B5ULL, 0xBA288F8DE67E829EULL, 0x27F37F0B1EE40E50ULL, 0xAE2207C5CDADE263ULL),
+     S256Field(0x68F3CD668450FA6FULL, 0xFCA87B7D37D4F889ULL, 0xAD4C924523AD7060ULL, 0xEA91FE510C079F71ULL), false},
+    {S256Field(0xCC9F4AB08624003DULL, 0x4AB767294238CB11ULL, 0xEFBC5932E58E4325ULL, 0xE6DFDE46EE37D206ULL),
+     S256Field(0x7548650E2216B93BULL, 0x3B1CE5EA527FD7DDULL, 0x8F2F48F7B88F9220ULL, 0x8727B3B7BE913949ULL), false},
+    {S256Field(0xE41019100EFCA824ULL, 0xE0BE0C4FEA2164FAULL, 0x9CEC541006585461ULL, 0xCB8DED0CAD72ACE5ULL),
+     S256Field(0xF140BD058F227361ULL, 0x96AD1FDFC7931742ULL, 0x5B316C487A2CCBC4ULL, 0x33A5008F740D88C8ULL), false},
+    {S256Field(0x559E11E1ECE4DD6AULL, 0x0A00E49CA3221CEFULL, 0xBC9ECA37E8D64C46ULL, 0x49DBE4F7B2792B64ULL),
+     S256Field(0xB13B72A42A9E3EAEULL, 0x1C38552FCA05BB69ULL, 0x2C5FE33DB692255AULL, 0xB8B57298470481C7ULL), false},
+    {S256Field(0x9411B4DA3BCBD327ULL, 0xB04E085221E4AAEEULL, 0x08E94900D7E76ED6ULL, 0xB0C53B298AF18367ULL),
+     S256Field(0x1616BC4A2D7BE436ULL, 0xD82A220C74636A0FULL, 0x638F6A601B66B2AFULL, 0xEE2A97401FBD7EA1ULL), false},
+    {S256Field(0xB0E1103548DCE109ULL, 0xE250E3149CF211D3ULL, 0x66A40CFC7AC96082ULL, 0x3C4E089CD9A6823DULL),
+     S256Field(0xE2BF65923A19AEEAULL, 0x9579E142D97FE697ULL, 0x80757BCA15764D37ULL, 0x43FBBE669FE191B4ULL), false},
+    {S256Field(0xDE6EFB6397B836A1ULL, 0xC806405FF7679EF7ULL, 0xD4D8862ECE77F526ULL, 0x6F6BA73F329DB920ULL),
+     S256Field(0x4DBDF2FB06832B84ULL, 0xD8990C5288E1FF93ULL, 0x3DB0B8A405BEE9C0ULL, 0xDC778A17FF5FC18EULL), false},
+    {S256Field(0x68056B7F825D5241ULL, 0x563ED7CA920BD2F6ULL, 0x534277D340B3EA8AULL, 0xF8CC1DADA779674EULL),
+     S256Field(0x960AF038F070E10AULL, 0x52C2D76C61EB0BD4ULL, 0xB33E892FA5166F04ULL, 0x13DE4E4410B170FEULL), false},
+    {S256Field(0x2AEE34209EB39EDEULL, 0x31088032D70612D4ULL, 0xBBCFF467E1024360ULL, 0x7D471A7DC7422AF4ULL),
+     S256Field(0x0C9BCD94ABF6607EULL, 0x7795CF7D1C22A8FDULL, 0x07B82231EFFC86FAULL, 0x004A7B19F3A68565ULL), false},
+    {S256Field(0x4FE8B5BDF4E5F03AULL, 0x96565FEB1E1606D5ULL, 0x737DCFB33D7DFE35ULL, 0x80C34FDD0289BE33ULL),
+     S256Field(0x117F4546FE3CA504ULL, 0xD30B2AEF1F3245CBULL, 0x55EDB57007DC9A03ULL, 0x247E0856A78C1ECDULL), false},
+    {S256Field(0xA56D49E2565EB1C1ULL, 0x7FCD7567CDAE5C5AULL, 0x7070FCC31982F096ULL, 0xF0025163F9B73FACULL),
+     S256Field(0x7DA7D7046DDE2AE0ULL, 0x8576FF5CD6CD11E5ULL, 0x4C66B4A5DA26AFEDULL, 0x054EA9E8883D20DFULL), false},
+    {S256Field(0xA610A061CA14F422ULL, 0xB383E4ED9E4C4DECULL, 0x4AFE802214DBC7BCULL, 0x6CED1AE897A9DF3DULL),
+     S256Field(0xAE73DA43D84FC091ULL, 0x8CA102C879A9C932ULL, 0xBB495A728BE6B9B8ULL, 0x25888AEB1B0F8E7AULL), false},
+    {S256Field(0x4CF35093DAC32C64ULL, 0x0E36FE03ECAE4BF8ULL, 0x0F704E950F47715EULL, 0xAC12140001ED23AAULL),
+     S256Field(0x8812ADBADEB1A867ULL, 0xED5A5D3A5A53F089ULL, 0x1870B695730499A3ULL, 0xCE8EBCCBAC338BAFULL), false},
+    {S256Field(0x22F382DE8319497CULL, 0x5D59B1FA512508C0ULL, 0x2D39E56E6913CAB1ULL, 0x174A53B9C9A28587ULL),
+     S256Field(0x83DA13AC079AFA73ULL, 0x646B3A1D8CB98543ULL, 0x57B4155F2C47F9E6ULL, 0xCCC9DC37ABFC9C16ULL), false},
+    {S256Field(0x5F5DA36F840DD273ULL, 0xD53D280E0E450111ULL, 0x30C7071EF1B92EA3ULL, 0x20E6E2E796946BB6ULL),
+     S256Field(0xC07CFD15BB46B593ULL, 0x811EC9793DA8693CULL, 0x4A0BA1AD97874655ULL, 0xD3AD7AFE4F1559E4ULL), false},
+    {S256Field(0xE948073D754B8367ULL, 0xB775B77D67D506BFULL, 0x40CAA5D458436A5DULL, 0x5E5A094AE446526EULL),
+     S256Field(0x45329A9D91CE85CAULL, 0x796AA9EF3DE5FFA4ULL, 0xC2C901F1572A4B7AULL, 0xAE8AF8C9A4795E05ULL), false},
+    {S256Field(0xE7B54F301A077674ULL, 0x35AE68136CC24CA3ULL, 0xA80280A07E71DB70ULL, 0x8E0CA824D7A351DBULL),
+     S256Field(0x0B84CBEC12B7ED98ULL, 0xCFF60419D2F91029ULL, 0xDC569D24DA62CF57ULL, 0x04EC560759192D41ULL), false},
+    {S256Field(0xF198579397B10D9DULL, 0xE6A52F189D1F8FCAULL, 0x9DECCB83310CB82DULL, 0x00D4E0ADB9702E85ULL),
+     S256Field(0xE82100487140DCEDULL, 0x0B5898C978E2D923ULL, 0x47D2F846432287F7ULL, 0x87B8019818376409ULL), false},
+    {S256Field(0x7B05E8360CBCAD59ULL, 0x7C845A05A4E0AAA0ULL, 0x7AA17C85A5F902F1ULL, 0x2ED76C1152AC3600ULL),
+     S256Field(0x14AC7A89C4EA66FEULL, 0x5F72C60130A7F941ULL, 0x2CDA6EAEC81767EDULL, 0x639F4D4043B85F22ULL), false},
+    {S256Field(0x20811A609C9CAEE8ULL, 0x632E2045B1A270BBULL, 0xF6F7A19AEEC4A667ULL, 0x0366521368EF74C0ULL),
+     S256Field(0x0A9EC6A3B772B711ULL, 0x01CBA9893295BA7FULL, 0x9949FC681BA69445ULL, 0x1F18C32B2A93DED9ULL), false},
+    {S256Field(0xE96AFC5EA8192441ULL, 0xAFDB5821A321B4AFULL, 0xC5FA63553E3D66C1ULL, 0xF7BB50DA51C982D1ULL),
+     S256Field(0xBC640EA1D45165AEULL, 0xB1CFDC1FBBC4C74BULL, 0x311BC63BDDE6485DULL, 0x93CC3BE30334A526ULL), false},
+    {S256Field(0x53FF97519446C85CULL, 0xDE37DE08E601C063ULL, 0xAA0676C453F6C6EAULL, 0x0E5891056FDB8F1FULL),
+     S256Field(0x5F6C77E72148972EULL, 0xF490234E80CDDADDULL, 0x0EC7418BAF481898ULL, 0xE39A485F11FA7BDAULL), false},
+    {S256Field(0xE0349010055AE087ULL, 0xC671B96FA3494A57ULL, 0x2D3945FB743A1510ULL, 0xA34667155B6EA598ULL),
+     S256Field(0xCB3F366322887627ULL, 0xC53EAB6F2394F0BCULL, 0x8DEFE9A1AA2A3051ULL, 0x21CA5FA5E56BC5BDULL), false},
+    {S256Field(0xFF18ADF3C22E1259ULL, 0x931739A40681362AULL, 0x2B6CF5FAA0077771ULL, 0xA740126D26F1463FULL),
+     S256Field(0x5F771724334A5F43ULL, 0x17865E753B1D6DADULL, 0x1B05F174A67C7EE5ULL, 0x05A9FFBAF194F1FFULL), false},
+    {S256Field(0x830F4571E4B84B48ULL, 0x91ADF4C799E817EAULL, 0x41910F577D417F70ULL, 0x5FB1DF0E7D45A4F5ULL),
+     S256Field(0x77EDEA6A37BE8EB8ULL, 0x0629C390873F21ADULL, 0xFBCF4646FE6D2582ULL, 0x2152FBBCBC3C4D49ULL), false},
+    {S256Field(0xD88A17A3CB08F1FEULL, 0xD7CE7EE70BA087BFULL, 0xA65405765D82D177ULL, 0x87E4B8216D9474E4ULL),
+     S256Field(0x75F74AC9AED5E2ECULL, 0x6E2F23DBD6786D9DULL, 0xCD7D7F8EA2F8C2CCULL, 0xF74E3AC0766348CEULL), false},
+    {S256Field(0x1146D987F9B8F255ULL, 0xE77D43E7492A0D21ULL, 0x1622E4608AA82FE9ULL, 0x95BBD97478E1B8A4ULL),
+     S256Field(0x010E3FE828361439ULL, 0xF2BA72AEFC777FC1ULL, 0xDEF2C208F0F2D0D8ULL, 0xBED43AD129E3C77FULL), false},
+    {S256Field(0x9A8700E6A1C4D15CULL, 0x105EA7BF07C0E74BULL, 0xA92C22C0C1254A44ULL, 0x35EA1B463FEA79A5ULL),
+     S256Field(0xDC939BAF7F3FE1EAULL, 0x5D633AA03065095EULL, 0x7888FA5FD74D3B18ULL, 0xAD2191651B9ED2CDULL), false},
+    {S256Field(0x884FDFF09475B7BAULL, 0xE039E730E4918B3DULL, 0x3D3E57EDF5018CDBULL, 0x959396981943785CULL),
+     S256Field(0xE9B8ABF87524F2FDULL, 0x9C653F64C8709385ULL, 0x8BA0386A4B9CD684ULL, 0x2E7E552888C331DDULL), false},
+    {S256Field(0x07275A940BC8F53BULL, 0xD702226B391747C7ULL, 0xAFE32CA7DD73D95EULL, 0xCBEE1405FF0DA7DEULL),
+     S256Field(0x2922E6B278C87F45ULL, 0x0D9FF4F68126F728ULL, 0xB51F3E689B8294CFULL, 0xF6211F4F4E75F902ULL), false},
+    {S256Field(0xA09C5DD90FD69985ULL, 0x9F309CCB6DDF72AEULL, 0x788F690DFBCCCF14ULL, 0x0AE97675CEB72F7EULL),
+     S256Field(0x89C8EB411409A003ULL, 0xD0B99D417AEE1AFFULL, 0xE9B8DFEE051A54C5ULL, 0x91219973F6E48D14ULL), false},
+    {S256Field(0xF377C88B14B311DDULL, 0x3DE3BEAEFBD71B9CULL, 0xDD580BFA0BA252E0ULL, 0xADD5BAD28FAAF5ACULL),
+     S256Field(0x02F982F349D6C38DULL, 0x52D4E1E7669B9B89ULL, 0x974E434F8359814FULL, 0xE9C43CF4DA3DC3A5ULL), false},
+    {S256Field(0x9DC193DFD9262B90ULL, 0xB723C4C1FE3CC29AULL, 0xC9B65F1778025D1FULL, 0x2B15862A5AC1612EULL),
+     S256Field(0x991996E6483D7557ULL, 0x6F534970F99489A4ULL, 0xA7A30D52DA874906ULL, 0x2EB0053DAA0A33FAULL), false},
+    {S256Field(0x4E75AE796078AFB0ULL, 0x14FF12C6C4126197ULL, 0x248D4468C66D1707ULL, 0x209D6BCD766163B5ULL),
+     S256Field(0x85D1B775A740B310ULL, 0x01EDB79339F4E3E3ULL, 0xA0965BABA9898A5BULL, 0x1A2F13429E7B3280ULL), false},
+    {S256Field(0x93F9714CA8E7BE40ULL, 0xF2D2C89491040EE5ULL, 0x7EE95C1616E4769AULL, 0x6AF9EAED1A96EE67ULL),
+     S256Field(0xFA416E026E387E1CULL, 0x45E3F666A0F59569ULL, 0x6709EA428347DC81ULL, 0xB3812A1169006649ULL), false},
+    {S256Field(0xF5F6400A0D7C0979ULL, 0x4A29B314BC5A8C96ULL, 0x3FA9DF3DFF41CED2ULL, 0x53F2432BA8171714ULL),
+     S256Field(0xF9F7E90C537B36A2ULL, 0x4BD5A4F5C9E8B845ULL, 0xCCD4E3E0911B07DEULL, 0xBD52EFFBC1F079B7ULL), false},
+    {S256Field(0xD26B6FA0F482801EULL, 0x40794F8BC5BD4155ULL, 0xEB3AAB424CB8D6F9ULL, 0x596668EE0444144EULL),
+     S256Field(0xD477148F04870C37ULL, 0x8DB6C1CB63D3535AULL, 0x1EC8F9608771304EULL, 0x949AA0A85BBAEF5FULL), false},
+    {S256Field(0xEF4040A588977063ULL, 0x65BF6F8BFB130C4FULL, 0x61D50F83867E0FDBULL, 0xA762E69E047F9A6FULL),
+     S256Field(0xA06369F8294F6EF1ULL, 0x958B48A396DFCE62ULL, 0x81A1732D93372A89ULL, 0x6B98DD57CBED1157ULL), false},
+    {S256Field(0xE4C9B2E7C32C19FDULL, 0x4ACAB8E9058028C3ULL, 0x2FDF4D17AB570B5BULL, 0xBE84D1881B505076ULL),
+     S256Field(0x67694A5372F1281FULL, 0x7955A7F55E50DC37ULL, 0x4D1E65F483083994ULL, 0xEFF960CB32DC5094ULL), false},
+    {S256Field(0xEBCB0298DF55A9BFULL, 0xF6B015EF29EA5BF8ULL, 0x810307F601D7C578ULL, 0x726298EB9C6E3181ULL),
+     S256Field(0xE116F8B0BC3ACCAEULL, 0xBE797BCBC00673B4ULL, 0xA9835A2EF3D099E0ULL, 0x38D48801A9DE9BFDULL), false},
+    {S256Field(0xBD1B75FD56C69482ULL, 0xCBEAB540132FA167ULL, 0x41F57274CAF2BC88ULL, 0x9867A0314C0D7EE5ULL),
+     S256Field(0x16F061146F792CD7ULL, 0x9E6245CF515628A9ULL, 0x9C792D55B1BA9963ULL, 0xD02E615A3B10834FULL), false},
+    {S256Field(0x9957F2D841A7E7D2ULL, 0xA4C90E8C3EFABD85ULL, 0x693AF7555946DE47ULL, 0xB934130F1339E48AULL),
+     S256Field(0xA4A991A898653D39ULL, 0xFFD381DBE70DCC41ULL, 0xAA0929A5FBF78D1FULL, 0x95233F6B9B2D0576ULL), false},
+    {S256Field(0x78A239D91D557AA1ULL, 0xDF1D92FECD01FC29ULL, 0x5927F2EA0099D6ABULL, 0xA866F24540D8815AULL),
+     S256Field(0x7981BBB4C1430634ULL, 0x61EB69C67C611A4BULL, 0xD793D8FA5DB0E139ULL, 0xB58739F6A8022B44ULL), false},
+    {S256Field(0xBB51340C9D82B151ULL, 0xCCA0A43D561FBA2DULL, 0xD645A1153B109A8FULL, 0xD2A63A50AE401E56ULL),
+     S256Field(0xD4142174DCF89405ULL, 0xA70F750AF484CA52ULL, 0x565AEE58B2948220ULL, 0xE82D86FB6443FCB7ULL), false},
+    {S256Field(0x7C6C4BACCA72DA5FULL, 0x22B9CD6B36C41349ULL, 0x23BC7202033725F9ULL, 0xBAF183A76100525EULL),
+     S256Field(0x377CE628A8F2A0CFULL, 0x8E2336C5CA739361ULL, 0x5688BD58DD69B1D1ULL, 0xDEAC9FBE9CCB4D33ULL), false},
+    {S256Field(0x7859F635EE4B3BA0ULL, 0x5C2ABEF5F18BF1F1ULL, 0xBEFE170F31BF245FULL, 0x41081105221FFB73ULL),
+     S256Field(0x486961DC17525595ULL, 0x1336498565A06455ULL, 0xF2CA65AE1D6B8498ULL, 0xDC37F36976FF5668ULL), false},
+    {S256Field(0xFA5ACA58C56C3943ULL, 0x5ADBD02D56B76A5FULL, 0x8F9332906E48F6FDULL, 0xF7AEF8A7E3844023ULL),
+     S256Field(0x431F627FACF442F1ULL, 0xEEC30184A8DCD003ULL, 0x7C442BBDC3AB3FCFULL, 0x4E3B0B44D5FFDA79ULL), false},
+    {S256Field(0x4629C9B893D98DEDULL, 0xDBDF22833B8A0218ULL, 0xC8CF22990531D65EULL, 0x63A2A210A16CC0C8ULL),
+     S256Field(0x519197D4E0D1CFC2ULL, 0x1FABF6A009C7873AULL, 0xD065033254ED9446ULL, 0x882B42E2E7FEC76FULL), false},
+    {S256Field(0x2089E66A000E5485ULL, 0x4513068BF5DA5DF0ULL, 0x8E2C708627320F12ULL, 0x1CD276D793A2BDFFULL),
+     S256Field(0xCA5CF051885FBD7FULL, 0x99D0E270B209A4ECULL, 0x8D4B34D4552E977FULL, 0x6615BDD18B2EAF73ULL), false},
+    {S256Field(0xEA861A50B8045445ULL, 0x80FF7371901E8D7EULL, 0x3DF12E2E5D57BEF0ULL, 0x0C15815D449D67CAULL),
+     S256Field(0x214F87D54054A206ULL, 0xBA3054E43658CEA3ULL, 0xD0A93C3B6663CD28ULL, 0x2F30D60A3AE94115ULL), false},
+    {S256Field(0x1FAC945711924459ULL, 0x7AF2FA25A3C7A78CULL, 0xC5A2E29F0DDDBB1FULL, 0xDFB547CB10019036ULL),
+     S256Field(0xFA205E0DCC65FD9EULL, 0x22AF0930E5C031DCULL, 0x8B8389CE9DC864CCULL, 0x9ACCD2A9BA0F4708ULL), false},
+    {S256Field(0x1E91239CC3857FAFULL, 0x882FCADE1E961970ULL, 0x0D57BA8F4828EF7FULL, 0xC757EB6B89AE8A9CULL),
+     S256Field(0x01D9DB0CA0584CA4ULL, 0x627D310D101894C1ULL, 0x257369F208BEC61BULL, 0xF03A59CFCD23FF36ULL), false},
+    {S256Field(0x9A8BB3518EF8B517ULL, 0x77C2771A47171BACULL, 0x95DBC8064A115E25ULL, 0x712022F7CCC4DB24ULL),
+     S256Field(0x48B7DF28249DA1ACULL, 0xA3603EDF3BD79D77ULL, 0xAE7101F9B0947541ULL, 0xBD578338DE4DE928ULL), false},
+    {S256Field(0x0E4D184F5459225DULL, 0x44FAF77E2D8858D1ULL, 0xF815D409919C02A2ULL, 0xFA8063AEADAFA0D0ULL),
+     S256Field(0x3A2B7E3B7ECE1507ULL, 0x0A2B6C36D007C59CULL, 0x160DE220824C425CULL, 0x0BA71F9057C0C069ULL), false},
+    {S256Field(0x3C753D59A90BC03EULL, 0x84B0F39351E015E3ULL, 0x9E5A925F74450F80ULL, 0x2CEED8ED2C82072EULL),
+     S256Field(0x1CB72B8B7AB82ADCULL, 0x4A1DF9CF20D53CD0ULL, 0xCD850EB7AFC7DAEBULL, 0xA4276B80E9B9DE3EULL), false},
+    {S256Field(0x9679FE9416F0D044ULL, 0xAABA9FD4909E61A7ULL, 0x9E2F69CF862EE0A5ULL, 0x658CA3C59D0257A8ULL),
+     S256Field(0xADD1F32EF7CB872DULL, 0x55A16763C418CE89ULL, 0x0F165D62713BD376ULL, 0xAE5CC1377AEA2546ULL), false},
+    {S256Field(0x50CD4E3142AA2494ULL, 0x7BDCDDFE7DD10C9AULL, 0xDD1136E7C4EBBC82ULL, 0x379C749A4539E8ECULL),
+     S256Field(0x5BEFA9E8CEC86C63ULL, 0x1364F6A7B7E85643ULL, 0x3C9C0EF1D6783F11ULL, 0xA25463848BF9C031ULL), false},
+    {S256Field(0xAB5AC9573696756DULL, 0x676AF16056561417ULL, 0xCE4C19835D3F305CULL, 0x31C94B4AAF91F2BAULL),
+     S256Field(0xABC45E8DDE08AE78ULL, 0x83AEDFCAE6AD1070ULL, 0xBF4B8B59AAF41606ULL, 0xF80F884B556E83A9ULL), false},
+    {S256Field(0x3436F9B45617E073ULL, 0x6BACBDBD3839317BULL, 0x90EE7896D7CFDC86ULL, 0x64587E2335471EB8ULL),
+     S256Field(0x58299E5E9FAF6589ULL, 0x85B90A39133AEAB3ULL, 0xAE96DD6447C299A1ULL, 0xD99FCDD5BF6902E2ULL), false},
+    {S256Field(0x44BCD88C4384480DULL, 0x94E0B6A22A91F2EFULL, 0x2CF28B54C92F0C12ULL, 0xB866D6B142DF940FULL),
+     S256Field(0x0E659B470C4CAFA8ULL, 0x24E522804B1D86D6ULL, 0x89A278D7EA9AD7ACULL, 0x1914B0B3426AEB70ULL), false},
+    {S256Field(0xADF714720E103DD6ULL, 0xC34604C07C004859ULL, 0x36A213CFC592A17AULL, 0xBC477BD55A4203F8ULL),
+     S256Field(0x639082D8D6F7C343ULL, 0x5D293572C63B44ACULL, 0x6CBAC552C6DEA639ULL, 0xE31E1E2429A8DD52ULL), false},
+    {S256Field(0xD229CDA81DB20D6CULL, 0xE2D52AE4ED4FE455ULL, 0xC4D9D1646102BA87ULL, 0xEC2BB89085DE819EULL),
+     S256Field(0xA0E99C4D629CF4A0ULL, 0x33A2364BE87EFA98ULL, 0x332F66F0650940C6ULL, 0xCCECC17661E013A1ULL), false},
+    {S256Field(0x7D0DC3B0D44EAB31ULL, 0x0AC5AF1404E63490ULL, 0x0303B423267BF8E8ULL, 0x589DB4FE5A6BB838ULL),
+     S256Field(0x941AEBE751361F6AULL, 0x1F610E552148F8DBULL, 0xF607062024BD90F3ULL, 0x6255445C108AA2A4ULL), false},
+    {S256Field(0x92D80B1836695F94ULL, 0x62A169C691627FA5ULL, 0xD0CCB8683AF9A9CFULL, 0xB1D25D51B4558F5FULL),
+     S256Field(0xA5B7EB9A5EE32736ULL, 0x60F6F18DAB863EDCULL, 0xF7BEA0AC19ABA817ULL, 0x706DDA72030E90B1ULL), false},
+    {S256Field(0x7BF961729A0C2C41ULL, 0x42831C1C560336C6ULL, 0xEA8A1860AD6EDB7CULL, 0x1339B337D16E2FA2ULL),
+     S256Field(0x185F054BA9F1BC2BULL, 0x6B1227F87DE923A4ULL, 0xA7A3240FD113A340ULL, 0x9F9B296362C7AE5BULL), false},
+    {S256Field(0x38A60ECB23B09D0FULL, 0xE50050640F50BECFULL, 0xD39D75EF5E545905ULL, 0x71C4A7E389E296CEULL),
+     S256Field(0x637B1F01720DDB62ULL, 0x786F2B084A62FFC7ULL, 0x0AF3E0A292F810AAULL, 0x1313FADB737AF3BAULL), false},
+    {S256Field(0x3704B1F858FC47AFULL, 0xA8DDFEC832C0CDECULL, 0xCC50329B5001B568ULL, 0x7FF3BBA11363CF17ULL),
+     S256Field(0x7F86164CF9BA43A7ULL, 0x17A53B1AD18BAC29ULL, 0xA0BC891B7473446BULL, 0x1F6BA7AE8018A629ULL), false},
+    {S256Field(0xD1DC4CBA9E41E20EULL, 0x38A87A3D78D33864ULL, 0xBCB0F7F003A4D3E9ULL, 0xFC395DC4A5114DC8ULL),
+     S256Field(0x77AD8CC2E7CF42EEULL, 0x0221475A685E4E2BULL, 0x4CEB81A98BDDB6D6ULL, 0x3866E09108D07D09ULL), false},
+    {S256Field(0x0184D60095213775ULL, 0x00B4293B23D42A99ULL, 0x6141E9395FEC7F61ULL, 0x8EC670463CEB60BBULL),
+     S256Field(0x0E010F3E7841FFFFULL, 0x71DA98A0BCCF51E9ULL, 0x06E643415CEDEE0EULL, 0x8F58A66FA0DA5BE3ULL), false},
+    {S256Field(0x49971018B6F83231ULL, 0xB7C30D8E760425E3ULL, 0xA8D1582765B3FDD0ULL, 0x850F8CC53502BA26ULL),
+     S256Field(0x4A031A9D5F2E8373ULL, 0x0A85BFA17722D77FULL, 0xD0BF7086B82CC789ULL, 0xBC4A9DBE02A79053ULL), false},
+    {S256Field(0x3CB3FF8D3452ABBBULL, 0xAE6AA72FE2B95C2EULL, 0x89DBAC3FED95D495ULL, 0x83DE61B441E701BBULL),
+     S256Field(0x8A05176B054EB66EULL, 0xD79C5F36BBCE4291ULL, 0xA6BFB6AF8C4E1563ULL, 0x32F0E334A34C609FULL), false},
+    {S256Field(0x88B11064DF2E6FFAULL, 0x46BE9F37B7155763ULL, 0x1445BB6A94750D46ULL, 0x53FE8AF98F9419FBULL),
+     S256Field(0x2A1EB37264E92EB5ULL, 0x5FB5F8E603BD70C2ULL, 0x1640CF6C4464DE5CULL, 0x9328817E7B515462ULL), false},
+    {S256Field(0xE9688C26F59276F1ULL, 0x33AE25B292A17B15ULL, 0x1A8BB5C00F7CD868ULL, 0x3D7663898F50C1DBULL),
+     S256Field(0x01E4A65B859CBCB3ULL, 0xF321982019B19786ULL, 0x60976E34DAD8333EULL, 0xD37669737A187DDBULL), false},
+    {S256Field(0x358D6C86DD45E458ULL, 0x2F0AA6CEA250E7FDULL, 0xB3A546D3E549DE04ULL, 0x8481BDE0E4E4D885ULL),
+     S256Field(0x6D64B1B59779057EULL, 0x900A79C42B262E55ULL, 0x84A25BF39CECB2CAULL, 0x38EE7B8CBA5404DDULL), false},
+    {S256Field(0xE54433526CE9F114ULL, 0x392ED605299561DDULL, 0x9FD43C6CD1D492BFULL, 0x9629A450BD383A8BULL),
+     S256Field(0xCA3972C4A24AA391ULL, 0xB925593E5C56AF8DULL, 0x576BEFD220CEF64DULL, 0xBF439B280C5FB6D7ULL), false},
+    {S256Field(0x160A0FA4152DA17DULL, 0x11DC13DB08D0646BULL, 0x0894E6B05FE00BC8ULL, 0x3BEAED1E0F518C5FULL),
+     S256Field(0xCE704985ECC768D2ULL, 0x54CDE77B8DFEC416ULL, 0xFEF4A8BEBE80E1B5ULL, 0xC3B0D7F55AFF7ACDULL), false},
+    {S256Field(0x83D38D9626CA6CC3ULL, 0x1477D747E187E183ULL, 0xEB1730DA7CC893DFULL, 0xB73B1C47EF1E4688ULL),
+     S256Field(0xFAC35D76A54FDBA3ULL, 0x7322A25209757F5AULL, 0x0A57D64BBCC80509ULL, 0x584315CB294922A9ULL), false},
+    {S256Field(0x234FA17DBA4EDCC5ULL, 0xE74E3221420311B7ULL, 0x8752DFC039275997ULL, 0x6E73DBA0CBDC9D61ULL),
+     S256Field(0x7B31F7CDD59DA0E4ULL, 0x278A77DA70067903ULL, 0xBEA4550888828693ULL, 0xEE0AC1FC49EECC48ULL), false},
+    {S256Field(0xC1B9AD04D063E1BEULL, 0xA92429A2F7E39A75ULL, 0x722615253DBCF027ULL, 0x131641D11D602B14ULL),
+     S256Field(0xFDD1FF3E21FEC890ULL, 0xBD0FAEC0F9745B77ULL, 0x6A42E30FCDBD2BEBULL, 0x4C3BDA61796039F0ULL), false},
+    {S256Field(0x409C4C424A80B979ULL, 0x0490F5FA329ABB31ULL, 0x7627D97EAA47C310ULL, 0x7706DD8937E5B592ULL),
+     S256Field(0x14CF48104126CFDEULL, 0x17FA0A34FD7EFE32ULL, 0x7778DD7991EA9C71ULL, 0x8A02A9827D5BB714ULL), false},
+    {S256Field(0x9C6E2192D38F93E0ULL, 0xD05B2A3BB676899FULL, 0x11F9892007A2FEF7ULL, 0xEDFE16B2DB401803ULL),
+     S256Field(0x3D01793DE29405ADULL, 0x5B3D5100C46E227EULL, 0x94D74FAA4B05D0D2ULL, 0xEE6902F1FCA5DB36ULL), false},
+    {S256Field(0xDCDB9C4B726FE285ULL, 0xA45BAC29413EF127ULL, 0x0D2F3C7A41F9E06AULL, 0x16D422C5929BC0F8ULL),
+     S256Field(0x33E0FFE6C155B441ULL, 0xE93F0C1137364D42ULL, 0xA8AB7E69A63531B1ULL, 0x0DF888FA51E22641ULL), false},
+    {S256Field(0x5D3132B869E306A5ULL, 0xB8B5F624C4C247F1ULL, 0x4927129B35F2E5C6ULL, 0x972CB363F9F30C33ULL),
+     S256Field(0xD061FD40B6E86295ULL, 0xB85702EDCCAD4F35ULL, 0x5F9E77FE5BC65079ULL, 0xAE634704E2DF92AAULL), false},
+    {S256Field(0xAE310BCABACFA513ULL, 0x4E24079F9A60E3AEULL, 0xAA5A344750F56A9CULL, 0x1FCC0E47EEC76D63ULL),
+     S256Field(0x75075BA4107AFC9CULL, 0x4BEDEDD164983918ULL, 0xB48E38754339F9B4ULL, 0x165DC1A041E35478ULL), false},
+    {S256Field(0xD12A03527C46E079ULL, 0xAB66930B85E9C78DULL, 0x0FEF75ADB02BA374ULL, 0xAB86C2AD2ACFAC53ULL),
+     S256Field(0xEC428BC17636FFE1ULL, 0xCE7728E84850D7C0ULL, 0xCF5C46D4D73200C9ULL, 0x1209C286019F29ABULL), false},
+    {S256Field(0x21A2707CFEDC69B2ULL, 0xA50A6089B26B7717ULL, 0x7306430435CAA386ULL, 0xC12B9073AD6CB8A1ULL),
+     S256Field(0x032AE9B020DD41DDULL, 0xB8EE1DBE3D27B2A0ULL, 0xD9772DC89F894976ULL, 0x3173C43FE534CDF1ULL), false},
+    {S256Field(0xD3EC7BCE9E341142ULL, 0x7AE684EB76472760ULL, 0x1BA1BD2179A11668ULL, 0xC6701C110C2DA3B0ULL),
+     S256Field(0x8924C6159E0F4DADULL, 0x5D07FCBA5BC9BE57ULL, 0x52F869BBDE19F5A1ULL, 0x2A020EB38D6CDD99ULL), false},
+    {S256Field(0xAB6F585DF961FE4DULL, 0x8A14886F8B107197ULL, 0xA3F3E931312CA73EULL, 0xD059BF85DC327A8FULL),
+     S256Field(0xB9935B066AE823C2ULL, 0xFD388BA1F4DAB64CULL, 0x3FE0765DC84955B4ULL, 0x45107A60C08B525EULL), false},
+    {S256Field(0xBCD6303F6CAF666BULL, 0x7FFCFED3C4B1CE30ULL, 0x62B6979AE817F463ULL, 0x13464A57A78102AAULL),
+     S256Field(0x3F495A907F6ECC27ULL, 0x48F300A81D0942E1ULL, 0xEF7E433453CCB0CAULL, 0x69BE159004614580ULL), false},
+    {S256Field(0xC75849C6065084AEULL, 0x9182BE7DCEABE577ULL, 0xEC05C88C85FE12D1ULL, 0xEB3CF8F532245362ULL),
+     S256Field(0x6F67C1FFF96B9480ULL, 0xF52B45C5E7DBD2A6ULL, 0x43FE63DCEFDCA4A1ULL, 0xC833C78222D9D700ULL), false},
+    {S256Field(0xF216B2098ECA5F51ULL, 0xDDEA171B94FC9AEBULL, 0x2C6ED6B2BF05B5CFULL, 0xDDE9D514DD9EE696ULL),
+     S256Field(0x9AD69A73D0C638F7ULL, 0x50FEEBE8DE89571FULL, 0xD891F34B0A7F8F09ULL, 0xB84E69133CE28111ULL), false},
+    {S256Field(0xF8E5BCBCC2E9A5D0ULL, 0xA576FCF984A201D9ULL, 0x4F7A60F2184519B2ULL, 0xBDF1A67D092D9997ULL),
+     S256Field(0xCDB4F7018562FF7BULL, 0xA6280B61E5626461ULL, 0xA80BE54A86BF7BAAULL, 0x4095902BAB65A1AAULL), false},
+    {S256Field(0x2F906B05999C88E4ULL, 0x9AED513E20AD46ECULL, 0x6E9F406EB1204B17ULL, 0xFD1A621023699373ULL),
+     S256Field(0x99C8C916595BC8DFULL, 0xDC6B71D495CC00F2ULL, 0xFB13C06954977782ULL, 0x1AC97B54B9C8C20BULL), false},
+    {S256Field(0x1CCC6A55A09B0CCAULL, 0xA345758924A4D6F0ULL, 0xD5C454F68A28DA59ULL, 0x0D538CB1DBB0F4C8ULL),
+     S256Field(0x731B147E0C929E05ULL, 0x8534CD99D89134C9ULL, 0xCB0A8D5C40EED7CFULL, 0xC8196BAC7A3EC110ULL), false},
+    {S256Field(0xBD515B5B5F8018CEULL, 0xCF2DA5738D892D68ULL, 0xF13FFCE4F2C86DC7ULL, 0x4EE48531D8C296B9ULL),
+     S256Field(0x3C35A61B1E48381FULL, 0x71074971B4E80601ULL, 0xFC7B4408D0C7C5E6ULL, 0xB68F9ED4810BF8B5ULL), false},
+    {S256Field(0xBDE5FC173B27E771ULL, 0x8C3B4196477DA62AULL, 0xCD5BE267B64483B4ULL, 0x68856A6EDDC4EC29ULL),
+     S256Field(0x6118D62A07BBDAB6ULL, 0x331D22F293B0733AULL, 0x13B6FD49C19F7B4AULL, 0x77A33DF14F79A1FBULL), false},
+    {S256Field(0x02852E91F1473678ULL, 0xCBA05795094392F7ULL, 0xFF5E314C55B8C070ULL, 0xFD76CC9C34C400DBULL),
+     S256Field(0x7E164EEA8D144F4FULL, 0x60628EEE1401C843ULL, 0xE0FEE0A73D032CD6ULL, 0xF2046543787143DAULL), false},
+    {S256Field(0xB5F00532CEE66B24ULL, 0xE8B9C60FED7B8366ULL, 0x80E44D99BF1ADED2ULL, 0x4CD5D8CFB9E9C7B8ULL),
+     S256Field(0x221EFDBAF40932FDULL, 0xCA61E45E12D2FAEDULL, 0x9FE4E8C39CD6D103ULL, 0x576EAE82DEB94B55ULL), false},
+    {S256Field(0xDF00B7148D7A2193ULL, 0x2C691E44F197546EULL, 0x19E6CE8274B4EA21ULL, 0x85A2ABA33123B402ULL),
+     S256Field(0x7F0C83D4B0CDCF3AULL, 0xE1C6DADF9C3B1242ULL, 0xD82C6082D1CC029FULL, 0x9C129857EB2B0516ULL), false},
+    {S256Field(0x6AE303CEEDD7E577ULL, 0xD3A0F2568536C4D5ULL, 0x5AC6047270EA2107ULL, 0xC352D50F8828F7B2ULL),
+     S256Field(0x3CA4FF88F8D9B570ULL, 0x00A8ABB2B6121706ULL, 0x6ABD53145BCE79FBULL, 0xBE772838BA76B9B9ULL), false},
+    {S256Field(0x35B0305B377568B0ULL, 0x35AE8DD019E03B05ULL, 0x440B6D6C5783650FULL, 0xD25DDBFC73CFFE74ULL),
+     S256Field(0x60A13926DF39929CULL, 0x832273881E3C3F00ULL, 0x8BEAEF74CDE7D92BULL, 0x7A3AFF7593F84893ULL), false},
+    {S256Field(0xA33563E81E712536ULL, 0xA85051F56FF5FE71ULL, 0xE086DE71AB635E9EULL, 0x06914E86B0A43A9FULL),
+     S256Field(0x2A247713801128F1ULL, 0x896C226B0AF7A9DAULL, 0x27D8ACEAE5AC28C0ULL, 0x2B7E792852D9BD05ULL), false},
+    {S256Field(0x55FE5118A71D7C13ULL, 0x641AB5F7FA0FFA38ULL, 0x55F07E9A97AAC805ULL, 0x4581353143E94A72ULL),
+     S256Field(0x9638BC553AFF63CFULL, 0x7020065542BD96B9ULL, 0xB57F50F177DD69C9ULL, 0x9F5858EC14979AD8ULL), false},
+    {S256Field(0xCADA3A0D2D83F366ULL, 0x0CD9CCEDE2F28588ULL, 0x9AEF430BCC1DC97AULL, 0xBC4A9DF5B713FE2EULL),
+     S256Field(0xD758D666581F33C1ULL, 0xA6E8A9FBFA547B16ULL, 0x383937ADF4B798CAULL, 0x0D3A81CA6E785C06ULL), false},
+    {S256Field(0x282DE545F3FCEB19ULL, 0x2E89B221F785C409ULL, 0xABC5C7626CE7BAB4ULL, 0xDA433D5E11CECCC0ULL),
+     S256Field(0x684E7120A6F5CC64ULL, 0x8E77FC2D9227B277ULL, 0x1DEBBDC4AF95E521ULL, 0xE498DBD321A81030ULL), false},
+    {S256Field(0xB06A2E32F712BE3CULL, 0x7295F18EDA146A66ULL, 0xD3C725DBAB001534ULL, 0x39D7349D9331B378ULL),
+     S256Field(0xCC3019F41C6FF65CULL, 0xEF5EF7A5ECA41644ULL, 0xFB127554C66812E8ULL, 0x8F929B4F56EF3BF7ULL), false},
+    {S256Field(0x54DE275C5ACF692AULL, 0xBCC4838A72207E06ULL, 0x1C1C116981C16EFDULL, 0x031E8E1EE9E8C7ECULL),
+     S256Field(0x9CC2A84EB16F667AULL, 0x70649827C5BF73B0ULL, 0xD9D0970290D6743BULL, 0xAD7E7F5B465B353DULL), false},
+    {S256Field(0x5AAE4FBCDF77F22BULL, 0xC699723994F82E03ULL, 0x9E51CD6C2995AF26ULL, 0xF0CBA617F7DC1DD0ULL),
+     S256Field(0x1FC8E2C75909A03CULL, 0x04F18C7E90A09566ULL, 0x9EF326C36516D040ULL, 0x1A25AB4313F9DF98ULL), false},
+    {S256Field(0xDEC0AA4A77829372ULL, 0xC49B300C88BA4553ULL, 0x313626AE5385796BULL, 0xB4319CC90F3E0D3BULL),
+     S256Field(0x7729CCC00ADD5427ULL, 0x707B1215CA3E11BBULL, 0xFFB7AFE09C21C5A2ULL, 0x4707D4499A6F502BULL), false},
+    {S256Field(0x58ACDCD4C6509C12ULL, 0x8D6BFE235BD1F476ULL, 0x21D170E8D87268EDULL, 0x381D7AB9DB2154D3ULL),
+     S256Field(0x54642A8E2EB46102ULL, 0x205828586CE6EAF7ULL, 0xEB5D24573A6581E7ULL, 0xA47AAB5B7FDA3DA9ULL), false},
+    {S256Field(0x92BBD7FF81F488B6ULL, 0xE9C9BF363FC7A915ULL, 0x5D3E00D862657F73ULL, 0xA9878607A88D6115ULL),
+     S256Field(0x495A7BBB031DAB1DULL, 0x39D0F01964AD5C6DULL, 0x1C063E7C82157C22ULL, 0xD181A1ABD58895D6ULL), false},
+    {S256Field(0x8DB3B4D6384FE955ULL, 0xF69956A5A063BCE4ULL, 0x4793B73E694C8A53ULL, 0xA703F05467AB87E6ULL),
+     S256Field(0xA26B2EFBD61344BDULL, 0x539E1629C597277FULL, 0xC0EA792D6B19199BULL, 0xD500F935A2B047ADULL), false},
+    {S256Field(0xE64093B6C38A8CC6ULL, 0xBA2E121E9F69F8FBULL, 0x48E279FF6ED7F3DCULL, 0x331924C750B3417EULL),
+     S256Field(0xC4E8E0FB46587810ULL, 0x7FB99E9ACE9E9B54ULL, 0x2BA5B601BE2FFB31ULL, 0xCA8F79411B33F018ULL), false},
+    {S256Field(0x3499656C06EACE58ULL, 0x1B7E4563A2F3211DULL, 0x46C6AD0D7053A03FULL, 0x73C6B3C5AAD550D7ULL),
+     S256Field(0x7170A9172AF8654EULL, 0xAA6A878DBBB8D291ULL, 0x1BA90991366D91C6ULL, 0x3A2FB4A4733A4F74ULL), false},
+    {S256Field(0xF4BF1126CDCBCB9EULL, 0xD6FA5689DCD83C3DULL, 0x9ECC32447FD43761ULL, 0xCDCB12D7119D337AULL),
+     S256Field(0xA08A585AC961CFD1ULL, 0xA199AF24358DF340ULL, 0xBFEFBEA096DE9949ULL, 0xE699E2E17BB9F11FULL), false},
+    {S256Field(0x54B388BF00181D5EULL, 0xDE71B3A9B95AAF20ULL, 0xA1D00D3A1C0EDDB8ULL, 0xC627F3E7506D47FDULL),
+     S256Field(0x927900A6369F886DULL, 0x8EF6B00549CBE2C3ULL, 0xB2D6960138A1F7D6ULL, 0xD78F9DD71E442A63ULL), false},
+    {S256Field(0x1D747CF7325FE9CCULL, 0xFBB883BB349D88DBULL, 0x3704110842D4AC23ULL, 0xC6ED5E6328EC31B1ULL),
+     S256Field(0x0C0BCE1C4A8FD94BULL, 0x844F972B60F22CF1ULL, 0x2932EE125C7F7B2AULL, 0xDE47405B49D7F830ULL), false},
+    {S256Field(0x34E28D9FB7828B16ULL, 0xA047958F28A4847FULL, 0xFA25F40A6F06DE53ULL, 0xBB88FABE0EDFD233ULL),
+     S256Field(0xC51473A20AEA5DF7ULL, 0xEC4A8174E3A1E969ULL, 0x345DC59601159163ULL, 0xB73676B304F5E8DDULL), false},
+    {S256Field(0x954AB30FE5324CAAULL, 0x694B65E30A9472A3ULL, 0xD23D8C749452A32EULL, 0x8C28A97BF8298BC0ULL),
+     S256Field(0x9E71DC73CBEF9482ULL, 0x7AE784F0451CB945ULL, 0x378FEDF31F7CC0EBULL, 0x40A30463A3305193ULL), false},
+    {S256Field(0x5DFB201F7611D8E2ULL, 0xC8130FE8DE49FC4DULL, 0x96BED5A6047F0DA2ULL, 0xAB1AC1872A38A2F1ULL),
+     S256Field(0x01A581F3C429D15BULL, 0xF7EF93D33E1E545FULL, 0xE9AA5F39DB6A42B6ULL, 0x13F4A37A324D17A1ULL), false},
+    {S256Field(0x863E87154754DD40ULL, 0xA2422631FC3466CFULL, 0x45B4841FCD72F6E9ULL, 0x9729247032C0DFCFULL),
+     S256Field(0x384B492F2AA36143ULL, 0x90DAE85255ACAF49ULL, 0xCD15C75DCBD4DF36ULL, 0x91D1A244265FEA1DULL), false},
+    {S256Field(0x226AEE642651B3FAULL, 0x8EA1B365772DF434ULL, 0x3703A607253F31EFULL, 0x2564FE9B5BEEF82DULL),
+     S256Field(0xDB82E6A301E5122DULL, 0x14F37DAB6B79816EULL, 0x95FA14AE1203925FULL, 0x8AD9F7A606783890ULL), false},
+    {S256Field(0x3C2D82EB8C2CA7FFULL, 0x1803645D95DF021AULL, 0x050791AD5A2F27AFULL, 0x89637F97580A796EULL),
+     S256Field(0xBED415E170493E68ULL, 0xF87BC6A38E42EAB7ULL, 0xD57B9CF154357489ULL, 0x2D1FE1248C888424ULL), false},
+    {S256Field(0x057C35330C7A89EEULL, 0x4BDBC59C7AB6D4F8ULL, 0x12860B88FC98658AULL, 0x71EFA4E26A4179E1ULL),
+     S256Field(0x4F489329C1366A2EULL, 0x2AAAFAB88E5E9A0BULL, 0x9EFB2C32B17294A2ULL, 0x145FA81F8BB624AEULL), false},
+    {S256Field(0x6186D63A0CA8DD7FULL, 0x1BC7280356A1381AULL, 0x2FDC9DA03D535742ULL, 0x308138E71BE25E09ULL),
+     S256Field(0xE415F2478A92C7F2ULL, 0xC8165646434AD915ULL, 0x5E39EC45D1408E18ULL, 0x28D1E2D28828FC92ULL), false},
+    {S256Field(0xB178E3D3AE180068ULL, 0x7EA3D56C20BD3103ULL, 0xBFC6C5C0C30DC01AULL, 0xFF3D6136FFAC5B0CULL),
+     S256Field(0x70A6BB6E188C6077ULL, 0x547676F24001F5E6ULL, 0x40D0372CDD96ADC1ULL, 0x133239BE84E4000EULL), false},
+    {S256Field(0xC0DCC568866A3FB1ULL, 0x6EC009281992E206ULL, 0xD1E5750C85B6862FULL, 0x575FC4E82A6DEB65ULL),
+     S256Field(0x09B8E90A902655ADULL, 0xED33B573C6A3AF2FULL, 0xD671DBC2978E87DAULL, 0x6F6EDB9042A6FCA2ULL), false},
+    {S256Field(0x954E7FDCBD21250AULL, 0xDF45E17583998AD4ULL, 0x531E342BA43555E7ULL, 0x3FA915480BAB8AD2ULL),
+     S256Field(0x91C86C02FAA76731ULL, 0x2E45E55A032B5FB7ULL, 0xCF5BDF9603BB127CULL, 0xBF9B66905499B030ULL), false},
+    {S256Field(0x21B6A8A4790117DFULL, 0xDA253BBBCE201029ULL, 0x227F26F81EEA2A8FULL, 0xA5EC9036B64EAB7AULL),
+     S256Field(0xD8128133F86462FEULL, 0x1C8461F05614A363ULL, 0x0C597983AD1FA0F7ULL, 0xB79DC6625EC14040ULL), false},
+    {S256Field(0x5CB023498DE0545FULL, 0x80E625DA2106C74FULL, 0xA375EA004B3508ACULL, 0x52045BCC58E07124ULL),
+     S256Field(0x36EA34C0506C3D91ULL, 0x793B9D0F2A8FDAF2ULL, 0xD430ED9C20CE312BULL, 0x1B3F31FCEBE3123AULL), false},
+    {S256Field(0x0B0F975C172AD712ULL, 0x5A398CB0DE104729ULL, 0x49DE7976146349B9ULL, 0xA153DFE913310B09ULL),
+     S256Field(0xC8A5F6538D48FDD2ULL, 0xBD053F285AF0B329ULL, 0xC48318D5F1F1B89AULL, 0xFD94D8413FB05B2FULL), false},
+    {S256Field(0x89F13D0C3220479FULL, 0x5DE47B95E5E5B38AULL, 0x80162C8D23760363ULL, 0x58B5436EBE472FDBULL),
+     S256Field(0x44A7375E567DB17AULL, 0x96AF27C4829BB341ULL, 0x4E2913A252F6DE83ULL, 0x85D7B6B055CD672CULL), false},
+    {S256Field(0x030C370111CF5B3AULL, 0xC4433A83BDB5A781ULL, 0x935C34D088EDC824ULL, 0x9A541AC6AF794615ULL),
+     S256Field(0x63F5575F36A44AE4ULL, 0x5548FEE2521EA52DULL, 0xCAFE1AF3688F475FULL, 0xB66148C1CB106AB7ULL), false},
+    {S256Field(0x48C4BA111FACCAE0ULL, 0x3C8B350C5A4BB337ULL, 0xC1DD94CE4F071FD2ULL, 0x08EA9666139527A8ULL),
+     S256Field(0x55AF34A30E62B945ULL, 0x35B783BE9CF0F8E9ULL, 0xE24E7C0CFB95C5D7ULL, 0x620EFABBC8EE2782ULL), false},
+    {S256Field(0xA293131DA190B632ULL, 0x63CF2A23A4AB5AB9ULL, 0xF3A66DF315559D82ULL, 0xC25F637176220CD9ULL),
+     S256Field(0x6EEBF3D6FC9590CFULL, 0x0A9F04FF9E027A1DULL, 0x989049903809D798ULL, 0x53154FEDE94D2873ULL), false},
+    {S256Field(0x21A40B5966A06F5EULL, 0xA34192516EA08370ULL, 0xC37B0D421263B716ULL, 0x383B24FBEA14253AULL),
+     S256Field(0x089F4786D3C6E772ULL, 0xE8F6AE74BB8C2B04ULL, 0x44CF566D54EA5A19ULL, 0x54CF706AC4EDBA20ULL), false},
+    {S256Field(0xE2CCB3B7D466D561ULL, 0x0C7B55DC31978B4DULL, 0x3E82D82A5688544CULL, 0x2A9E8DFE3CCE6BABULL),
+     S256Field(0xF96CCF5252E76373ULL, 0x5E01EAEC17A02182ULL, 0xBAC7B5AD608B96CFULL, 0x01DFEDA5C16E651FULL), false},
+    {S256Field(0xC7975C1D4638A136ULL, 0x2B0D1CE336838195ULL, 0x789E59C6B60D790CULL, 0xE68432D03E02ED6DULL),
+     S256Field(0xAAFD18108C6C2584ULL, 0x2E09E3EBDB357336ULL, 0x24D2A7303A01E647ULL, 0xCA5BE41398E35A66ULL), false},
+    {S256Field(0x2139B408DBCF2DCEULL, 0x68114A105C1DC6C0ULL, 0xBD49E4C992FF9980ULL, 0x95E62D4292E46218ULL),
+     S256Field(0x62BDDFDF58C86594ULL, 0x5E7B30603704D20EULL, 0x183A26E2B428D52EULL, 0x06B68184296C2875ULL), false},
+    {S256Field(0x7CE87C4416E8C10CULL, 0xB472985F391BD680ULL, 0x0EEFBDECE7306E7FULL, 0x395DD559E2FE5C2AULL),
+     S256Field(0xBC3D6D9305FE638EULL, 0x4C909C04DC66922CULL, 0xD0413E87AFFA4E27ULL, 0xFD62DCD4B4592AC5ULL), false},
+    {S256Field(0xE8BD32043F8BE384ULL, 0x71EC0AADA31DB6C3ULL, 0x251AD6C94FDEF072ULL, 0xB23790A42BE63E1BULL),
+     S256Field(0xD10A473DEB19880EULL, 0x17F004F4149ECB58ULL, 0xE8D50F88AA81F945ULL, 0xFC6B694919D55EDBULL), false},
+    {S256Field(0x51664DB20D6C14EFULL, 0x0858FC7506F93C8FULL, 0x9F6EED5BEEE26480ULL, 0x7A514ADC35525DCBULL),
+     S256Field(0x7AD3E1870B3FBD13ULL, 0x29BEAEF72AA6E24FULL, 0xE897F0B94C8F5C37ULL, 0x56EDD1FED152E4D8ULL), false},
+    {S256Field(0xFF9F053D097EC94BULL, 0x27ED7091C8D59C2DULL, 0x1EE215AA8AE68181ULL, 0xB2113BCB7B4AEFEDULL),
+     S256Field(0xBD5FBFFC687831ADULL, 0x0943220B2357D0FDULL, 0x105A0B53454CB4EBULL, 0x93BE9E7399E8EE73ULL), false},
+    {S256Field(0x4A9463D04F6D65EBULL, 0x5A99107754402152ULL, 0x8EA8EF3BF4908F23ULL, 0x1EE1FD584325D90DULL),
+     S256Field(0x1E036B925D22941CULL, 0xCA32F4E9863582B1ULL, 0x1CFAB9FC4F42FCFAULL, 0xBB692891BDD6C73CULL), false},
+    {S256Field(0xB805264597A6257FULL, 0x1873C3B1A27A6C40ULL, 0xA6424274AB07E789ULL, 0x71E935C8E1F54F25ULL),
+     S256Field(0x5B217461D1B1E582ULL, 0xEF2523540CF70F7AULL, 0x3DED86BA47AE2A52ULL, 0x78D93E59F47C2251ULL), false},
+    {S256Field(0x1F1950EF0E36CB44ULL, 0x617E8B6C8DCA2019ULL, 0xBC058FD0D883357DULL, 0x15515634D38FAAA8ULL),
+     S256Field(0x329AF4651F495A68ULL, 0xA8C37175F020C1E5ULL, 0xE370E3F0B463205DULL, 0xAB4FFFC755575215ULL), false},
+    {S256Field(0xBF08472479CA950EULL, 0x39E015762BB13BACULL, 0xC52F8BE79EE2C461ULL, 0xABC451CA4EE795CAULL),
+     S256Field(0x07CE7D8C9A9490D2ULL, 0x52684000CEA553ECULL, 0xDB1DFB80C2C91456ULL, 0xAE2718BEFE820A59ULL), false},
+    {S256Field(0x51F946107427BACCULL, 0x9E733164DD2D62E1ULL, 0x36358EB0958DC4AAULL, 0x3BC6BC6446BF5201ULL),
+     S256Field(0x14C33FD5EAD6FDA6ULL, 0xD71B75A5228BEB47ULL, 0xCDB62EE226D6C02BULL, 0x8E305CC07176C305ULL), false}
+};
+
+constexpr S256AffineCoords S256_GENERATOR_ODD_MULTIPLES[S256_GENERATOR_ODD_MULTIPLES_SIZE] = {
+    {S256Field(0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL, 0x79BE667EF9DCBBACULL),
+     S256Field(0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL), false},
+    {S256Field(0x8601F113BCE036F9ULL, 0xB531C845836F99B0ULL, 0x49344F85F89D5229ULL, 0xF9308A019258C310ULL),
+     S256Field(0x6CB9FD7584B8E672ULL, 0x6500A99934C2231BULL, 0x0FE337E62A37F356ULL, 0x388F7B0F632DE814ULL), false},
+    {S256Field(0xCBA8D569B240EFE4ULL, 0xE88B84BDDC619AB7ULL, 0x55B4A7250A5C5128ULL, 0x2F8BDE4D1A072093ULL),
+     S256Field(0xDCA87D3AA6AC62D6ULL, 0xF788271BAB0D6840ULL, 0xD4DBA9DDA6C9C426ULL, 0xD8AC222636E5E3D6ULL), false},
+    {S256Field(0xE92BDDEDCAC4F9BCULL, 0x3D419B7E0330E39CULL, 0xA398F365F2EA7A0EULL, 0x5CBDF0646E5DB4EAULL),
+     S256Field(0xA5082628087264DAULL, 0xA813D0B813FDE7B5ULL, 0xA3178D6D861A54DBULL, 0x6AEBCA40BA255960ULL), false},
+    {S256Field(0xC35F110DFC27CCBEULL, 0xE09796974C57E714ULL, 0x09AD178A9F559ABDULL, 0xACD484E2F0C7F653ULL),
+     S256Field(0x05CC262AC64F9C37ULL, 0xADD888A4375F8E0FULL, 0x64380971763B61E9ULL, 0xCC338921B0A7D9FDULL), false},
+    {S256Field(0xBBEC17895DA008CBULL, 0x5649980BE5C17891ULL, 0x5EF4246B70C65AACULL, 0x774AE7F858A9411EULL),
+     S256Field(0x301D74C9C953C61BULL, 0x372DB1E2DFF9D6A8ULL, 0x0243DD56D7B7B365ULL, 0xD984A032EB6B5E19ULL), false},
+    {S256Field(0xDEEDDF8F19405AA8ULL, 0xB075FBC6610E58CDULL, 0xC7D1D205C3748651ULL, 0xF28773C2D975288BULL),
+     S256Field(0x29B5CB52DB03ED81ULL, 0x3A1A06DA521FA91FULL, 0x758212EB65CDAF47ULL, 0x0AB0902E8D880A89ULL), false},
+    {S256Field(0x44ADBCF8E27E080EULL, 0x31E5946F3C85F79EULL, 0x5A465AE3095FF411ULL, 0xD7924D4F7D43EA96ULL),
+     S256Field(0xC504DC9FF6A26B58ULL, 0xEA40AF2BD896D3A5ULL, 0x83842EC228CC6DEFULL, 0x581E2872A86C72A6ULL), false},
+    {S256Field(0x66E4FAA04A2D4A34ULL, 0xEB9898AE79B97687ULL, 0xA420FEE807EACF21ULL, 0xDEFDEA4CDB677750ULL),
+     S256Field(0xCFB199F69E56EB77ULL, 0xCED1F4A04A95C0F6ULL, 0xE997B0EAD2A93DAEULL, 0x4211AB0694635168ULL), false},
+    {S256Field(0x7475656138385B6CULL, 0xF06ACFEBD7E86D27ULL, 0x93EF5CFF444F4979ULL, 0x2B4EA0A797A443D2ULL),
+     S256Field(0xB570C854E5C09B7AULL, 0x1A01F60C50269763ULL, 0xB343083B5A1C8613ULL, 0x85E89BC037945D93ULL), false},
+    {S256Field(0x81340AEF25BE59D5ULL, 0x1D9AD40271F81071ULL, 0x4F93FA332CE33330ULL, 0x352BBF4A4CDD1256ULL),
+     S256Field(0x67BD3D8BCF81998CULL, 0x4A1B3B2E71B1039CULL, 0xD59C18259DDA3E1FULL, 0x321EB4075348F534ULL), false},
+    {S256Field(0xDC9CDADD4ECACC3FULL, 0xE42AB8DFEFF5FF29ULL, 0x0230010559879124ULL, 0x2FA2104D6B38D11BULL),
+     S256Field(0x423BA76B532B7D67ULL, 0x181D70ECFC882648ULL, 0xB64569335BD5DD80ULL, 0x02DE1068295DD865ULL), false},
+    {S256Field(0x69CA0CD7F5453714ULL, 0x263C3D84E09572E2ULL, 0xAB21A9B066EDDA83ULL, 0x9248279B09B4D68DULL),
+     S256Field(0xE54A32CE97CB3402ULL, 0x3FC0DE2A887912FFULL, 0x5D1AA71BDEA2B1FFULL, 0x73016F7BF234AADEULL), false},
+    {S256Field(0x7E996D443DEE8729ULL, 0x2F570E144BF615C0ULL, 0x8E70132FB0BEB752ULL, 0xDAED4F2BE3A8BF27ULL),
+     S256Field(0xAB40E52290BE1C55ULL, 0x3F83C230F3AFA726ULL, 0xD4A1ACA87EF8D700ULL, 0xA69DCE4A7D6C98E8ULL), false},
+    {S256Field(0xE6A3B5E87D22E7DBULL, 0x11ECD9E9FDF281B0ULL, 0x8ACF28D7CBB19F90ULL, 0xC44D12C7065D812EULL),
+     S256Field(0xA039063F0E0E6482ULL, 0x0E106E861EDF61C5ULL, 0x76C45926C982FDACULL, 0x2119A460CE326CDCULL), false},
+    {S256Field(0xB61C65CBD269E6B4ULL, 0x152B695336C28063ULL, 0xC89A20CFDED60853ULL, 0x6A245BF6DC698504ULL),
+     S256Field(0xFD5E6348100D8A82ULL, 0x8B33BA48D0423B6EULL, 0x8B3F5126F16A24ADULL, 0xE022CF42C2BD4A70ULL), false},
+    {S256Field(0xF95AE57F0D0BD6A5ULL, 0xCE13300B0BEC1146ULL, 0xC077E3D2FE541084ULL, 0x1697FFA6FD9DE627ULL),
+     S256Field(0xADEE9D63D01B2396ULL, 0xA2CF15009E498AE7ULL, 0x27561506E4557433ULL, 0xB9C398F186806F5DULL), false},
+    {S256Field(0xF982345EF27A7479ULL, 0x9DEB8360FFB7F61DULL, 0x986D0F07E834CB0DULL, 0x605BDB019981718BULL),
+     S256Field(0x3B01E1E9056B8C49ULL, 0xC26BFAE84FB14DB4ULL, 0x81A78D93EC96FE23ULL, 0x02972D2DE4F8D206ULL), false},
+    {S256Field(0xFE31C7E9D87FF33DULL, 0xDCB01C354959B10CULL, 0x7402FDC45A215E10ULL, 0x62D14DAB4150BF49ULL),
+     S256Field(0x35F5642483B25EAFULL, 0x01AA132967AB4722ULL, 0x98088A1950EED0DBULL, 0x80FC06BD8CC5B010ULL), false},
+    {S256Field(0x5E555C2F86308B6FULL, 0x2C50E9F56B9B8B42ULL, 0xDE5B4B06C408E56BULL, 0x80C60AD0040F27DAULL),
+     S256Field(0x1AA01F56430BD57AULL, 0xA65EED4CBE7024EBULL, 0x26E66BAD7FE72F70ULL, 0x1C38303F1CC5C30FULL), false},
+    {S256Field(0x9D5EABB0FA03C8FBULL, 0x4CC5DC9487D84704ULL, 0xAA74C6348CC54D34ULL, 0x7A9375AD6167AD54ULL),
+     S256Field(0x02D499EC224DC7F7ULL, 0xBDC59EA10C70CE2BULL, 0x09559E0D79269046ULL, 0x0D0E3FA9ECA87269ULL), false},
+    {S256Field(0x4BB51F459BC3FFC9ULL, 0xBB408EC39B68DF50ULL, 0x907A9ED045447A79ULL, 0xD528ECD9B696B54CULL),
+     S256Field(0x063465B521409933ULL, 0xBC4345405C520DBCULL, 0x9966F21881FD656EULL, 0xEECF41253136E5F9ULL), false},
+    {S256Field(0x87231808F8B45963ULL, 0x5266115E4A7ECB13ULL, 0xEA25F514E8ECDAD0ULL, 0x049370A4B5F43412ULL),
+     S256Field(0xB653052A12949C9AULL, 0x54C3F3AFBB5B6764ULL, 0x8B3081B0512FD62AULL, 0x758F3F41AFD6ED42ULL), false},
+    {S256Field(0xF1C13EB1FC345D74ULL, 0x881D811E0E1498E2ULL, 0xD73DF930D64702EFULL, 0x77F230936EE88CBBULL),
+     S256Field(0xBE8EB3C7671C60D6ULL, 0x96C95330D97077CBULL, 0x0A08266E9BA1B378ULL, 0x958EF42A7886B640ULL), false},
+    {S256Field(0xEB28531B7739F530ULL, 0x58C80074AB9D4DBAULL, 0xEA44887E5C7C0BCEULL, 0xF2DAC991CC4CE4B9ULL),
+     S256Field(0x1A117DBA703A3C37ULL, 0x9EB5FBEB0598E4FDULL, 0x4DA1F32DEC2531DFULL, 0xE0DEDC9B3B2F8DADULL), false},
+    {S256Field(0xBCBA4850C690D45BULL, 0x5A216CDFC9DAE3DEULL, 0x1B4BE8FBBE252012ULL, 0x463B3D9F662621FBULL),
+     S256Field(0x1CB377B01AF7307EULL, 0xC622E27C970A1DE3ULL, 0x43114306DD8622D7ULL, 0x5ED430D78C296C35ULL), false},
+    {S256Field(0xA32496B49998F247ULL, 0x6B98FAC14328A2D1ULL, 0x09232D4AFF3B5997ULL, 0xF16F804244E46E2AULL),
+     S256Field(0xD6579962C4E31DF6ULL, 0x2A6C53C26E5CCE26ULL, 0x13D206FCDF4E33D9ULL, 0xCEDABD9B82203F7EULL), false},
+    {S256Field(0x369E15F7151D41D1ULL, 0x5D245315ACE27C65ULL, 0xB0352B7A14311AF5ULL, 0xCAF754272DC84563ULL),
+     S256Field(0xC32F908318A04476ULL, 0x5F4FA9B7962232A5ULL, 0xA41B643FA5E46057ULL, 0xCB474660EF35F5F2ULL), false},
+    {S256Field(0x24497BC86F082120ULL, 0x44A09C07CB86D7C1ULL, 0xF85D0F1709979D8BULL, 0x2600CA4B282CB986ULL),
+     S256Field(0x4B0BE9475A7E4B40ULL, 0x5AC6BE74AB5F0EF4ULL, 0xA693B03FCDDBB45DULL, 0x4119B88753C15BD6ULL), false},
+    {S256Field(0xC602A7746998E435ULL, 0x01C48685E24F7DC8ULL, 0x338EC53CD12220BCULL, 0x7635CA72D7E8432CULL),
+     S256Field(0xD9E76F302C5B9C61ULL, 0x4ECFC061D57048BAULL, 0x3D1D5E590F78E6D7ULL, 0x091B649609489D61ULL), false},
+    {S256Field(0xC1A50743BF56CC18ULL, 0xB7F2B33479D468FBULL, 0xDBBF4A87DEEE8A66ULL, 0x754E3239F325570CULL),
+     S256Field(0x0C5D98093C536683ULL, 0x23EE33D0197A695DULL, 0xB3CD0ED304EA49A0ULL, 0x0673FB86E5BDA30FULL), false},
+    {S256Field(0x9FE2694691D9B9E8ULL, 0x330800661D1C952FULL, 0xFF57859C82D570F0ULL, 0xE3E6BD1071A1E96AULL),
+     S256Field(0x67002AF4920E37F5ULL, 0xA5A2283993E90C41ULL, 0x40C0AA58379A3CB6ULL, 0x59C9E0BBA394E76FULL), false},
+    {S256Field(0x4CC47FDCF04AA6EBULL, 0xC4CCB1F32BA35F4BULL, 0x26AE73D88F732985ULL, 0x186B483D056A0338ULL),
+     S256Field(0xA4A797F86E80888BULL, 0x21FB8090895138B4ULL, 0x2E17446E204180ABULL, 0x3B952D32C67CF77EULL), false},
+    {S256Field(0x1A8321724CE0963FULL, 0x5442E6D2B737D9C9ULL, 0x44C98561F4BE4F72ULL, 0xDF9D70A6B9876CE5ULL),
+     S256Field(0x17B8C45CF2BA2417ULL, 0xB157222720EF9DA2ULL, 0x5F862B785DC39D4AULL, 0x55EB2DAFD84D6CCDULL), false},
+    {S256Field(0x5DE64C5F34CE7143ULL, 0xAB52554F849ED899ULL, 0x497CA815D5DCE0F8ULL, 0x5EDD5CC23C51E87AULL),
+     S256Field(0xCDC706AB7399A868ULL, 0xC13C66C0D17A2905ULL, 0x61E8CEC030C89AD0ULL, 0xEFAE9C8DBC141306ULL), false},
+    {S256Field(0x722D362F84614FBAULL, 0x7AA3FBA1C355B17AULL, 0xDA12FE02287E9E77ULL, 0x290798C2B6476830ULL),
+     S256Field(0x6D003AFD41943E7AULL, 0x5B29C094DB2A2314ULL, 0x988D00BCF79AF25DULL, 0xE38DA76DCD440621ULL), false},
+    {S256Field(0x62DFDECEF4053B45ULL, 0xCD29552FE3602573ULL, 0x054754EFA150AC39ULL, 0xAF3C423A95D9F5B3ULL),
+     S256Field(0xBC2FEDED498FD9C6ULL, 0xC8CD5AA667A15581ULL, 0x9A93B0E6F35CFB40ULL, 0xF98A3FD831EB2B74ULL), false},
+    {S256Field(0x8D2FED50D884249AULL, 0x06BB66B26DCF98DFULL, 0xCCCAA28C99BF2749ULL, 0x766DBB24D134E745ULL),
+     S256Field(0x2C924F97CBAC5996ULL, 0x97584A65FA06CEDDULL, 0x8DCC887980DA38B8ULL, 0x744B1152EACBE5E3ULL), false},
+    {S256Field(0xCE92E666191ABE3EULL, 0x45F7B44F6C596A58ULL, 0xA21277C33784F416ULL, 0x59DBF46F8C94759BULL),
+     S256Field(0xD85E216C4A307F6EULL, 0x42CE739A7919798CULL, 0x0F4EA6CE648309A0ULL, 0xC534AD44175FBC30ULL), false},
+    {S256Field(0xB62DC6018CFD87B8ULL, 0xDD647E711A95E73CULL, 0x305E691E74E9A4A8ULL, 0xF13ADA95103C4537ULL),
+     S256Field(0x0778419BDAF5733DULL, 0x6949E21A6A75C257ULL, 0x63BF4BC808341F32ULL, 0xE13817B44EE14DE6ULL), false},
+    {S256Field(0x488550015A88522CULL, 0xDA1869C06EBADFB6ULL, 0x6D4167A2C59CCA4CULL, 0x7754B4FA0E8ACED0ULL),
+     S256Field(0x37A48B57841163A2ULL, 0x8D1E4E350B6CBCC5ULL, 0x224B967C3020B8FAULL, 0x30E93E864E669D82ULL), false},
+    {S256Field(0xA6828C99E2262519ULL, 0x01858F95DE8041D2ULL, 0xAA3874D46ABEF9D7ULL, 0x948DCADF5990E048ULL),
+     S256Field(0xCBBA2CAE5347D57EULL, 0xDF9154EFBD2EF1D2ULL, 0xD5D28A3224B1BC25ULL, 0xE491A42537F6E597ULL), false},
+    {S256Field(0x70328A8A3D7C77ABULL, 0xFB224CF5AC0BFA15ULL, 0x89C7B48F8202EC37ULL, 0x7962414450C76C16ULL),
+     S256Field(0x60AFA5B29DB83437ULL, 0x12507A051F04AC57ULL, 0x0D5C1FC133EF6F6BULL, 0x100B610EC4FFB476ULL), false},
+    {S256Field(0xB0DD085137EC47CAULL, 0x5A16977225B8847BULL, 0xB15B160644D91548ULL, 0x3514087834964B54ULL),
+     S256Field(0x7E7D15A0DE293311ULL, 0x6039E77C15C2378BULL, 0x8E1652C48E8127FCULL, 0xEF0AFBB205620544ULL), false},
+    {S256Field(0x42943D3F7B527EAFULL, 0x93E947EB8DF787B4ULL, 0xC79CE2C9DD8BC549ULL, 0xD3CC30AD6B483E4BULL),
+     S256Field(0xAFB34DB04EEDE0A4ULL, 0x3C2AD46290358630ULL, 0x89C5E9BE8F9508AEULL, 0x8B378A22D827278DULL), false},
+    {S256Field(0x3975BA0FF4847610ULL, 0x2B29823DB913F649ULL, 0xCE1C78FCBFEFE08BULL, 0x1624D84780732860ULL),
+     S256Field(0xCC06E2A404078575ULL, 0x896878F5282BE4C8ULL, 0x0914448C6CD9D4CAULL, 0x68651CF9B6DA903EULL), false},
+    {S256Field(0x6DF7B4FD5FC61CD4ULL, 0x5192474B5AF207DAULL, 0x6902C95633E62A98ULL, 0x733CE80DA955A8A2ULL),
+     S256Field(0xC54673BC1DC5EA1DULL, 0x3E1EF8E0201E4578ULL, 0x485A4D8B8DB9FCCEULL, 0xF5435A2BD2BADF7DULL), false},
+    {S256Field(0xEF258DFAB81C045CULL, 0x8966C5092171E699ULL, 0xCF1A1C33BBD3B49FULL, 0x15D9441254945064ULL),
+     S256Field(0xFC37BBE9EFE4070DULL, 0x434800BACEBFC685ULL, 0x34F5137B73B84177ULL, 0xD56EB30B69463E72ULL), false},
+    {S256Field(0xAC138599D0717940ULL, 0x1C21417C9D2B8AAAULL, 0xB612136E5CE70D27ULL, 0xA1D0FCF2EC9DE675ULL),
+     S256Field(0x19212D39C197A629ULL, 0x641462A54070F3D5ULL, 0xB2E90737309667F2ULL, 0xEDD77F50BCB5A3CAULL), false},
+    {S256Field(0xC7CA37331CB36980ULL, 0xA790BADEE8245C06ULL, 0x5780C0735F84DBE9ULL, 0xE22FBE15C0AF8CCCULL),
+     S256Field(0xE43D06D77D31DA06ULL, 0xA38289154964799BULL, 0x88B430A69F53A1A7ULL, 0x0A855BABAD5CD60CULL), false},
+    {S256Field(0x4009452246CFA9B3ULL, 0x69635E394704EAA7ULL, 0x0EE13473C1155F5FULL, 0x311091DD9860E8E2ULL),
+     S256Field(0xBD80F0B1286D8374ULL, 0x871EC5A64FEEE685ULL, 0xFFD1F04788C06830ULL, 0x66DB656F87D1F04FULL), false},
+    {S256Field(0x1867D4232EC2DBDFULL, 0x883928B45A934078ULL, 0xB31C0442D3E6AC24ULL, 0x34C1FD04D301BE89ULL),
+     S256Field(0xC5321857BA73ABEEULL, 0xD57F1CEEB487443DULL, 0x54BD46F730174136ULL, 0x09414685E97B1B59ULL), false},
+    {S256Field(0xCC2A5E6B049B8D63ULL, 0x8D13F3ABBCD08AFFULL, 0x1C14DE5B557EB42AULL, 0xF219EA5D6B54701CULL),
+     S256Field(0xD8C2962A400766D1ULL, 0xF4B08D3C07B27FB8ULL, 0xF73AF4544CCCF6B1ULL, 0x4CB95957E83D40B0ULL), false},
+    {S256Field(0x7236912469A0B448ULL, 0x543A5490BCA62708ULL, 0xB1F683DB8F45DE26ULL, 0xD7B8740F74A8FBAAULL),
+     S256Field(0x411E0315EAA4593BULL, 0xFF15DB5ED3C049B3ULL, 0xE1010F337AD4717EULL, 0xFA77968128D9C92EULL), false},
+    {S256Field(0x9FE4D3091AA824BFULL, 0xAD5BCD32ABDD9428ULL, 0xF86F7C98D3A3335EULL, 0x32D31C222F8F6F0EULL),
+     S256Field(0x118D14B8462E1661ULL, 0x2E6DAC9E6F26E961ULL, 0x9CCD3D7915B9E1DAULL, 0x5F3032F5892156E3ULL), false},
+    {S256Field(0x340F86CBC18347B5ULL, 0x8793D77CD59592C4ULL, 0x71045A155D9831EAULL, 0x7461F371914AB326ULL),
+     S256Field(0xB39847B3CC092FF6ULL, 0x2EEE1FF50C986EA6ULL, 0xCBDDDCAE0AA44254ULL, 0x8EC0BA238B96BEC0ULL), false},
+    {S256Field(0x287698BAD7B2B2D6ULL, 0x6D716B2C3E67453DULL, 0x74356A25AA38206AULL, 0xEE079ADB1DF18600ULL),
+     S256Field(0xEBAAC479EC1C8C1EULL, 0xA446989AF04C4E25ULL, 0x4C5F37E0ECC5F9F6ULL, 0x8DC2412AAFE3BE5CULL), false},
+    {S256Field(0x2BFD8616BA9DA6B5ULL, 0xE65DE331874C9DC7ULL, 0x467B18302EE620F7ULL, 0x16EC93E447EC83F0ULL),
+     S256Field(0x9626778E25B0674DULL, 0x9D58186A50E49713ULL, 0xD0E8C2A7CA5804A3ULL, 0x5E4631150E62FB40ULL), false},
+    {S256Field(0x85B96065D537BD99ULL, 0xD8855897F98B6AA4ULL, 0x38978290AFA70B6BULL, 0xEAA5F980C245F6F0ULL),
+     S256Field(0xB18041024EDC07DCULL, 0xD784869D7E6EA67FULL, 0x19A528391C994624ULL, 0xF65F5D3E292C2E08ULL), false},
+    {S256Field(0xA96C4B6B35A49F51ULL, 0x58AE04877151342EULL, 0x692EE1910A024399ULL, 0x078C9407544AC132ULL),
+     S256Field(0x62B675F194A3DDB4ULL, 0xFA1FBD583C064D24ULL, 0xD5404795539A5E68ULL, 0xF3E0319169EB9B85ULL), false},
+    {S256Field(0x726578D9702857A5ULL, 0x01CDC8AE7A6FC688ULL, 0x16DCD838431AEA00ULL, 0x494F4BE219A1A770ULL),
+     S256Field(0x55F4B031880D562CULL, 0xF925CE30D767ED6EULL, 0x39BA7F075E36BA2AULL, 0x42242A969283A5F3ULL), false},
+    {S256Field(0xBF4C1E665C1FE9B5ULL, 0xD28211EA58FAA70EULL, 0x6BC7F2F5144EA549ULL, 0xA598A8030DA6D86CULL),
+     S256Field(0x10026DBD2D864E6BULL, 0x23FC63B65B35F86AULL, 0x7E4B4A7140737AECULL, 0x204B5D6F84822C30ULL), false},
+    {S256Field(0x4DBADC3E58595997ULL, 0x208F020F12570A18ULL, 0x09192F5F2DBEAFECULL, 0xC41916365ABB2B5DULL),
+     S256Field(0xED16E96B58FA9913ULL, 0xD5CAF9450F34BFC0ULL, 0x49D245B328984989ULL, 0x04F14351D0087EFAULL), false},
+    {S256Field(0xE4C73A5514742881ULL, 0x92A2E0D2E0A36ACFULL, 0x5A724604DA03BC5BULL, 0x841D6063A586FA47ULL),
+     S256Field(0xE7A36DE01A8D6154ULL, 0xE62562D6744C169CULL, 0x1904F9A1C7543698ULL, 0x073867F59C0659E8ULL), false}
+};
+
+constexpr S256AffineCoords S256_LAMBDA_GENERATOR_ODD_MULTIPLES[S256_GENERATOR_ODD_MULTIPLES_SIZE] = {
+    {S256Field(0xA7BBA04400B88FCBULL, 0x872844067F15E98DULL, 0xAB0102B696902325ULL, 0xBCACE2E99DA01887ULL),
+     S256Field(0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL), false},
+    {S256Field(0xF7F0728C77206B2FULL, 0x8AF1E022C6DC8E1CULL, 0x8DCD8DCF2A28FA2FULL, 0xDF6EDF03731F9B4BULL),
+     S256Field(0x6CB9FD7584B8E672ULL, 0x6500A99934C2231BULL, 0x0FE337E62A37F356ULL, 0x388F7B0F632DE814ULL), false},
+    {S256Field(0x138C694695A83668ULL, 0xA045693EE0D097CCULL, 0xF79F54FBCCB94671ULL, 0x337B52E3ACDA49DFULL),
+     S256Field(0xDCA87D3AA6AC62D6ULL, 0xF788271BAB0D6840ULL, 0xD4DBA9DDA6C9C426ULL, 0xD8AC222636E5E3D6ULL), false},
+    {S256Field(0x3BC4686E4E53BC94ULL, 0x0D3B20E20FAF7AAAULL, 0xA4FEC4D1C095C06EULL, 0x13F26E754BEA0B77ULL),
+     S256Field(0xA5082628087264DAULL, 0xA813D0B813FDE7B5ULL, 0xA3178D6D861A54DBULL, 0x6AEBCA40BA255960ULL), false},
+    {S256Field(0x20CD912E65953A52ULL, 0xB565CDF5EF6D44E1ULL, 0x7B6558AFEC58AB20ULL, 0x87B404037E44E819ULL),
+     S256Field(0x05CC262AC64F9C37ULL, 0xADD888A4375F8E0FULL, 0x64380971763B61E9ULL, 0xCC338921B0A7D9FDULL), false},
+    {S256Field(0xC5FF4334BB209CE7ULL, 0x79859BB70B5FF620ULL, 0x8D897C41BEBF1A26ULL, 0x51F4D3D1171DAC1DULL),
+     S256Field(0x301D74C9C953C61BULL, 0x372DB1E2DFF9D6A8ULL, 0x0243DD56D7B7B365ULL, 0xD984A032EB6B5E19ULL), false},
+    {S256Field(0x60AAEE6A475FB678ULL, 0x32907ED74A3D0562ULL, 0x07046C4578FC783BULL, 0xF14D58374BB890A2ULL),
+     S256Field(0x29B5CB52DB03ED81ULL, 0x3A1A06DA521FA91FULL, 0x758212EB65CDAF47ULL, 0x0AB0902E8D880A89ULL), false},
+    {S256Field(0x3AC0A40C71B1B3B4ULL, 0x05CC3BC9C1C0A639ULL, 0x0E1B4825512B6948ULL, 0x805F1105F5F9454AULL),
+     S256Field(0xC504DC9FF6A26B58ULL, 0xEA40AF2BD896D3A5ULL, 0x83842EC228CC6DEFULL, 0x581E2872A86C72A6ULL), false},
+    {S256Field(0xC640B26AF6433CC9ULL, 0x5CD58547A6754102ULL, 0xDD08754CC8986867ULL, 0xC2E95843A1F110E2ULL),
+     S256Field(0xCFB199F69E56EB77ULL, 0xCED1F4A04A95C0F6ULL, 0xE997B0EAD2A93DAEULL, 0x4211AB0694635168ULL), false},
+    {S256Field(0x5D2EB9142ED76769ULL, 0x57BAFB25D78EEB1CULL, 0x3272082DBFC45CC5ULL, 0x54F51A8F5A6BB0F6ULL),
+     S256Field(0xB570C854E5C09B7AULL, 0x1A01F60C50269763ULL, 0xB343083B5A1C8613ULL, 0x85E89BC037945D93ULL), false},
+    {S256Field(0x2FDEAAB069CBBC35ULL, 0x592BC884809F2969ULL, 0xA63D667A0A204325ULL, 0x680EB70F9B7E452EULL),
+     S256Field(0x67BD3D8BCF81998CULL, 0x4A1B3B2E71B1039CULL, 0xD59C18259DDA3E1FULL, 0x321EB4075348F534ULL), false},
+    {S256Field(0xB6704DCE788930FCULL, 0x47C5360F34A09B26ULL, 0xCFE162A03AED4DA4ULL, 0xBAE0440B1659BC6EULL),
+     S256Field(0x423BA76B532B7D67ULL, 0x181D70ECFC882648ULL, 0xB64569335BD5DD80ULL, 0x02DE1068295DD865ULL), false},
+    {S256Field(0x8D758E87EF3195BEULL, 0xE15B71F68400AA85ULL, 0x1F7497E0301D395FULL, 0xF7554ECE5468C831ULL),
+     S256Field(0xE54A32CE97CB3402ULL, 0x3FC0DE2A887912FFULL, 0x5D1AA71BDEA2B1FFULL, 0x73016F7BF234AADEULL), false},
+    {S256Field(0x837A2DFEF61B7229ULL, 0x546322C61318A794ULL, 0x1D6D435F1AC76911ULL, 0x8CA980CFE497BE98ULL),
+     S256Field(0xAB40E52290BE1C55ULL, 0x3F83C230F3AFA726ULL, 0xD4A1ACA87EF8D700ULL, 0xA69DCE4A7D6C98E8ULL), false},
+    {S256Field(0xC5C56571D53BA020ULL, 0x1B9C0525119BD70CULL, 0x188C807E0658F9EBULL, 0xE48590B373B31775ULL),
+     S256Field(0xA039063F0E0E6482ULL, 0x0E106E861EDF61C5ULL, 0x76C45926C982FDACULL, 0x2119A460CE326CDCULL), false},
+    {S256Field(0x8F8022A6AFAC1B9BULL, 0x20BA50015945EB46ULL, 0xE84D275183B19A3AULL, 0xE6034C74DAE527C2ULL),
+     S256Field(0xFD5E6348100D8A82ULL, 0x8B33BA48D0423B6EULL, 0x8B3F5126F16A24ADULL, 0xE022CF42C2BD4A70ULL), false},
+    {S256Field(0x4457DB1DAE44E551ULL, 0x1FA0E628E0674325ULL, 0x73175272408C8FA1ULL, 0xD3EA40607DAAB599ULL),
+     S256Field(0xADEE9D63D01B2396ULL, 0xA2CF15009E498AE7ULL, 0x27561506E4557433ULL, 0xB9C398F186806F5DULL), false},
+    {S256Field(0xB5888B9A7429B03FULL, 0xA473AA2F5494174BULL, 0x6851DCDF234E9878ULL, 0x7FF6966B4F8F79E9ULL),
+     S256Field(0x3B01E1E9056B8C49ULL, 0xC26BFAE84FB14DB4ULL, 0x81A78D93EC96FE23ULL, 0x02972D2DE4F8D206ULL), false},
+    {S256Field(0xEB070EF4045CFCB3ULL, 0xD1ACC036018D2AADULL, 0x554CE32C94E4EC59ULL, 0xAB880849ED4C54AFULL),
+     S256Field(0x35F5642483B25EAFULL, 0x01AA132967AB4722ULL, 0x98088A1950EED0DBULL, 0x80FC06BD8CC5B010ULL), false},
+    {S256Field(0xEF4EADD83E1F51A1ULL, 0x3AA695AC94AF5F75ULL, 0xFAA581FBA9FCCFDFULL, 0x148D9EEE8FA96DBDULL),
+     S256Field(0x1AA01F56430BD57AULL, 0xA65EED4CBE7024EBULL, 0x26E66BAD7FE72F70ULL, 0x1C38303F1CC5C30FULL), false},
+    {S256Field(0x30E6211E6A19F543ULL, 0xC7B2DEF83C35304CULL, 0x6BC8823EFDBA68BAULL, 0xC5011EACB8769193ULL),
+     S256Field(0x02D499EC224DC7F7ULL, 0xBDC59EA10C70CE2BULL, 0x09559E0D79269046ULL, 0x0D0E3FA9ECA87269ULL), false},
+    {S256Field(0x60BB6FA33B5E25E7ULL, 0x3FA22DF8EC823EA9ULL, 0x89EB86D54A9BD852ULL, 0xE9C9D489F658169BULL),
+     S256Field(0x063465B521409933ULL, 0xBC4345405C520DBCULL, 0x9966F21881FD656EULL, 0xEECF41253136E5F9ULL), false},
+    {S256Field(0x06BA66DB4351973DULL, 0xB9AF414EEEB1662DULL, 0x4ABE8C119F6C352EULL, 0x5E51873A71EB0AA7ULL),
+     S256Field(0xB653052A12949C9AULL, 0x54C3F3AFBB5B6764ULL, 0x8B3081B0512FD62AULL, 0x758F3F41AFD6ED42ULL), false},
+    {S256Field(0x575E312130323CACULL, 0xE26F62CD10A2ED1DULL, 0x0CF2D3EA4DCE1C4FULL, 0xA0A5DF60C8A81C44ULL),
+     S256Field(0xBE8EB3C7671C60D6ULL, 0x96C95330D97077CBULL, 0x0A08266E9BA1B378ULL, 0x958EF42A7886B640ULL), false},
+    {S256Field(0xA9B4C1E66D0865EEULL, 0xD68631E918EC3D0DULL, 0x8CCE3FF1A1C0BA81ULL, 0x88BF82907965EFF5ULL),
+     S256Field(0x1A117DBA703A3C37ULL, 0x9EB5FBEB0598E4FDULL, 0x4DA1F32DEC2531DFULL, 0xE0DEDC9B3B2F8DADULL), false},
+    {S256Field(0xDB2EB2C6A6151CCDULL, 0x2EE49DC8F4120947ULL, 0xA273C509461C8F85ULL, 0xD3D898009F38F50EULL),
+     S256Field(0x1CB377B01AF7307EULL, 0xC622E27C970A1DE3ULL, 0x43114306DD8622D7ULL, 0x5ED430D78C296C35ULL), false},
+    {S256Field(0xF8E4228DBB643650ULL, 0xE618BD708C9CDDA6ULL, 0xE68C6222C186E54DULL, 0xAAAA6EA8422EAD4AULL),
+     S256Field(0xD6579962C4E31DF6ULL, 0x2A6C53C26E5CCE26ULL, 0x13D206FCDF4E33D9ULL, 0xCEDABD9B82203F7EULL), false},
+    {S256Field(0xD41882A114A4F300ULL, 0xB7F55B5495505FA9ULL, 0x783F1D5BE329E931ULL, 0x9BDF1191C50B7CF2ULL),
+     S256Field(0xC32F908318A04476ULL, 0x5F4FA9B7962232A5ULL, 0xA41B643FA5E46057ULL, 0xCB474660EF35F5F2ULL), false},
+    {S256Field(0x0ABD22060CB65103ULL, 0xE3D8D7924D3F70F9ULL, 0x77DF55E43B922921ULL, 0x6C89C3391CFCFF60ULL),
+     S256Field(0x4B0BE9475A7E4B40ULL, 0x5AC6BE74AB5F0EF4ULL, 0xA693B03FCDDBB45DULL, 0x4119B88753C15BD6ULL), false},
+    {S256Field(0x7B55A11ED0E6C1CFULL, 0xC139C7AB67D378FAULL, 0x361BAF7AA5CF654AULL, 0xFB81BEC00632EC3AULL),
+     S256Field(0xD9E76F302C5B9C61ULL, 0x4ECFC061D57048BAULL, 0x3D1D5E590F78E6D7ULL, 0x091B649609489D61ULL), false},
+    {S256Field(0x0D769207101C2518ULL, 0xF6CDFF78FD8B3E68ULL, 0x6228149AD347DB19ULL, 0xBE02DB9626DDC9F5ULL),
+     S256Field(0x0C5D98093C536683ULL, 0x23EE33D0197A695DULL, 0xB3CD0ED304EA49A0ULL, 0x0673FB86E5BDA30FULL), false},
+    {S256Field(0xC17B586F6BAEEF76ULL, 0xAF721AA9A550463EULL, 0x175635870889D21DULL, 0x87BD9A8F1C28C565ULL),
+     S256Field(0x67002AF4920E37F5ULL, 0xA5A2283993E90C41ULL, 0x40C0AA58379A3CB6ULL, 0x59C9E0BBA394E76FULL), false},
+    {S256Field(0xA728031158D30E3FULL, 0xFAA0DDDBB9624747ULL, 0x82602C3C002F9697ULL, 0x2B6A73604E57F39EULL),
+     S256Field(0xA4A797F86E80888BULL, 0x21FB8090895138B4ULL, 0x2E17446E204180ABULL, 0x3B952D32C67CF77EULL), false},
+    {S256Field(0x591932131C6074DBULL, 0x7C28977D64893824ULL, 0xEADCE5AC6C793132ULL, 0x689FF442F8586658ULL),
+     S256Field(0x17B8C45CF2BA2417ULL, 0xB157222720EF9DA2ULL, 0x5F862B785DC39D4AULL, 0x55EB2DAFD84D6CCDULL), false},
+    {S256Field(0xD5E63C7C5ADD7B20ULL, 0x89D9B6DE36A3C416ULL, 0x79FBE4C3892900C3ULL, 0x3C431AE2642BC765ULL),
+     S256Field(0xCDC706AB7399A868ULL, 0xC13C66C0D17A2905ULL, 0x61E8CEC030C89AD0ULL, 0xEFAE9C8DBC141306ULL), false},
+    {S256Field(0xDFB858419BFE323BULL, 0xCCE185AD8CCD0198ULL, 0xF9AEFB9126C20244ULL, 0x30571001B9F78798ULL),
+     S256Field(0x6D003AFD41943E7AULL, 0x5B29C094DB2A2314ULL, 0x988D00BCF79AF25DULL, 0xE38DA76DCD440621ULL), false},
+    {S256Field(0x86E92A72E701991AULL, 0x9AD442008BA9CED5ULL, 0x5EDAB57A183E8DCBULL, 0x00D263AD8326F2B8ULL),
+     S256Field(0xBC2FEDED498FD9C6ULL, 0xC8CD5AA667A15581ULL, 0x9A93B0E6F35CFB40ULL, 0xF98A3FD831EB2B74ULL), false},
+    {S256Field(0xEB258F4DB2E63CF9ULL, 0x41290BDF6AC298BEULL, 0x70DC5BA76F2903F8ULL, 0x3CFF41CA67DE3FDDULL),
+     S256Field(0x2C924F97CBAC5996ULL, 0x97584A65FA06CEDDULL, 0x8DCC887980DA38B8ULL, 0x744B1152EACBE5E3ULL), false},
+    {S256Field(0x4BF07A876C079EF2ULL, 0xB65CB88558A6076BULL, 0x1FB0E230E64EFD81ULL, 0x04C5C14383B1BF52ULL),
+     S256Field(0xD85E216C4A307F6EULL, 0x42CE739A7919798CULL, 0x0F4EA6CE648309A0ULL, 0xC534AD44175FBC30ULL), false},
+    {S256Field(0x7998212E095052C4ULL, 0xB1E99C3030DB955FULL, 0x3070FDBA90063187ULL, 0x86C9895737BB6706ULL),
+     S256Field(0x0778419BDAF5733DULL, 0x6949E21A6A75C257ULL, 0x63BF4BC808341F32ULL, 0xE13817B44EE14DE6ULL), false},
+    {S256Field(0xD7C4E0C12BE7DBA3ULL, 0x2990A5AA1CC01DF6ULL, 0x4DAC8FDCB60AF467ULL, 0x8F4C4A008E5CEC56ULL),
+     S256Field(0x37A48B57841163A2ULL, 0x8D1E4E350B6CBCC5ULL, 0x224B967C3020B8FAULL, 0x30E93E864E669D82ULL), false},
+    {S256Field(0x55B863ADD20C3970ULL, 0xCE7F2D98202526A1ULL, 0x45332A0368BBD810ULL, 0x9CD292290E9E7708ULL),
+     S256Field(0xCBBA2CAE5347D57EULL, 0xDF9154EFBD2EF1D2ULL, 0xD5D28A3224B1BC25ULL, 0xE491A42537F6E597ULL), false},
+    {S256Field(0xBAC23033100B5D72ULL, 0xA1BC0CF2B751F987ULL, 0xC611B701B641D0C1ULL, 0x8E5CCF4E7EA43DB6ULL),
+     S256Field(0x60AFA5B29DB83437ULL, 0x12507A051F04AC57ULL, 0x0D5C1FC133EF6F6BULL, 0x100B610EC4FFB476ULL), false},
+    {S256Field(0x9F0ACA6C5498D815ULL, 0x5A885C86698C6AFBULL, 0x13A5F96FA79A40ACULL, 0x8036894BB4D69021ULL),
+     S256Field(0x7E7D15A0DE293311ULL, 0x6039E77C15C2378BULL, 0x8E1652C48E8127FCULL, 0xEF0AFBB205620544ULL), false},
+    {S256Field(0xB6D5CEC8B7B44E89ULL, 0x0E6158465DB7E19FULL, 0xBA0AE6B3814BE933ULL, 0xB524F8A331B07052ULL),
+     S256Field(0xAFB34DB04EEDE0A4ULL, 0x3C2AD46290358630ULL, 0x89C5E9BE8F9508AEULL, 0x8B378A22D827278DULL), false},
+    {S256Field(0x689D7429559F7BB4ULL, 0xA1179A0DE44CC5A2ULL, 0xD1CED61C15BC3C2AULL, 0xCF04550093816AE0ULL),
+     S256Field(0xCC06E2A404078575ULL, 0x896878F5282BE4C8ULL, 0x0914448C6CD9D4CAULL, 0x68651CF9B6DA903EULL), false},
+    {S256Field(0x05AC50187CA9BCE6ULL, 0xF4A4F9E34F51067FULL, 0x37B2E3DC35025697ULL, 0x0CCBD8BA298A5973ULL),
+     S256Field(0xC54673BC1DC5EA1DULL, 0x3E1EF8E0201E4578ULL, 0x485A4D8B8DB9FCCEULL, 0xF5435A2BD2BADF7DULL), false},
+    {S256Field(0x2EEF9D7FE11A2857ULL, 0xF1A04744376BABAEULL, 0xB696C0E3FEEFA7D9ULL, 0x65384C59E84EA37AULL),
+     S256Field(0xFC37BBE9EFE4070DULL, 0x434800BACEBFC685ULL, 0x34F5137B73B84177ULL, 0xD56EB30B69463E72ULL), false},
+    {S256Field(0x94BB79217DE9A019ULL, 0x19C4A96A3A6EA125ULL, 0x77CBB3BAF8635B1EULL, 0xD3231073A5A886C5ULL),
+     S256Field(0x19212D39C197A629ULL, 0x641462A54070F3D5ULL, 0xB2E90737309667F2ULL, 0xEDD77F50BCB5A3CAULL), false},
+    {S256Field(0xE3ED90C700B8DBB6ULL, 0xAE79AE57129D49DCULL, 0x5605537FBA6E8944ULL, 0x55987956C1020A09ULL),
+     S256Field(0xE43D06D77D31DA06ULL, 0xA38289154964799BULL, 0x88B430A69F53A1A7ULL, 0x0A855BABAD5CD60CULL), false},
+    {S256Field(0xF2CA639E978D98BEULL, 0x457399AA9853E177ULL, 0x3633E5B458D8D905ULL, 0x92889FA7F164BBE6ULL),
+     S256Field(0xBD80F0B1286D8374ULL, 0x871EC5A64FEEE685ULL, 0xFFD1F04788C06830ULL, 0x66DB656F87D1F04FULL), false},
+    {S256Field(0x44FF7627F6B22BB8ULL, 0xBACE2A8A273D519CULL, 0xFCC6B989F5D1A0FBULL, 0x723284D28F50AEA2ULL),
+     S256Field(0xC5321857BA73ABEEULL, 0xD57F1CEEB487443DULL, 0x54BD46F730174136ULL, 0x09414685E97B1B59ULL), false},
+    {S256Field(0x6795505BF4F97B56ULL, 0xFADF69E1ABB760F2ULL, 0xDF057D63DBB17512ULL, 0x330D232FA1CF7D21ULL),
+     S256Field(0xD8C2962A400766D1ULL, 0xF4B08D3C07B27FB8ULL, 0xF73AF4544CCCF6B1ULL, 0x4CB95957E83D40B0ULL), false},
+    {S256Field(0x57F696886D76DFBFULL, 0xCB65335BB7CAF16AULL, 0x99CB563CE7ABB401ULL, 0x90A8B67ED2E6D154ULL),
+     S256Field(0x411E0315EAA4593BULL, 0xFF15DB5ED3C049B3ULL, 0xE1010F337AD4717EULL, 0xFA77968128D9C92EULL), false},
+    {S256Field(0x890D88CE2C84596BULL, 0x1479376C2905D4BAULL, 0xB167513853F5D433ULL, 0x8F264368F04301D9ULL),
+     S256Field(0x118D14B8462E1661ULL, 0x2E6DAC9E6F26E961ULL, 0x9CCD3D7915B9E1DAULL, 0x5F3032F5892156E3ULL), false},
+    {S256Field(0x9AB88E9BAC307F42ULL, 0x1E0554114AB0BE7FULL, 0xF9D9BF0476FED794ULL, 0x309D096507710D6CULL),
+     S256Field(0xB39847B3CC092FF6ULL, 0x2EEE1FF50C986EA6ULL, 0xCBDDDCAE0AA44254ULL, 0x8EC0BA238B96BEC0ULL), false},
+    {S256Field(0x291F70F8DE1E873BULL, 0x79E054F13A2F60EFULL, 0xD81C5D76967A81D5ULL, 0x8292903799C9E044ULL),
+     S256Field(0xEBAAC479EC1C8C1EULL, 0xA446989AF04C4E25ULL, 0x4C5F37E0ECC5F9F6ULL, 0x8DC2412AAFE3BE5CULL), false},
+    {S256Field(0xD6372271F3F309BBULL, 0x0C9196C4D333FCF6ULL, 0xF0C2EF7A6F7838E5ULL, 0xAAD8F0B2BD30ABDEULL),
+     S256Field(0x9626778E25B0674DULL, 0x9D58186A50E49713ULL, 0xD0E8C2A7CA5804A3ULL, 0x5E4631150E62FB40ULL), false},
+    {S256Field(0x58A60B22526C24DEULL, 0x84BDDB39F4ACBB50ULL, 0xA4D06222622D9D32ULL, 0x28EABE22CEE183DDULL),
+     S256Field(0xB18041024EDC07DCULL, 0xD784869D7E6EA67FULL, 0x19A528391C994624ULL, 0xF65F5D3E292C2E08ULL), false},
+    {S256Field(0xB5F7D474ACEB43F3ULL, 0x7F7F90B086CCFD73ULL, 0x533A9DD7EF778890ULL, 0xAECDEFD0C3358ECDULL),
+     S256Field(0x62B675F194A3DDB4ULL, 0xFA1FBD583C064D24ULL, 0xD5404795539A5E68ULL, 0xF3E0319169EB9B85ULL), false},
+    {S256Field(0x1FEB25A8FE399D2DULL, 0xBFCA43EB42C7F9F1ULL, 0xCAEEAC7AFF3C2D67ULL, 0x4DB9267BB76C2C02ULL),
+     S256Field(0x55F4B031880D562CULL, 0xF925CE30D767ED6EULL, 0x39BA7F075E36BA2AULL, 0x42242A969283A5F3ULL), false},
+    {S256Field(0x631E0D8332FAE1EFULL, 0xDF5DAED4C77E1B62ULL, 0xD12CA4FD8A8D1E86ULL, 0x4A23F26EB70F60AAULL),
+     S256Field(0x10026DBD2D864E6BULL, 0x23FC63B65B35F86AULL, 0x7E4B4A7140737AECULL, 0x204B5D6F84822C30ULL), false},
+    {S256Field(0x5A8ADD0FB9A43852ULL, 0x82F1E9A3CCF762F1ULL, 0xFD6D55FBBED899BDULL, 0xE378CA57B07EB88CULL),
+     S256Field(0xED16E96B58FA9913ULL, 0xD5CAF9450F34BFC0ULL, 0x49D245B328984989ULL, 0x04F14351D0087EFAULL), false},
+    {S256Field(0xE6B55F70B1038E42ULL, 0x6645A5EA00B6172BULL, 0xEEABB561A27043DDULL, 0xCF1F4919C237FF97ULL),
+     S256Field(0xE7A36DE01A8D6154ULL, 0xE62562D6744C169CULL, 0x1904F9A1C7543698ULL, 0x073867F59C0659E8ULL), false}
+};
+
+constexpr S256AffineCoords S256_GENERATOR_FIXED_TABLE[S256_GENERATOR_FIXED_TABLE_SIZE] = {
+    {S256Field(0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL, 0x79BE667EF9DCBBACULL),
+     S256Field(0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL), false},
+    {S256Field(0x8601F113BCE036F9ULL, 0xB531C845836F99B0ULL, 0x49344F85F89D5229ULL, 0xF9308A019258C310ULL),
+     S256Field(0x6CB9FD7584B8E672ULL, 0x6500A99934C2231BULL, 0x0FE337E62A37F356ULL, 0x388F7B0F632DE814ULL), false},
+    {S256Field(0xCBA8D569B240EFE4ULL, 0xE88B84BDDC619AB7ULL, 0x55B4A7250A5C5128ULL, 0x2F8BDE4D1A072093ULL),
+     S256Field(0xDCA87D3AA6AC62D6ULL, 0xF788271BAB0D6840ULL, 0xD4DBA9DDA6C9C426ULL, 0xD8AC222636E5E3D6ULL), false},
+    {S256Field(0xE92BDDEDCAC4F9BCULL, 0x3D419B7E0330E39CULL, 0xA398F365F2EA7A0EULL, 0x5CBDF0646E5DB4EAULL),
+     S256Field(0xA5082628087264DAULL, 0xA813D0B813FDE7B5ULL, 0xA3178D6D861A54DBULL, 0x6AEBCA40BA255960ULL), false},
+    {S256Field(0xC35F110DFC27CCBEULL, 0xE09796974C57E714ULL, 0x09AD178A9F559ABDULL, 0xACD484E2F0C7F653ULL),
+     S256Field(0x05CC262AC64F9C37ULL, 0xADD888A4375F8E0FULL, 0x64380971763B61E9ULL, 0xCC338921B0A7D9FDULL), false},
+    {S256Field(0xBBEC17895DA008CBULL, 0x5649980BE5C17891ULL, 0x5EF4246B70C65AACULL, 0x774AE7F858A9411EULL),
+     S256Field(0x301D74C9C953C61BULL, 0x372DB1E2DFF9D6A8ULL, 0x0243DD56D7B7B365ULL, 0xD984A032EB6B5E19ULL), false},
+    {S256Field(0xDEEDDF8F19405AA8ULL, 0xB075FBC6610E58CDULL, 0xC7D1D205C3748651ULL, 0xF28773C2D975288BULL),
+     S256Field(0x29B5CB52DB03ED81ULL, 0x3A1A06DA521FA91FULL, 0x758212EB65CDAF47ULL, 0x0AB0902E8D880A89ULL), false},
+    {S256Field(0x44ADBCF8E27E080EULL, 0x31E5946F3C85F79EULL, 0x5A465AE3095FF411ULL, 0xD7924D4F7D43EA96ULL),
+     S256Field(0xC504DC9FF6A26B58ULL, 0xEA40AF2BD896D3A5ULL, 0x83842EC228CC6DEFULL, 0x581E2872A86C72A6ULL), false},
+    {S256Field(0xC44EE89E2A6DEC0AULL, 0xB2A31369B87A5AE9ULL, 0x3011AABC21C23E97ULL, 0xE60FCE93B59E9EC5ULL),
+     S256Field(0xE1F32CCE69616821ULL, 0x1296891E44D23F0BULL, 0x9DB99F34F5793710ULL, 0xF7E3507399E59592ULL), false},
+    {S256Field(0x9BD870AA1118E5C3ULL, 0xFC579B27452BEBC1ULL, 0xB441656EF4E65B4BULL, 0x6ECA335D9645307DULL),
+     S256Field(0x498A2F7805A08668ULL, 0x3A496A3A3BF8EC34ULL, 0x592F579074B875A0ULL, 0xD50123B57A7A0710ULL), false},
+    {S256Field(0x0ECD31E14F87F62EULL, 0x10E6E63863716127ULL, 0x0D7C744ED34659F0ULL, 0xE9623BBEF1BF90ECULL),
+     S256Field(0x53013EAFA44EE737ULL, 0xFE6043C9DD68844EULL, 0xE0FE953A8EDAA929ULL, 0x38A9743B4BC299E9ULL), false},
+    {S256Field(0xEB0AADF82A8D733CULL, 0xFFC274BF62FCA8F9ULL, 0x0884A36F2080D682ULL, 0xBC82DD73E5161DBAULL),
+     S256Field(0x1E786104F47797F0ULL, 0xAE93A0BAE7389730ULL, 0x54A9B4BF719F02DFULL, 0xE5F28C3A044B1CACULL), false},
+    {S256Field(0xD7EFE2315FBC7671ULL, 0x743F1BC852858E32ULL, 0xD20291CE1798F490ULL, 0x8E3D1248C7657211ULL),
+     S256Field(0x7EF1DC6418717DECULL, 0xB9352BAAA63E144AULL, 0xF64480E19393E90EULL, 0x099A48E10ECFCB81ULL), false},
+    {S256Field(0xF3287432BEB31DB2ULL, 0x8FCAE82788F506A0ULL, 0x896A193ED088A2B6ULL, 0x78A891AA2234A498ULL),
+     S256Field(0x3069D623B9FA4343ULL, 0x54379BCDD800B82DULL, 0xFCF5F25527302DF6ULL, 0x6912A35BEB5035CBULL), false},
+    {S256Field(0x65348F778DB0E595ULL, 0xA7163CB9FBA082BBULL, 0xD7CE3765816076EBULL, 0x7D86781855DB1B17ULL),
+     S256Field(0x99951E3ABC733DE8ULL, 0x2937844E0E25D532ULL, 0x2E562E2BED4F8838ULL, 0xE2B99ADFEC86F877ULL), false},
+    {S256Field(0x008FEF8516060DFCULL, 0x76545F84205E6A2AULL, 0x48494B9DC41AB086ULL, 0xDDC5310F00582AC8ULL),
+     S256Field(0xFB5F8AB6E7820CA8ULL, 0x41DBAFC6ABD04730ULL, 0x0191AB6DCC8F0E90ULL, 0xBA0D2F3AF20D9692ULL), false},
+    {S256Field(0x0646E23FD5F51508ULL, 0xD8C39CABD5AC1CA1ULL, 0xEA2A6E3E172DE238ULL, 0x8282263212C609D9ULL),
+     S256Field(0xD31B6EAFF6E26CAFULL, 0x62D613AC2F7B17BEULL, 0x5E8256E830B60ACEULL, 0x11F8A8098557DFE4ULL), false},
+    {S256Field(0xFCFC0CB9E57E8DFAULL, 0x09809191A3C7E184ULL, 0x0D9A30F8ACA98CA0ULL, 0x8262CF2FF0799C4CULL),
+     S256Field(0x35CFF8D8FBAC376AULL, 0x57B6ED332B14C478ULL, 0x66FEE22EC5B34F34ULL, 0x83FD95E209109E4EULL), false},
+    {S256Field(0x9052E48B026BDB6FULL, 0x7CA41BD47B734B94ULL, 0x168105B24CE99C87ULL, 0x19825C8B1DA0DDD5ULL),
+     S256Field(0xB5DF7084C49CFC9BULL, 0xEBE9EECC8CF6D3A6ULL, 0x320261CC94F59F6CULL, 0x6294310F0D4C878FULL), false},
+    {S256Field(0x50ED09523D82824CULL, 0xDFA58E345E1534E6ULL, 0x43C5F56EC6C2999EULL, 0x6F12D86C11601914ULL),
+     S256Field(0x8579C34806EB34D0ULL, 0x391C92410854BC5BULL, 0x875994F3FD623769ULL, 0x5C4FF7F44AB3BFA0ULL), false},
+    {S256Field(0x076DDC02DB453629ULL, 0x45CFDCDC0F59E603ULL, 0x14262716A23ABEF6ULL, 0x203A8C6F9A0AAA5DULL),
+     S256Field(0x5971C7853FF89F84ULL, 0x686DEB25C5285ED4ULL, 0x36CC76D15F410612ULL, 0x3B0F0B53DE5DD9B9ULL), false},
+    {S256Field(0x783130DDE46C7ECBULL, 0x9D3AED3FE5BB4CE9ULL, 0xC81EF7334866E1ECULL, 0x6E2ACAEB3D034181ULL),
+     S256Field(0x8449201EEEBC8720ULL, 0xFAC706B91B67512CULL, 0x9D80C4DAF0FB643AULL, 0x9E61A46797EFEE14ULL), false},
+    {S256Field(0xEB7018F3F0A4147EULL, 0x2747DD8BF775F201ULL, 0xAF61717E8A490A58ULL, 0xD5A70492E9E9156BULL),
+     S256Field(0x8E4B3CB833FB65FFULL, 0xF4C4D9847967F57FULL, 0xFC490990765E0532ULL, 0x9DB526F5DBAB89C6ULL), false},
+    {S256Field(0x4EDDB46BD8EDCEC6ULL, 0xA1061CC2D3634F45ULL, 0x0523EFC6302CDAC6ULL, 0x38C5119AABE18BA8ULL),
+     S256Field(0x456E0BFB1933DB08ULL, 0x28A16C822B5530A6ULL, 0x668CB2DA275F282FULL, 0xE649DD2285D9732AULL), false},
+    {S256Field(0x73FCE5B551E5B739ULL, 0xE0B93833FD2222EDULL, 0x72F99CC6C6FC846DULL, 0x175E159F728B865AULL),
+     S256Field(0x6EFA6FFEE9FED695ULL, 0xACB5955ADD24345CULL, 0xA4EF97A51FF71F5EULL, 0xD3506E0D9E3C79EBULL), false},
+    {S256Field(0x65B7F8F1C5041216ULL, 0x3F7335F6842B836AULL, 0x128B59EFDC2FED52ULL, 0xDA75317B21F7ACF4ULL),
+     S256Field(0xDAED32986E708572ULL, 0xE9AAC07AE77ACEDAULL, 0xDF19E21B342D7FC6ULL, 0x73F8A046BF72D5F0ULL), false},
+    {S256Field(0xB0143E71E465A930ULL, 0x2587F1C16B1352FDULL, 0x0573C58C4A82EB1EULL, 0x1C71C5B48E9749D7ULL),
+     S256Field(0x1D873F6CC34638B5ULL, 0x79345E3FB7174D47ULL, 0x2713F1F2824BB68CULL, 0x4A91C334E8F5FA0CULL), false},
+    {S256Field(0xE318DAE5BADB6EE7ULL, 0x7850DD432744A077ULL, 0x936E837A909B4C9CULL, 0xD84E4AFC1F31A566ULL),
+     S256Field(0x82D556E6D42EBED2ULL, 0xFDD8AC974AA3E649ULL, 0x12A38D58F565DE4DULL, 0xE525809A7C7B79CEULL), false},
+    {S256Field(0x394E9ECFA49E6D10ULL, 0xF60ADFF3AEAC99D2ULL, 0x41B22B9285FF6ED3ULL, 0xF3D4444BDE66814DULL),
+     S256Field(0x0A038CC05347DA3FULL, 0xFC1ADA50CE9D6C63ULL, 0x4BAB95AC198A4B5BULL, 0x0A4324DFA6F0163DULL), false},
+    {S256Field(0x48CB3406E9D33A07ULL, 0x4E72EE08AA39BCABULL, 0xF9085520CDBDF404ULL, 0xAE30652C9D9C1D89ULL),
+     S256Field(0x74870C0F60A0B2A6ULL, 0x1C9C37F5DFD7E95CULL, 0xEFCCE7D33DB8D5CFULL, 0x6CB9D9C38D63FE57ULL), false},
+    {S256Field(0x759654B90C28CACAULL, 0x1869C7BBCC8281DAULL, 0x15E17E7583388C9AULL, 0xD8DC1B2A5BD5E1C8ULL),
+     S256Field(0xCDB676EA23B3EC7AULL, 0x7D315D2CEC8128F6ULL, 0x8C6D8DA420247D94ULL, 0x8CEC0AD927CEC7D5ULL), false},
+    {S256Field(0x8921FB663BC4416FULL, 0xA7AEFD23F30B0402ULL, 0xD59425A8D032F31DULL, 0x2749E292C5F84ECCULL),
+     S256Field(0x7E98BDE2FC6BBD8EULL, 0xF59E9FB65EE96105ULL, 0x403D94990FCADB3EULL, 0x50CC2D4E37672BC4ULL), false},
+    {S256Field(0x526BAD8F83FF4640ULL, 0x53441C7E55552FFEULL, 0x99CEAC05B6262EE0ULL, 0x363D90D447B00C9CULL),
+     S256Field(0x62003C7F3BEE9DE9ULL, 0x45B9A89008199ECBULL, 0x953B445397F33631ULL, 0x04E273ADFC732221ULL), false},
+    {S256Field(0x4B891216F6E55DC8ULL, 0x6FF95AB6EACA0439ULL, 0xBA84A440C0509442ULL, 0x4431404790C5FFB2ULL),
+     S256Field(0x31D944AEDBE323B3ULL, 0xA66A29B79EAA2E50ULL, 0xFE99837F5642FED7ULL, 0x96B0C142E65366F8ULL), false},
+    {S256Field(0xDFE9485D701B23A8ULL, 0xAB7B7D470A87EE0AULL, 0x126243D5B921089DULL, 0x9E22FE8D866CA87CULL),
+     S256Field(0xF7A413C50884EDAEULL, 0xC0F7C949FB511CECULL, 0x177F3F02099C1533ULL, 0xFD2FF0E9CA122D10ULL), false},
+    {S256Field(0xDD7408BF071A70E4ULL, 0xCD5EE51F5F5CF475ULL, 0x2EDD69E64705306DULL, 0x508DF6D503CE2A8DULL),
+     S256Field(0xDF2E5BF729950984ULL, 0x4EC03228EE8AADFEULL, 0x777304AA733E49C5ULL, 0x154C439B933BC42DULL), false},
+    {S256Field(0x6EAFDA76CE1ABE11ULL, 0xDAB921C259CB220FULL, 0x338DF581930125B2ULL, 0xE3DBFF8455109763ULL),
+     S256Field(0x4B49AD549FA8DE63ULL, 0xD3C97D903C6B5C41ULL, 0x6438FA75DB8A8EF3ULL, 0x06F2F9099A341421ULL), false},
+    {S256Field(0xDCF1B23603593449ULL, 0xF61B7C12E42A46FFULL, 0x878D9C13A07D014AULL, 0x19ACE064C7DE940DULL),
+     S256Field(0x3A414B93ADF83631ULL, 0xAC710B9F4084068AULL, 0xBFEBD739D9402C46ULL, 0xE37992035268A333ULL), false},
+    {S256Field(0xEE3E9892CCBA6B63ULL, 0x0A0FE674FD0B3BB5ULL, 0x108C33228EA88E31ULL, 0xD8740CEC20F87DAAULL),
+     S256Field(0xBEEA36C06934C5F3ULL, 0x40104F5CC381694AULL, 0x378A6EE9903AC37DULL, 0x6472C133C6B932BFULL), false},
+    {S256Field(0x6194FF2C1B3EC038ULL, 0xD9FD516AE60C6B27ULL, 0x64883E762F290A50ULL, 0x58AC33391B506083ULL),
+     S256Field(0x16EAA3F110246279ULL, 0x0219043C0B4FBBCAULL, 0x78779249E991FE97ULL, 0x9163D706D55C92D9ULL), false},
+    {S256Field(0x69F79A55DFFDF80CULL, 0x43E4A781A15BCD1BULL, 0x8C6244B5B7456388ULL, 0x8B4B5F165DF3C2BEULL),
+     S256Field(0xB3EFF0C65FD4FD36ULL, 0xF9E336546162EE56ULL, 0xB3FBD7813AB0DA04ULL, 0x4AAD0A6F68D308B4ULL), false},
+    {S256Field(0xA0A2A582F55812DDULL, 0x3D446723552D30E2ULL, 0x0B6ABED6C058F78EULL, 0x7029BD7A92FF352FULL),
+     S256Field(0x721CC66B1A2D2927ULL, 0x47DAE84243B2C73CULL, 0x7DD6544AE30683ACULL, 0xB0EEFADAFDE8B3D2ULL), false},
+    {S256Field(0x49CE5683BD486ED1ULL, 0x5745BEBA49565B6AULL, 0x009D4109D8CF7560ULL, 0x9CCFEDCAEAE65C99ULL),
+     S256Field(0x4F6D59ED75E95D8DULL, 0x2421675969592AA2ULL, 0xB6122481200B3411ULL, 0x7C2F4D713D6A32CFULL), false},
+    {S256Field(0xA206B1A75BD0EACAULL, 0xD0C74576BA2D4AB7ULL, 0x35A8FDE33CA4DF19ULL, 0xCD9A4B8763414143ULL),
+     S256Field(0x6E6FAFB5ABFF4ACCULL, 0x0127B38EED6F634FULL, 0x815488AE933EA08BULL, 0xF0455879A1E8F23EULL), false},
+    {S256Field(0xF20953A3C7BC57C6ULL, 0x4903D7A23EB276CBULL, 0x884F2D2E93D63094ULL, 0xAD09882F88ED9BEAULL),
+     S256Field(0xCA32C0EDAE4A0AB8ULL, 0x7B311D373590E2D3ULL, 0xA28186C729DABE5FULL, 0x7243C08C42FBA52BULL), false},
+    {S256Field(0xEA830C72ABA56302ULL, 0xF506A937AF0F1862ULL, 0x1EADA2D2A9FAD2E0ULL, 0xD9D1290AEB3CA41FULL),
+     S256Field(0xEAADDAFA88291C29ULL, 0x1739AECD9FA74F2AULL, 0x029715C6726386E4ULL, 0x7EB53113EC2D3EEDULL), false},
+    {S256Field(0xBACD3704F4D1243AULL, 0x02B126023F54A5FDULL, 0x91CD21AC063F5584ULL, 0xBC5079DE539D6CEFULL),
+     S256Field(0xF5C95168855DB68AULL, 0x5F7EE4F5B1F47169ULL, 0x8EEC72B94DFFC8D7ULL, 0x65062A3B3A705CBBULL), false},
+    {S256Field(0x08D244E6B74A3F9FULL, 0xC287A665DC098169ULL, 0x913DEAAE7DB2625AULL, 0x4D31A77E505FC7E8ULL),
+     S256Field(0x4FCB0241301E0BA7ULL, 0xCBF6FB51B6E00A75ULL, 0x06B18F38C7802753ULL, 0x22241EC96098575BULL), false},
+    {S256Field(0xCB6115925232FCDAULL, 0xB700DBFFA6C0E77BULL, 0x6BF771C00BD548C7ULL, 0x723CBAA6E5DB996DULL),
+     S256Field(0x01DC069D9EB39F5FULL, 0x2660A06537794948ULL, 0xA921137488824D6EULL, 0x96E867B5595CC498ULL), false},
+    {S256Field(0x2567E09E80633CB1ULL, 0x575A224B69D02113ULL, 0x00C6273212181FCBULL, 0x6DDE9CF317AACAD4ULL),
+     S256Field(0x57DD49AA67CE6B34ULL, 0x80B27FDACF859EF3ULL, 0x5C99EF86A1BA66A8ULL, 0x9188FBE7A707E41DULL), false},
+    {S256Field(0x419A518D2933F3C5ULL, 0x085A0F7115F12522ULL, 0x13C4BB7F8E47B850ULL, 0x486FA72CD5B5CDE8ULL),
+     S256Field(0x9AD4A71ACAFB0F53ULL, 0x62D9B783CF0F23B7ULL, 0xE48C48BAECC8F19FULL, 0x62E12319F56BDD43ULL), false},
+    {S256Field(0xEBD594225E99F728ULL, 0x677375FBE6F12204ULL, 0xB664FF27B76A5303ULL, 0x24796974A894AF4FULL),
+     S256Field(0x37A00516EBAAEBFFULL, 0x5ADBF3C09575A2D8ULL, 0xEC52E87E7D8D664AULL, 0xE3D78D44688F3001ULL), false},
+    {S256Field(0xC9E0C6D42FB0079AULL, 0x916F9EF723926049ULL, 0x631A59EE76B38324ULL, 0x2F39CBDAA3D55FF0ULL),
+     S256Field(0xFE2297302C5690BAULL, 0x9BFB3FBC882A0230ULL, 0x4DA936D0278DA58BULL, 0xABEADBDE13863983ULL), false},
+    {S256Field(0x793300B2E4F7AB73ULL, 0x62E3D4EA9D4443A7ULL, 0x56A39E86C534AED2ULL, 0xE5A31D6C327D61BAULL),
+     S256Field(0x3913A3FC70561F42ULL, 0xBF8C4449A80CBA21ULL, 0x0C118A977A4ECE5DULL, 0x37788C3D8D1E9D7AULL), false},
+    {S256Field(0x88F929A3C14DCD86ULL, 0x1FC5D42096BF71B5ULL, 0xDF50DD982051DCF1ULL, 0xCC389D4A0D153447ULL),
+     S256Field(0x68EB6DD9C8F0A873ULL, 0x05C57E18FE7E7874ULL, 0x9B568BDBBEA910CAULL, 0x93AE4FD660F6BBEDULL), false},
+    {S256Field(0x24F9C6EB78819311ULL, 0x0B3E1EE210877147ULL, 0x3750A17E0CF5ED1FULL, 0x7F9291C89D71E902ULL),
+     S256Field(0xAA9F9B57AC2EB125ULL, 0x120AAA409C86A174ULL, 0xF5D0DE8C452415B6ULL, 0x9DA00D1063EC3EF0ULL), false},
+    {S256Field(0x9A533ECA0E7DD7FAULL, 0x0947961237A91983ULL, 0xBA5FEEC812C2D3B5ULL, 0xEEBFA4D493BEBF98ULL),
+     S256Field(0xDDFD4FDAE1DE8999ULL, 0x9AE4CDC3A711F712ULL, 0x69EE7EDAF178089DULL, 0x5D9A8CA3970EF0F2ULL), false},
+    {S256Field(0xF3F678FFBB7CECEBULL, 0x73A59F938897FAF0ULL, 0x36FFB8126F6E6814ULL, 0x437A86204276D450ULL),
+     S256Field(0x7363BCC356C181E1ULL, 0x87220FCFDC8F9782ULL, 0x69B8FEB699D297FFULL, 0x0B916BA13EEAC32FULL), false},
+    {S256Field(0xD58D729E097F96F2ULL, 0x35823529D2C8735CULL, 0x83CB7E3B9A3CC273ULL, 0xA9EF9F13E2A489BCULL),
+     S256Field(0xC03D55B056C04BE4ULL, 0xB74F89AF5A9B4702ULL, 0xD956EE160EBB613DULL, 0xE814CCE594559D7CULL), false},
+    {S256Field(0xBC0AB5A1350CF77EULL, 0x07DBF57454A8AB0DULL, 0x553827D69FAA0642ULL, 0x66D80541EE1D35BEULL),
+     S256Field(0x2A5F97AFA0EAA3A6ULL, 0x9444B43AB7B1B76DULL, 0xC3F1D420535613F6ULL, 0x51CFDFE732FFFB42ULL), false},
+    {S256Field(0x9354862887213A5AULL, 0x0B73204A785FA62BULL, 0xBF3508A1C64CC3C8ULL, 0x62AC05E136503FA2ULL),
+     S256Field(0xC10D21C0F46A9E45ULL, 0xE5590901817994EFULL, 0xD395E79E07A92579ULL, 0x236FBDF3A0D1A6E4ULL), false},
+    {S256Field(0xC30FD49867BAD12BULL, 0x85D5EA00EAF66E1EULL, 0x5BF613AF5C6F2DB3ULL, 0xCA13C44972448F5BULL),
+     S256Field(0x89699F469723B0F2ULL, 0x6370AB7111A57566ULL, 0xAC15FA64EAADA3D6ULL, 0x83AA098361C287C8ULL), false},
+    {S256Field(0xDDAEE5F95C80414EULL, 0x14EF8A862D66CF7FULL, 0x5AC11C4F44609E49ULL, 0x1CECB101A7052AE8ULL),
+     S256Field(0xDCAE9492D2169A3BULL, 0x907557E5447231D0ULL, 0x4E5AA32835EDAD16ULL, 0xF343606696097CFBULL), false},
+    {S256Field(0xC4F5BC8C4ED810A9ULL, 0x4F889D3F3C700155ULL, 0xC950DAF5F1DF2392ULL, 0x2A69907504D78F9CULL),
+     S256Field(0xCF86B388FA9B4728ULL, 0x667D47E97EC145C7ULL, 0xC3EC586954FB04FCULL, 0x54F9039B6C3DFFDAULL), false},
+    {S256Field(0xEFD7835B39A48DB0ULL, 0x9F1215A29B3C03BFULL, 0x2791D0A09B7BDE45ULL, 0x100F44DA696E7167ULL),
+     S256Field(0x0FBD5CD62BC65A09ULL, 0xB7FF4A18FF5195ACULL, 0x2EC8F3300C090666ULL, 0xCDD9E13192A00B77ULL), false},
+    {S256Field(0x9CB9A13495BC15B4ULL, 0x9275028E465A2EE6ULL, 0xED858EE9CED7CA8DULL, 0x10E90E2E51EEADC9ULL),
+     S256Field(0x34EBE60958AA258DULL, 0x4CA5896302BB6A88ULL, 0x4D57A8C616AD1F75ULL, 0xC68A370380D5E042ULL), false},
+    {S256Field(0x2DD3FC303FE75269ULL, 0xA377A3CC053D3318ULL, 0x4575B90B714B7DCDULL, 0xF7422F42DA541638ULL),
+     S256Field(0x18980E8717E49BD5ULL, 0x7FB3A237F4A398E0ULL, 0xD18CE7DCB9F63597ULL, 0x406C2F1A3313093FULL), false},
+    {S256Field(0x653B6696F5A7175FULL, 0xEDB8E771D31CF42AULL, 0x72879A5582D5DEBBULL, 0x2D8CAD0417D43CFFULL),
+     S256Field(0xCF37BB91BB9D592AULL, 0x7A846BFD9CB5E5E0ULL, 0x7BB232FA612C9D37ULL, 0xC73F3B83318CA94AULL), false},
+    {S256Field(0xE34C9BC394B51045ULL, 0xBBC6C896F31C25B3ULL, 0x8AE73D4EB1E8CF73ULL, 0x1ECBFD1DB98A6EA5ULL),
+     S256Field(0x53A6710102C70026ULL, 0xB1900646B436422DULL, 0x447D0BB1849A9B38ULL, 0x1CF6E2308B99C3A6ULL), false},
+    {S256Field(0xF7ACD766E9358533ULL, 0x10A933F9D4FB4B9DULL, 0x83E955A291D32A8CULL, 0x9A0894C5FE577528ULL),
+     S256Field(0xFB3E1C5DC360BA08ULL, 0x65A6E5BDBB80DDADULL, 0x1F917D5F954FC321ULL, 0xA79883C4201B8FC3ULL), false},
+    {S256Field(0x694405D6198EF7F6ULL, 0x5923F3F77A078F9FULL, 0x5BD9C85273B8AEA6ULL, 0x664DD849DB4FD2E3ULL),
+     S256Field(0xE7496FF35D1EAC94ULL, 0xFC3D3AB31B8E6ECEULL, 0xA1448CE5DD0458CFULL, 0xAD51201717F27932ULL), false},
+    {S256Field(0xE0C0A6B7C3C934B3ULL, 0x2B31F5805B0AE2C4ULL, 0x8231D9669811A702ULL, 0x82113A9377D0B863ULL),
+     S256Field(0x77E5E62AC42C6A0FULL, 0xAA1F7C269A446803ULL, 0x08466CF2B5A0C628ULL, 0x8DA1B8DAC9AE3666ULL), false},
+    {S256Field(0x2C8ACDE6E534FD2DULL, 0xA77F8D4464F3B385ULL, 0x1DC9227A4A04C017ULL, 0xE1031BE262C7ED1BULL),
+     S256Field(0xA44F18F29456A00DULL, 0xF292DD419E1CED79ULL, 0x6BB6A4176597535AULL, 0x9D7061928940405EULL), false},
+    {S256Field(0x579623AEEF028D83ULL, 0x6195926DBA743961ULL, 0x6A5ABE5A15DE69DBULL, 0xA7EBF7C4E3C785ECULL),
+     S256Field(0x9640392B99D0BED1ULL, 0x47A389274B053919ULL, 0xCFD9C7377044804BULL, 0x6205152FBFE362D5ULL), false},
+    {S256Field(0xBAE0E40227DD5CFAULL, 0x6A89C5137F09D4B5ULL, 0x1CDC6A5342634633ULL, 0x5B5CA08DCB024F4CULL),
+     S256Field(0xE664A6F99E48E98CULL, 0xBFD067CCAF3269D3ULL, 0xE991F0CEA8869094ULL, 0x3ECCB6F70AA15825ULL), false},
+    {S256Field(0x2B9528E323531F82ULL, 0xFF51326BB10C2C9FULL, 0xCCEF3E7489C22C29ULL, 0x046F26ACC1114BB5ULL),
+     S256Field(0xA505FC8B0BCEDA07ULL, 0xD025945CDAB55C7FULL, 0xCE2370AC2FC32579ULL, 0x6B804B31635B82EAULL), false},
+    {S256Field(0x60B1543710432711ULL, 0xCF140B2FDD916B90ULL, 0x35F96F0F0899645AULL, 0xC11926D931E0EFB5ULL),
+     S256Field(0xE49261E2EFE2610CULL, 0x83AB922CA0F34055ULL, 0x18494BF186CCC6CFULL, 0x8BE1F8CC7D25B689ULL), false},
+    {S256Field(0xC179874FA1257963ULL, 0x5B018D52C34AA861ULL, 0x6CDBB54B538979C4ULL, 0x690846E9EB688F2EULL),
+     S256Field(0x3A576599466F9835ULL, 0x6CBC3CA821C92B25ULL, 0xB4017024F92FBB7FULL, 0xE2485FCB7F3FEBC5ULL), false},
+    {S256Field(0x2D11394BDEE23ACEULL, 0xDEC87C65B54DD2FDULL, 0xBBA7552DF4A32915ULL, 0xFB3DF7FB8C9220BAULL),
+     S256Field(0xE09DEF4C9722E8DEULL, 0x9E727142FED27F5EULL, 0x52A251540DBAB58AULL, 0x510E29BC11C73C56ULL), false},
+    {S256Field(0x8607CFEF50272351ULL, 0x70734B3DF99FF109ULL, 0x3EB8A3EB3AB1CD41ULL, 0x6DD85EC24F5C518BULL),
+     S256Field(0x9B07FA2B7FC7664BULL, 0x877C6FF7C3E0817CULL, 0x09D407F9AF5C41B7ULL, 0x16EA67F4121F427EULL), false},
+    {S256Field(0x2D5E688D9094696DULL, 0x5CF8B266A41D6AF5ULL, 0x0AC2839F143BD7ECULL, 0xFEEA6CAE46D55B53ULL),
+     S256Field(0x3155DEBF18090088ULL, 0x981C8957CC41442DULL, 0xB06E4E12BF3ECD5CULL, 0xE57C6B6C97DCE1BAULL), false},
+    {S256Field(0x079361BB48DFD587ULL, 0x5EC4BA38C9B02656ULL, 0x34867AAA2CF5A12DULL, 0x5084B41BACF4508BULL),
+     S256Field(0x6E79E97F91470E89ULL, 0x5DB6F5606891F560ULL, 0x619AA6C855292747ULL, 0x34A9631A1D980D31ULL), false},
+    {S256Field(0xD08232617AB34CC6ULL, 0xC80C29767CF30A12ULL, 0x53FB3F1FD18D7128ULL, 0x4F14C03E0642D5EAULL),
+     S256Field(0x25EC252F987E681FULL, 0xB9DE3CCE8E81DD02ULL, 0xC653A70F43A62540ULL, 0x7B53D0A8CAA4E894ULL), false},
+    {S256Field(0x342771011241D90DULL, 0xE81CF141DB2444F8ULL, 0xD41436095EDDD363ULL, 0xA74DB87E49C79ED1ULL),
+     S256Field(0xF32518B83F7ADAD4ULL, 0xA9EE509344A0A313ULL, 0x27FDD08A588171C8ULL, 0xF78691CDAF23EEF3ULL), false},
+    {S256Field(0xA5ECCA2231C1AE1FULL, 0x456E58C68ACD40B2ULL, 0x9ACDCD44EBA35658ULL, 0x6901FA5744BAA2CFULL),
+     S256Field(0x0F833065D22838B0ULL, 0xD79F3BA5E5C77A93ULL, 0x461B5380C29C900DULL, 0x35DE5C882273C212ULL), false},
+    {S256Field(0x4B031081B27A4BDBULL, 0x046A6D0435494CACULL, 0xA244B643F1BBA35DULL, 0x8D3CD82D1D438127ULL),
+     S256Field(0xC3D34C7CE69A8A2CULL, 0xD4E3807D370AD296ULL, 0x70CFBF9D0076236EULL, 0x9BD4256180EE41F4ULL), false},
+    {S256Field(0x440CD3C6B4EC1D2DULL, 0xD9099F5C6E7D8F45ULL, 0xAFE9D672967B691FULL, 0xEAF98363D6064739ULL),
+     S256Field(0xFCFE75604C838452ULL, 0xA9F52D5457E84B53ULL, 0x775228A0E6B199AAULL, 0xE518183A7FE78D22ULL), false},
+    {S256Field(0xBCB35BF7045AE767ULL, 0xC273A9CB9E89771CULL, 0x66F40E052C06E5D8ULL, 0xFB95BD163AEDB634ULL),
+     S256Field(0x1853EA0AFBBF0E11ULL, 0xB816F4718A59F134ULL, 0x52004D9D3682275BULL, 0x664C14D811A8DDBCULL), false},
+    {S256Field(0x33FA978BC1EC6CB1ULL, 0xFEED657D808583DEULL, 0xB367BE4BE6FFCA3CULL, 0xDA67A91D91049CDCULL),
+     S256Field(0x7E9EA8E27A68BE1DULL, 0xDEC7ADC508F740A1ULL, 0x41F463F7EC9780E5ULL, 0x9BACAA35481642BCULL), false},
+    {S256Field(0x9EFDD06515BC8A44ULL, 0x68410177CBE151A1ULL, 0xD38565A4BA5A5FC7ULL, 0x4D0180583CFCEDA3ULL),
+     S256Field(0x2F1F94C91ADBC09EULL, 0x969420468582DA36ULL, 0x67E9BA8007D63813ULL, 0x3A33C6C18CB4F5D3ULL), false},
+    {S256Field(0xBC1AB52865DAEB00ULL, 0x5923EB24CE645F76ULL, 0x082CB6A273B6E9D1ULL, 0x2F661507DF5CF957ULL),
+     S256Field(0x12276789833992C0ULL, 0x6ECDEE27195D308CULL, 0x6EF9537A8200ADD0ULL, 0xFD5C12136F52B33FULL), false},
+    {S256Field(0x182A90A0916AA6D9ULL, 0x3662C8B647702DCFULL, 0x254F174DA1835A38ULL, 0xF594117D05FE47D2ULL),
+     S256Field(0xC7D0696EBF2E50CFULL, 0x7A9277883E6B5B86ULL, 0xCF65DBDAB094BCEBULL, 0xCAA761A56E971B12ULL), false},
+    {S256Field(0xCAAE03957AC6F4C0ULL, 0xDA4E8DE8CC4BDC4CULL, 0xC4E1C38BE696711DULL, 0x0F2D4D7F1F4D9CDEULL),
+     S256Field(0xE7E7BBAD72339B58ULL, 0x8F6A10A790242656ULL, 0x17FB27FDF381E71EULL, 0x3EC89F857E93DE4DULL), false},
+    {S256Field(0xD855053FDF428CB2ULL, 0x233822FD66A22B55ULL, 0x1EB7A1815958D0F1ULL, 0x1D5DCEC2E2A14BBDULL),
+     S256Field(0x1E5ED100895B189BULL, 0xBD3E912F876044A5ULL, 0x0D078782486F0B88ULL, 0x6E5C4083B142C8C5ULL), false},
+    {S256Field(0xFB0EA88FA8381273ULL, 0xD84376960693DAE5ULL, 0x9FDEA9B2CC4126CEULL, 0x89D9A2FD30096743ULL),
+     S256Field(0xA03EB3EED309773DULL, 0x8F61D680AD127324ULL, 0x377AAF2076CF62F5ULL, 0xDFCA25B451D66F50ULL), false},
+    {S256Field(0x1CC32B2CB5C71D91ULL, 0x23945E2E2A894FD2ULL, 0xC52A1C13115AFECEULL, 0x83191B8783A50AE1ULL),
+     S256Field(0x70B9EC08E2148A61ULL, 0x17A11F51750445EEULL, 0x9E06DE13D17CAE8AULL, 0xE0AC7F1573801B70ULL), false},
+    {S256Field(0x57545CCC1A37B7C0ULL, 0xEC08D0F7BB11069FULL, 0xA6E000935EF22151ULL, 0x53904FAA0B334CDDULL),
+     S256Field(0x9DCB096B022771C8ULL, 0x13999981E1443469ULL, 0x88C9ECCAC20D3C1CULL, 0x5BC087D0BC80106DULL), false},
+    {S256Field(0x71AC42FE48A2050EULL, 0x742EF557615F8A67ULL, 0x96B769CC6E479B89ULL, 0x673724FD24BC7318ULL),
+     S256Field(0xB90C9A49061D3D70ULL, 0xBE6BACFD43349CC2ULL, 0x203482C09A886B6DULL, 0xE4CF8257896A4A20ULL), false},
+    {S256Field(0xCBF6E48382DE63BFULL, 0xE03AF53287261C66ULL, 0x9E598A631F6166A8ULL, 0x4366EFA472DF4C30ULL),
+     S256Field(0x02C6A408E17924CDULL, 0xF33B0C525AAA6D6BULL, 0x2EE2537E130268EAULL, 0x2E7DD909BEE2D7CEULL), false},
+    {S256Field(0xF10527FF06F96190ULL, 0xD1F02DE907C9525EULL, 0x97BE5569667AA75FULL, 0x7BD753627991AB1FULL),
+     S256Field(0xA3D17204ABDA00F6ULL, 0xCE0FCC5C1E0EA695ULL, 0xD5ED6474943827D6ULL, 0x8336F2B3DBBA6309ULL), false},
+    {S256Field(0x33B1531556AD41EDULL, 0x0308AC35F4F03524ULL, 0xAFA3419E8918DC92ULL, 0x4F7E927BDDAAD5C1ULL),
+     S256Field(0xDF4357867E642D57ULL, 0x2E7314714EAF775BULL, 0x552980DF53A8F6A6ULL, 0xDFE7745156A88B10ULL), false},
+    {S256Field(0xCFA6051267748690ULL, 0x7D57904DD8630B01ULL, 0x94B452B1EDD33D00ULL, 0x2355CB867D291CCCULL),
+     S256Field(0x47C475314C89582BULL, 0x58286858CD1C9391ULL, 0xF55B85EC15AA7C58ULL, 0x21C2F18A5A71E1F8ULL), false},
+    {S256Field(0x6DAEA2160ADE7F16ULL, 0xAE9CBAE93CBE028CULL, 0x013592AB6C275D24ULL, 0x0B66825B9B3DA56CULL),
+     S256Field(0xD944426848C56217ULL, 0xB7243C0DF3E7CD2BULL, 0xEF3A76BA8B57A97FULL, 0xA1FBA0B818E09B3FULL), false},
+    {S256Field(0x2906B02299060D5BULL, 0x904613B11C3A3A7CULL, 0xB6109B2FD9F951CBULL, 0xF602043CF0BD022CULL),
+     S256Field(0x76F6F50B1AF88F13ULL, 0x37AA56D2B7DD1A3FULL, 0x881A8F64AC4F7BEAULL, 0xF036B706C1F0CF19ULL), false},
+    {S256Field(0xEFF959F43AD86047ULL, 0x79B53A043A9B8BCAULL, 0x719CCA7764CA9067ULL, 0x8E7BCD0BD35983A7ULL),
+     S256Field(0xEA10047E8460372AULL, 0x79E88E2E47FD68B3ULL, 0x940310420CA95145ULL, 0x10B7770B2A3DA4B3ULL), false},
+    {S256Field(0xFFE8879A041EAD4BULL, 0x3A75EDFB691B03C1ULL, 0xC714734EFAFE76BEULL, 0xBFC90C0C8C8F337EULL),
+     S256Field(0x7452C6F086FEDAEDULL, 0xFB468EFF32E0AE3EULL, 0x4DBA718DD5042D36ULL, 0x7A9481B1E09CDED2ULL), false},
+    {S256Field(0x26E7BD0775BB3B3EULL, 0x50753617EF9F73CBULL, 0xDCA5993E8C2D3F5BULL, 0x732DF11CBE3FAAA4ULL),
+     S256Field(0xCC577E1ED7366693ULL, 0xE69DAD6D64C58436ULL, 0xCB7E255840253916ULL, 0x7F41903EDE8F9977ULL), false},
+    {S256Field(0xC5F5B3C1888DC3B9ULL, 0x19A66924E9774C99ULL, 0x28DA8840CC97EF60ULL, 0x4CE094B9603947B4ULL),
+     S256Field(0x2C14F7B6E5C0DE52ULL, 0x16205B20C9EA0650ULL, 0xD57B4D80CA76ACA2ULL, 0x05390FBABF1A9B3EULL), false},
+    {S256Field(0x4C375E0B0AAAFE5AULL, 0xE25470B3A509AEDDULL, 0x96D8A6A95B023FD0ULL, 0x9A968EB76FC667DEULL),
+     S256Field(0xCE6BFD424ED975C0ULL, 0xE7B5880A65E70CC0ULL, 0x54FC66D03D861D0EULL, 0xABF6FB07A6D3BA29ULL), false},
+    {S256Field(0x3751CBF9F34C6397ULL, 0x07DD3DB50074CD09ULL, 0x4F0AEF802536B221ULL, 0xD3C6FBED01716195ULL),
+     S256Field(0xB1FC8D0568CB3F9CULL, 0x8A0C7708905E0E00ULL, 0x9458394D92EAB646ULL, 0x4A0DD2C55E5E2AF1ULL), false},
+    {S256Field(0x19B825930AC3137EULL, 0xFE925B62A5AF6446ULL, 0xE02F06A76AAB3953ULL, 0x4CBDE398129243B8ULL),
+     S256Field(0xC008F15CEEC02FE6ULL, 0xD193A7AE588EAD60ULL, 0x50092A134B94C370ULL, 0x6CE554608F136159ULL), false},
+    {S256Field(0x47A2306CE0FBF84BULL, 0x03C48FCBBC3F0B8AULL, 0xB8BD9C730C14CEBBULL, 0x4B9D333C82B16247ULL),
+     S256Field(0x239EE4B4A36C3C48ULL, 0x6766D543E2F5B5E6ULL, 0x55313D982679B7EBULL, 0xFD7FC7FBE24CC152ULL), false},
+    {S256Field(0x0A841E1599C43862ULL, 0x71A7F4F18397E669ULL, 0xE6D0818689B81BDEULL, 0x385EED34C1CDFF21ULL),
+     S256Field(0xC0458FE5542E5453ULL, 0x6B304EEC2086DC8CULL, 0x6701DE19E9EBF457ULL, 0x283BEBC3E8EA23F5ULL), false},
+    {S256Field(0x14BD306AB6E2D9B3ULL, 0x41DB92831B38D635ULL, 0x5E12EA6139CF8456ULL, 0x19A314F397C705E7ULL),
+     S256Field(0xD552EE25CBAAAF33ULL, 0xA5021D1D2404BE56ULL, 0x234965F887F528B3ULL, 0x6CACD8F5DAC728DDULL), false},
+    {S256Field(0x7D8587EB12F00480ULL, 0x20358804A100DCEEULL, 0x55DC986364F67219ULL, 0x5840ED4B95A8DAA3ULL),
+     S256Field(0x1592D5E2BE22CF9EULL, 0xBA75225452AE3872ULL, 0x07968DEAA15DD8DAULL, 0x670CDA6B220BF141ULL), false},
+    {S256Field(0xE484DEE823F54C42ULL, 0x45DC1A3C269A3DC8ULL, 0x1DC58C1F4ECE5325ULL, 0x9F5701A5346918FBULL),
+     S256Field(0x860E1C492FEB6A21ULL, 0x89EE784AB219E527ULL, 0xBFB95B6B5729BFDDULL, 0xCE7B8FB8801D9E57ULL), false},
+    {S256Field(0x7E9413329522461AULL, 0xBCB30A265BC71832ULL, 0x01BB8701067EF9A0ULL, 0x27F61169235A8CFCULL),
+     S256Field(0x6AA4CAF9C7301A2DULL, 0xE4981B20DA863944ULL, 0xEA48C56127428EE8ULL, 0xE512F1A9900A6AD2ULL), false},
+    {S256Field(0xCCE2C9B2D14F36B9ULL, 0x2598CABB63B9F390ULL, 0x261BF2F435F4A981ULL, 0x640779856CEEF941ULL),
+     S256Field(0x894B1EE9E4B4B50AULL, 0x8CDA0870499CEEB2ULL, 0xEF90D75FD85A7B6CULL, 0xDA61928F44E56EFAULL), false},
+    {S256Field(0xCEF63DF994D6B76FULL, 0x7FE5A9FBB4C815DBULL, 0x452F708BC09DFEAEULL, 0xA23750E31C85669FULL),
+     S256Field(0x41D92CCC8DCCA8DAULL, 0xE7707C11FDB848D1ULL, 0xAC32FA3E4D411113ULL, 0xF7339B14A6E7DE6DULL), false},
+    {S256Field(0x12EE9C64FCEEE475ULL, 0xAB6AC82840ED782BULL, 0x5ED3C021F3CAFF41ULL, 0xBBF1AC07A3F2378DULL),
+     S256Field(0x84622A0087FE5067ULL, 0x24EB9D89438B41D6ULL, 0x10883CC836B15FE3ULL, 0xB4BFB8DEEAD460E6ULL), false},
+    {S256Field(0xC606ED86C3FAC3A7ULL, 0x0FDDF84A5947FBC9ULL, 0x637C73A4413DFA18ULL, 0x06F9D9B803ECF191ULL),
+     S256Field(0xD86890603A842160ULL, 0x7EA4DD2F5C281002ULL, 0x69B8E2A30E45C4D4ULL, 0x7C80C68E603059BAULL), false},
+    {S256Field(0x24ED75E8D21CE204ULL, 0xB2A7258E426763D5ULL, 0xB8374D859CA6F72FULL, 0x43CA41D162B3C64FULL),
+     S256Field(0xE525044E934A8F6BULL, 0x9AB6C7B33EA4A468ULL, 0x1C650F9218DBA31FULL, 0xDCEA5A82E37023FAULL), false},
+    {S256Field(0x64FCE92CEBE6EFDAULL, 0x922D4FF3F8728059ULL, 0xB666F723785A506DULL, 0x9C3E06EF22892BF5ULL),
+     S256Field(0xDF140F32A7AEFC7DULL, 0xD43BC8687B36FDF7ULL, 0x8AF0B2D44CE26FD5ULL, 0xA7B709E5E762923DULL), false},
+    {S256Field(0x79127AB5C6C88BE2ULL, 0xEA2C7820D06EE5E2ULL, 0x3BB72759D830775BULL, 0x5D6F8AA313E20F03ULL),
+     S256Field(0x892E553F0D7AD75DULL, 0xEDAB6F8EA6BF92C2ULL, 0xC71AAF33AB08BC20ULL, 0xADC4B18D8D56D4E8ULL), false},
+    {S256Field(0xF289351B92D1B844ULL, 0xC69C0382C173E484ULL, 0xC86B15C3C1388BC5ULL, 0xF57D35C304A60D5FULL),
+     S256Field(0x464BABBD61266837ULL, 0x7006972030915C6AULL, 0x7904D3F5A9E4634CULL, 0x707F3D9EA98EF4D9ULL), false},
+    {S256Field(0x234D007F3CC7CB09ULL, 0x3BC7EB68A1D1B435ULL, 0xF596E1FEE3D87146ULL, 0x13E7607A3A6594A5ULL),
+     S256Field(0x1BE75A8A08079160ULL, 0x65EAE2BB66B57641ULL, 0xE325FDD85B34299DULL, 0x284DC88DE8FBB8B1ULL), false},
+    {S256Field(0x0060CE1258CDEE05ULL, 0xA8761FB2172EC3B9ULL, 0x2400250B1B06901DULL, 0x29BEA322568182E6ULL),
+     S256Field(0x9E4A0359A62651C8ULL, 0xF9FC31B6C8C698E3ULL, 0xA9009B3FB8705EC7ULL, 0x7C40D9A2690E9A0EULL), false},
+    {S256Field(0x11B6C75612F18ADAULL, 0xD460BD93BBDBDBCCULL, 0xD9C36FAFF33D4A59ULL, 0xF521786D238288E7ULL),
+     S256Field(0x1DD68AFD23953516ULL, 0xAA5EF4A36C5BF098ULL, 0xECC26102BCD1D1D6ULL, 0xE0686FBF6038DB57ULL), false},
+    {S256Field(0x13B7E0E742D0E6BDULL, 0xF774D163DB0F5E53ULL, 0x82A2147C104D6ECBULL, 0x3322D401243C4E25ULL),
+     S256Field(0x24F3A2E96C28B2A0ULL, 0x2805F63EA2873AF6ULL, 0xBFB019BC4DDAF9B7ULL, 0x56E70797E9664EF5ULL), false},
+    {S256Field(0xABD9D3F2059AB499ULL, 0x0B13299C6E73C330ULL, 0x5D2196B3C67F01BCULL, 0x78BAAFF3015C05BAULL),
+     S256Field(0x681D2318FEE097FDULL, 0x91632EEE8D125199ULL, 0xAFCA84E0ED82082EULL, 0xAD4BDCDBDB06C0AFULL), false},
+    {S256Field(0x4493E16CFD06ACE6ULL, 0x23709B36F83A20CAULL, 0xC20B84984929AB1AULL, 0x6F70F211A14AE3D4ULL),
+     S256Field(0x048BED34B602D5DEULL, 0x75329566BE5AC5EEULL, 0x6F95D8F347B99F50ULL, 0x791E8A3094027B73ULL), false},
+    {S256Field(0xDC8EE3EE60EE1B40ULL, 0x8CED485B71E96247ULL, 0xF80949F19103CCD4ULL, 0xE1599DB29D6AA415ULL),
+     S256Field(0xE1D6265ED78F93A6ULL, 0xA6363A74BC32999DULL, 0xEFAF894AAA2FC7CFULL, 0x793362232A81D4A0ULL), false},
+    {S256Field(0xF81DFA2849C00C3EULL, 0xF00E8F03C91208E2ULL, 0x436562D33D451859ULL, 0xBB0B049704406956ULL),
+     S256Field(0x799A982D11955A35ULL, 0xFE67044E905DC90AULL, 0x655D2FA17AB1B052ULL, 0x4067E45853AF9F63ULL), false},
+    {S256Field(0xE0E75B9C05DD32E6ULL, 0xC663B551B53E5EE7ULL, 0x9B649DBE075A5FBFULL, 0xDC5A41554195789EULL),
+     S256Field(0x80E7DB7A754A99B9ULL, 0x2FF2EE9076E49BCFULL, 0x6DCEA5E201BF5944ULL, 0x4AF3A8A63F9F67A7ULL), false},
+    {S256Field(0x9ED45BAC4544E7CBULL, 0xA1064225B5296035ULL, 0xBE3354A571014E99ULL, 0x156E197039873B9DULL),
+     S256Field(0x6D5392C0AD250A37ULL, 0x9496D58D5EB439CDULL, 0xA939572A63834BE8ULL, 0x6BC08D9F8F31907DULL), false},
+    {S256Field(0xDBFBC29CC59853CAULL, 0x48E9626B9F19BF54ULL, 0x6BCA76A228E71613ULL, 0x4269BCCECB684382ULL),
+     S256Field(0xDA958EF535B8D367ULL, 0xFD3940A5F9E5A8A3ULL, 0x23C84CA9C431A409ULL, 0xED2B1C1A82C016B7ULL), false},
+    {S256Field(0x721D74D28134AB83ULL, 0x741B3F9AF7643397ULL, 0x2BD1770D89665868ULL, 0x85672C7D2DE0B7DAULL),
+     S256Field(0xC8E3094F790313A6ULL, 0xE77F17FCC5298F44ULL, 0x6374049BFA62C2E5ULL, 0x7C481B9B5B43B2EBULL), false},
+    {S256Field(0xFDF0723A83BA9000ULL, 0xC4872F9C6825E8B6ULL, 0x684876075840143DULL, 0xAC3874F9FFF1D8C1ULL),
+     S256Field(0x4DA3C7D96F10CF0AULL, 0x085E350D7F66E9FAULL, 0xB862DDE894117F93ULL, 0xAA65E92308A1C069ULL), false},
+    {S256Field(0x1A606F66ED06DBD4ULL, 0xEC0E3F8578A20D08ULL, 0x9AD14075E9A3E729ULL, 0x570D5CE7AA687013ULL),
+     S256Field(0x5A65BECEBD1ED495ULL, 0xB683A36DC6460BEDULL, 0x05B66E6711D01BBBULL, 0xA6AE5349420E02F6ULL), false},
+    {S256Field(0x434C1F92092D230EULL, 0xDAEE32A0D2933928ULL, 0xF87C229EE0366EF5ULL, 0x75B5F87028268BB6ULL),
+     S256Field(0x037CBDFBD51570B8ULL, 0x0267A4B00511F8FBULL, 0x63D7874554DDFA8EULL, 0x527CCE21E3A78523ULL), false},
+    {S256Field(0x47B6BF6AC34FCC0EULL, 0x927F10A42BE3884CULL, 0xB0A5B80E27D259C8ULL, 0x44FC8EFAE1EDDEC2ULL),
+     S256Field(0x9CFF031E719C420AULL, 0x720E94A4BCD0489DULL, 0xE49267E78833D3D7ULL, 0xD2C7DE94BA9B1367ULL), false},
+    {S256Field(0xD5A481FC8BB69991ULL, 0xFFFB3FA2C3307175ULL, 0x866A16620E02F535ULL, 0xDEA2BA47BACE7BC6ULL),
+     S256Field(0x706742A9F16FE2DFULL, 0x229DCDB3621ED9BCULL, 0xAC5CBFEC84F7B9E7ULL, 0xAE28BFD6D90C28E4ULL), false},
+    {S256Field(0x8C240D02514FC9CCULL, 0x26D00ABC29A46165ULL, 0xEFC1CF6CC4B8A836ULL, 0x3968FC98A6E168D6ULL),
+     S256Field(0x019394895FAD37DDULL, 0x1A146576FF88F334ULL, 0x1237982D1AAD32C9ULL, 0x789CBBD0DB4B5928ULL), false},
+    {S256Field(0x0AEC2191AE0C85F1ULL, 0xA6A52E53603A3A25ULL, 0x26B25DF0957945D5ULL, 0x6896910698E06A29ULL),
+     S256Field(0x2C7482332DC1DE21ULL, 0x1F40C19DA0D50392ULL, 0x56F305C1D845D72DULL, 0xAEFD3FB4B38C9792ULL), false},
+    {S256Field(0xFFD959AF60C82A0AULL, 0x0F9226C60F668832ULL, 0x6B06C9F1919413B1ULL, 0x0948BF809B1988A4ULL),
+     S256Field(0xD4CB7F88D8C8E589ULL, 0x6D4DFF08C97CD2BEULL, 0xDC6B74C5D1C3418CULL, 0x53A562856DCB6646ULL), false},
+    {S256Field(0x7282FE5FB8C8AC7FULL, 0x641242EE65E2AA52ULL, 0xB5C3396D2056F849ULL, 0x9945B2FBE3822BBCULL),
+     S256Field(0x96D943A169AEA3B0ULL, 0x282F7A23EEDACDFAULL, 0x607DB44FFB28EFF5ULL, 0x3EEFED824B0F282DULL), false},
+    {S256Field(0xED1D79E3969E353AULL, 0x10A0440852BBE1F6ULL, 0x235F82227107D5FEULL, 0x2A314C6B205870E6ULL),
+     S256Field(0xC25926E1E5746067ULL, 0x138A54AADB2658BFULL, 0x1A463E476BAA1BA0ULL, 0x15A4AC0BF35A27ACULL), false},
+    {S256Field(0x89E2F49EE9B84966ULL, 0x1B4F4106DD7F3FF9ULL, 0x498B6FAF3A6B6C91ULL, 0x5959A500B703FC2DULL),
+     S256Field(0x40A6632187473A6AULL, 0x9100DCC08CFE2426ULL, 0xF94312820DC82A70ULL, 0x0370E6741F5CA897ULL), false},
+    {S256Field(0x3B0C9B922BC6B173ULL, 0x7DD8623C7EED3FEBULL, 0xE1160C46305B5F9DULL, 0x9EEB313937222FE8ULL),
+     S256Field(0x9539620D9723A71DULL, 0x0EA71ABED0E70C4BULL, 0x952AABFDBBBA1AE3ULL, 0xE121F1E0110ED58DULL), false},
+    {S256Field(0x5772443F7EC805F3ULL, 0x7DE40F7509D99591ULL, 0x16EBB238806E9788ULL, 0x39CC4FE4C7F718F5ULL),
+     S256Field(0xD191A0C13A3C48D3ULL, 0xBBB957373FC912E4ULL, 0x151E6693CF42DE7DULL, 0xECB1472C5A46F8F3ULL), false},
+    {S256Field(0x93D62FB5CE22580EULL, 0xC7132896D2D6F887ULL, 0x6892FFDE64DBD4D2ULL, 0xF94C807466ECDC69ULL),
+     S256Field(0x81E523F67127DB82ULL, 0x9887EC4532371D4EULL, 0x9194BFF6AB5A81F6ULL, 0x5E9C7FDC6785225AULL), false},
+    {S256Field(0x6BE40BAD10C4F21FULL, 0x5024A9594D03DA7AULL, 0xFCC02068DB1999D2ULL, 0x8CCCB86C6AD5D162ULL),
+     S256Field(0xF7F126EA729DFEA0ULL, 0x4B92DCAC8264BE28ULL, 0x699BEF549C8758A5ULL, 0x57F8965862751C43ULL), false},
+    {S256Field(0xCCECD819F38FD8E8ULL, 0xF1B0E44DFC69752AULL, 0x4F067CE0F02873A8ULL, 0x6260CE7F461801C3ULL),
+     S256Field(0xC1A84E95B2B4AE17ULL, 0xECD292238051C198ULL, 0xA7F09049776A1EF7ULL, 0xBC2DA82B6FA5B571ULL), false},
+    {S256Field(0xBB0BA46541136602ULL, 0x38C46F480D9E3A5BULL, 0x3D058937F2333B3DULL, 0x87D127280482DFC3ULL),
+     S256Field(0x4F683C41D8AF6AACULL, 0x87A884746FD3BF7CULL, 0x926A276CFF677453ULL, 0x71CE24870A5A03DEULL), false},
+    {S256Field(0x5B205D7348C5A916ULL, 0x3F5C440D535610F2ULL, 0x6B0ACC63DAB54AA1ULL, 0xFD5D7D3FE261E974ULL),
+     S256Field(0xB14B37B07ADB8BDAULL, 0xE5D73814BDCF6FAAULL, 0xD2B43CA679C7B52FULL, 0x0DD83ED0EEB55B07ULL), false},
+    {S256Field(0x45D9909635F7529CULL, 0x38765B98B5BD51DDULL, 0x2BA453C32D344381ULL, 0xDE0DD410981C2612ULL),
+     S256Field(0x63C20C02E4CD88FEULL, 0x178924C6889B7740ULL, 0x9B2109822D7A3570ULL, 0xD70A6E9D10A2145FULL), false},
+    {S256Field(0x3C82F48D38F76D11ULL, 0x1511000FBF851557ULL, 0x69C5BEFC39C292A2ULL, 0xB26C208ADA4CF44EULL),
+     S256Field(0xDC1C00B1E3B7356BULL, 0x050030659D82624BULL, 0xF0C4E87D90CD6433ULL, 0x1F1CF8820949D33CULL), false},
+    {S256Field(0xF94E3B06669E22DBULL, 0xAC993FF59F9C8933ULL, 0xA7E3BD29018C294EULL, 0xFCEB14B8FC7FF523ULL),
+     S256Field(0xBF572DB25C2260A1ULL, 0xAD550E793A4EBE4CULL, 0xFCD8A5A7525F0924ULL, 0x64AA6B3A40D6B8D1ULL), false},
+    {S256Field(0x6F084179A38A2755ULL, 0x53721A716549C550ULL, 0x55C175774B507FAAULL, 0x4E909A623CCD5CACULL),
+     S256Field(0xAF7A49F623CCA3DEULL, 0xB6CD5394D229800CULL, 0xCEF246DD507559DBULL, 0xAE56DA878CCE35AEULL), false},
+    {S256Field(0xA8258959983BA64DULL, 0xBDE60F7788C595A3ULL, 0xBFB0A145EB8E40E2ULL, 0xC367455C22E04C03ULL),
+     S256Field(0x614CC8F96A2181FDULL, 0x42626AACA1778F14ULL, 0x080E0E6E84D964C7ULL, 0x3A520AD069CB6033ULL), false},
+    {S256Field(0x2953CC8D2037FA2DULL, 0x043EC8F575BFDC43ULL, 0x3D8348414BBF4103ULL, 0xE5037DE0AFC1D8D4ULL),
+     S256Field(0xE0E5DC841D755BDAULL, 0xBD5F5B03EC481F10ULL, 0xF9F98D09FB990BDDULL, 0x4571534BAA94D3B5ULL), false},
+    {S256Field(0x388A8A6E177E7775ULL, 0xB5E1559388ED95F6ULL, 0xE58543BACF5291AEULL, 0x9D896A3AFF9633CEULL),
+     S256Field(0xEFCF6D3ABA056691ULL, 0xE899CD7EE299253BULL, 0x94E964ED7250927DULL, 0xDD91A9E43F49BF0BULL), false},
+    {S256Field(0x5FDE04DE3C2A3293ULL, 0x5688B86EE903476CULL, 0xD0EB0A573282F4CDULL, 0x8327B8EE71163792ULL),
+     S256Field(0x6BC854E18E0DF9BDULL, 0x96AFDAB4EE326A41ULL, 0x18BB3EA662797084ULL, 0x04997E266EE0A98EULL), false},
+    {S256Field(0x2421B26C4562C042ULL, 0x092D23234B8DFB1AULL, 0x97D6661D8F9A8ED6ULL, 0x5AE42AAA2A6DB168ULL),
+     S256Field(0xF905CCDF8F79269CULL, 0x94E0DB95107CD8DBULL, 0xAB5C1DDC60389D4AULL, 0x99D93A7C05FF051EULL), false},
+    {S256Field(0xB34881285E85AF61ULL, 0x4E8ED722DD4AE766ULL, 0x59AEB68FF6C21B0FULL, 0x92C23AE426A1C8EBULL),
+     S256Field(0x4E723669C36A2B09ULL, 0x2D23AD82B6286FEDULL, 0x09F217D5C738D579ULL, 0x414CF88F01551BB4ULL), false},
+    {S256Field(0xCE2AF1B2C7B5EBA8ULL, 0x2DABEDC7F918EA36ULL, 0x88D0F4176AF8DF42ULL, 0xFEE5608C76AFDF10ULL),
+     S256Field(0x3F515D368D0B9B5CULL, 0xE380FF42BF905479ULL, 0xB11402F99287C14EULL, 0x3807599134FE58AFULL), false},
+    {S256Field(0x81E3BA4B3C63CAF4ULL, 0xA28FF3AB28F53D52ULL, 0x20A113B4C62A6AFCULL, 0x42E544EB92E667E6ULL),
+     S256Field(0x187AEC09969C29C8ULL, 0x73A50E7B6BEFC5F1ULL, 0xF71F220C17415E78ULL, 0x9FF854E0F91CC671ULL), false},
+    {S256Field(0x80A2BD985E0F09A1ULL, 0xF0A109F1B9403283ULL, 0x83996ED2A4700EFEULL, 0x7AED83B665532CE3ULL),
+     S256Field(0x045D8CDE85857D73ULL, 0xD88B2F300F3F4A54ULL, 0x7DDAFD0AB1032D8EULL, 0xF5B8545F9A31EF7CULL), false},
+    {S256Field(0x25866A0AE4FCE725ULL, 0xE7E8DBD1C6A6C5B7ULL, 0xF5EA905E8F1771B4ULL, 0xE06372B0F4A207ADULL),
+     S256Field(0xB27034F94EEE31DDULL, 0xD7484A7787104870ULL, 0x12A27BB2AD5A488CULL, 0x7A908974BCE18CFEULL), false},
+    {S256Field(0xDBAA8188DA328D6AULL, 0xB24D773A95ADC18BULL, 0xA346899185B08FA7ULL, 0xC663C05BA6234E00ULL),
+     S256Field(0x23B0BB6ABEC9B8C0ULL, 0xDD8551EA512BF9CCULL, 0xD39AFDCF27571317ULL, 0x3331E98D5F721C38ULL), false},
+    {S256Field(0xBC91C8483996DE2FULL, 0x77CEDF2EE0B25114ULL, 0x9CEB30DEEA0FE4E9ULL, 0xD3FC2682DFB86A45ULL),
+     S256Field(0x8C492241D4526F8CULL, 0x4E59B498DF7ABF16ULL, 0xF68B4754D4F781DAULL, 0xC4F0DF99A45F0A18ULL), false},
+    {S256Field(0x5C6C48D103E697EAULL, 0x9CE678FB985F83E8ULL, 0x7DCA1FEC9A3FABD1ULL, 0xC17A4B43FEB2C023ULL),
+     S256Field(0x0EE3B87DDEDC6C87ULL, 0x96E1A1B57F9F02ABULL, 0xCAE178F719601FAEULL, 0x39355C2D55AB5954ULL), false},
+    {S256Field(0x82D2C3023163DA1BULL, 0x9A0EDEE60F93A311ULL, 0x68C9349D7FC11FDEULL, 0x8F618B7CA26790B4ULL),
+     S256Field(0xC7F3121103BDD76EULL, 0x6450C66A3249B6E7ULL, 0xB5FBDA74D7AC5A42ULL, 0x78233F25F08BEB6EULL), false},
+    {S256Field(0xEE8590FE0EC8AE90ULL, 0xCFB26B92E8BBC5DEULL, 0xB86D5B8DAC83F1B8ULL, 0x9798C0F15B7A1E6EULL),
+     S256Field(0x7A9AC2EAE52844D3ULL, 0xE2E4965BD03188E2ULL, 0xDD2EC9494F9C73BEULL, 0xBA40E2AA75A42ED3ULL), false},
+    {S256Field(0x05A1978F11D66B7FULL, 0x7AA692505187DC81ULL, 0x47CF1B90B8928475ULL, 0xFDFA6EE3FB5A2D67ULL),
+     S256Field(0xDAA8F80678E5178BULL, 0xD846F9DD13D78DE9ULL, 0x93C0C1C9A3DA18C4ULL, 0x4D9CF31E224998DBULL), false},
+    {S256Field(0xB80757849265BCF0ULL, 0x69CE2B78411C7D30ULL, 0xADDEA9A461CF220EULL, 0xFD58CE38DE229E43ULL),
+     S256Field(0xF33E7A9CEB996292ULL, 0x87261BFE28F1CD1DULL, 0xD5382AB9A485E4FBULL, 0xFFE0A5E53763215BULL), false},
+    {S256Field(0x40AD6908D0559754ULL, 0x04B10BDDE2A3F585ULL, 0x58D0BBF9DC0CE022ULL, 0x213C7A715CD5D453ULL),
+     S256Field(0xDFF2C27534B458F2ULL, 0xBB4850F5F36A7EEDULL, 0x7013AD06245BA190ULL, 0x4B6DAD0B5AE46250ULL), false},
+    {S256Field(0x532D80119E05DCCCULL, 0xAE3FA3ED4C19A93EULL, 0x9546E096B953D172ULL, 0xB8CEF6E1753DA030ULL),
+     S256Field(0x3014A0CFCC6D5750ULL, 0xDF757FC36A6B6813ULL, 0x6A4D4A74E4D2BD99ULL, 0x302B8A60A6CC9BBFULL), false},
+    {S256Field(0x85BDFEE1373BB31AULL, 0x701F7B6B5FDB97B4ULL, 0xE02A0BDE2EBB5F49ULL, 0x03FB33E779B47385ULL),
+     S256Field(0xE34CBE697D215C9EULL, 0xC65A7C76C47640D4ULL, 0x1E0C161AABBB572BULL, 0xF36AD952548EFE28ULL), false},
+    {S256Field(0xA5B515EBDD9A4AB4ULL, 0x717C36C1855BB7C0ULL, 0x61F16F7B4D0F7A36ULL, 0x4B177CD109EC3E11ULL),
+     S256Field(0x8AADDFE4635AB6F7ULL, 0x6E37E255F1741F55ULL, 0xFDA8F67293626B48ULL, 0x3EC966E9A5E2FA65ULL), false},
+    {S256Field(0x6F46FB29B01C23A4ULL, 0xC22A415847A49CF5ULL, 0xC2A03829B9B9CD75ULL, 0x5E87035206A27A06ULL),
+     S256Field(0x1217996B10D986F9ULL, 0xA2171D874A4CCFDAULL, 0xE71755D1AE2C6E2DULL, 0x5B96644EFB9C9221ULL), false},
+    {S256Field(0x1F3F35D2007B0C66ULL, 0x34A7FEE4656C86FBULL, 0x4472244F60ACEB74ULL, 0xE545C301930D680AULL),
+     S256Field(0xD87F57D271F2D470ULL, 0x97E5828E1B5A239DULL, 0x7E5C6FDA3959BCBFULL, 0xE06A340E8C62955EULL), false},
+    {S256Field(0x4A58190B83648BBAULL, 0x82A0F0B069C3C744ULL, 0xA133EE225F01B398ULL, 0xB2A442157A54F580ULL),
+     S256Field(0x246FAB4A00FB6452ULL, 0xC0D855151C9C17BBULL, 0x9E9FBC978FBD7E31ULL, 0xFE4F5FC2B6936661ULL), false},
+    {S256Field(0xCF6DD22EEBAB27D0ULL, 0xF70B41FA2C45103FULL, 0x1BA9701918D97007ULL, 0x1B908E0F3D453865ULL),
+     S256Field(0x71E8675E40D3D110ULL, 0xB5BBCA93587E51B5ULL, 0x6F357C91817C4B9AULL, 0x9B6D625EEC466B5EULL), false},
+    {S256Field(0xF0CC3A3B08FBD53CULL, 0xE2838C70ADC62CDDULL, 0x8DBB9352A5419A87ULL, 0x4E7C272A7AF4B34EULL),
+     S256Field(0xE0B3941817DCAAE6ULL, 0x530B9614BFF7DD33ULL, 0xE16FD09F6DEF681BULL, 0x17749C766C9D0B18ULL), false},
+    {S256Field(0xEE298464E521B3FFULL, 0x233C0717E9AA750CULL, 0x75E44D2BE9AE24A5ULL, 0x02484E3010C9455CULL),
+     S256Field(0xCC1AE4B90269DA7EULL, 0xAD7006DE923AC8BBULL, 0x07EC2B3C2B2D0EEBULL, 0x9619D0A0AA23E30DULL), false},
+    {S256Field(0xF96B79FA804BA7B9ULL, 0x20D6A47030741751ULL, 0xEF79B70D672C954EULL, 0x16C1C526CFB6CE57ULL),
+     S256Field(0x475BE3A51C5BD741ULL, 0xEC755C01BDC9A9CCULL, 0x062627459C8A94DEULL, 0xDB157F7C34031439ULL), false},
+    {S256Field(0xE836487AA36683FAULL, 0x95821B5380EC0825ULL, 0x87A89CE774527B66ULL, 0x03973CD753F931AFULL),
+     S256Field(0xDF5FB2B77F4A577FULL, 0xD77884E18FE981DEULL, 0x643E12B632B5A26CULL, 0x38CF5A2CC30CA3A3ULL), false},
+    {S256Field(0x180B3999C0BF6F06ULL, 0x713C133225043B57ULL, 0x1C2C04F4B0205765ULL, 0xBA6A9BBA72ECF151ULL),
+     S256Field(0xE32BEF70781DB551ULL, 0x9E5D14F7AC697AAFULL, 0x32020BF2E558BD8EULL, 0x13771E38B34A11B0ULL), false},
+    {S256Field(0xFD1EF9F071231A43ULL, 0x44D514D665AD43B9ULL, 0xD8AED95064DE442FULL, 0x35C5BCCC27CC4DD2ULL),
+     S256Field(0x7DB72E451620C8F6ULL, 0x4CF7A4CC063CF0AEULL, 0x734E5820B6FA589DULL, 0x0E3675723B9746CEULL), false},
+    {S256Field(0xBF40BC56FDD40609ULL, 0xC74190980D81CD76ULL, 0xA122F12FC588356AULL, 0xFD479C245C5586BCULL),
+     S256Field(0x9DE2F1366A64CA53ULL, 0x9113AED7261CA473ULL, 0xF2CAD7A43C9841FDULL, 0x3069CFB52694AFEFULL), false},
+    {S256Field(0x4DB702F52B799A7FULL, 0x4F18B6CD53B8E842ULL, 0xBDED8EB9AF2C7D54ULL, 0x6C40002A3ACCD864ULL),
+     S256Field(0x8B5CC82CD3C81E32ULL, 0xC07ABD4C820483F6ULL, 0x690B836A0E1DDCBDULL, 0x95C2DC1530B635BEULL), false},
+    {S256Field(0x32427E2840FB27B6ULL, 0xC76E3DB2BE430576ULL, 0x10F238AD61686AA5ULL, 0xFEA74E3DBE778B1BULL),
+     S256Field(0x701D3DB7F23CB96FULL, 0x126B596B973F7B77ULL, 0x7CF674DECCB6AF93ULL, 0x6E0568DB9B0B1329ULL), false},
+    {S256Field(0x5DD81AE9BE889756ULL, 0xF27B64997B004BB2ULL, 0x226CD97B271899F3ULL, 0x762E8BC33211FEA8ULL),
+     S256Field(0x25E259E07CA6B774ULL, 0x1972DB314884FA5EULL, 0x3C7CC4F14982E347ULL, 0xC02894260AF3E97CULL), false},
+    {S256Field(0x26F75E970975D2EAULL, 0x1E52ACFA1014E8EAULL, 0x8E19BDBB2308F4A9ULL, 0xDF077D47DF609534ULL),
+     S256Field(0xAA3C2D9E31936F95ULL, 0x8A1EC5B84FBDD277ULL, 0x24C8425C98A2527CULL, 0xF8617A8800EF7F44ULL), false},
+    {S256Field(0x5B8491FBBC4C92D7ULL, 0x35DB4D6EE54391B4ULL, 0x2E17DEA8334B1429ULL, 0x9F3E7D758BD3DA03ULL),
+     S256Field(0x6CBBBFCFB14906DDULL, 0x452A2303D694E118ULL, 0x58862B21CBAB1502ULL, 0xECD2841EA77D466BULL), false},
+    {S256Field(0x5AE0D732B2A8C483ULL, 0x174B0C88C5040AC3ULL, 0xDC38C3D22EF95281ULL, 0xA0CC795D7B5CCF9EULL),
+     S256Field(0x5096745592CC6BA9ULL, 0x6B348F1BDF693605ULL, 0xE2374FC97231DF78ULL, 0xABC30122F8B3873EULL), false},
+    {S256Field(0x170F1B6BC5DD3AEEULL, 0x13153A8A8F96D2F2ULL, 0xE0E22A9AC6A976CAULL, 0x6D1C50A51553C7CCULL),
+     S256Field(0xFEE354E4FDF597F7ULL, 0x851E310AA8ED53ADULL, 0x977272002287D474ULL, 0xAFFF148E06ABDFDCULL), false},
+    {S256Field(0x678CA9B7E4A6D0BBULL, 0x659D3122F5A1AFDCULL, 0xF311A6D8A8A6418FULL, 0x5E5F1D618B97F9F3ULL),
+     S256Field(0x168384791033EAF9ULL, 0x72555F2E506F653AULL, 0x358F6BCD04E721DAULL, 0xD7B1502B06A7E6F7ULL), false},
+    {S256Field(0xDDA9B5E44F005E3FULL, 0x5AF68E31BEC39BD2ULL, 0xFFD3CB9ACE01A149ULL, 0xF8138A6B3C16427FULL),
+     S256Field(0x42D7E0202F357EB7ULL, 0xF4EC41BD554BE213ULL, 0xF9D015E57AA5CB51ULL, 0xCA758F3BEFB4EBD9ULL), false},
+    {S256Field(0x52C02A4417BDDE39ULL, 0x1544E179B7604329ULL, 0x10A2570D599968D3ULL, 0x76E64113F677CF0EULL),
+     S256Field(0xB4B1752D1901AC01ULL, 0x5E2A33D2B56D2032ULL, 0x577066D70681F0D3ULL, 0xC90DDF8DEE4E95CFULL), false},
+    {S256Field(0x2F05091CC078EE8DULL, 0x4EBF20CE50691944ULL, 0x25FF7263AA9B4FF6ULL, 0xD08E57AD859DA9BEULL),
+     S256Field(0xE997F4DC2DA63E86ULL, 0x123EF7CF9422ED9DULL, 0x2D6172EE757E6DF4ULL, 0x852E97984AB488D7ULL), false},
+    {S256Field(0x15914670429129ECULL, 0x0CAE3ACF1E482548ULL, 0x5F58BE80ECD31D08ULL, 0x7DA6C085E4D44D27ULL),
+     S256Field(0xEB50AEE2ACD9FF0EULL, 0x0448C08654CA586AULL, 0x511D0207491627BFULL, 0xF498146BB9F41857ULL), false},
+    {S256Field(0x4F83D49551654F22ULL, 0xB2F7F394231AAEE9ULL, 0x21BE9001BE69D94FULL, 0x90D090CFF5C1BE6EULL),
+     S256Field(0x0F5DE057601A43E1ULL, 0x6DD635653DA3F874ULL, 0x953F021E06BF7033ULL, 0xCD569A1D2BACF61AULL), false},
+    {S256Field(0x1B6EF651C76B19FAULL, 0xD9D6E06D068819D7ULL, 0xC7322C310821292EULL, 0xDA4798587CF1D1ECULL),
+     S256Field(0x6AA26EEB326F5AF7ULL, 0xA67BD13E9553FC20ULL, 0xD17369077E16569EULL, 0xEBB1D7789BCCAF01ULL), false},
+    {S256Field(0xCD92FB65B9135DBDULL, 0xF0C087AF39D8631EULL, 0xD817AAF582E9897CULL, 0xE3E47504A8DDEE6AULL),
+     S256Field(0x6906AF3E4748045DULL, 0xA5A202FF5EC95DA9ULL, 0x0B98C81952B83FFEULL, 0x930A5BF809CBC6C4ULL), false},
+    {S256Field(0xCBF0B9E5CDEE455FULL, 0xFF67FFE6E8CE4075ULL, 0xA4745338F80BDB4AULL, 0x7E8C656FE870A9B0ULL),
+     S256Field(0x173DE998171B9CBAULL, 0x4AA2D16746F46627ULL, 0x2A3F760F4803A53BULL, 0xBDDDC632CA30740FULL), false},
+    {S256Field(0x37796B9B6698B59EULL, 0x0A335925893447A4ULL, 0x5BEB035AB3E3C726ULL, 0x3DF841F891A95EB1ULL),
+     S256Field(0xBCF8E6796B92BAF5ULL, 0x7BFC867B214949F8ULL, 0xDA02BAE8F11CF386ULL, 0xB38FE6DF98B090C1ULL), false},
+    {S256Field(0x3AB150242BCBB891ULL, 0x8F7CC643DF26CBEEULL, 0xE8281BAA743F8F9AULL, 0xC738C56B03B2ABE1ULL),
+     S256Field(0x17E735D9699A84C3ULL, 0x82314EEF7880CFE9ULL, 0x7F718F2EACBFBBBBULL, 0x893FB578951AD253ULL), false},
+    {S256Field(0x34BAAF338761D58DULL, 0xCA4C9BE408D60E2FULL, 0x10A240A35720DF7AULL, 0xB8C46127823F6146ULL),
+     S256Field(0x638EA0BA9D1051A4ULL, 0x3F7504785E107C5BULL, 0x14A458F697F3C505ULL, 0x8F9ED96C5170E37DULL), false},
+    {S256Field(0x2DB0B304050B0040ULL, 0xF3F47DB9F0134ADCULL, 0xA350C993FE9A3671ULL, 0x08D56E9F710271F7ULL),
+     S256Field(0xB58E267A5B3FD0A1ULL, 0xF6D7C4720E1782BEULL, 0x1FFD150A8D79B285ULL, 0xA12185AEBD0A9AA2ULL), false},
+    {S256Field(0xF56563DF13573B7FULL, 0x889A1C5ED30B6270ULL, 0x41E20F977BE65A37ULL, 0xDC13F232D42FCE63ULL),
+     S256Field(0x42ACD2284C1F2BA6ULL, 0x7045547017404B1CULL, 0x3C7410DA84A90A76ULL, 0xC909BA80429E340CULL), false},
+    {S256Field(0xB02F590B87AE9CEBULL, 0x226C21EA70EF2D14ULL, 0x3AF19565DB2119A8ULL, 0x25C02DE601DF7F07ULL),
+     S256Field(0x47090D134BC6E275ULL, 0x37C641DF0A658726ULL, 0x0C884E0DCFAD11D5ULL, 0x8A9FEAD2C812383CULL), false},
+    {S256Field(0x1F8098F6EC5A3C34ULL, 0xAECE82C0295949FEULL, 0xE8AB9F4CA7AE3E58ULL, 0xFEDD9D1B2CF8E49CULL),
+     S256Field(0x62B54BF4E13D7714ULL, 0xADAEB54699BF8297ULL, 0xB0BE85312C8F4B00ULL, 0xA52E24C31853B8E0ULL), false},
+    {S256Field(0x9B4E54D1AAB6A396ULL, 0x73021B91A1136076ULL, 0x2DEE2D7F5E8488B3ULL, 0x3E0E3286BC6EA48CULL),
+     S256Field(0x2EB31E48D980E27EULL, 0x6AB01041F3468F6AULL, 0x4F31FE1DEB453FC6ULL, 0xCA448172FA3B3796ULL), false},
+    {S256Field(0xAAF35862341023ECULL, 0x5645D8F76FECF570ULL, 0x4982E0200982B9AFULL, 0x344AB93080C32D28ULL),
+     S256Field(0x04F898291E1EEB87ULL, 0xFC4E976AFC3995D7ULL, 0x73F8F2D1EA514C5FULL, 0x6E1C2B042B24462AULL), false},
+    {S256Field(0x372E9F6588F6C14BULL, 0xD1D72E5F3A925014ULL, 0xE264C7637C972877ULL, 0xD895626548B65B81ULL),
+     S256Field(0x79363ED75D7D991FULL, 0x03428D632BB067E1ULL, 0x728EC60818C340EBULL, 0xFEBFAA38F2BC7EAEULL), false},
+    {S256Field(0x80BA87FF6127B756ULL, 0x03428BE4ABA09704ULL, 0x72D362DA5060B416ULL, 0x6D8C782F716DF126ULL),
+     S256Field(0x6551F74ABF172571ULL, 0x4E3AA6DA2D7CDCCAULL, 0x1459A82D36D34DAFULL, 0x99AEDF0896FDB911ULL), false},
+    {S256Field(0x4DEE1A73758CF17AULL, 0xF1F85DCBA5882352ULL, 0x8D059AEF1B4097F8ULL, 0xEBCABEDD95BF7ACAULL),
+     S256Field(0x446CDC5F5CAA0CCDULL, 0x10FAD212D0ACE95CULL, 0x02C00A1B67C32E6BULL, 0x47D3CE0F8F22B9CBULL), false},
+    {S256Field(0xBCEEE515AC855C5BULL, 0x1185621A017C8AFBULL, 0x45331A369E17FC28ULL, 0xE8DF4D2E4BD4CE24ULL),
+     S256Field(0x59D5E72C2E465650ULL, 0x9663B55F1E1E4D7DULL, 0x4444DB4F59EF32C5ULL, 0x6C57FD70C47F9B26ULL), false},
+    {S256Field(0xD08F5BDA52E7E454ULL, 0xFE32EFEF0F0E6150ULL, 0x912486023A981662ULL, 0x4068D3D718ECA832ULL),
+     S256Field(0x779ACDE5D8EF191EULL, 0x988D21ED13C37332ULL, 0xB9EC14597D9D38D1ULL, 0x8CD853B7254A47AAULL), false},
+    {S256Field(0x0857ADF846C5D939ULL, 0xA475A2877BA933DEULL, 0xB55BF32E60CA027EULL, 0x12550ECDB1D825E0ULL),
+     S256Field(0x92A74FC559E757C9ULL, 0x838B741FECD8D431ULL, 0x5448E43C17724A72ULL, 0x7B8F8334F872D7A7ULL), false},
+    {S256Field(0x38D0AAC656C8A56FULL, 0x85093C5434F37421ULL, 0xC69BB7B53AFAD08FULL, 0x944D671AC3B585D4ULL),
+     S256Field(0xB9F4DC65DA7BE289ULL, 0x67D4C174DD06517EULL, 0x4C143936133AC619ULL, 0xA71065977B501FFFULL), false},
+    {S256Field(0xAEEB8A18AE08F15AULL, 0xFD69E56DC812900BULL, 0xFE6B03655AD3C305ULL, 0x86A54E91CD099A0CULL),
+     S256Field(0x3524D1E7C1388308ULL, 0x77129D125B35254DULL, 0x3A72A8D06D756867ULL, 0xCFEE614837A78460ULL), false},
+    {S256Field(0x49150A564F676E03ULL, 0xCEFFC73693E84EDDULL, 0xEB0F6433571E8761ULL, 0xB8DA94032A957518ULL),
+     S256Field(0x1488E4E74EFDF6E7ULL, 0x92CC584D95FF3B51ULL, 0xD7C99CC9762808B0ULL, 0x2804DFA44805A1E4ULL), false},
+    {S256Field(0xEA19849DC6E1346BULL, 0x5ABE7B10385AF1C5ULL, 0xE54C761F14D152C0ULL, 0x069068FF0982D10BULL),
+     S256Field(0x7BB58A54D7226C13ULL, 0xA4F6893994C6026EULL, 0xDA85DB2BD086442AULL, 0xB863E3E090BFDE26ULL), false},
+    {S256Field(0x30E691FCDCA1F6A1ULL, 0x068CBD14348CFF1AULL, 0x5286DC5CB1E86CE1ULL, 0x898C3493CB259761ULL),
+     S256Field(0xA4ADC20F164F647CULL, 0xB2A7CF979F2BD79CULL, 0x9D84542452AC6E93ULL, 0x75F75986AB56A554ULL), false},
+    {S256Field(0xAA69E03C3D1E3998ULL, 0x5E56C8B917A04328ULL, 0x1A5299D7022A274EULL, 0xB213E2FED2918BF0ULL),
+     S256Field(0xEC2CBDC6325FB81EULL, 0xD534165BEBDED175ULL, 0xC3D61EBF83A43BC3ULL, 0x229F8EC20F2D3C12ULL), false},
+    {S256Field(0x00BE1FECA25BE234ULL, 0x0E83E3E70DDF3507ULL, 0x5D1D0BA691606E06ULL, 0x4B3B3AD816C7F93EULL),
+     S256Field(0x063B7E03920E8362ULL, 0x41E7FD92CF211B84ULL, 0x7875E96DFD8CC04CULL, 0x5EEC023B85DABC9CULL), false},
+    {S256Field(0xB96634A7E289F55EULL, 0x2976B0F0E2C76707ULL, 0x020251B0278965BEULL, 0x9F7B88B6DDB04F96ULL),
+     S256Field(0xB3CD3B65FE1E4BDEULL, 0xC0E536E0EB10A2B1ULL, 0xBE3146B4298FC71FULL, 0x32F9F784C70410F7ULL), false},
+    {S256Field(0x16549C8C1DFE1D2BULL, 0xC493F509E56878E5ULL, 0xE76CCADFD3FB73A4ULL, 0xD58A43E9CB7448E3ULL),
+     S256Field(0xFCF2795B8CD50922ULL, 0x54D9BA215CBD6FBFULL, 0x10A729132828276BULL, 0xFC17866BA05883CFULL), false},
+    {S256Field(0x124151BE249C795EULL, 0xED4406AA99CE805EULL, 0xCD6D969C3C27EA4EULL, 0x21D2713971118310ULL),
+     S256Field(0xB0012EC399208ECEULL, 0xD671944A4ADFB761ULL, 0x17735B85522BB4C3ULL, 0x94C5F9B4B075ACEAULL), false},
+    {S256Field(0xF1A11778E3C0DF5DULL, 0x2019EFFB5156A792ULL, 0x7D8ADAB9475D7FABULL, 0xE80FEA14441FB33AULL),
+     S256Field(0xFCB4291B6AC9EC78ULL, 0x2D155E80AF322EA9ULL, 0x1E89768CA3CA9447ULL, 0xEED1DE7F638E0077ULL), false},
+    {S256Field(0x2C0359ECD7592D55ULL, 0x06D5B94740E35019ULL, 0x08AFEF69633CE3B1ULL, 0x5D2EC6DBC4A10526ULL),
+     S256Field(0x266E5D0EAF5183A7ULL, 0x0E2A7BCDAD115174ULL, 0x58F710FA268CD695ULL, 0x0A92CDF89C6E45EBULL), false},
+    {S256Field(0x991F4B49FE8F9F5CULL, 0x7361F1E159880A51ULL, 0xFE2CAE34215F404DULL, 0xAC371DC3B11BF742ULL),
+     S256Field(0x17A83FF3325A503CULL, 0x22953458EE751E1DULL, 0xFF2101E73254E735ULL, 0xC51616C18709A477ULL), false},
+    {S256Field(0xF4A1C8D519E33446ULL, 0x40893BC452AF385DULL, 0x9348C0BD0222A17AULL, 0x8942003A14F1840CULL),
+     S256Field(0x40D38A00E6387689ULL, 0x6BFD773679E74F98ULL, 0x4D8B2D6D0EFDE4E0ULL, 0xA9FD039595A5077AULL), false},
+    {S256Field(0x3D728C95B913CB26ULL, 0x99EB419C013BD6D0ULL, 0xA2CDA44FF5505C98ULL, 0x2770266B30A342A8ULL),
+     S256Field(0xBFE71733F348A7A2ULL, 0xE940C91BCC815BEBULL, 0x5552D24D07F2B324ULL, 0xF649BC5E79B0DB1AULL), false},
+    {S256Field(0xF0AAA021595E8247ULL, 0x97BFDC455686CD1AULL, 0x78E5E6E01CF8BA90ULL, 0x75E4D0D383CBED21ULL),
+     S256Field(0xCA23FD9D59982D22ULL, 0x7DDAB5B6EA9AD893ULL, 0x741F970EC7B726D4ULL, 0x1FCE42A175410990ULL), false},
+    {S256Field(0x7479F44DA6333323ULL, 0x9CBBBC1C68F4ABF4ULL, 0x3F020D605984DA84ULL, 0x3ED1B6383361BBF0ULL),
+     S256Field(0x4B13FC48B5D61BA3ULL, 0xA9B728A10B78F729ULL, 0x5D97C989688F929EULL, 0xD84F2DA48B5B4EE7ULL), false},
+    {S256Field(0xF25057D4B33980BFULL, 0x68A3702E50DD00BAULL, 0xB846FD772348DD43ULL, 0x70FDD2F06A758181ULL),
+     S256Field(0x12EEA8CEA0B75785ULL, 0x0A10358385D74A56ULL, 0x957A410D11EE596BULL, 0x5EDFCAC0D0D58696ULL), false},
+    {S256Field(0xDDC07BBCC4E16070ULL, 0xF2A182031EFD6915ULL, 0x13BA48E51D567543ULL, 0xA301697BDFCD7043ULL),
+     S256Field(0x0C0D1A041E177EA1ULL, 0x1735DBF7C0A11A13ULL, 0x081809FA25D40F9BULL, 0x7370F91CFB67E4F5ULL), false},
+    {S256Field(0x67012700138011FCULL, 0x83596A67AD728562ULL, 0x156B133082200A4DULL, 0x6E8313A30815EB11ULL),
+     S256Field(0x6ACB69FA3F15AB7DULL, 0x26AF915AE9C51F9AULL, 0xC1A12DB201DAC304ULL, 0xC147818BDC24F204ULL), false},
+    {S256Field(0x53A749B8D00E6BA7ULL, 0x3D36EC5B44916F7FULL, 0x2BD1E038A4D9E1B4ULL, 0xF952A9099784851FULL),
+     S256Field(0x8DBAEEE50175E4C1ULL, 0x5557167B4C62A2B9ULL, 0x861376A2E27FA0F6ULL, 0xD8A93A5B08ABCEBFULL), false},
+    {S256Field(0x690065A283AA0E93ULL, 0x8F2E3943AEFB1F62ULL, 0x504031A19D9E893AULL, 0x94016D5E31D3FEE7ULL),
+     S256Field(0x38EED26887ADDAC2ULL, 0xF484373BAA57B07AULL, 0x40355D354EEE6FD7ULL, 0x675032EE5C454D96ULL), false},
+    {S256Field(0xB0F4862E0266B17BULL, 0x023568A20262BB32ULL, 0x1BB978846A9F09C2ULL, 0xEF22D174D59FB289ULL),
+     S256Field(0x32A6E04379DAC83EULL, 0x3EE7276F71C341B7ULL, 0x68F9CCC3AE34A107ULL, 0xBC5784C97AB24C75ULL), false},
+    {S256Field(0x2313015A92D382A0ULL, 0xF28DCBBCE2ECD9AEULL, 0x39CACC780B2DF927ULL, 0xB5F7EFCE4CEB892DULL),
+     S256Field(0xBA2F0ABBA5B4B532ULL, 0x71FB096D29ACF8C5ULL, 0x3C0957C6E0CBDDD3ULL, 0x6843545B51C3F235ULL), false},
+    {S256Field(0x7E692464412CFFA5ULL, 0x89ED4208668CC5C4ULL, 0x408754D8FBD46243ULL, 0x1CDDC3D2B2E71076ULL),
+     S256Field(0xADE6D89CD521954EULL, 0xC41C98426B36B528ULL, 0x3FDB126BF942B08AULL, 0x1E476A0CB2F1F8A6ULL), false},
+    {S256Field(0xD35FE43934A9F22FULL, 0xCC0819C5217A8E2AULL, 0xF21F8B8B948835B0ULL, 0x2ACCB359F25CE939ULL),
+     S256Field(0x7B75DCB3B75C4927ULL, 0x154BD7BEC5BA550BULL, 0x19213A37EDF0EDF1ULL, 0xD518A4E9588AD2E5ULL), false},
+    {S256Field(0xAB7AC63E3FB04ED4ULL, 0x08CC330B11307FFFULL, 0x463F9D0512678DE2ULL, 0x90AD85B389D6B936ULL),
+     S256Field(0x991D4D48CB6EF150ULL, 0x39AEFABE1582894DULL, 0xAFFDCBD9427222B8ULL, 0x0E507A3620A38261ULL), false},
+    {S256Field(0x6275DB33B0B7B678ULL, 0xF13C4311BCF63816ULL, 0xA1986BCA426B6C76ULL, 0x186E497334E4231BULL),
+     S256Field(0xA7A076F2F8D91FC1ULL, 0x11077225449535DCULL, 0xAA7FC825C0B7E67EULL, 0xC0D460E49807BD84ULL), false},
+    {S256Field(0xCF06E5CBB3421FB8ULL, 0x984971F2EF5A55D0ULL, 0xE7E06B34C3B72412ULL, 0x061C8D834F6DBF62ULL),
+     S256Field(0x995EF6684E3CCD80ULL, 0x8067134B3A6FCDD2ULL, 0xBA9392590E05EB5CULL, 0x6DFC6AD99003B4B7ULL), false},
+    {S256Field(0x7124BE18AF6B35A4ULL, 0x889F37A6AB27FB48ULL, 0xB7363240733A68ADULL, 0xF6A6B63A208EE513ULL),
+     S256Field(0xCAEB6FEC81F422A6ULL, 0x19D5756E75EE1862ULL, 0x1CAD3704F560186FULL, 0x3DF7C8A8002D138BULL), false},
+    {S256Field(0xB96823E8A6954C11ULL, 0x7FA8A43C1560D018ULL, 0x220D1B0F150778FFULL, 0x87A2FC28C286C376ULL),
+     S256Field(0x756E332E272A8B45ULL, 0xCC48933F2A78124BULL, 0x97B1948DA0D27532ULL, 0x33AD518B45AAECEFULL), false},
+    {S256Field(0xAE47472AE2706AB6ULL, 0x3C0B341DD2E53C0DULL, 0x84556EFCBC384CFEULL, 0xE1472E046E7881A6ULL),
+     S256Field(0x36E86A169D58DE05ULL, 0xAA589D55453CD275ULL, 0x83F691978C8621F8ULL, 0x82CD92AA47C58FC6ULL), false},
+    {S256Field(0xEBFAE54207A84FB6ULL, 0xC42368750FA15021ULL, 0xDE8B4D601E48B9EBULL, 0x1CAF92C804F8AEF5ULL),
+     S256Field(0x16B1819027149109ULL, 0xEC1CC1696A2CE676ULL, 0x481A64F8FF101622ULL, 0xBC24B85AC976E53AULL), false},
+    {S256Field(0xB768CFE14A955911ULL, 0x107E16A260DED52DULL, 0x2589EFE9B3D78397ULL, 0x705BFD69AF09650DULL),
+     S256Field(0x8BB7C693FFD200E4ULL, 0x297F3B522A42E72DULL, 0xA7E63D81F54051FAULL, 0xE14AA4130B73F990ULL), false},
+    {S256Field(0x1B7B444C9EC4C0DAULL, 0xE88C5678723EA335ULL, 0x9239C1AD981F162EULL, 0x8F68B9D2F63B5F33ULL),
+     S256Field(0xF23CBF79501FFF82ULL, 0xBBEA2CFE95510BFDULL, 0xDE1D90C2B6BE215DULL, 0x662A9F2DBA063986ULL), false},
+    {S256Field(0x18E2B8EDD23809FAULL, 0xFD845CB351D954BEULL, 0x8BA93363F2451F08ULL, 0x38381DBE2E509F22ULL),
+     S256Field(0xBD707518331FED52ULL, 0x3681FCCB32D8F24DULL, 0xB09405A5520EB1CCULL, 0xE4A32D0A0FB917DCULL), false},
+    {S256Field(0x3EA4264897C2A310ULL, 0xF186AEA540122630ULL, 0xF6921B82AA4699A1ULL, 0x49262724E4372AE6ULL),
+     S256Field(0x0C41B6815E27DED0ULL, 0x6D163612A75FF8CEULL, 0x5A2CFA569714303BULL, 0x1337E773BCA7ABF9ULL), false},
+    {S256Field(0x1384B079CEBD2D31ULL, 0x4DCC1A56FF06DB8DULL, 0xD5E253B3E477E2F8ULL, 0xE306568C1A240C90ULL),
+     S256Field(0x692B408392546E44ULL, 0xFFBC8042BE373826ULL, 0x888F2B107F7D0DB6ULL, 0x0EAC6FE378934260ULL), false},
+    {S256Field(0xC530C39E363136B0ULL, 0x74EBF8D9AAB41DD9ULL, 0x271B0E7623FBD633ULL, 0x3B9E100E2428CEFCULL),
+     S256Field(0x953EC16F6CDBBC8AULL, 0xA2AE28A33AD31F81ULL, 0xDF1533EB8F475B26ULL, 0xFAFB98152D16BB71ULL), false},
+    {S256Field(0x9608F0472F485D3FULL, 0x17CA07688107BEEEULL, 0x2B76CA80F5DEDEF7ULL, 0xBB0AAD49712AC9A9ULL),
+     S256Field(0xE79392503CA2F975ULL, 0x895A5AFA31670BFFULL, 0x8ECD201F7297DA34ULL, 0xEA699C53C5835479ULL), false},
+    {S256Field(0x4AEED33A36718DC9ULL, 0xE1E58B4DB01123DEULL, 0xD4E8EB197AFE0113ULL, 0x79090AC8E4EEFCC0ULL),
+     S256Field(0x963322B11CFAE7C5ULL, 0xDD36AFB70BA9008BULL, 0x13D816CBCD9AAA56ULL, 0xEAAB722B91905B8FULL), false},
+    {S256Field(0xA269694C7F60C7D1ULL, 0x8DD71DE7CD775AD2ULL, 0x1C03DBBCE549BA66ULL, 0xE77C81ADE9F97B55ULL),
+     S256Field(0x4EC581F282D72449ULL, 0x631470F71C2986D3ULL, 0xC5FC3B323EA81543ULL, 0x3ACF1478EEF81321ULL), false},
+    {S256Field(0x6686FD5053231E11ULL, 0x1F48E86503681E3EULL, 0x5FF99FF9198C3609ULL, 0xE4F3FB0176AF85D6ULL),
+     S256Field(0x822C38576FEB73BCULL, 0x6CC7E74EC951D1C9ULL, 0x1661A6D0EA02B728ULL, 0x1E63633AD0EF4F1CULL), false},
+    {S256Field(0x5399F04E6BF05BD6ULL, 0xA2F56E03212A9946ULL, 0x0832F51FEB470DECULL, 0x900C3241BEE44FE9ULL),
+     S256Field(0xDE52AD3BF00D358BULL, 0xD69853583C4EFB15ULL, 0xF95C7204570B2439ULL, 0x6C31F9E8E8B1F0F5ULL), false},
+    {S256Field(0x7A7C28CC9F105C50ULL, 0x82E0DEEF7B138525ULL, 0xD628CC3403C233CDULL, 0x5A8D0362AB0590AAULL),
+     S256Field(0x5C9B201838A4CDE9ULL, 0xA605F68A66D013C3ULL, 0x936A6B724143FF74ULL, 0xC059EAB113D4E536ULL), false},
+    {S256Field(0x647E18B9B2D64FEBULL, 0x3772F8A59292292CULL, 0x48EF3A5776CBA4E8ULL, 0xD93F4D031232F60AULL),
+     S256Field(0x7B0FBD5934698359ULL, 0x93E0430BEEC90DA3ULL, 0xA237311C54DC8C4DULL, 0x7925555D45CB2733ULL), false},
+    {S256Field(0x722204CD439FBC84ULL, 0x7E7062916057A016ULL, 0x1B14E2BC662AC65BULL, 0x2F0769C6E36F2844ULL),
+     S256Field(0x3FB902DE1C201BECULL, 0xCCA79B6A4C4DD5D7ULL, 0xFA5DF007990E2149ULL, 0xB434F3724D73BDDDULL), false},
+    {S256Field(0xD537EACC86A758EAULL, 0x91188318927F19C4ULL, 0x9586895A15416E39ULL, 0xFE7E6780559E0309ULL),
+     S256Field(0xE4F22D95DB7AB649ULL, 0x3B801707443120D1ULL, 0x88C08E169849251FULL, 0x38AA6967A281DCB9ULL), false},
+    {S256Field(0xDE7156268CFFFEFAULL, 0x1018044F70651AFAULL, 0xD6DF6F9150C3AF85ULL, 0x91BAF5CA75383127ULL),
+     S256Field(0xC7D36F34DF7F6FAFULL, 0xF4BEF310E6FD303DULL, 0xE5D969F127DD3D92ULL, 0x04E5CF119347BCEBULL), false},
+    {S256Field(0x2FC0917E8D33C546ULL, 0x82575FB3285EDAF3ULL, 0xCB2C5373E0F5DDD7ULL, 0x44584121CB3F78A7ULL),
+     S256Field(0x60A6D187000B4FD4ULL, 0x852F0A3CFB2CA736ULL, 0x77225EAE391ADA20ULL, 0x308D9377F3F8753AULL), false},
+    {S256Field(0x16FB6EAE20EAE29EULL, 0xC7034F2F0D4E1D07ULL, 0xEB961537A45A4266ULL, 0x8C00FA9B18EBF331ULL),
+     S256Field(0xE7D2A4C66702414BULL, 0xC2FADAFA81E36C54ULL, 0xA9DC343A3736C974ULL, 0xEFA47267FEA521A1ULL), false},
+    {S256Field(0xC3F95603EBFD913DULL, 0x50A680E6EE54C9EAULL, 0x74D07A084C2A8D20ULL, 0x36362AA7E907DDF8ULL),
+     S256Field(0xC44F9AEAC52E243DULL, 0xD830BB10D6B2FAAFULL, 0x3416244370DA2A82ULL, 0x48F278676CB8AFD5ULL), false},
+    {S256Field(0x7CABABF9AD132896ULL, 0xFCB1E3BAB7BC6C96ULL, 0xF295AD962DD9200DULL, 0x4487976DF32A1E02ULL),
+     S256Field(0x48C01B12AF685248ULL, 0x06B40D5A6276AA7AULL, 0xEFC9A90774561A33ULL, 0x27BD5860D115AFE1ULL), false},
+    {S256Field(0xE08156F6BFA2670CULL, 0x7400F82BA06273E6ULL, 0x8B6A9CAA83350324ULL, 0x4A4D3AC28BCB8378ULL),
+     S256Field(0x808B9FFDD6C1764DULL, 0x4930594CBF29BEEDULL, 0x17E7711DDEF02B9DULL, 0x70ABB91C01845A4FULL), false},
+    {S256Field(0x0D96AFE24CB24AA7ULL, 0x903108C639345C53ULL, 0xC3AE6FD89FF8FE18ULL, 0x5F7B2D190AE91802ULL),
+     S256Field(0x6D7807434A693D7DULL, 0xCE8DEB7093C81D0CULL, 0x30A3F80A3CE67C47ULL, 0x07703600C4FDF2B3ULL), false},
+    {S256Field(0x4191BC5F2F7FB8BDULL, 0x7BC464A15FE4090AULL, 0x2AEC24E6D94886D8ULL, 0x51397451339D90D0ULL),
+     S256Field(0x8094AC2D83908C0FULL, 0xFAFC32D3E3F98D5AULL, 0x4B88FEFDAE815C47ULL, 0xFCD7143E47643BF3ULL), false},
+    {S256Field(0xE2B74915EE36CA73ULL, 0xEAC864D36BBBF3EDULL, 0xAA429112BF014887ULL, 0xCF8316D62BFBDFB8ULL),
+     S256Field(0x5B4921942EC25534ULL, 0x1C961598D88D710FULL, 0xE384450890DCCA68ULL, 0x09FEB58DEB5D9D73ULL), false},
+    {S256Field(0x3C8937D6B752F97DULL, 0x5A2EFBC75F347661ULL, 0xE539D28668CFA616ULL, 0x8610DE9A4C4BB49DULL),
+     S256Field(0x8057DCD41F1B1AF2ULL, 0x57AB4D9F545543E0ULL, 0x937CD99B2533F99EULL, 0xD31997A02B630BBCULL), false},
+    {S256Field(0x997FDDFC60CB3E41ULL, 0x143D084F308B92C0ULL, 0x3E10CEC0A9E98ED3ULL, 0xE7A26CE69DD4829FULL),
+     S256Field(0x0E8A9421CF2CFD51ULL, 0xD0A6B2C0420E83E2ULL, 0x471B006A1AAFBB18ULL, 0x2A758E300FA7984BULL), false},
+    {S256Field(0x70F9FD2BFAEE42DBULL, 0xD9BBBC5B4730714AULL, 0xFC7B6EDB91ECBFC1ULL, 0xCC3427E7D9B59150ULL),
+     S256Field(0xC6229C0115D87BDBULL, 0x10E5CBAD8E72422DULL, 0x885E3FD3FB215200ULL, 0xEA249841A521C6A1ULL), false},
+    {S256Field(0xFF4366C67ED4A086ULL, 0xB1D75C158E9C410EULL, 0xEC83C585FBCB5CF4ULL, 0x948F05BACD98445DULL),
+     S256Field(0xA2A1800F9E2BCA4BULL, 0x1C2328A71C3FA2D1ULL, 0x82F450A660113941ULL, 0x864CA89FFB5A2A33ULL), false},
+    {S256Field(0xC0CBEA6CB7542C21ULL, 0xAE19F4D28EA64C15ULL, 0x0656FC45451D6D43ULL, 0x2584196292919AC9ULL),
+     S256Field(0x3BEBE319672BFABFULL, 0xF3E3A186E4C2AD7BULL, 0x01E5DAA4CC7513D5ULL, 0xFCB35B1F1CDB2448ULL), false},
+    {S256Field(0x43C461F40C1ECBF8ULL, 0x6489F0DE9AEED7CAULL, 0x22A9754CC1E8421FULL, 0x7E12CDC41373C525ULL),
+     S256Field(0x9D45B8CDB0BED615ULL, 0xC969F61D8FE1D9F5ULL, 0x143F94DABE4D1259ULL, 0x71284F88888DC837ULL), false},
+    {S256Field(0x17E6651C14557D86ULL, 0x1CFEEC478E667FF4ULL, 0x772B91CA7A05A6CFULL, 0x4B8EC2FF2A3742A6ULL),
+     S256Field(0xBDD9B191B5167EB9ULL, 0x28D5F2EF0FC3F692ULL, 0x14A4072DE527AC5FULL, 0xFDE6C3FF04C157ABULL), false},
+    {S256Field(0x52B82D3B4780763CULL, 0x5F8A6D5E9265691DULL, 0x532436DC697AC07EULL, 0xFCD5C10733963A42ULL),
+     S256Field(0xB54E742038E851CBULL, 0xB119B22E716463A4ULL, 0x3B720DB35F72E38CULL, 0x18DDABE2E5522C46ULL), false},
+    {S256Field(0xBCE3BE305D8EF686ULL, 0xF68E48F402272E66ULL, 0x2238A5DAF8266E53ULL, 0x900F2CEE5843CBE5ULL),
+     S256Field(0x073A4967E121A8CFULL, 0x596CDFF43C9156D5ULL, 0xD61C551B1349D110ULL, 0x732AC155EC60425AULL), false},
+    {S256Field(0x3CF29EB3DE6B80EFULL, 0x71CBCB967D79424FULL, 0xD23540C223BCBDC5ULL, 0xB6459E0EE3662EC8ULL),
+     S256Field(0xF30BF0B61A71BA45ULL, 0xC4B3AE6D48E35B2FULL, 0xE1DADF16E5661DB3ULL, 0x067C876D06F3E06DULL), false},
+    {S256Field(0x439CF279319888E9ULL, 0x3D12BA6BF2448A8BULL, 0xDDE60D3029668167ULL, 0x1F90EA773AC3A6E2ULL),
+     S256Field(0x56FDFC97EF113B79ULL, 0x213751FEE59522E6ULL, 0x958153D271EB96A8ULL, 0x89BE367C15DAA10EULL), false},
+    {S256Field(0x085EFB6F3562222CULL, 0xDE03447991E6F2C6ULL, 0x6E702BAD334B52BAULL, 0x13A4E54DEDFFE0ADULL),
+     S256Field(0x8CB1668CA8200145ULL, 0xD4F9C577ADC904C0ULL, 0xB2CAC2F81D609A52ULL, 0xC9D67D4E5816E813ULL), false},
+    {S256Field(0x437E4DC0F43B46BBULL, 0x12ED3A63FAC92525ULL, 0x1D407C05D8455DBDULL, 0x61991EBF233CAADDULL),
+     S256Field(0xF48F5901CC20A848ULL, 0x1CA8729CA52ECD8EULL, 0x952F387166FBADF1ULL, 0x01C5E308F3FDE492ULL), false},
+    {S256Field(0x7E5BE3DDD21ADD3BULL, 0x8B9A944F45727D8FULL, 0x49039CDB0D162611ULL, 0xEA27AEA4B787D387ULL),
+     S256Field(0x1B5E291DB68CE7DDULL, 0x78B212D68E4E1BE7ULL, 0x5723CEB2325C2F62ULL, 0xC70FF1E6E42A17DEULL), false},
+    {S256Field(0x6E8AF8BB611FF757ULL, 0x9B4CE9741C4C226EULL, 0xBA9010F8B6E2B6DAULL, 0x594651356B7FFD54ULL),
+     S256Field(0x28A66ECA894D031AULL, 0x961BBC7B7FBFFE3BULL, 0x042038D015C406F9ULL, 0x3611360CE5DF2750ULL), false},
+    {S256Field(0x676258A3636160B5ULL, 0xCCC53F2470E7EBC0ULL, 0xE843AF7970091EC0ULL, 0x16B26E3915F73290ULL),
+     S256Field(0x14625FBF58A1DC0EULL, 0xE1363AAC70BA3EF8ULL, 0xB6364352463654D4ULL, 0x060F565A6302EF8BULL), false},
+    {S256Field(0x3964D28937B32DB8ULL, 0xC91ED749F647791FULL, 0x1BEA143C842CEA85ULL, 0x024B5295C4559F93ULL),
+     S256Field(0x59454FAAAA64F760ULL, 0x62AB6811205B81A9ULL, 0x7B6E2821CC5E5BE8ULL, 0x609FEF8F5BFF309CULL), false},
+    {S256Field(0xDEDA0F5B496943E8ULL, 0x1D6F1FC67E73C5A5ULL, 0x793234AA118F0623ULL, 0xD68A80C8280BB840ULL),
+     S256Field(0x294C84266B133120ULL, 0x5B0E7B8F7845295AULL, 0x0C4B1F9177B0E28BULL, 0xDB8BA9FFF4B586D0ULL), false},
+    {S256Field(0x35B42AA18CA1C4F9ULL, 0x4F4EFE34CAB7E282ULL, 0x4C40B83DA61F16F4ULL, 0x7815F78F22BD728CULL),
+     S256Field(0x9AB1EA36B778BC15ULL, 0x5CB42DE61577D1E1ULL, 0x7DD93CF31458C35DULL, 0xC1C601E8CD39AF6AULL), false},
+    {S256Field(0x6D26E1C3EE8C8530ULL, 0x512DF681EF8F4D8EULL, 0x6E377C64016A6C6DULL, 0xC39273CDA0EC4017ULL),
+     S256Field(0xC4030F0F798446C7ULL, 0x50EDFCBDA2EED715ULL, 0x9D01D39441C31998ULL, 0x8C41BE4257433C8EULL), false},
+    {S256Field(0x31F240BB237A26C1ULL, 0x166C6E58C0DBF6A5ULL, 0x27522431C1D03B25ULL, 0xDA317447F58411B0ULL),
+     S256Field(0xF51836ECECF74D6FULL, 0xD36836C5D7A81525ULL, 0xD2384167C259D8B7ULL, 0x753B97B87F5D8C69ULL), false},
+    {S256Field(0xD2B628A93739DC49ULL, 0x239392DA66F55603ULL, 0x1064AC508BFF231AULL, 0x6A4BE6CB02AF0E6CULL),
+     S256Field(0x3E6A2B9DF2EDD5CFULL, 0xAB7E2B4CB14A4A4DULL, 0x7DC166E360FA8058ULL, 0xF15D8FAA2A890759ULL), false},
+    {S256Field(0x98BE8A0C46987FACULL, 0x8BC90F8640A86F67ULL, 0x44E982603EC98A3CULL, 0x01F7C69F13AE7F13ULL),
+     S256Field(0x3F91E73819174C68ULL, 0xCB7F5DE219F6BC26ULL, 0xE5B1036E329AB6F9ULL, 0x9D4ECC3F36FDA22DULL), false},
+    {S256Field(0x1D33A1BD76DABA4DULL, 0x9C65FB0E20319626ULL, 0xCB7062EDD8FA2BCBULL, 0x557E9401761FD381ULL),
+     S256Field(0x51374A1BB7A52316ULL, 0xC5E9B8F5FA43590AULL, 0x46D35CFA15CCBC86ULL, 0x7A7E8F3A601FA7E0ULL), false},
+    {S256Field(0x038F52FF29F5341AULL, 0x9CC7A32C669636B8ULL, 0x3B29D40EA7B10141ULL, 0x3ADADA82199885A9ULL),
+     S256Field(0xB51580936586C6CCULL, 0xE9D6D2E5B45E8FBCULL, 0x552E35BF36AB1017ULL, 0xBFEA1E228999369FULL), false},
+    {S256Field(0x4095980FC28D3D5DULL, 0x9612AEB973449CEAULL, 0x52DC0270907A30B0ULL, 0x324AED7DF65C8042ULL),
+     S256Field(0x967224AF96AB7C84ULL, 0x19213B0C7E332843ULL, 0xF130C0C35AEC1F4FULL, 0x648A365774B61F2FULL), false},
+    {S256Field(0xF5C917582FD53ED3ULL, 0x163F74FB9DA56CCEULL, 0x5B8F60B931DF7C49ULL, 0x20840BD5996772ADULL),
+     S256Field(0x87143FE51A7A7132ULL, 0x5487C47394E70899ULL, 0x487BD476A6BAFAC2ULL, 0xF2993497CEC18243ULL), false},
+    {S256Field(0xDBD2CBB588A35B35ULL, 0x1AB5D88A5C0A121EULL, 0xBD13D029E588EBFDULL, 0xE6B6BFF60EB339BBULL),
+     S256Field(0xC57293DB9C1007BDULL, 0xFE3B6C9D3BE999C7ULL, 0x266F43E3835961DDULL, 0x1A5FF2BD3300D2F3ULL), false},
+    {S256Field(0x0D4EF8D2C0360DD3ULL, 0x47A8A836D850E209ULL, 0x88B0B8086E0CE3BBULL, 0xE05317745BE499B2ULL),
+     S256Field(0xB2AECD913C24F87BULL, 0x61B987DE98103DC2ULL, 0xCD809582B5B6A014ULL, 0xDC1C3B71A5D92F39ULL), false},
+    {S256Field(0x7C146662D098DFEAULL, 0xFADCB3C92EA67879ULL, 0xE018E5D2A83A5E57ULL, 0xA8153B3A77886C59ULL),
+     S256Field(0x8A49A9DF6E6D892FULL, 0xB1B5E0F742DAF415ULL, 0x53D8DB9C57853E03ULL, 0x2A47396461D060FCULL), false},
+    {S256Field(0x0A7E77A48BCECFA5ULL, 0x2A0D62DA1B16BB02ULL, 0xDEB4695C638EDA3BULL, 0x4F05C3B30FECADDAULL),
+     S256Field(0x2ECD024A95D37B53ULL, 0x447EE431F01B48CDULL, 0xADD63236159534B9ULL, 0x53A499EA603D426FULL), false},
+    {S256Field(0x461E7659084B96AAULL, 0xD0298635522ABCCEULL, 0xE26405E1AA3B980EULL, 0xD9309AB99F67A91BULL),
+     S256Field(0xF26C4F37C2B28A86ULL, 0xD3B6C9FBAFCFE978ULL, 0xD7E10F066274CB5FULL, 0x6EF99B2A9B4EC557ULL), false},
+    {S256Field(0xCF7B8D059F8FCF0EULL, 0xD65B6FFDE7C4A6FAULL, 0xBA9C3446DEAA3411ULL, 0x7D587CA138562D35ULL),
+     S256Field(0x501C1A09D8BC9459ULL, 0xC463900AD323780AULL, 0x2723400B6CFD6AD0ULL, 0xA7295C0388304C61ULL), false},
+    {S256Field(0x8E8BD373FD054C96ULL, 0xEEC4143BA8D1CA88ULL, 0x6D51DFDBE5FEE5DCULL, 0x4DF9C14919CDE61FULL),
+     S256Field(0x92EBAC06CAD10D5DULL, 0xB5D506CDC2884901ULL, 0x050974C23A1D85D4ULL, 0x0035EC51092D8728ULL), false},
+    {S256Field(0xF4F225DA5DEF001DULL, 0x21F9BBD6989BA27EULL, 0x20E0BD1C09E3B64BULL, 0xA549A32DB27E2CAFULL),
+     S256Field(0xDD5DB1A7F0624783ULL, 0xEB141E2A62C9705AULL, 0xDF4CC30ED8A59456ULL, 0x799B7A7906D966CBULL), false},
+    {S256Field(0x05AEF1E5C52ED4CBULL, 0xC954DEFB3C09EC5AULL, 0x23F08BD983532E6EULL, 0x7E798F30DA07ECD1ULL),
+     S256Field(0x2571660794BB9462ULL, 0xB173571BFF9F37A1ULL, 0x041A9549DEF2F057ULL, 0xD23DCCC4A24DAC83ULL), false},
+    {S256Field(0xFDF3A0FBD3630834ULL, 0x8463F12863DAC067ULL, 0xAD5B9E96BA8C8108ULL, 0x224FA20031514783ULL),
+     S256Field(0xCD3C4737C47A2272ULL, 0x3D62924EC0A50F75ULL, 0x3C4B70FA391D09F5ULL, 0xBBE54E32BB3EDA5CULL), false},
+    {S256Field(0xB67649D1583C19D7ULL, 0xBBBB5E45AC2CF57BULL, 0x129A25CCE4228EF2ULL, 0xC2D4A0CC600A39E4ULL),
+     S256Field(0x72F28B82C507928DULL, 0x26804A8317345C97ULL, 0xD4183B5F7F41260DULL, 0x65ADA0F9C0806294ULL), false},
+    {S256Field(0x84C80AD4BC940C9AULL, 0x13CF3CE13AF42330ULL, 0x0E5585E2744DDC21ULL, 0x2EC22A7EC305F319ULL),
+     S256Field(0xCD194FD9851E7A4DULL, 0x12405183D9A35BDAULL, 0x4C2E24F5029C7FEBULL, 0x8B1DA468DE337968ULL), false},
+    {S256Field(0xAA70EE5FDD683EEBULL, 0x3E36EB38A08D3133ULL, 0xAB1AF6525084B8F3ULL, 0xAFC669738F9A8CECULL),
+     S256Field(0x91E29CAB30CD4509ULL, 0x570BAB5525EDDFDCULL, 0xBC359C7FCA239C16ULL, 0x002C21976DD22752ULL), false},
+    {S256Field(0xEA201F87B76F4293ULL, 0x10E978B5653C5139ULL, 0x121BC8CF370B282EULL, 0xD2557B5A9F343309ULL),
+     S256Field(0x1DB187A25282740AULL, 0xE34B6838DE405A5FULL, 0x12682F06EB4AD21FULL, 0xA787B34355E427F0ULL), false},
+    {S256Field(0xCBFC99C8AC1F98CDULL, 0x523489054D7F0308ULL, 0xFAED8A9C1CC66021ULL, 0x9C3919A84A474870ULL),
+     S256Field(0xBE7E5E03D4FC599DULL, 0x905326F76C64C8E6ULL, 0x584F044BF260E641ULL, 0xDDB84F0F4A4DDD57ULL), false},
+    {S256Field(0x17B98D538FB64DB3ULL, 0xA7EDE4CA39DD5384ULL, 0x40BBB83FBE53B8D6ULL, 0xC114239229BDCCB7ULL),
+     S256Field(0xE230CE9FFC0259BEULL, 0xA87580904D4567D1ULL, 0xA5CECDE4FE978BD1ULL, 0x1237F6DC5B486FC2ULL), false},
+    {S256Field(0x1EDED83403081E46ULL, 0x3A52218C554559EAULL, 0x082D9C2C19263471ULL, 0x6C5B4BF831A77224ULL),
+     S256Field(0xED1F9CB80BFBCD70ULL, 0x41D0CF826AC22A62ULL, 0xB2347863CE2BE478ULL, 0xCB0513714926D42FULL), false},
+    {S256Field(0xDCAE5AEC464DCD4BULL, 0x0C30C7D59911C124ULL, 0xB5670665CAB10A45ULL, 0xE1E9A856670CADE4ULL),
+     S256Field(0x2D0B625EBB041F2CULL, 0x7F44D19AACA16B29ULL, 0xB7AC43599B257792ULL, 0x562B0A954455C531ULL), false},
+    {S256Field(0x005876FE2BADD73CULL, 0x8FD9CDD902A64B7DULL, 0x778A74E42EDC1420ULL, 0x51B21A57AD11B099ULL),
+     S256Field(0x6F7D4AE1EB36D8D1ULL, 0x6C20130F28C734BAULL, 0xD54A07F01D2C1CFAULL, 0x00793010001FD3E5ULL), false},
+    {S256Field(0x6D75D0B73B09F34BULL, 0xE58873E608CC66CEULL, 0x61AB6296F3F39D61ULL, 0x9701F3A63B1CB798ULL),
+     S256Field(0xACDC850CC0DF5793ULL, 0x7104BC397FDCC794ULL, 0x5D7031B531568337ULL, 0x3DD44BBB8CAF0ED1ULL), false},
+    {S256Field(0x15CE6223BF1E2F46ULL, 0x5270F71E87277830ULL, 0x445592E040D63C57ULL, 0xA036B41D2C9E66CCULL),
+     S256Field(0xF731E2695EFFB349ULL, 0x0680E282CFF0B1F4ULL, 0x7DF1F6AA479EB08DULL, 0xC3BF91A003E96B3DULL), false},
+    {S256Field(0xBCD8B9038C4CEA08ULL, 0x654B58BA0E0EA21DULL, 0x6F4A611534004652ULL, 0x6A85FADBAA4E8C50ULL),
+     S256Field(0xA19DECE59862F4F3ULL, 0xB4271A4B43D721B6ULL, 0x531933C148FE6230ULL, 0x00B64604BAE4659DULL), false},
+    {S256Field(0x5A21382120A959E5ULL, 0x91E1493A8B91D4CCULL, 0x8DE05F281D8E06BBULL, 0x6057170B1DD12FDFULL),
+     S256Field(0xE899BE932385A2A8ULL, 0x465152BC3EE24C65ULL, 0xADD9A2DAF71DF262ULL, 0x9A1AF0B26A6A4807ULL), false},
+    {S256Field(0x0D4DA162971C032BULL, 0xFF6B668A17AFDC98ULL, 0x3DD11B5FDFC766C5ULL, 0x71EBA8FCD6E00260ULL),
+     S256Field(0xE7AB5A8E1668359FULL, 0x71931AD1774B4755ULL, 0xEF660516F54CBB7FULL, 0xD2FF12624B61D39DULL), false},
+    {S256Field(0xD06E47452A03A61CULL, 0x507868F469070574ULL, 0x2CA17442BAAA9DD0ULL, 0x855EC305B3249D23ULL),
+     S256Field(0x5DFC6EAAC65DFC07ULL, 0xD332F74EA17E4496ULL, 0xF543CBFF9B42FB4EULL, 0x0DD85D2EC5F01C17ULL), false},
+    {S256Field(0xB00C0A481F32D706ULL, 0x0618CCA4746A0678ULL, 0xF150D29A3095BFA2ULL, 0x3CE4486ABAB3FBF1ULL),
+     S256Field(0x40B73637FC7FD9E4ULL, 0xEDD15643CD61E89FULL, 0x88EFD046B1094906ULL, 0xE775408DAAE37852ULL), false},
+    {S256Field(0x6DB40CBB791CD3FBULL, 0x4A2A33FD9729BE68ULL, 0xF02E03218F8844EBULL, 0x11CCC5143F4E37FAULL),
+     S256Field(0xA93716BA55160D86ULL, 0xFA0B1EFD2CDD3472ULL, 0xB528E244938CC239ULL, 0x4AA56B2A902B11DEULL), false},
+    {S256Field(0x387B9119618F7552ULL, 0xBD41138B98054FACULL, 0x43B97774F82382DDULL, 0x0250BB17E5149C6FULL),
+     S256Field(0x3F0849623510B14DULL, 0xDA006F3C333D6F1EULL, 0x342D7DF75FE9D817ULL, 0x731930FC9BBE8082ULL), false},
+    {S256Field(0x05D13E939F725D12ULL, 0xD94642BBDCB5F475ULL, 0xAB4A39CE0A022FBFULL, 0x1A749C88B3467FD3ULL),
+     S256Field(0x0136514D23AC56E4ULL, 0x607208698990DAA7ULL, 0xF458BE75C2AF3D8FULL, 0x7E91D19573EC0E2CULL), false},
+    {S256Field(0xD61048E529FAE458ULL, 0x8B0A5C42766EC97FULL, 0x109D156A5DFB7B32ULL, 0xC750685BE0F8218CULL),
+     S256Field(0xB01684195757B598ULL, 0x0A5DCA50335951A2ULL, 0xFB52F414C672C7B4ULL, 0xEAD795F8CF921E05ULL), false},
+    {S256Field(0xB1A6973EECB94266ULL, 0x80CEF0FBA7D4DF12ULL, 0x421439A4518DA318ULL, 0xA576DF8E23A08411ULL),
+     S256Field(0xEE8BE11AE1B28EC8ULL, 0x432E10A7F514D9F3ULL, 0xC92B97AFE58CD82CULL, 0x40A6BF20E76640B2ULL), false},
+    {S256Field(0xB68AEB58CD9ED6C1ULL, 0xC24E745BC3D593D6ULL, 0x80BFC187705EDD0EULL, 0x0328336DCB74F53EULL),
+     S256Field(0xDEC6EBE6F8FAFEEEULL, 0x265BF4DF25CB494AULL, 0xC46D5943A20D7C8CULL, 0x71A8983812FD9F28ULL), false},
+    {S256Field(0x919A9A8D3235983AULL, 0xE38A1037013BCEB2ULL, 0xDC63926D70FE1531ULL, 0xCE4F4EAE8B911C54ULL),
+     S256Field(0xECFD6B190D3CDECFULL, 0x526C65228EBF740AULL, 0x3EADE0249E707543ULL, 0xF3C9F973C390FBBBULL), false},
+    {S256Field(0xA6DAAB6655B0E6C9ULL, 0xDB5FF9CF786E4C89ULL, 0x78E28FB36DF8BCBDULL, 0x4DBEBFA54B986222ULL),
+     S256Field(0xE94A78555EB2CC25ULL, 0x589311B2BC504EFAULL, 0xF45A626E6E2229F3ULL, 0x10FEE7B03C913AEDULL), false},
+    {S256Field(0x64E01A11A5857295ULL, 0x69C8E47F03433F01ULL, 0x8B2E118FCA1CA120ULL, 0xA42A240BFEF45C21ULL),
+     S256Field(0x56B377FECA7EB9C1ULL, 0x27A1C22CD1519395ULL, 0x67A6B22B24DDA4C4ULL, 0x3AA0B3F261005D45ULL), false},
+    {S256Field(0x2220FF556FCDC098ULL, 0x550AE00F6AE46803ULL, 0x7A7F1F86C0C499C1ULL, 0x34E12B2F96FB2226ULL),
+     S256Field(0x64CB1ADE6A7474E2ULL, 0x04DF5130F19883F6ULL, 0xD974CBC8417972DBULL, 0xA64AC2DDD7B5D322ULL), false},
+    {S256Field(0x1CD6EB5E8F173B92ULL, 0x3B7E72F4169FB761ULL, 0x9BE31A218F4D6568ULL, 0x10F4D240D9BB91F2ULL),
+     S256Field(0xC902006D633146C2ULL, 0x90BB769D1486ADB7ULL, 0x211B25A5A33908BAULL, 0x850E2D95091753ADULL), false},
+    {S256Field(0xEE6FD1D9A8D84958ULL, 0x6A11DEB16CACC5CAULL, 0x49F19B976D40CC86ULL, 0xE846E80B69B677E7ULL),
+     S256Field(0x40C4647B7882CF9FULL, 0xAD51A33671E0C1A6ULL, 0x41DBD9104798B76FULL, 0xA29CB8FC894C7E25ULL), false},
+    {S256Field(0x8F763889BE58AD71ULL, 0xBB30D1F5CF9A3A20ULL, 0x0A05FE9629DE8C38ULL, 0x7778A78C28DEC3E3ULL),
+     S256Field(0x3B513FC1FD9F43ACULL, 0x87B38411FF24AC56ULL, 0xF7098E12F2FF5800ULL, 0x34626D9AB5A5B22FULL), false},
+    {S256Field(0x2F7C6EAE3319C869ULL, 0x18A9F95D761EB270ULL, 0xD01839022FCCACDCULL, 0x3018045D98173FC8ULL),
+     S256Field(0xFC0C76C9D2B856F0ULL, 0xCA2A84CA4A3D9A7BULL, 0xF86624320D622E3BULL, 0xAC5FC5782503B7B6ULL), false},
+    {S256Field(0x4C66986FA5ED29B5ULL, 0xF5830B60712ADD1BULL, 0x43AB67DB9A63C885ULL, 0x322881B61EE57EF3ULL),
+     S256Field(0xEF4F126E7CD15AD2ULL, 0xCA83AEAB94EE7604ULL, 0xB110B19DF41531E1ULL, 0x1677028417A0344EULL), false},
+    {S256Field(0x3BFA840786C96100ULL, 0xA163011AA6E9C8E6ULL, 0xFB43DD9B2DF3DBCCULL, 0x3F38473AC0FB1B9FULL),
+     S256Field(0xF1E2AC1BF2624707ULL, 0x66571C7C0B75F1BCULL, 0x2534C4462F079CE5ULL, 0x70C69C55F5D40395ULL), false},
+    {S256Field(0x234C6EC6FD22D2ACULL, 0x10DDFE126DCAACE0ULL, 0xCB43C0E09785DF2FULL, 0x288113C5FD27A76DULL),
+     S256Field(0x081EB55F8F42A268ULL, 0xDDC3D44A1548C8FDULL, 0xF20777260C976137ULL, 0xA1A7EB0158FBC5C8ULL), false},
+    {S256Field(0xD4BA80DD245F8EA8ULL, 0xD17248E3964D2900ULL, 0x553F4D95D7119FE5ULL, 0xF963A200C8463A2AULL),
+     S256Field(0x4BC55FB059BC99EBULL, 0x8BB8F2359D8B6082ULL, 0xA3B722301FF42720ULL, 0x9C8594268C7F83C0ULL), false},
+    {S256Field(0x9E1A88312606A315ULL, 0x40726072F26963ADULL, 0xF98D8B2A590E097EULL, 0xA5D9224CFF70D9A7ULL),
+     S256Field(0xD35613359E3B68D1ULL, 0xED4D0D347D11A7C9ULL, 0x343306ABD7980DE9ULL, 0x87328B003B20DA5BULL), false},
+    {S256Field(0x9CDB7B5406231493ULL, 0x96411A830CCC4D46ULL, 0x4EB4E41D00E5E6A4ULL, 0xF1FE982E1B73C360ULL),
+     S256Field(0x196A99A6758848C1ULL, 0xF173FB346E5FF0D0ULL, 0x216D3C205F7D99D3ULL, 0x2E2019EAED9A4DDCULL), false},
+    {S256Field(0xB09EDA9C06D903ACULL, 0xD5F96274E5AD7E5CULL, 0x63729FD30E7AFD2EULL, 0x0928955EE637A844ULL),
+     S256Field(0xC5180E935BCD091FULL, 0xAC3D26EFA8A8D83FULL, 0x27B78A13093A95EEULL, 0xC25621003D3F42A8ULL), false},
+    {S256Field(0x811128757874B839ULL, 0xBE4115B3953D2B41ULL, 0x053DF0DFB230B6AEULL, 0x3E03B81FC0E1E5A8ULL),
+     S256Field(0xA0C1CE567C0594BAULL, 0x7DE5C5F0FDAB5B8DULL, 0xC44F660757198F66ULL, 0xD13AE163DFF07F42ULL), false},
+    {S256Field(0x3A3F78E68357A513ULL, 0xF151BD1345B3023FULL, 0xD62FA283AA2922C5ULL, 0xE662C0B7A2F4492CULL),
+     S256Field(0x192A201CA017D07EULL, 0xD8035CD625538D89ULL, 0x05DAE208A121A419ULL, 0xAB0B193CE6124523ULL), false},
+    {S256Field(0x4995F7EFDF37D242ULL, 0xC29FECA6079C14B0ULL, 0x843862C7CBE3587DULL, 0x40BF80B1C94CF6CBULL),
+     S256Field(0x3D1D8279A6405088ULL, 0x74321EBA42BD3558ULL, 0x4F53FE9B1B26FE12ULL, 0xB579DD35D856AAF0ULL), false},
+    {S256Field(0xBAF2B364595A3558ULL, 0xAC071F85E234A7F2ULL, 0x806F978138DB59F6ULL, 0x3D14FE97601DCA70ULL),
+     S256Field(0xC6ADB3AC6443DF4CULL, 0x82E0A2E147C1D727ULL, 0x8F29A931DBF56E14ULL, 0x16C6BDD6E84681EFULL), false},
+    {S256Field(0xEDE9F5AD82B1FC24ULL, 0x2528D81C7E3F7570ULL, 0x1CC1AC4D2C924865ULL, 0xDD6FA540E82E6525ULL),
+     S256Field(0x4A431C460E9B74CAULL, 0xEC10DE6BED732230ULL, 0xE366F1EBF1657E77ULL, 0x67E62B7EB1D3186FULL), false},
+    {S256Field(0x81EA91593DD08E02ULL, 0x108547B7FDADF028ULL, 0x0F869499AA3D1E80ULL, 0x13FA2DA82DE55D78ULL),
+     S256Field(0xDA5541DC3CB03410ULL, 0xE644AFBB19A42B97ULL, 0x313356206BB432C7ULL, 0x136338B04555DA72ULL), false},
+    {S256Field(0xAC233AB9944EE41AULL, 0x879B56DD3B7D69A6ULL, 0x3F7C10B672C68282ULL, 0xD06C4851D3C70A44ULL),
+     S256Field(0x2F1F84E98B295E6FULL, 0x9B7B84346162EE25ULL, 0xBBB0ACD4F4F63091ULL, 0x5815FD4C0584D0ADULL), false},
+    {S256Field(0x27AAE75163D82751ULL, 0x5645B4A907AD3545ULL, 0x399064F3A0E3B285ULL, 0x85D0FEF3EC6DB109ULL),
+     S256Field(0x82C237A24EB1F962ULL, 0x3E8751E968773315ULL, 0xE29D496E582CF566ULL, 0x1F03648413A38C0BULL), false},
+    {S256Field(0xB9955061ECDE4CF3ULL, 0x9340E535478A066AULL, 0xBE7C2D26D15D9AE7ULL, 0x384DAB4AC11422C3ULL),
+     S256Field(0xB7C796B2252D0566ULL, 0x1F430A339751BA73ULL, 0xBFB4ED6DA2B4C6F0ULL, 0xD6E3C5BCD1B9CA43ULL), false},
+    {S256Field(0x98AF3E921E5238C2ULL, 0x40355F5C380ECB8BULL, 0x41B1610B4E82ED48ULL, 0x14F0EC0EB7D415AAULL),
+     S256Field(0x6E86A34792F07922ULL, 0xD25C00D80304939DULL, 0x921FC73E3842747FULL, 0xAB12D53DD4835D80ULL), false},
+    {S256Field(0x8F6352EFD543E94DULL, 0xDD1302A756F98E18ULL, 0xC41C34678A5A0DDAULL, 0xEB42F3BB782C287EULL),
+     S256Field(0x40559DE445924D89ULL, 0x4CD8468DE60D6D42ULL, 0xC9A0DD572FCDFB77ULL, 0x234A6D074F25D92DULL), false},
+    {S256Field(0x0324E5B57E19AAEDULL, 0x459BACDE8C667327ULL, 0xA9EEC02F6E06A920ULL, 0x1CF138CA516820D9ULL),
+     S256Field(0xC136EA5D692F400EULL, 0x479EEF8FEFC77FFBULL, 0x5F4372A66B6DDE17ULL, 0xD6FFDAF3171C6386ULL), false},
+    {S256Field(0x5F6C0E9FB6A8AA39ULL, 0x37A6637B4A78FAC5ULL, 0xC875A096849990D9ULL, 0xB58686BE5F40D412ULL),
+     S256Field(0x8FC7935D2B493C1FULL, 0xABBDAF98E6DB347BULL, 0x149478D454C0A91DULL, 0x5632D54324C78C2CULL), false},
+    {S256Field(0xEE91EBE3B03B4CC5ULL, 0x572831BA5A1C77C2ULL, 0x67B5BC4FE7F3A802ULL, 0x5FC19DB06B8BCC2BULL),
+     S256Field(0xA3B39FB865B57C28ULL, 0x9276F503CC087EC4ULL, 0x6EE2138F9A3A5EF4ULL, 0xEC8E84C0EC98C7C6ULL), false},
+    {S256Field(0xBB4B857D4CB38CB5ULL, 0xE10B7FDF4D388948ULL, 0xDEBA8A40FD3EEA1BULL, 0xB88FB70D42EDE289ULL),
+     S256Field(0x97BFA7565965F3D7ULL, 0x4D4F3E1227AF8C71ULL, 0x6034BB994B35A8E2ULL, 0xD6C736AD46EA3280ULL), false},
+    {S256Field(0x8F5404824526087EULL, 0xFDFB6D8882DA2030ULL, 0xC1C9B6041798B85DULL, 0xFF2B0DCE97EECE97ULL),
+     S256Field(0x2C951E01F0C29907ULL, 0xC7B7ED6FB90E2CEBULL, 0x8AF4C4DC54D07936ULL, 0x493D13FEF524BA18ULL), false},
+    {S256Field(0xC59054FE79D681F9ULL, 0x66CE0EEFAC8FEB9FULL, 0x88B7FF25E02C94B0ULL, 0xC745FDF2775F2308ULL),
+     S256Field(0x603173437BBB1247ULL, 0x8CDBD335C67D45C7ULL, 0x8A71394C70E81867ULL, 0x590222F2F6B9E5E7ULL), false},
+    {S256Field(0x5E04CEED35CD0EA3ULL, 0xB34478E820CAC481ULL, 0x27A59E5EB672E7F2ULL, 0xABB279F3A975050BULL),
+     S256Field(0x470931337C307BCEULL, 0x7C9769059E02F3B6ULL, 0x9FB4BE0C03078ED4ULL, 0x5DEE103BBF17970DULL), false},
+    {S256Field(0x5C2E2F3F1BC9EE3EULL, 0xEA9FA1A963E7382CULL, 0x27FAEAA74267ED11ULL, 0x3F81150B59FC6828ULL),
+     S256Field(0x3CEADB0C599AAE06ULL, 0x7623B2DCFCDA8160ULL, 0x4671BEB3C4795662ULL, 0x19C88A68FDBFA82DULL), false},
+    {S256Field(0x6171BEFAF8E4A007ULL, 0x15ECEECF08BB358BULL, 0x9594BA33AA56C7ECULL, 0x5CF8132DD0082DE6ULL),
+     S256Field(0xCE63F0909068B883ULL, 0xC8946F96C79C7FE8ULL, 0xF4AD4158848C3DF6ULL, 0xB45AEE5C0D61FA0DULL), false},
+    {S256Field(0x0956FE7B26C2D4A7ULL, 0x1BC36F933BCFFFB1ULL, 0x653E33973C404ED2ULL, 0xB6D5FE4D0D4BA494ULL),
+     S256Field(0x118DCE7E3AE86371ULL, 0x745B7E4E6F5E3CC8ULL, 0x4DFCF9209DFFFD8EULL, 0x47F373A13ABBD6C1ULL), false},
+    {S256Field(0x50933622FC66DD33ULL, 0xEA8FBC8FF1DC76DCULL, 0x06BB1B150029B022ULL, 0x61C8BBC066CF5887ULL),
+     S256Field(0xA3BBA9F3B6F10BFAULL, 0x6A5106EAC2820C8CULL, 0x44669994B985D3FBULL, 0x93599E239E54F703ULL), false},
+    {S256Field(0x9805B7CCDD6B2FF8ULL, 0x876336C17286C8FAULL, 0x87C9F5373EC3BDF1ULL, 0x94E32BA574267851ULL),
+     S256Field(0xADD485552CE1AF3EULL, 0xB33AF042526BFE13ULL, 0x92F1E488662D9E8CULL, 0x0D1B448B43DA04E1ULL), false},
+    {S256Field(0x780E5E2CF856E241ULL, 0x57F1EE148CD6DD28ULL, 0x9ED2B2E6301B212BULL, 0x827FBBE4B1E880EAULL),
+     S256Field(0xD605B68BAEC293ECULL, 0x7FF7A63186903166ULL, 0x71BEF2C67D1D1268ULL, 0xC60F9C923C727B0BULL), false},
+    {S256Field(0x634485CB3BB80FA7ULL, 0x3AA7DA6BB7041388ULL, 0xC0D1A06BD320819FULL, 0x0857E31F6308C2FBULL),
+     S256Field(0xBD98211F09366B2DULL, 0x172E37043CD7016AULL, 0x92D7CC9D1DCB7147ULL, 0xF64393423AE01720ULL), false},
+    {S256Field(0xF5D02C3A09C70E63ULL, 0x9CBB8B78E753D496ULL, 0x3545C655764A672EULL, 0x28AACCEA56BD6004ULL),
+     S256Field(0xB9F03882F057DA4EULL, 0xF5FC59CE444DA1E8ULL, 0x67A89667C768EBB7ULL, 0x2B69322EF81A0E15ULL), false},
+    {S256Field(0x601DC52F73E674B5ULL, 0x92D8F69CE7060AACULL, 0x45DDB2C9BCEB8A4FULL, 0xA2F3B625A055A661ULL),
+     S256Field(0xB0938C8E0E937941ULL, 0x9222FA317C33FA53ULL, 0x80044A90F32A7C4BULL, 0x620EA159614C68AEULL), false},
+    {S256Field(0xC7601631D91EB056ULL, 0xA002EFDB8ECFD386ULL, 0x1D98B5C6A3F515F5ULL, 0x3C4F83C9EAAE5923ULL),
+     S256Field(0x7425893DA05CECABULL, 0x1982B54481CF6B87ULL, 0x33AD6573C3B27880ULL, 0x94479007514A8B6AULL), false},
+    {S256Field(0x19061FDBBD86DFA9ULL, 0xDC38B4A409B993A7ULL, 0xE29C1E03E8103BAAULL, 0xAFF8E1288A9967D4ULL),
+     S256Field(0x07103C36C1D12681ULL, 0xF9116DA94419F9C7ULL, 0xD3D3EBAA1FCF53F4ULL, 0x8D8B4BB321377C3FULL), false},
+    {S256Field(0x28F2736B989BA9C1ULL, 0xE40F7CA5A09D338EULL, 0xE8458262AECEE579ULL, 0xD3FB784528DC00B3ULL),
+     S256Field(0x061B88DFEB51B267ULL, 0x341CEDD5C011ADE0ULL, 0xCA7CA05758B70FE6ULL, 0xF894D434EFA6B4E7ULL), false},
+    {S256Field(0x9DA96C1D0F2BB909ULL, 0x6391027C53598D99ULL, 0xFF47298839187D7FULL, 0x4EC9300E0AC9AA88ULL),
+     S256Field(0xB88A383FA4CF4071ULL, 0xD52E16820DAC3827ULL, 0x5C80DC45184C49BAULL, 0x782BA106BE1B04DCULL), false},
+    {S256Field(0x7F3B58FA2120E2B3ULL, 0x7A58FDCE7F47F9AAULL, 0xE7BE4AE34CE6E521ULL, 0xEAA649F21F51BDBAULL),
+     S256Field(0xD47A5305BA5AD93DULL, 0x01A6B965F13F7E59ULL, 0xC69A80F89879AA5AULL, 0xBE3279ED5BBBB03AULL), false},
+    {S256Field(0xF583FD3A3F2E070DULL, 0x29AAB71CC52A6A98ULL, 0xF48731C3B85047E2ULL, 0x4B72A5E9042F4ABFULL),
+     S256Field(0xE44BA82EE96DD780ULL, 0xB0B465DDD2948C3DULL, 0x60277BB36D0F3C10ULL, 0x599E1D4E1D6AE1CFULL), false},
+    {S256Field(0xE9CE7FD84A02591CULL, 0x3EF54996585125A1ULL, 0x85A6BFBEB5E1FD61ULL, 0xA9FC93FC6539C8E2ULL),
+     S256Field(0x790ADDEF69BEC2DCULL, 0xCA888C415FCF7253ULL, 0x3E84C17A1A9165E5ULL, 0x9C2CE739DC538717ULL), false},
+    {S256Field(0x11006E0E2D968B59ULL, 0x09A28BAE13CBBC2EULL, 0x6A7D7AC1209B0277ULL, 0xC940017C1A6F9F0AULL),
+     S256Field(0xFEFD76408DE572FBULL, 0xE2842CB64390C9C8ULL, 0x13B8A1BFA5B5742CULL, 0x39D922500C9B8620ULL), false},
+    {S256Field(0xA2873335726B3332ULL, 0x310388D073EE5DE6ULL, 0xEC6793A5F70BF8E0ULL, 0x1F84BB9D7EED0024ULL),
+     S256Field(0x554428A314E8D52EULL, 0xC2BCCE2D436DC3A2ULL, 0x2547C27F75B9EDF0ULL, 0xEE726D072BCA9ECCULL), false},
+    {S256Field(0x5CDAA54ACDEFA98EULL, 0x7248446811AC2799ULL, 0x6CA8157B3991E9C7ULL, 0x0F13E0890945FCD0ULL),
+     S256Field(0xC08A7769BE286767ULL, 0x287E705E16CEACCDULL, 0x35E3F8B0A7B362DBULL, 0xADD521F1764E7C50ULL), false},
+    {S256Field(0xA5E1C03BE9F59B6BULL, 0xE9B38C63C1888E2FULL, 0xB3728A1D2D5826D3ULL, 0xDDE191A551DDEC7DULL),
+     S256Field(0xF6AD962926CB1410ULL, 0x8B5738BBE7154FECULL, 0xE0A757D61C52E14EULL, 0x5B2BFB78028275CBULL), false},
+    {S256Field(0xB68C55FDC9C6B699ULL, 0xA86F57356BE46871ULL, 0x5A16D7BF97B41682ULL, 0x5FAB012EED836F7AULL),
+     S256Field(0xB1732152C1C6C3AAULL, 0x90AB117FEA883519ULL, 0xE9EBB41130D62F7BULL, 0x2D9BFA70A3C3D144ULL), false},
+    {S256Field(0x1E23632DDA34D24FULL, 0x41B6D8F0C9A13740ULL, 0x9391DF6DECF42EE5ULL, 0xE4A42D43C5CF169DULL),
+     S256Field(0x3A7F7131DEBA9414ULL, 0xE886EEDFA8D8E4F1ULL, 0x26FC99CCFB8AD34CULL, 0x4D9F92E716D1C735ULL), false},
+    {S256Field(0x5C8410AF3BEA0C68ULL, 0x09430123677B392BULL, 0x4949BC8E8D396FAFULL, 0x3E419634E156A3A2ULL),
+     S256Field(0xBCBB6FF71A45EDB6ULL, 0x2FA11946303CDA1AULL, 0xF373CBFE37069306ULL, 0x0123C59D924B21F7ULL), false},
+    {S256Field(0xAF75D23C939824D7ULL, 0x6EB7B64C351C9897ULL, 0xEED4A3E62F7F0B57ULL, 0x8D9438F5455D7508ULL),
+     S256Field(0x8A004F489366489FULL, 0x8FB9E2B8326B063DULL, 0x2CA60BD31AB6EF6FULL, 0x3261E0734FEE6C2AULL), false},
+    {S256Field(0x8E48071A98D713DEULL, 0x9360C2FB7428E620ULL, 0x0D4A912A2FE54543ULL, 0xB72524C558EE5442ULL),
+     S256Field(0x76FFE5259B8350E9ULL, 0x0482D26FE44A5FCBULL, 0x1042D182E9D69415ULL, 0x4C51B39A8A283E45ULL), false},
+    {S256Field(0x2CC6C293FE3B2CB4ULL, 0x3049F35BF3721040ULL, 0x9ADC76E38121149EULL, 0x3DE45F5A216D1251ULL),
+     S256Field(0xF61E33AC307EB02FULL, 0x823E28E65A87044CULL, 0x50E08AA4A97C9106ULL, 0xBA2A8598405EADDCULL), false},
+    {S256Field(0x7234766F6CE4E5BFULL, 0x9B67CA86A09005B1ULL, 0xC1E3FCE3748906AEULL, 0x8511F1C68959BE87ULL),
+     S256Field(0x2FC92944C1789C08ULL, 0x2DA87889BC536526ULL, 0x4C1DDF7EC6AA0023ULL, 0xECDFF5CF91BCD487ULL), false},
+    {S256Field(0x31B5668A3D3258ABULL, 0x57D242818ABC14DCULL, 0x2CFA1C72EE14AB59ULL, 0x8C5A052E81CF6022ULL),
+     S256Field(0xE57E0853022D0F8FULL, 0x46DAE8F9C0D944ADULL, 0x079A80C7904C08C2ULL, 0x6811DB4BB443BDA1ULL), false},
+    {S256Field(0x158C2A0ABF91BCEEULL, 0xF5CF1D8F1E0C0D84ULL, 0xBDC63CEC556BF137ULL, 0xCEF7F816DEBD3560ULL),
+     S256Field(0x6BB4DA9F81966B33ULL, 0xA63E4B02A172F6ACULL, 0x2463B339C01D245FULL, 0x67E74C8363748701ULL), false},
+    {S256Field(0x47173B9D4300BF19ULL, 0x92B53576A88FEA49ULL, 0x54160FADAB352B6BULL, 0x1EC80FEF360CBDD9ULL),
+     S256Field(0x671CDC1CC107CEFDULL, 0x0146E77F6295A07BULL, 0x2F3A4958A7ABBF5EULL, 0xAEEFE93756B5340DULL), false},
+    {S256Field(0x4B17CBBC52FEA1F9ULL, 0xC4FF0B508C0452B9ULL, 0x3BCFDDAB67106531ULL, 0xA6DC880A55D1F2E8ULL),
+     S256Field(0x3B1C14E47BC345E9ULL, 0x057B89DB7E68F7E6ULL, 0x038683A116ACBC50ULL, 0x7EF1A8547DC367C3ULL), false},
+    {S256Field(0xC8D40C3F06D6C9B3ULL, 0x8C6C4CE874865637ULL, 0x2BDC229C78A481BAULL, 0xFE6BA93FEA424599ULL),
+     S256Field(0x0C2C788FA948BDFBULL, 0xD980F1BF05C2E9B0ULL, 0xB6BB41B345413B56ULL, 0x7EE918D740539872ULL), false},
+    {S256Field(0x422F10730CF95151ULL, 0xB964806E442C4B64ULL, 0xB020C8C2DC08DED1ULL, 0x15D5E2F146FC98BFULL),
+     S256Field(0x482A07CC2FF8ECF2ULL, 0xBB204FB97DD8C0F9ULL, 0x7F90E109789023F9ULL, 0xA5B72E31915FD4ECULL), false},
+    {S256Field(0x3D7810B9296A5658ULL, 0x3814B25241EF6564ULL, 0xD8C7E00927AE29BEULL, 0x84C0E8725688447AULL),
+     S256Field(0x2D96729BD81B80D1ULL, 0xD3A61A981F4F1FD2ULL, 0xA087E3190653725EULL, 0x26598380C16022C4ULL), false},
+    {S256Field(0x375BB5C894DC6A0FULL, 0x7443419142FE1575ULL, 0x565264E7A2C077C2ULL, 0xFED6B1C71A93731DULL),
+     S256Field(0xCCB8D72D976FC7E0ULL, 0x1374D5930A3FC409ULL, 0x8479181AE4D3AE23ULL, 0x8DE2ABE6B0FFFF0AULL), false},
+    {S256Field(0xDB3885F118E29355ULL, 0x2F1C8E9339720D86ULL, 0x0FCEF8604023B9D8ULL, 0x2A6A4DD992D3CBC7ULL),
+     S256Field(0x0053E00FB5CC2872ULL, 0xFE905A3A64C4C76CULL, 0x760FDC81E268F90DULL, 0x8677DFBA7C4A7E0CULL), false},
+    {S256Field(0x1F9FA88FE148DABFULL, 0xC1ADD2B9349D78EBULL, 0xD9764EC235FAE735ULL, 0xE42D93026C927546ULL),
+     S256Field(0xD772C756811E1361ULL, 0x3272757019E77EB9ULL, 0xD8B38CEBFDF38530ULL, 0x6413862C6E2D84B0ULL), false},
+    {S256Field(0x9DDB5928366642BEULL, 0xCE3490717D58BA88ULL, 0x91B00AF4680DFA8BULL, 0x146A778C04670C2FULL),
+     S256Field(0xD0B297483D83EFD0ULL, 0x0AAA971D2F7E5ED1ULL, 0xDD669827F9D4B287ULL, 0xB318E0EC3354028AULL), false},
+    {S256Field(0x9D93873827315443ULL, 0x3D79BBD54AE86729ULL, 0xF42C899820A142A1ULL, 0xFC696C040660935FULL),
+     S256Field(0x7490D60B57D28960ULL, 0x487FF486109BD1B1ULL, 0xBBF0E1CDD69677B5ULL, 0xE0CE27EBF83B5892ULL), false},
+    {S256Field(0xD1BB2F5C16FDB4EBULL, 0x8FA3DD79C62E6A79ULL, 0x1AE56A3562BEB092ULL, 0x974AF221FF4FF2ADULL),
+     S256Field(0x8409C3DFA9F6F484ULL, 0x111C572A3BFFC234ULL, 0x64D1E43D02C090EDULL, 0x5552387D535003CAULL), false},
+    {S256Field(0x73904ADB5D5AEEE3ULL, 0xE8284BC36658C813ULL, 0x09121B3A669270C5ULL, 0x5BAAB59B49DE398BULL),
+     S256Field(0x82D29AFB70F69717ULL, 0x215DDC9DABD31EEDULL, 0x6E5A008661FFDAF7ULL, 0x8A577F617C0F7E85ULL), false},
+    {S256Field(0x851B1E44F5726890ULL, 0xE59025FEAC837D15ULL, 0x01032FCEBF910A0EULL, 0xFB685FA7EB49C43DULL),
+     S256Field(0x606EA8F3B835783AULL, 0x4FA6CB12E90E79B2ULL, 0x869CA16D9864BA09ULL, 0xD750DF22C98E5E2EULL), false},
+    {S256Field(0x5464BF13A8BCA48AULL, 0x78B4D5F4E83DF62FULL, 0x0AB27B91C287F71DULL, 0x5DE58FF659E2995AULL),
+     S256Field(0x58794E80D2FD41CDULL, 0x3FE5BD9C4E0F8AA9ULL, 0x309A623C252D3C84ULL, 0x685A3B3D80359B55ULL), false},
+    {S256Field(0xBDE38344E5EF63B6ULL, 0x5AB4D016731B182EULL, 0xAF1B7FDA3B4FC1C8ULL, 0x6F1825CDEAD618BFULL),
+     S256Field(0x12C846CF45C655F3ULL, 0x3C895A64027F9454ULL, 0x98F4204D78333455ULL, 0xFF097E7DD591911BULL), false},
+    {S256Field(0x7B5047EDF4A63F3BULL, 0x83203B019978F972ULL, 0xB587115F5E76C765ULL, 0xC5ECB895F762A376ULL),
+     S256Field(0xB53F374685005024ULL, 0x8BEB65EE5E30BEE5ULL, 0x74EA4058FF9233ECULL, 0x22252518197881F3ULL), false},
+    {S256Field(0x6D76A8793180EEF9ULL, 0x8D0012209A28B977ULL, 0x7E3ACEBB1AA07B12ULL, 0xFA50C0F61D22E5F0ULL),
+     S256Field(0x38CD8D7D3F4F2811ULL, 0x5E683293A57A213BULL, 0xB72CD2872281A68AULL, 0x6B84C6922397EBA9ULL), false},
+    {S256Field(0x71EE0E3391DA5E12ULL, 0xA9C60A4015CACB29ULL, 0xCDA329F93A1CA2B6ULL, 0xF7502E3C4379E31BULL),
+     S256Field(0x7A4B9C5E8385F4EBULL, 0x7B86D32EF725CEBCULL, 0x59970945C3D67204ULL, 0x3C57F5EDD67CFAFDULL), false},
+    {S256Field(0x2074933110B7D105ULL, 0xF4CA5C4B94E57C9FULL, 0xA3A4F6624E3455B3ULL, 0x12FE78F983AE5862ULL),
+     S256Field(0x458AC6FB9F794A60ULL, 0x1DECE265D6EE90B8ULL, 0x786B5AA199A7CB77ULL, 0x2062F1A338D6BCF7ULL), false},
+    {S256Field(0xF621D8339E0C5D05ULL, 0x480E6C50AA572DAFULL, 0x58C4BB1028084B1AULL, 0x76AAC31347DF473DULL),
+     S256Field(0x556619B751ECE63EULL, 0x4B1225CF015E6EE3ULL, 0xABEF32C83202625FULL, 0xEF5576EF0D5C70EFULL), false},
+    {S256Field(0x9E26F485FC53C086ULL, 0xC6B55C349C9A1AECULL, 0x87E60C3145E88104ULL, 0xA663FE5BBE5C5CCCULL),
+     S256Field(0xE69C5032A5016201ULL, 0x991ECCA573994FC0ULL, 0x5D1B102C89823DC3ULL, 0xB541997F6B211FBFULL), false},
+    {S256Field(0x9AD801ED4B758574ULL, 0xD8326689434F9C6EULL, 0x5B7CA1027AE2BDF3ULL, 0xDE95527A0206CD82ULL),
+     S256Field(0x4B7DF1FCFB67232AULL, 0xBAE6A105155A2DEBULL, 0x4E21DC847F169ED7ULL, 0x4CD3E056AC93D14EULL), false},
+    {S256Field(0xD779B8ABFD85474FULL, 0x894C4A2B89634668ULL, 0xBFEDCCBE44785AEAULL, 0x8DA6BCE066D32ADDULL),
+     S256Field(0x5FDF9C7D3D7B4EF7ULL, 0x0B1CC59305DBDD7AULL, 0x84FDDF5D071DFFF1ULL, 0x13FC6C6AF31ED4FFULL), false},
+    {S256Field(0x6B5D42567DD042EAULL, 0xEBFA26A6458EAFD0ULL, 0xB1BD6649E33C93BEULL, 0x7329ACC7CFB3BA39ULL),
+     S256Field(0xADA8CFEC2F5C94A1ULL, 0x184897731DFAB4F0ULL, 0x89284E794FAB68EEULL, 0x9272493541B76F14ULL), false},
+    {S256Field(0x0E53D32B5F067EC2ULL, 0x1A288AB5D5BBA522ULL, 0xB1A5BF6B7D88E842ULL, 0xDA1D61D0CA721A11ULL),
+     S256Field(0x655FBA0F1AD836F1ULL, 0x66A73899D279B48AULL, 0x79C0766161C91E29ULL, 0x8157F55A7C99306CULL), false},
+    {S256Field(0x15D87732FA95A8DBULL, 0xB83EC0C4479D36F6ULL, 0x19E96646991B1723ULL, 0xE3E90DA46303DD04ULL),
+     S256Field(0x1016CF7F1B0D1CF9ULL, 0xFBB1EF97CC984D3DULL, 0xB00FAA90C702E76AULL, 0xFBE53BC0056C178BULL), false},
+    {S256Field(0x17AAFD64112EE214ULL, 0x782A4E9795931540ULL, 0xA8B650DFD5C0C01CULL, 0x9F4FFEC732E3D775ULL),
+     S256Field(0x3EF442225085F37AULL, 0x9719B6930BC88028ULL, 0x60E96682FD75C69DULL, 0x639CE2E1318E2F2EULL), false},
+    {S256Field(0xF8B681451F61A0A5ULL, 0x4B1253E1B3C14E3EULL, 0xB171A0A41F440B2CULL, 0x431F622D41134AC1ULL),
+     S256Field(0x46B7B7FE78CEF899ULL, 0x41BAAA0435565772ULL, 0x6D6DE6519723AA72ULL, 0xA298327FE7AA438FULL), false},
+    {S256Field(0xCAC267D567748503ULL, 0x0E6E0E47731328E7ULL, 0x6CB62EF39F8A12ACULL, 0x993DBADDECE78FB8ULL),
+     S256Field(0x9BA736137EB0CEE2ULL, 0x17F87BF69B8ADAA4ULL, 0x785F784787A1F51AULL, 0xA521A9EE8569EEEBULL), false},
+    {S256Field(0x8DEA2275A6D23D80ULL, 0xE10BD11F26474D47ULL, 0xA339431CB90962C0ULL, 0x75F17ABA06AD5EA5ULL),
+     S256Field(0x986A85B0280DD57EULL, 0x372FFBEDBB4EA590ULL, 0xC7FC7D0BF19B6292ULL, 0xA07A62FE15639A80ULL), false},
+    {S256Field(0xAE2B9B6D61AD3413ULL, 0x8DB9C0040327D684ULL, 0xA6E95F485CB87B7AULL, 0x6678555E11D9F4A0ULL),
+     S256Field(0x124810207EBCA672ULL, 0xA6CE2D153ADC6660ULL, 0x925266D927CBDF9EULL, 0x510DDA3DE278F646ULL), false},
+    {S256Field(0xAC00AF5B06CC8563ULL, 0x9224DF5BFFE101EAULL, 0xADAC82BD81963688ULL, 0xEBDC4A362CDA7748ULL),
+     S256Field(0x49B17BCEA394CCFAULL, 0xBEC4079249204F92ULL, 0x9B1EE35E6CDD4F07ULL, 0x659A3144E856D35FULL), false},
+    {S256Field(0x2A73B0610D064E13ULL, 0x15311DE0446F1E06ULL, 0x7215FF98E8FD4166ULL, 0xA8E282FF0C970690ULL),
+     S256Field(0xCEF7C73111F4CC0CULL, 0x8B679A3E50DD6BD6ULL, 0xABFB7F3C5B251588ULL, 0x7F97355B8DB81C09ULL), false},
+    {S256Field(0x22A199B0BA3979B5ULL, 0xBA288F8DE67E829EULL, 0x27F37F0B1EE40E50ULL, 0xAE2207C5CDADE263ULL),
+     S256Field(0x68F3CD668450FA6FULL, 0xFCA87B7D37D4F889ULL, 0xAD4C924523AD7060ULL, 0xEA91FE510C079F71ULL), false},
+    {S256Field(0xE41019100EFCA824ULL, 0xE0BE0C4FEA2164FAULL, 0x9CEC541006585461ULL, 0xCB8DED0CAD72ACE5ULL),
+     S256Field(0xF140BD058F227361ULL, 0x96AD1FDFC7931742ULL, 0x5B316C487A2CCBC4ULL, 0x33A5008F740D88C8ULL), false},
+    {S256Field(0x9411B4DA3BCBD327ULL, 0xB04E085221E4AAEEULL, 0x08E94900D7E76ED6ULL, 0xB0C53B298AF18367ULL),
+     S256Field(0x1616BC4A2D7BE436ULL, 0xD82A220C74636A0FULL, 0x638F6A601B66B2AFULL, 0xEE2A97401FBD7EA1ULL), false},
+    {S256Field(0xDE6EFB6397B836A1ULL, 0xC806405FF7679EF7ULL, 0xD4D8862ECE77F526ULL, 0x6F6BA73F329DB920ULL),
+     S256Field(0x4DBDF2FB06832B84ULL, 0xD8990C5288E1FF93ULL, 0x3DB0B8A405BEE9C0ULL, 0xDC778A17FF5FC18EULL), false},
+    {S256Field(0x2AEE34209EB39EDEULL, 0x31088032D70612D4ULL, 0xBBCFF467E1024360ULL, 0x7D471A7DC7422AF4ULL),
+     S256Field(0x0C9BCD94ABF6607EULL, 0x7795CF7D1C22A8FDULL, 0x07B82231EFFC86FAULL, 0x004A7B19F3A68565ULL), false},
+    {S256Field(0xA56D49E2565EB1C1ULL, 0x7FCD7567CDAE5C5AULL, 0x7070FCC31982F096ULL, 0xF0025163F9B73FACULL),
+     S256Field(0x7DA7D7046DDE2AE0ULL, 0x8576FF5CD6CD11E5ULL, 0x4C66B4A5DA26AFEDULL, 0x054EA9E8883D20DFULL), false},
+    {S256Field(0x4CF35093DAC32C64ULL, 0x0E36FE03ECAE4BF8ULL, 0x0F704E950F47715EULL, 0xAC12140001ED23AAULL),
+     S256Field(0x8812ADBADEB1A867ULL, 0xED5A5D3A5A53F089ULL, 0x1870B695730499A3ULL, 0xCE8EBCCBAC338BAFULL), false},
+    {S256Field(0x22F382DE8319497CULL, 0x5D59B1FA512508C0ULL, 0x2D39E56E6913CAB1ULL, 0x174A53B9C9A28587ULL),
+     S256Field(0x83DA13AC079AFA73ULL, 0x646B3A1D8CB98543ULL, 0x57B4155F2C47F9E6ULL, 0xCCC9DC37ABFC9C16ULL), false},
+    {S256Field(0xE948073D754B8367ULL, 0xB775B77D67D506BFULL, 0x40CAA5D458436A5DULL, 0x5E5A094AE446526EULL),
+     S256Field(0x45329A9D91CE85CAULL, 0x796AA9EF3DE5FFA4ULL, 0xC2C901F1572A4B7AULL, 0xAE8AF8C9A4795E05ULL), false},
+    {S256Field(0xF198579397B10D9DULL, 0xE6A52F189D1F8FCAULL, 0x9DECCB83310CB82DULL, 0x00D4E0ADB9702E85ULL),
+     S256Field(0xE82100487140DCEDULL, 0x0B5898C978E2D923ULL, 0x47D2F846432287F7ULL, 0x87B8019818376409ULL), false},
+    {S256Field(0x20811A609C9CAEE8ULL, 0x632E2045B1A270BBULL, 0xF6F7A19AEEC4A667ULL, 0x0366521368EF74C0ULL),
+     S256Field(0x0A9EC6A3B772B711ULL, 0x01CBA9893295BA7FULL, 0x9949FC681BA69445ULL, 0x1F18C32B2A93DED9ULL), false},
+    {S256Field(0x53FF97519446C85CULL, 0xDE37DE08E601C063ULL, 0xAA0676C453F6C6EAULL, 0x0E5891056FDB8F1FULL),
+     S256Field(0x5F6C77E72148972EULL, 0xF490234E80CDDADDULL, 0x0EC7418BAF481898ULL, 0xE39A485F11FA7BDAULL), false},
+    {S256Field(0xFF18ADF3C22E1259ULL, 0x931739A40681362AULL, 0x2B6CF5FAA0077771ULL, 0xA740126D26F1463FULL),
+     S256Field(0x5F771724334A5F43ULL, 0x17865E753B1D6DADULL, 0x1B05F174A67C7EE5ULL, 0x05A9FFBAF194F1FFULL), false},
+    {S256Field(0xD88A17A3CB08F1FEULL, 0xD7CE7EE70BA087BFULL, 0xA65405765D82D177ULL, 0x87E4B8216D9474E4ULL),
+     S256Field(0x75F74AC9AED5E2ECULL, 0x6E2F23DBD6786D9DULL, 0xCD7D7F8EA2F8C2CCULL, 0xF74E3AC0766348CEULL), false},
+    {S256Field(0x9A8700E6A1C4D15CULL, 0x105EA7BF07C0E74BULL, 0xA92C22C0C1254A44ULL, 0x35EA1B463FEA79A5ULL),
+     S256Field(0xDC939BAF7F3FE1EAULL, 0x5D633AA03065095EULL, 0x7888FA5FD74D3B18ULL, 0xAD2191651B9ED2CDULL), false},
+    {S256Field(0x884FDFF09475B7BAULL, 0xE039E730E4918B3DULL, 0x3D3E57EDF5018CDBULL, 0x959396981943785CULL),
+     S256Field(0xE9B8ABF87524F2FDULL, 0x9C653F64C8709385ULL, 0x8BA0386A4B9CD684ULL, 0x2E7E552888C331DDULL), false},
+    {S256Field(0xA09C5DD90FD69985ULL, 0x9F309CCB6DDF72AEULL, 0x788F690DFBCCCF14ULL, 0x0AE97675CEB72F7EULL),
+     S256Field(0x89C8EB411409A003ULL, 0xD0B99D417AEE1AFFULL, 0xE9B8DFEE051A54C5ULL, 0x91219973F6E48D14ULL), false},
+    {S256Field(0x9DC193DFD9262B90ULL, 0xB723C4C1FE3CC29AULL, 0xC9B65F1778025D1FULL, 0x2B15862A5AC1612EULL),
+     S256Field(0x991996E6483D7557ULL, 0x6F534970F99489A4ULL, 0xA7A30D52DA874906ULL, 0x2EB0053DAA0A33FAULL), false},
+    {S256Field(0x93F9714CA8E7BE40ULL, 0xF2D2C89491040EE5ULL, 0x7EE95C1616E4769AULL, 0x6AF9EAED1A96EE67ULL),
+     S256Field(0xFA416E026E387E1CULL, 0x45E3F666A0F59569ULL, 0x6709EA428347DC81ULL, 0xB3812A1169006649ULL), false},
+    {S256Field(0xD26B6FA0F482801EULL, 0x40794F8BC5BD4155ULL, 0xEB3AAB424CB8D6F9ULL, 0x596668EE0444144EULL),
+     S256Field(0xD477148F04870C37ULL, 0x8DB6C1CB63D3535AULL, 0x1EC8F9608771304EULL, 0x949AA0A85BBAEF5FULL), false},
+    {S256Field(0xE4C9B2E7C32C19FDULL, 0x4ACAB8E9058028C3ULL, 0x2FDF4D17AB570B5BULL, 0xBE84D1881B505076ULL),
+     S256Field(0x67694A5372F1281FULL, 0x7955A7F55E50DC37ULL, 0x4D1E65F483083994ULL, 0xEFF960CB32DC5094ULL), false},
+    {S256Field(0xBD1B75FD56C69482ULL, 0xCBEAB540132FA167ULL, 0x41F57274CAF2BC88ULL, 0x9867A0314C0D7EE5ULL),
+     S256Field(0x16F061146F792CD7ULL, 0x9E6245CF515628A9ULL, 0x9C792D55B1BA9963ULL, 0xD02E615A3B10834FULL), false},
+    {S256Field(0x78A239D91D557AA1ULL, 0xDF1D92FECD01FC29ULL, 0x5927F2EA0099D6ABULL, 0xA866F24540D8815AULL),
+     S256Field(0x7981BBB4C1430634ULL, 0x61EB69C67C611A4BULL, 0xD793D8FA5DB0E139ULL, 0xB58739F6A8022B44ULL), false},
+    {S256Field(0xBB51340C9D82B151ULL, 0xCCA0A43D561FBA2DULL, 0xD645A1153B109A8FULL, 0xD2A63A50AE401E56ULL),
+     S256Field(0xD4142174DCF89405ULL, 0xA70F750AF484CA52ULL, 0x565AEE58B2948220ULL, 0xE82D86FB6443FCB7ULL), false},
+    {S256Field(0x7859F635EE4B3BA0ULL, 0x5C2ABEF5F18BF1F1ULL, 0xBEFE170F31BF245FULL, 0x41081105221FFB73ULL),
+     S256Field(0x486961DC17525595ULL, 0x1336498565A06455ULL, 0xF2CA65AE1D6B8498ULL, 0xDC37F36976FF5668ULL), false},
+    {S256Field(0x4629C9B893D98DEDULL, 0xDBDF22833B8A0218ULL, 0xC8CF22990531D65EULL, 0x63A2A210A16CC0C8ULL),
+     S256Field(0x519197D4E0D1CFC2ULL, 0x1FABF6A009C7873AULL, 0xD065033254ED9446ULL, 0x882B42E2E7FEC76FULL), false},
+    {S256Field(0xEA861A50B8045445ULL, 0x80FF7371901E8D7EULL, 0x3DF12E2E5D57BEF0ULL, 0x0C15815D449D67CAULL),
+     S256Field(0x214F87D54054A206ULL, 0xBA3054E43658CEA3ULL, 0xD0A93C3B6663CD28ULL, 0x2F30D60A3AE94115ULL), false},
+    {S256Field(0x1E91239CC3857FAFULL, 0x882FCADE1E961970ULL, 0x0D57BA8F4828EF7FULL, 0xC757EB6B89AE8A9CULL),
+     S256Field(0x01D9DB0CA0584CA4ULL, 0x627D310D101894C1ULL, 0x257369F208BEC61BULL, 0xF03A59CFCD23FF36ULL), false},
+    {S256Field(0x0E4D184F5459225DULL, 0x44FAF77E2D8858D1ULL, 0xF815D409919C02A2ULL, 0xFA8063AEADAFA0D0ULL),
+     S256Field(0x3A2B7E3B7ECE1507ULL, 0x0A2B6C36D007C59CULL, 0x160DE220824C425CULL, 0x0BA71F9057C0C069ULL), false},
+    {S256Field(0x9679FE9416F0D044ULL, 0xAABA9FD4909E61A7ULL, 0x9E2F69CF862EE0A5ULL, 0x658CA3C59D0257A8ULL),
+     S256Field(0xADD1F32EF7CB872DULL, 0x55A16763C418CE89ULL, 0x0F165D62713BD376ULL, 0xAE5CC1377AEA2546ULL), false},
+    {S256Field(0xAB5AC9573696756DULL, 0x676AF16056561417ULL, 0xCE4C19835D3F305CULL, 0x31C94B4AAF91F2BAULL),
+     S256Field(0xABC45E8DDE08AE78ULL, 0x83AEDFCAE6AD1070ULL, 0xBF4B8B59AAF41606ULL, 0xF80F884B556E83A9ULL), false},
+    {S256Field(0x3436F9B45617E073ULL, 0x6BACBDBD3839317BULL, 0x90EE7896D7CFDC86ULL, 0x64587E2335471EB8ULL),
+     S256Field(0x58299E5E9FAF6589ULL, 0x85B90A39133AEAB3ULL, 0xAE96DD6447C299A1ULL, 0xD99FCDD5BF6902E2ULL), false},
+    {S256Field(0xADF714720E103DD6ULL, 0xC34604C07C004859ULL, 0x36A213CFC592A17AULL, 0xBC477BD55A4203F8ULL),
+     S256Field(0x639082D8D6F7C343ULL, 0x5D293572C63B44ACULL, 0x6CBAC552C6DEA639ULL, 0xE31E1E2429A8DD52ULL), false},
+    {S256Field(0x7D0DC3B0D44EAB31ULL, 0x0AC5AF1404E63490ULL, 0x0303B423267BF8E8ULL, 0x589DB4FE5A6BB838ULL),
+     S256Field(0x941AEBE751361F6AULL, 0x1F610E552148F8DBULL, 0xF607062024BD90F3ULL, 0x6255445C108AA2A4ULL), false},
+    {S256Field(0x7BF961729A0C2C41ULL, 0x42831C1C560336C6ULL, 0xEA8A1860AD6EDB7CULL, 0x1339B337D16E2FA2ULL),
+     S256Field(0x185F054BA9F1BC2BULL, 0x6B1227F87DE923A4ULL, 0xA7A3240FD113A340ULL, 0x9F9B296362C7AE5BULL), false},
+    {S256Field(0x3704B1F858FC47AFULL, 0xA8DDFEC832C0CDECULL, 0xCC50329B5001B568ULL, 0x7FF3BBA11363CF17ULL),
+     S256Field(0x7F86164CF9BA43A7ULL, 0x17A53B1AD18BAC29ULL, 0xA0BC891B7473446BULL, 0x1F6BA7AE8018A629ULL), false},
+    {S256Field(0x0184D60095213775ULL, 0x00B4293B23D42A99ULL, 0x6141E9395FEC7F61ULL, 0x8EC670463CEB60BBULL),
+     S256Field(0x0E010F3E7841FFFFULL, 0x71DA98A0BCCF51E9ULL, 0x06E643415CEDEE0EULL, 0x8F58A66FA0DA5BE3ULL), false},
+    {S256Field(0x3CB3FF8D3452ABBBULL, 0xAE6AA72FE2B95C2EULL, 0x89DBAC3FED95D495ULL, 0x83DE61B441E701BBULL),
+     S256Field(0x8A05176B054EB66EULL, 0xD79C5F36BBCE4291ULL, 0xA6BFB6AF8C4E1563ULL, 0x32F0E334A34C609FULL), false},
+    {S256Field(0xE9688C26F59276F1ULL, 0x33AE25B292A17B15ULL, 0x1A8BB5C00F7CD868ULL, 0x3D7663898F50C1DBULL),
+     S256Field(0x01E4A65B859CBCB3ULL, 0xF321982019B19786ULL, 0x60976E34DAD8333EULL, 0xD37669737A187DDBULL), false},
+    {S256Field(0x358D6C86DD45E458ULL, 0x2F0AA6CEA250E7FDULL, 0xB3A546D3E549DE04ULL, 0x8481BDE0E4E4D885ULL),
+     S256Field(0x6D64B1B59779057EULL, 0x900A79C42B262E55ULL, 0x84A25BF39CECB2CAULL, 0x38EE7B8CBA5404DDULL), false},
+    {S256Field(0x160A0FA4152DA17DULL, 0x11DC13DB08D0646BULL, 0x0894E6B05FE00BC8ULL, 0x3BEAED1E0F518C5FULL),
+     S256Field(0xCE704985ECC768D2ULL, 0x54CDE77B8DFEC416ULL, 0xFEF4A8BEBE80E1B5ULL, 0xC3B0D7F55AFF7ACDULL), false},
+    {S256Field(0x234FA17DBA4EDCC5ULL, 0xE74E3221420311B7ULL, 0x8752DFC039275997ULL, 0x6E73DBA0CBDC9D61ULL),
+     S256Field(0x7B31F7CDD59DA0E4ULL, 0x278A77DA70067903ULL, 0xBEA4550888828693ULL, 0xEE0AC1FC49EECC48ULL), false},
+    {S256Field(0x409C4C424A80B979ULL, 0x0490F5FA329ABB31ULL, 0x7627D97EAA47C310ULL, 0x7706DD8937E5B592ULL),
+     S256Field(0x14CF48104126CFDEULL, 0x17FA0A34FD7EFE32ULL, 0x7778DD7991EA9C71ULL, 0x8A02A9827D5BB714ULL), false},
+    {S256Field(0xDCDB9C4B726FE285ULL, 0xA45BAC29413EF127ULL, 0x0D2F3C7A41F9E06AULL, 0x16D422C5929BC0F8ULL),
+     S256Field(0x33E0FFE6C155B441ULL, 0xE93F0C1137364D42ULL, 0xA8AB7E69A63531B1ULL, 0x0DF888FA51E22641ULL), false},
+    {S256Field(0xAE310BCABACFA513ULL, 0x4E24079F9A60E3AEULL, 0xAA5A344750F56A9CULL, 0x1FCC0E47EEC76D63ULL),
+     S256Field(0x75075BA4107AFC9CULL, 0x4BEDEDD164983918ULL, 0xB48E38754339F9B4ULL, 0x165DC1A041E35478ULL), false},
+    {S256Field(0x21A2707CFEDC69B2ULL, 0xA50A6089B26B7717ULL, 0x7306430435CAA386ULL, 0xC12B9073AD6CB8A1ULL),
+     S256Field(0x032AE9B020DD41DDULL, 0xB8EE1DBE3D27B2A0ULL, 0xD9772DC89F894976ULL, 0x3173C43FE534CDF1ULL), false},
+    {S256Field(0xAB6F585DF961FE4DULL, 0x8A14886F8B107197ULL, 0xA3F3E931312CA73EULL, 0xD059BF85DC327A8FULL),
+     S256Field(0xB9935B066AE823C2ULL, 0xFD388BA1F4DAB64CULL, 0x3FE0765DC84955B4ULL, 0x45107A60C08B525EULL), false},
+    {S256Field(0xBCD6303F6CAF666BULL, 0x7FFCFED3C4B1CE30ULL, 0x62B6979AE817F463ULL, 0x13464A57A78102AAULL),
+     S256Field(0x3F495A907F6ECC27ULL, 0x48F300A81D0942E1ULL, 0xEF7E433453CCB0CAULL, 0x69BE159004614580ULL), false},
+    {S256Field(0xF216B2098ECA5F51ULL, 0xDDEA171B94FC9AEBULL, 0x2C6ED6B2BF05B5CFULL, 0xDDE9D514DD9EE696ULL),
+     S256Field(0x9AD69A73D0C638F7ULL, 0x50FEEBE8DE89571FULL, 0xD891F34B0A7F8F09ULL, 0xB84E69133CE28111ULL), false},
+    {S256Field(0x2F906B05999C88E4ULL, 0x9AED513E20AD46ECULL, 0x6E9F406EB1204B17ULL, 0xFD1A621023699373ULL),
+     S256Field(0x99C8C916595BC8DFULL, 0xDC6B71D495CC00F2ULL, 0xFB13C06954977782ULL, 0x1AC97B54B9C8C20BULL), false},
+    {S256Field(0xBD515B5B5F8018CEULL, 0xCF2DA5738D892D68ULL, 0xF13FFCE4F2C86DC7ULL, 0x4EE48531D8C296B9ULL),
+     S256Field(0x3C35A61B1E48381FULL, 0x71074971B4E80601ULL, 0xFC7B4408D0C7C5E6ULL, 0xB68F9ED4810BF8B5ULL), false},
+    {S256Field(0x02852E91F1473678ULL, 0xCBA05795094392F7ULL, 0xFF5E314C55B8C070ULL, 0xFD76CC9C34C400DBULL),
+     S256Field(0x7E164EEA8D144F4FULL, 0x60628EEE1401C843ULL, 0xE0FEE0A73D032CD6ULL, 0xF2046543787143DAULL), false},
+    {S256Field(0xDF00B7148D7A2193ULL, 0x2C691E44F197546EULL, 0x19E6CE8274B4EA21ULL, 0x85A2ABA33123B402ULL),
+     S256Field(0x7F0C83D4B0CDCF3AULL, 0xE1C6DADF9C3B1242ULL, 0xD82C6082D1CC029FULL, 0x9C129857EB2B0516ULL), false},
+    {S256Field(0x35B0305B377568B0ULL, 0x35AE8DD019E03B05ULL, 0x440B6D6C5783650FULL, 0xD25DDBFC73CFFE74ULL),
+     S256Field(0x60A13926DF39929CULL, 0x832273881E3C3F00ULL, 0x8BEAEF74CDE7D92BULL, 0x7A3AFF7593F84893ULL), false},
+    {S256Field(0x55FE5118A71D7C13ULL, 0x641AB5F7FA0FFA38ULL, 0x55F07E9A97AAC805ULL, 0x4581353143E94A72ULL),
+     S256Field(0x9638BC553AFF63CFULL, 0x7020065542BD96B9ULL, 0xB57F50F177DD69C9ULL, 0x9F5858EC14979AD8ULL), false},
+    {S256Field(0xCADA3A0D2D83F366ULL, 0x0CD9CCEDE2F28588ULL, 0x9AEF430BCC1DC97AULL, 0xBC4A9DF5B713FE2EULL),
+     S256Field(0xD758D666581F33C1ULL, 0xA6E8A9FBFA547B16ULL, 0x383937ADF4B798CAULL, 0x0D3A81CA6E785C06ULL), false},
+    {S256Field(0xB06A2E32F712BE3CULL, 0x7295F18EDA146A66ULL, 0xD3C725DBAB001534ULL, 0x39D7349D9331B378ULL),
+     S256Field(0xCC3019F41C6FF65CULL, 0xEF5EF7A5ECA41644ULL, 0xFB127554C66812E8ULL, 0x8F929B4F56EF3BF7ULL), false},
+    {S256Field(0x5AAE4FBCDF77F22BULL, 0xC699723994F82E03ULL, 0x9E51CD6C2995AF26ULL, 0xF0CBA617F7DC1DD0ULL),
+     S256Field(0x1FC8E2C75909A03CULL, 0x04F18C7E90A09566ULL, 0x9EF326C36516D040ULL, 0x1A25AB4313F9DF98ULL), false},
+    {S256Field(0x58ACDCD4C6509C12ULL, 0x8D6BFE235BD1F476ULL, 0x21D170E8D87268EDULL, 0x381D7AB9DB2154D3ULL),
+     S256Field(0x54642A8E2EB46102ULL, 0x205828586CE6EAF7ULL, 0xEB5D24573A6581E7ULL, 0xA47AAB5B7FDA3DA9ULL), false},
+    {S256Field(0x8DB3B4D6384FE955ULL, 0xF69956A5A063BCE4ULL, 0x4793B73E694C8A53ULL, 0xA703F05467AB87E6ULL),
+     S256Field(0xA26B2EFBD61344BDULL, 0x539E1629C597277FULL, 0xC0EA792D6B19199BULL, 0xD500F935A2B047ADULL), false},
+    {S256Field(0x3499656C06EACE58ULL, 0x1B7E4563A2F3211DULL, 0x46C6AD0D7053A03FULL, 0x73C6B3C5AAD550D7ULL),
+     S256Field(0x7170A9172AF8654EULL, 0xAA6A878DBBB8D291ULL, 0x1BA90991366D91C6ULL, 0x3A2FB4A4733A4F74ULL), false},
+    {S256Field(0x54B388BF00181D5EULL, 0xDE71B3A9B95AAF20ULL, 0xA1D00D3A1C0EDDB8ULL, 0xC627F3E7506D47FDULL),
+     S256Field(0x927900A6369F886DULL, 0x8EF6B00549CBE2C3ULL, 0xB2D6960138A1F7D6ULL, 0xD78F9DD71E442A63ULL), false},
+    {S256Field(0x34E28D9FB7828B16ULL, 0xA047958F28A4847FULL, 0xFA25F40A6F06DE53ULL, 0xBB88FABE0EDFD233ULL),
+     S256Field(0xC51473A20AEA5DF7ULL, 0xEC4A8174E3A1E969ULL, 0x345DC59601159163ULL, 0xB73676B304F5E8DDULL), false},
+    {S256Field(0x954AB30FE5324CAAULL, 0x694B65E30A9472A3ULL, 0xD23D8C749452A32EULL, 0x8C28A97BF8298BC0ULL),
+     S256Field(0x9E71DC73CBEF9482ULL, 0x7AE784F0451CB945ULL, 0x378FEDF31F7CC0EBULL, 0x40A30463A3305193ULL), false},
+    {S256Field(0x863E87154754DD40ULL, 0xA2422631FC3466CFULL, 0x45B4841FCD72F6E9ULL, 0x9729247032C0DFCFULL),
+     S256Field(0x384B492F2AA36143ULL, 0x90DAE85255ACAF49ULL, 0xCD15C75DCBD4DF36ULL, 0x91D1A244265FEA1DULL), false},
+    {S256Field(0x3C2D82EB8C2CA7FFULL, 0x1803645D95DF021AULL, 0x050791AD5A2F27AFULL, 0x89637F97580A796EULL),
+     S256Field(0xBED415E170493E68ULL, 0xF87BC6A38E42EAB7ULL, 0xD57B9CF154357489ULL, 0x2D1FE1248C888424ULL), false},
+    {S256Field(0x6186D63A0CA8DD7FULL, 0x1BC7280356A1381AULL, 0x2FDC9DA03D535742ULL, 0x308138E71BE25E09ULL),
+     S256Field(0xE415F2478A92C7F2ULL, 0xC8165646434AD915ULL, 0x5E39EC45D1408E18ULL, 0x28D1E2D28828FC92ULL), false},
+    {S256Field(0xC0DCC568866A3FB1ULL, 0x6EC009281992E206ULL, 0xD1E5750C85B6862FULL, 0x575FC4E82A6DEB65ULL),
+     S256Field(0x09B8E90A902655ADULL, 0xED33B573C6A3AF2FULL, 0xD671DBC2978E87DAULL, 0x6F6EDB9042A6FCA2ULL), false},
+    {S256Field(0x21B6A8A4790117DFULL, 0xDA253BBBCE201029ULL, 0x227F26F81EEA2A8FULL, 0xA5EC9036B64EAB7AULL),
+     S256Field(0xD8128133F86462FEULL, 0x1C8461F05614A363ULL, 0x0C597983AD1FA0F7ULL, 0xB79DC6625EC14040ULL), false},
+    {S256Field(0x0B0F975C172AD712ULL, 0x5A398CB0DE104729ULL, 0x49DE7976146349B9ULL, 0xA153DFE913310B09ULL),
+     S256Field(0xC8A5F6538D48FDD2ULL, 0xBD053F285AF0B329ULL, 0xC48318D5F1F1B89AULL, 0xFD94D8413FB05B2FULL), false},
+    {S256Field(0x030C370111CF5B3AULL, 0xC4433A83BDB5A781ULL, 0x935C34D088EDC824ULL, 0x9A541AC6AF794615ULL),
+     S256Field(0x63F5575F36A44AE4ULL, 0x5548FEE2521EA52DULL, 0xCAFE1AF3688F475FULL, 0xB66148C1CB106AB7ULL), false},
+    {S256Field(0x48C4BA111FACCAE0ULL, 0x3C8B350C5A4BB337ULL, 0xC1DD94CE4F071FD2ULL, 0x08EA9666139527A8ULL),
+     S256Field(0x55AF34A30E62B945ULL, 0x35B783BE9CF0F8E9ULL, 0xE24E7C0CFB95C5D7ULL, 0x620EFABBC8EE2782ULL), false},
+    {S256Field(0x21A40B5966A06F5EULL, 0xA34192516EA08370ULL, 0xC37B0D421263B716ULL, 0x383B24FBEA14253AULL),
+     S256Field(0x089F4786D3C6E772ULL, 0xE8F6AE74BB8C2B04ULL, 0x44CF566D54EA5A19ULL, 0x54CF706AC4EDBA20ULL), false},
+    {S256Field(0xC7975C1D4638A136ULL, 0x2B0D1CE336838195ULL, 0x789E59C6B60D790CULL, 0xE68432D03E02ED6DULL),
+     S256Field(0xAAFD18108C6C2584ULL, 0x2E09E3EBDB357336ULL, 0x24D2A7303A01E647ULL, 0xCA5BE41398E35A66ULL), false},
+    {S256Field(0x7CE87C4416E8C10CULL, 0xB472985F391BD680ULL, 0x0EEFBDECE7306E7FULL, 0x395DD559E2FE5C2AULL),
+     S256Field(0xBC3D6D9305FE638EULL, 0x4C909C04DC66922CULL, 0xD0413E87AFFA4E27ULL, 0xFD62DCD4B4592AC5ULL), false},
+    {S256Field(0x51664DB20D6C14EFULL, 0x0858FC7506F93C8FULL, 0x9F6EED5BEEE26480ULL, 0x7A514ADC35525DCBULL),
+     S256Field(0x7AD3E1870B3FBD13ULL, 0x29BEAEF72AA6E24FULL, 0xE897F0B94C8F5C37ULL, 0x56EDD1FED152E4D8ULL), false},
+    {S256Field(0x4A9463D04F6D65EBULL, 0x5A99107754402152ULL, 0x8EA8EF3BF4908F23ULL, 0x1EE1FD584325D90DULL),
+     S256Field(0x1E036B925D22941CULL, 0xCA32F4E9863582B1ULL, 0x1CFAB9FC4F42FCFAULL, 0xBB692891BDD6C73CULL), false},
+    {S256Field(0x1F1950EF0E36CB44ULL, 0x617E8B6C8DCA2019ULL, 0xBC058FD0D883357DULL, 0x15515634D38FAAA8ULL),
+     S256Field(0x329AF4651F495A68ULL, 0xA8C37175F020C1E5ULL, 0xE370E3F0B463205DULL, 0xAB4FFFC755575215ULL), false},
+    {S256Field(0x51F946107427BACCULL, 0x9E733164DD2D62E1ULL, 0x36358EB0958DC4AAULL, 0x3BC6BC6446BF5201ULL),
+     S256Field(0x14C33FD5EAD6FDA6ULL, 0xD71B75A5228BEB47ULL, 0xCDB62EE226D6C02BULL, 0x8E305CC07176C305ULL), false},
+    {S256Field(0x92F76CC4EB9A9787ULL, 0x89BDDE8159599680ULL, 0x74669716BBD3788DULL, 0xDD3625FAEF5BA060ULL),
+     S256Field(0x37F68D00C644A573ULL, 0x9414619828833959ULL, 0x61DA2501045731CAULL, 0x7A188FA3520E30D4ULL), false}
+};
@@ -0,0 +1,31 @@
+#ifndef PRECOMPUTED_H
+#define PRECOMPUTED_H
+
+#include <stddef.h>
+
+#include "group.h"
+
+/**
+ * @brief The tables of multiples of the generator point G that group.cpp's multiplications by G look up. They are
+ * generated by precompute_tables.cpp and compiled in as constant data (precomputed.cpp), so no table is built at
+ * run time: loading the library costs nothing and the first multiplication by G is as fast as the others.
+ * Regenerate them with `./precompute_tables > precomputed.cpp` after changing a table's layout.
+ */
+
+// The table of s256_multiply_generator(): j * 16^i * G at index i * 15 + j - 1, for each of the 64 4-bit windows i
+// and each non-zero window value j
+static const size_t S256_GENERATOR_WINDOW_TABLE_SIZE = 64 * 15;
+extern const S256AffineCoords S256_GENERATOR_WINDOW_TABLE[S256_GENERATOR_WINDOW_TABLE_SIZE];
+
+// The odd multiples (1, 3, ..., 127) * G, from which s256_multiply_joint() picks its wNAF digits of width 8
+static const size_t S256_GENERATOR_ODD_MULTIPLES_SIZE = 64;
+extern const S256AffineCoords S256_GENERATOR_ODD_MULTIPLES[S256_GENERATOR_ODD_MULTIPLES_SIZE];
+// The same multiples of lambda * G, i.e., with x multiplied by beta, for s256_multiply_joint_glv()
+extern const S256AffineCoords S256_LAMBDA_GENERATOR_ODD_MULTIPLES[S256_GENERATOR_ODD_MULTIPLES_SIZE];
+
+// The table of s256_multiply_generator_fixed(): (2j + 1) * 16^i * G at index i * 8 + j, for each of the 64 windows
+// i and j in [0, 8), followed by 16^64 * G
+static const size_t S256_GENERATOR_FIXED_TABLE_SIZE = 64 * 8 + 1;
+extern const S256AffineCoords S256_GENERATOR_FIXED_TABLE[S256_GENERATOR_FIXED_TABLE_SIZE];
+
+#endif
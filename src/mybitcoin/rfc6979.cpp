@@ -0,0 +1,200 @@
+#include <string.h>
+#include <mycrypto/sha256.h>
+
+#include "rfc6979.h"
+
+static const size_t SHA256_BLOCK_SIZE = 64;
+
+static const uint32_t SHA256_ROUND_CONSTANTS[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t rotate_right(const uint32_t x, const int bits) {
+    return (x >> bits) | (x << (32 - bits));
+}
+
+SHA256Hasher::SHA256Hasher()
+    : state_{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19} {}
+
+void SHA256Hasher::compress(const uint8_t block[64]) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i) {
+        w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) |
+            ((uint32_t)block[4 * i + 2] << 8) | block[4 * i + 3];
+    }
+    for (int i = 16; i < 64; ++i) {
+        uint32_t s0 = rotate_right(w[i - 15], 7) ^ rotate_right(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotate_right(w[i - 2], 17) ^ rotate_right(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+    uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+    for (int i = 0; i < 64; ++i) {
+        uint32_t t1 = h + (rotate_right(e, 6) ^ rotate_right(e, 11) ^ rotate_right(e, 25)) + ((e & f) ^ (~e & g)) +
+            SHA256_ROUND_CONSTANTS[i] + w[i];
+        uint32_t t2 = (rotate_right(a, 2) ^ rotate_right(a, 13) ^ rotate_right(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state_[0] += a;
+    state_[1] += b;
+    state_[2] += c;
+    state_[3] += d;
+    state_[4] += e;
+    state_[5] += f;
+    state_[6] += g;
+    state_[7] += h;
+}
+
+void SHA256Hasher::write(const uint8_t* data, const size_t len) {
+    size_t buffered = length_ % SHA256_BLOCK_SIZE;
+    length_ += len;
+    size_t i = 0;
+    if (buffered > 0) {
+        i = len < SHA256_BLOCK_SIZE - buffered ? len : SHA256_BLOCK_SIZE - buffered;
+        memcpy(buffer_ + buffered, data, i);
+        if (buffered + i < SHA256_BLOCK_SIZE) { return; }
+        compress(buffer_);
+    }
+    for (; i + SHA256_BLOCK_SIZE <= len; i += SHA256_BLOCK_SIZE) {
+        compress(data + i);
+    }
+    memcpy(buffer_, data + i, len - i);
+}
+
+void SHA256Hasher::finalize(uint8_t* hash) {
+    const uint64_t bit_length = length_ * 8;
+    // 0x80, then zeros up to 8 bytes short of a block boundary, then the message's length in bits
+    uint8_t padding[SHA256_BLOCK_SIZE + 8] = {0x80};
+    size_t padding_len = SHA256_BLOCK_SIZE - (length_ + 8) % SHA256_BLOCK_SIZE;
+    for (int i = 0; i < 8; ++i) {
+        padding[padding_len + i] = (uint8_t)(bit_length >> (56 - 8 * i));
+    }
+    write(padding, padding_len + 8);
+    for (int i = 0; i < 8; ++i) {
+        hash[4 * i] = (uint8_t)(state_[i] >> 24);
+        hash[4 * i + 1] = (uint8_t)(state_[i] >> 16);
+        hash[4 * i + 2] = (uint8_t)(state_[i] >> 8);
+        hash[4 * i + 3] = (uint8_t)state_[i];
+    }
+}
+
+HMACSHA256::HMACSHA256(const uint8_t* key, const size_t key_len) {
+    uint8_t block[SHA256_BLOCK_SIZE] = {0};
+    if (key_len > SHA256_BLOCK_SIZE) {
+        SHA256Hasher hasher;
+        hasher.write(key, key_len);
+        hasher.finalize(block);
+    } else {
+        memcpy(block, key, key_len);
+    }
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; ++i) { block[i] ^= 0x36; }
+    inner_.write(block, SHA256_BLOCK_SIZE);
+    // 0x36 ^ 0x5c, from the ipad block straight to the opad one
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; ++i) { block[i] ^= 0x6a; }
+    outer_.write(block, SHA256_BLOCK_SIZE);
+    memset(block, 0, sizeof(block));
+}
+
+SHA256Hasher HMACSHA256::inner() const {
+    return inner_;
+}
+
+void HMACSHA256::finalize(SHA256Hasher inner, uint8_t* mac) const {
+    uint8_t inner_hash[SHA256_HASH_SIZE];
+    inner.finalize(inner_hash);
+    SHA256Hasher outer = outer_;
+    outer.write(inner_hash, SHA256_HASH_SIZE);
+    outer.finalize(mac);
+}
+
+void HMACSHA256::compute(const uint8_t* data, const size_t data_len, uint8_t* mac) const {
+    SHA256Hasher inner = inner_;
+    inner.write(data, data_len);
+    finalize(inner, mac);
+}
+
+/**
+ * @brief Step b and c's K = 0x00 0x00 ..., the same for every key. A function-local static is initialized on first
+ * use, once, even if several threads get there at the same time.
+ */
+static const HMACSHA256& initial_hmac() {
+    static const uint8_t zeros[SHA256_HASH_SIZE] = {0};
+    static const HMACSHA256 hmac(zeros, SHA256_HASH_SIZE);
+    return hmac;
+}
+
+static const uint8_t ZERO_PRIVKEY[32] = {0};
+
+RFC6979Generator::RFC6979Generator() : RFC6979Generator(ZERO_PRIVKEY) {}
+
+RFC6979Generator::RFC6979Generator(const uint8_t* privkey_bytes) {
+    memcpy(privkey_bytes_, privkey_bytes, sizeof(privkey_bytes_));
+    uint8_t v[SHA256_HASH_SIZE];
+    memset(v, 0x01, sizeof(v));
+    const uint8_t separator = 0x00;
+    first_inner_ = initial_hmac().inner();
+    first_inner_.write(v, SHA256_HASH_SIZE);
+    first_inner_.write(&separator, 1);
+    first_inner_.write(privkey_bytes_, sizeof(privkey_bytes_));
+}
+
+S256Scalar RFC6979Generator::generate(const uint8_t* msg_hash, const uint8_t* extra_entropy,
+    const size_t extra_entropy_len) const {
+    // bits2octets(h1): the hash reduced modulo n
+    uint8_t h1[SHA256_HASH_SIZE];
+    S256Scalar::from_bytes(msg_hash).get_bytes(h1);
+    uint8_t k[SHA256_HASH_SIZE], v[SHA256_HASH_SIZE];
+    memset(v, 0x01, sizeof(v));
+    // Step d, K = HMAC_K(V || 0x00 || int2octets(x) || bits2octets(h1) || k'), from the per-key midstate
+    SHA256Hasher inner = first_inner_;
+    inner.write(h1, sizeof(h1));
+    if (extra_entropy != nullptr) { inner.write(extra_entropy, extra_entropy_len); }
+    initial_hmac().finalize(inner, k);
+    // Step e, V = HMAC_K(V)
+    HMACSHA256 hmac(k, sizeof(k));
+    hmac.compute(v, sizeof(v), v);
+    // Step f, K = HMAC_K(V || 0x01 || int2octets(x) || bits2octets(h1) || k')
+    const uint8_t separator[2] = {0x00, 0x01};
+    inner = hmac.inner();
+    inner.write(v, sizeof(v));
+    inner.write(&separator[1], 1);
+    inner.write(privkey_bytes_, sizeof(privkey_bytes_));
+    inner.write(h1, sizeof(h1));
+    if (extra_entropy != nullptr) { inner.write(extra_entropy, extra_entropy_len); }
+    hmac.finalize(inner, k);
+    // Step g, V = HMAC_K(V)
+    hmac = HMACSHA256(k, sizeof(k));
+    hmac.compute(v, sizeof(v), v);
+    while (true) {
+        // Step h, qlen = hlen = 256, so T is a single V = HMAC_K(V)
+        hmac.compute(v, sizeof(v), v);
+        bool overflow = false;
+        S256Scalar candidate = S256Scalar::from_bytes(v, &overflow);
+        if (!overflow && !candidate.is_zero()) {
+            memset(k, 0, sizeof(k));
+            memset(v, 0, sizeof(v));
+            return candidate;
+        }
+        // K = HMAC_K(V || 0x00), V = HMAC_K(V), less likely than once in 2^127 messages
+        inner = hmac.inner();
+        inner.write(v, sizeof(v));
+        inner.write(&separator[0], 1);
+        hmac.finalize(inner, k);
+        hmac = HMACSHA256(k, sizeof(k));
+        hmac.compute(v, sizeof(v), v);
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef RFC6979_H
+#define RFC6979_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "scalar.h"
+
+/**
+ * @brief Deterministic ECDSA nonces (RFC 6979) with HMAC-SHA256.
+ * Generating one k takes seven HMACs under three different keys, and a one-shot hmac_sha256() hashes the padded key
+ * (the ipad and opad blocks) again for each of them, then the data. Here the SHA-256 state after the ipad and opad
+ * blocks (a "midstate") is computed once per HMAC key and copied for each message, and the first HMAC, whose key,
+ * V and private key are the same for every message signed with a key, is hashed up to the message once per key.
+ * Everything lives on the stack, nothing is allocated.
+ */
+
+/**
+ * @brief An incremental SHA-256. Copying one copies the state, so a common prefix can be hashed once and the copies
+ * finished with different suffixes.
+ */
+class SHA256Hasher {
+protected:
+  uint32_t state_[8];
+  uint8_t buffer_[64];
+  // The number of bytes written so far
+  uint64_t length_ = 0;
+  void compress(const uint8_t block[64]);
+public:
+  SHA256Hasher();
+  void write(const uint8_t* data, const size_t len);
+  /**
+   * @brief Write the padding and get the SHA256_HASH_SIZE-byte hash. The hasher can't be written to afterwards.
+   */
+  void finalize(uint8_t* hash);
+};
+
+/**
+ * @brief HMAC-SHA256 under a fixed key, with the ipad and opad blocks hashed once in the constructor.
+ */
+class HMACSHA256 {
+protected:
+  SHA256Hasher inner_;
+  SHA256Hasher outer_;
+public:
+  /**
+   * @param key the key. Keys longer than a SHA-256 block (64 bytes) are hashed first, as HMAC defines.
+   */
+  HMACSHA256(const uint8_t* key, const size_t key_len);
+  /**
+   * @brief The inner hasher after the ipad block, i.e., ready for the data, to be finished by finalize()
+   */
+  SHA256Hasher inner() const;
+  /**
+   * @brief Get the MAC of the data written to inner, a copy of inner()
+   * @param mac SHA256_HASH_SIZE bytes. It may be some of the data, which has been hashed by then.
+   */
+  void finalize(SHA256Hasher inner, uint8_t* mac) const;
+  /**
+   * @brief Get the MAC of data. mac may point to the same array as data.
+   */
+  void compute(const uint8_t* data, const size_t data_len, uint8_t* mac) const;
+};
+
+/**
+ * @brief The RFC 6979 nonce generator of one private key, see section 3.2 of the RFC.
+ */
+class RFC6979Generator {
+protected:
+  uint8_t privkey_bytes_[32] = {0};
+  // The inner hash of step d's HMAC, HMAC_K(V || 0x00 || int2octets(x) || ...) with K = 0x00 0x00 ... and
+  // V = 0x01 0x01 ..., up to the message hash, which depends on nothing but the private key
+  SHA256Hasher first_inner_;
+public:
+  RFC6979Generator();
+  /**
+   * @param privkey_bytes the private key, 32 bytes in big-endian order
+   */
+  explicit RFC6979Generator(const uint8_t* privkey_bytes);
+  /**
+   * @brief Get the first k in [1, n) for a message
+   * @param msg_hash the message hash, 32 bytes. It is reduced modulo n (bits2octets() in the RFC).
+   * @param extra_entropy nullptr, or additional data k' appended to the private key and the message hash in steps
+   * d and f (section 3.6 of the RFC), e.g., 32 random bytes, so that k is no longer a function of the message alone
+   * @param extra_entropy_len the length of extra_entropy
+   */
+  S256Scalar generate(const uint8_t* msg_hash, const uint8_t* extra_entropy = nullptr,
+    const size_t extra_entropy_len = 0) const;
+};
+
+#endif
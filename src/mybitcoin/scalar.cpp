@@ -0,0 +1,236 @@
+#include <stdexcept>
+#include <vector>
+
+#include "int128.h"
+#include "kernel.h"
+#include "modinv.h"
+#include "scalar.h"
+
+using namespace std;
+using namespace boost::multiprecision;
+
+static const uint64_t S256_N[4] = {
+    0xBFD25E8CD0364141ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL
+};
+// 2^256 - n, so 2^256 ≡ S256_N_C (mod n)
+static const uint64_t S256_N_C[3] = {0x402DA1732FC9BEBFULL, 0x4551231950B75FC4ULL, 0x1ULL};
+// (n - 1) / 2, the largest "low" s
+static const uint64_t S256_N_HALF[4] = {
+    0xDFE92F46681B20A0ULL, 0x5D576E7357A4501DULL, 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL
+};
+
+/**
+ * @brief r = t - n if carry is set or t >= n, otherwise r = t, without branches. t + carry * 2^256 has to be
+ * smaller than 2n.
+ */
+static void subtract_n_once(const uint64_t t[4], const uint64_t carry, uint64_t r[4]) {
+    uint64_t diff[4];
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 d = (u128)t[i] - S256_N[i] - borrow;
+        diff[i] = (uint64_t)d;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+    uint64_t mask = -(carry | (borrow ^ 1));
+    for (int i = 0; i < 4; ++i) { r[i] = (diff[i] & mask) | (t[i] & ~mask); }
+}
+
+/**
+ * @brief out = lo + hi * S256_N_C, where out has out_len limbs, which have to be enough to hold the sum
+ * @param lo four little-endian limbs
+ * @param hi hi_len little-endian limbs
+ */
+static void fold(const uint64_t lo[4], const uint64_t* hi, const int hi_len, uint64_t* out, const int out_len) {
+    for (int i = 0; i < out_len; ++i) { out[i] = i < 4 ? lo[i] : 0; }
+    for (int i = 0; i < hi_len; ++i) {
+        u128 acc = 0;
+        for (int j = 0; j < 3; ++j) {
+            acc += (u128)hi[i] * S256_N_C[j] + out[i + j];
+            out[i + j] = (uint64_t)acc; acc >>= 64;
+        }
+        // The carry is propagated all the way up regardless of its value, so the schedule stays fixed
+        for (int k = i + 3; k < out_len; ++k) {
+            acc += out[k];
+            out[k] = (uint64_t)acc; acc >>= 64;
+        }
+    }
+}
+
+/**
+ * @brief Reduce a 512-bit product modulo n
+ * @param in the product in eight little-endian limbs
+ * @param r the reduced result in four little-endian limbs
+ */
+static void reduce_512(const uint64_t in[8], uint64_t r[4]) {
+    uint64_t t1[7], t2[5], t3[5], t4[5];
+    // 256 + 129 bits fit in 7 limbs
+    fold(in, in + 4, 4, t1, 7);
+    // 129 + 129 bits plus the lower 256 bits are less than 2^260
+    fold(t1, t1 + 4, 3, t2, 5);
+    // t2[4] is at most 16, so t3 < 2^257, i.e., t3[4] is 0 or 1
+    fold(t2, t2 + 4, 1, t3, 5);
+    // If t3[4] is 1, t3's lower 256 bits are tiny, so this last fold can't overflow 2^256
+    fold(t3, t3 + 4, 1, t4, 5);
+    subtract_n_once(t4, 0, r);
+}
+
+void s256_scalar_reduce(const uint64_t num[4], uint64_t r[4]) {
+    // 2^256 < 2n, so subtracting n once is enough
+    subtract_n_once(num, 0, r);
+}
+
+void s256_scalar_add(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]) {
+    uint64_t sum[4];
+    u128 acc = 0;
+    for (int i = 0; i < 4; ++i) {
+        acc += (u128)a[i] + b[i];
+        sum[i] = (uint64_t)acc; acc >>= 64;
+    }
+    subtract_n_once(sum, (uint64_t)acc, r);
+}
+
+void s256_scalar_multiply(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]) {
+    uint64_t product[8];
+    s256_kernel().multiply_wide(a, b, product);
+    reduce_512(product, r);
+}
+
+void s256_scalar_negate(const uint64_t a[4], uint64_t r[4]) {
+    uint64_t diff[4];
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 d = (u128)S256_N[i] - a[i] - borrow;
+        diff[i] = (uint64_t)d;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+    // n - 0 is n, which has to become 0
+    uint64_t mask = -(uint64_t)((a[0] | a[1] | a[2] | a[3]) != 0);
+    for (int i = 0; i < 4; ++i) { r[i] = diff[i] & mask; }
+}
+
+S256Scalar::S256Scalar() {}
+
+S256Scalar::S256Scalar(const uint64_t num) {
+    // Any 64-bit number is smaller than n
+    this->n_[0] = num;
+}
+
+S256Scalar::S256Scalar(const int512_t& num) {
+    if (num < 0 || num >= S256Scalar::order()) {
+        throw invalid_argument("num [" + num.str() + "] is negative or not smaller than secp256k1's order");
+    }
+    for (int i = 0; i < 4; ++i) {
+        this->n_[i] = (uint64_t)((num >> (64 * i)) & 0xFFFFFFFFFFFFFFFFULL);
+    }
+}
+
+const int512_t& S256Scalar::order() {
+    return S256Scalar::ORDER;
+}
+
+S256Scalar S256Scalar::from_limbs(const uint64_t limbs[4]) {
+    S256Scalar result;
+    s256_scalar_reduce(limbs, result.n_);
+    return result;
+}
+
+S256Scalar S256Scalar::from_bytes(const uint8_t* input_bytes, bool* overflow) {
+    uint64_t limbs[4] = {0};
+    for (int i = 0; i < 32; ++i) {
+        limbs[3 - i / 8] = (limbs[3 - i / 8] << 8) | input_bytes[i];
+    }
+    S256Scalar result = S256Scalar::from_limbs(limbs);
+    if (overflow != nullptr) {
+        *overflow = ((limbs[0] ^ result.n_[0]) | (limbs[1] ^ result.n_[1]) | (limbs[2] ^ result.n_[2]) |
+                     (limbs[3] ^ result.n_[3])) != 0;
+    }
+    return result;
+}
+
+void S256Scalar::get_bytes(uint8_t* output_bytes) const {
+    for (int i = 0; i < 32; ++i) {
+        output_bytes[i] = (uint8_t)(this->n_[3 - i / 8] >> (56 - 8 * (i % 8)));
+    }
+}
+
+int512_t S256Scalar::num() const {
+    int512_t result = 0;
+    for (int i = 3; i >= 0; --i) {
+        result <<= 64;
+        result |= this->n_[i];
+    }
+    return result;
+}
+
+const uint64_t* S256Scalar::limbs() const {
+    return this->n_;
+}
+
+bool S256Scalar::operator==(const S256Scalar& other) const {
+    return ((this->n_[0] ^ other.n_[0]) | (this->n_[1] ^ other.n_[1]) | (this->n_[2] ^ other.n_[2]) |
+            (this->n_[3] ^ other.n_[3])) == 0;
+}
+
+bool S256Scalar::operator!=(const S256Scalar& other) const {
+    return !(*this == other);
+}
+
+S256Scalar S256Scalar::operator+(const S256Scalar& other) const {
+    S256Scalar result;
+    s256_scalar_add(this->n_, other.n_, result.n_);
+    return result;
+}
+
+S256Scalar S256Scalar::operator-(const S256Scalar& other) const {
+    return *this + other.negate();
+}
+
+S256Scalar S256Scalar::operator*(const S256Scalar& other) const {
+    S256Scalar result;
+    s256_scalar_multiply(this->n_, other.n_, result.n_);
+    return result;
+}
+
+S256Scalar S256Scalar::negate() const {
+    S256Scalar result;
+    s256_scalar_negate(this->n_, result.n_);
+    return result;
+}
+
+S256Scalar S256Scalar::inverse() const {
+    S256Scalar result;
+    s256_scalar_inverse(this->n_, result.n_);
+    return result;
+}
+
+void S256Scalar::batch_inverse(S256Scalar* scalars, const size_t count) {
+    if (count == 0) { return; }
+    // The same as S256Field::batch_inverse(), prefix[i] is the product of all non-zero scalars[0..i]
+    vector<S256Scalar> prefix(count);
+    S256Scalar product = S256Scalar(1);
+    for (size_t i = 0; i < count; ++i) {
+        if (!scalars[i].is_zero()) { product = product * scalars[i]; }
+        prefix[i] = product;
+    }
+    S256Scalar inv = product.inverse();
+    for (size_t i = count; i-- > 0;) {
+        if (scalars[i].is_zero()) { continue; }
+        S256Scalar scalar = scalars[i];
+        scalars[i] = i > 0 ? inv * prefix[i - 1] : inv;
+        inv = inv * scalar;
+    }
+}
+
+bool S256Scalar::is_zero() const {
+    return (this->n_[0] | this->n_[1] | this->n_[2] | this->n_[3]) == 0;
+}
+
+bool S256Scalar::is_high() const {
+    // The scalar is high if and only if (n - 1) / 2 - scalar borrows
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        u128 d = (u128)S256_N_HALF[i] - this->n_[i] - borrow;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+    return borrow;
+}
@@ -0,0 +1,121 @@
+#ifndef SCALAR_H
+#define SCALAR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace std;
+using namespace boost::multiprecision;
+
+// See field.h
+namespace s256_constants {
+using namespace boost::multiprecision::literals;
+constexpr int512_t ORDER = 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141_cppi512;
+}
+
+/**
+ * @brief Arithmetic modulo secp256k1's group order
+ * n = 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141 on four little-endian 64-bit limbs, which
+ * is what signing does with the private key and the nonce. Products go through the kernel set picked for the CPU
+ * (see kernel.h) and are reduced by folding with 2^256 ≡ 2^256 - n (mod n), a 129-bit number. Every function runs
+ * the same instructions whatever the values are, so they can be used on secrets.
+ */
+
+/**
+ * @brief r = num mod n, for a 256-bit num that may not be smaller than n, e.g., a message hash
+ */
+void s256_scalar_reduce(const uint64_t num[4], uint64_t r[4]);
+
+/**
+ * @brief r = (a + b) mod n, where a and b are in [0, n). r may point to the same array as a or b.
+ */
+void s256_scalar_add(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]);
+
+/**
+ * @brief r = (a * b) mod n, where a and b are in [0, n). r may point to the same array as a or b.
+ */
+void s256_scalar_multiply(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]);
+
+/**
+ * @brief r = -a mod n, where a is in [0, n). r may point to the same array as a.
+ */
+void s256_scalar_negate(const uint64_t a[4], uint64_t r[4]);
+
+/**
+ * @brief An integer modulo secp256k1's group order n, i.e., what ECDSA's k, r, s and message hashes are reduced to,
+ * stored in four 64-bit limbs. It is to the group order what S256Field is to the base field's prime: signing and
+ * verification work on it instead of on int512_t/int1024_t and a `%` by n after every operation. The arithmetic is
+ * the constant-time s256_scalar_*() functions above and safegcd (see modinv.h) for inverses.
+ * @note The value is always kept fully reduced, i.e., in [0, n).
+ */
+class S256Scalar {
+protected:
+  // Little-endian limbs: n_[0] holds the least significant 64 bits.
+  uint64_t n_[4] = {0, 0, 0, 0};
+public:
+  /**
+   * @brief Initialize the scalar to zero.
+   */
+  S256Scalar();
+  /**
+   * @brief Initialize the scalar from a small integer.
+   */
+  explicit S256Scalar(const uint64_t num);
+  /**
+   * @brief Initialize the scalar from an int512_t
+   * @param num the number of the scalar, it has to be in [0, n)
+   * @throw invalid_argument if num is negative or not smaller than n
+   */
+  explicit S256Scalar(const int512_t& num);
+  // n as an int512_t, a compile-time constant
+  static constexpr int512_t ORDER = s256_constants::ORDER;
+  /**
+   * @brief Get n as an int512_t
+   */
+  static const int512_t& order();
+  /**
+   * @brief Initialize the scalar from four little-endian 64-bit limbs.
+   * The value is reduced modulo n if it is not smaller than n.
+   */
+  static S256Scalar from_limbs(const uint64_t limbs[4]);
+  /**
+   * @brief Initialize the scalar from a 32-byte big-endian byte array, e.g., a message hash or an r or s from a
+   * signature. The value is reduced modulo n if it is not smaller than n.
+   * @param overflow if not nullptr, it is set to whether the value was not smaller than n, which is what callers
+   * that have to reject such values (e.g., a private key) check
+   */
+  static S256Scalar from_bytes(const uint8_t* input_bytes, bool* overflow = nullptr);
+  /**
+   * @brief Write the scalar to a pre-allocated, 32-byte long array in big-endian order.
+   */
+  void get_bytes(uint8_t* output_bytes) const;
+  int512_t num() const;
+  const uint64_t* limbs() const;
+
+  bool operator==(const S256Scalar& other) const;
+  bool operator!=(const S256Scalar& other) const;
+  S256Scalar operator+(const S256Scalar& other) const;
+  S256Scalar operator-(const S256Scalar& other) const;
+  S256Scalar operator*(const S256Scalar& other) const;
+  S256Scalar negate() const;
+  /**
+   * @brief Get the multiplicative inverse of the scalar with the constant-time safegcd algorithm, see modinv.h. The
+   * inverse of zero is defined to be zero.
+   */
+  S256Scalar inverse() const;
+  /**
+   * @brief Invert many scalars at once with Montgomery's trick, see S256Field::batch_inverse()
+   * @param scalars an array of count scalars, each of them is replaced by its inverse in place. Zeros stay zero.
+   * @param count the number of scalars
+   */
+  static void batch_inverse(S256Scalar* scalars, const size_t count);
+  bool is_zero() const;
+  /**
+   * @brief Check if the scalar is greater than n / 2. Of the two valid s of an ECDSA signature, s and n - s, the one
+   * that isn't high is the canonical (BIP62 "low S") one.
+   */
+  bool is_high() const;
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include <random>
+#include <string.h>
+
+#include "rfc6979.h"
+#include "sigcache.h"
+#include "utils.h"
+
+static const uint64_t REFERENCED = (uint64_t)1 << 63;
+static const uint64_t TAG_MASK = REFERENCED - 1;
+
+static uint64_t get_uint64_from_bytes(const uint8_t* bytes, const size_t len) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < len; ++i) { value = (value << 8) | bytes[i]; }
+    return value;
+}
+
+SignatureCache::SignatureCache(const size_t entries) : hits_(0), misses_(0), insertions_(0), evictions_(0) {
+    size_t capacity = WAYS;
+    while (capacity < entries) { capacity *= 2; }
+    mask_ = capacity - 1;
+    slots_.reset(new atomic<uint64_t>[capacity]);
+    for (size_t i = 0; i < capacity; ++i) { slots_[i].store(0, memory_order_relaxed); }
+    random_device device;
+    for (size_t i = 0; i < sizeof(salt_); i += 4) {
+        uint32_t random = device();
+        memcpy(salt_ + i, &random, 4);
+    }
+}
+
+void SignatureCache::get_entry(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig, uint64_t* tag,
+    size_t* positions) const {
+    uint8_t buf[S256Point::SEC_COMPRESSED_LEN];
+    SHA256Hasher hasher;
+    hasher.write(salt_, sizeof(salt_));
+    // The message as verify() sees it, so that hashes it takes for the same message share an entry and no others do
+    S256Point::get_scalar_from_hash(msg_hash).get_bytes(buf);
+    hasher.write(buf, SHA256_HASH_SIZE);
+    hasher.write(buf, pubkey.get_sec_format(true, buf));
+    sig.r_scalar().get_bytes(buf);
+    hasher.write(buf, SHA256_HASH_SIZE);
+    sig.s_scalar().get_bytes(buf);
+    hasher.write(buf, SHA256_HASH_SIZE);
+    uint8_t hash[SHA256_HASH_SIZE];
+    hasher.finalize(hash);
+    // The tag (8 bytes) and each position (6 bytes) come from different bytes of the hash, so they are independent
+    // of each other
+    *tag = get_uint64_from_bytes(hash, 8) & TAG_MASK;
+    if (*tag == 0) { *tag = 1; }
+    for (size_t i = 0; i < WAYS; ++i) {
+        positions[i] = get_uint64_from_bytes(hash + 8 + i * 6, 6) & mask_;
+    }
+}
+
+bool SignatureCache::contains(const uint64_t tag, const size_t* positions) {
+    for (size_t i = 0; i < WAYS; ++i) {
+        uint64_t slot = slots_[positions[i]].load(memory_order_relaxed);
+        if ((slot & TAG_MASK) == tag) {
+            if ((slot & REFERENCED) == 0) { slots_[positions[i]].fetch_or(REFERENCED, memory_order_relaxed); }
+            hits_.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+    misses_.fetch_add(1, memory_order_relaxed);
+    return false;
+}
+
+void SignatureCache::insert(const uint64_t tag, const size_t* positions) {
+    uint64_t slots[WAYS];
+    for (size_t i = 0; i < WAYS; ++i) {
+        slots[i] = slots_[positions[i]].load(memory_order_relaxed);
+        // Already there, e.g., inserted by another thread in the meantime
+        if ((slots[i] & TAG_MASK) == tag) { return; }
+    }
+    for (size_t i = 0; i < WAYS; ++i) {
+        uint64_t empty = 0;
+        if (slots[i] == 0 && slots_[positions[i]].compare_exchange_strong(empty, tag, memory_order_relaxed)) {
+            insertions_.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+    }
+    // All WAYS slots are taken. The first pass clears the referenced bits it passes over, so unless other threads
+    // keep hitting all of the entries, the second finds one to replace.
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < WAYS; ++i) {
+            uint64_t slot = slots_[positions[i]].load(memory_order_relaxed);
+            if ((slot & REFERENCED) == 0) {
+                if (slots_[positions[i]].compare_exchange_strong(slot, tag, memory_order_relaxed)) {
+                    insertions_.fetch_add(1, memory_order_relaxed);
+                    evictions_.fetch_add(1, memory_order_relaxed);
+                    return;
+                }
+            } else {
+                slots_[positions[i]].fetch_and(TAG_MASK, memory_order_relaxed);
+            }
+        }
+    }
+    slots_[positions[0]].store(tag, memory_order_relaxed);
+    insertions_.fetch_add(1, memory_order_relaxed);
+    evictions_.fetch_add(1, memory_order_relaxed);
+}
+
+bool SignatureCache::contains(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig) {
+    uint64_t tag;
+    size_t positions[WAYS];
+    get_entry(pubkey, msg_hash, sig, &tag, positions);
+    return contains(tag, positions);
+}
+
+void SignatureCache::insert(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig) {
+    uint64_t tag;
+    size_t positions[WAYS];
+    get_entry(pubkey, msg_hash, sig, &tag, positions);
+    insert(tag, positions);
+}
+
+bool SignatureCache::verify(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig) {
+    uint64_t tag;
+    size_t positions[WAYS];
+    get_entry(pubkey, msg_hash, sig, &tag, positions);
+    if (contains(tag, positions)) { return true; }
+    if (!pubkey.verify(msg_hash, sig)) { return false; }
+    insert(tag, positions);
+    return true;
+}
+
+size_t SignatureCache::capacity() const {
+    return mask_ + 1;
+}
+
+SignatureCache::Stats SignatureCache::stats() const {
+    Stats stats;
+    stats.hits = hits_.load(memory_order_relaxed);
+    stats.misses = misses_.load(memory_order_relaxed);
+    stats.insertions = insertions_.load(memory_order_relaxed);
+    stats.evictions = evictions_.load(memory_order_relaxed);
+    return stats;
+}
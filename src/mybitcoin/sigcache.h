@@ -0,0 +1,73 @@
+#ifndef SIGCACHE_H
+#define SIGCACHE_H
+
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ecc.h"
+
+/**
+ * @brief A fixed-size cache of (msg_hash, public key, signature) triples that have passed S256Point::verify(), so
+ * that verifying one again, e.g., when a transaction is re-checked or a chain is replayed, is a hash and a lookup
+ * instead of a double scalar multiplication. Failed verifications aren't cached.
+ * An entry is SHA-256(salt || msg_hash mod n || SEC public key || r || s), of which 63 bits are kept as a tag.
+ * msg_hash is reduced the way verify() reduces it, so two hashes share an entry only if verify() can't tell them
+ * apart. The salt is random per cache, so nobody outside can tell which triples collide with each other or with a
+ * cached one; a triple that hasn't been verified is taken for one that has with a probability of about WAYS / 2^63.
+ * The slots are 64-bit atomics, so lookups and insertions from any number of threads take no lock: an entry can
+ * only be in one of WAYS slots picked by its hash, and an insertion is a single compare-and-swap there. Eviction is
+ * CLOCK-like: a hit sets a slot's "referenced" bit, and an insertion into WAYS full slots replaces one whose bit is
+ * clear, clearing the bits of those it passes over, i.e., entries that have been hit get a second chance.
+ */
+class SignatureCache {
+protected:
+  // 0 is an empty slot, otherwise bit 63 is the referenced bit and bits 0 to 62 the tag, which is never 0
+  unique_ptr<atomic<uint64_t>[]> slots_;
+  size_t mask_;
+  uint8_t salt_[32];
+  atomic<uint64_t> hits_;
+  atomic<uint64_t> misses_;
+  atomic<uint64_t> insertions_;
+  atomic<uint64_t> evictions_;
+  /**
+   * @brief Hash a triple to its tag and the WAYS slots it may be in
+   */
+  void get_entry(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig, uint64_t* tag,
+    size_t* positions) const;
+  bool contains(const uint64_t tag, const size_t* positions);
+  void insert(const uint64_t tag, const size_t* positions);
+public:
+  // The number of slots an entry may be in
+  static const size_t WAYS = 4;
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    // Insertions that replaced another entry
+    uint64_t evictions;
+  };
+  /**
+   * @brief Initialize an empty cache with a random salt
+   * @param entries the capacity, rounded up to a power of two no smaller than WAYS. Each entry takes 8 bytes.
+   */
+  explicit SignatureCache(const size_t entries);
+  /**
+   * @brief Whether the triple has been verified and is still in the cache
+   */
+  bool contains(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig);
+  /**
+   * @brief Cache a triple that has been verified
+   */
+  void insert(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig);
+  /**
+   * @brief The same as pubkey.verify(msg_hash, sig), but skips the verification if the triple is in the cache and
+   * caches it if it passes
+   */
+  bool verify(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig);
+  size_t capacity() const;
+  Stats stats() const;
+};
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef SMALL_FIELD_H
+#define SMALL_FIELD_H
+
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+
+#include "int128.h"
+
+/**
+ * @brief Compile-time specialized counterparts of FieldElement and FieldElementPoint for curves over primes that
+ * fit in 64 bits, such as the ones over 223 in Jimmy's book.
+ * The prime and the curve's a and b are template parameters, so they are checked once, when the template is
+ * instantiated, instead of on every construction, and elements are a single uint64_t whose products are reduced with
+ * native 128-bit arithmetic instead of int512_t's division. Everything is constexpr, so whole scalar
+ * multiplications (or order searches) can be evaluated by the compiler, e.g.:
+ *   using Point = small_field::FieldElementPoint<0, 7, 223>;
+ *   static_assert((Point(15, 86) * 7).infinity());
+ * The classes live in their own namespace as FieldElement and FieldElementPoint are taken by the int512_t versions.
+ */
+namespace small_field {
+
+constexpr uint64_t multiply_mod(const uint64_t a, const uint64_t b, const uint64_t m) {
+  return (uint64_t)((u128)a * b % m);
+}
+
+constexpr uint64_t power_mod(uint64_t base, uint64_t exponent, const uint64_t m) {
+  uint64_t result = 1 % m;
+  while (exponent > 0) {
+    if (exponent & 1) { result = multiply_mod(result, base, m); }
+    base = multiply_mod(base, base, m);
+    exponent >>= 1;
+  }
+  return result;
+}
+
+/**
+ * @brief Deterministic Miller-Rabin test. Using the first 12 primes as witnesses is known to be exact for every
+ * n < 3.3 * 10^24, which covers all 64-bit integers.
+ */
+constexpr bool is_prime(const uint64_t n) {
+  const uint64_t witnesses[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+  if (n < 2) { return false; }
+  for (uint64_t w : witnesses) {
+    if (n % w == 0) { return n == w; }
+  }
+  uint64_t d = n - 1;
+  int s = 0;
+  while ((d & 1) == 0) { d >>= 1; ++s; }
+  for (uint64_t w : witnesses) {
+    uint64_t x = power_mod(w, d, n);
+    if (x == 1 || x == n - 1) { continue; }
+    bool composite = true;
+    for (int i = 1; i < s && composite; ++i) {
+      x = multiply_mod(x, x, n);
+      if (x == n - 1) { composite = false; }
+    }
+    if (composite) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief An element of the finite field of P elements
+ */
+template <uint64_t P>
+class FieldElement {
+  static_assert(is_prime(P), "P is not a prime number");
+protected:
+  uint64_t num_ = 0;
+public:
+  constexpr FieldElement() {}
+  /**
+   * @throw invalid_argument if num is not smaller than P
+   */
+  constexpr explicit FieldElement(const uint64_t num): num_(num) {
+    if (num >= P) {
+      throw std::invalid_argument("num [" + std::to_string(num) + "] is not smaller than prime [" +
+        std::to_string(P) + "]");
+    }
+  }
+  constexpr uint64_t num() const { return this->num_; }
+  static constexpr uint64_t prime() { return P; }
+
+  constexpr bool operator==(const FieldElement& other) const { return this->num_ == other.num_; }
+  constexpr bool operator!=(const FieldElement& other) const { return this->num_ != other.num_; }
+  constexpr FieldElement operator+(const FieldElement& other) const {
+    // Both are smaller than P, so subtracting P once is enough, including when the sum overflows 2^64
+    uint64_t sum = this->num_ + other.num_;
+    return FieldElement(sum < this->num_ || sum >= P ? sum - P : sum);
+  }
+  constexpr FieldElement operator-(const FieldElement& other) const {
+    return FieldElement(this->num_ >= other.num_ ? this->num_ - other.num_ : P - (other.num_ - this->num_));
+  }
+  constexpr FieldElement operator*(const FieldElement& other) const {
+    return FieldElement(multiply_mod(this->num_, other.num_, P));
+  }
+  constexpr FieldElement operator*(const uint64_t coef) const {
+    return FieldElement(multiply_mod(this->num_, coef % P, P));
+  }
+  /**
+   * @brief Divide by other, i.e., multiply by other^(P-2) per Fermat's little theorem
+   */
+  constexpr FieldElement operator/(const FieldElement& other) const {
+    return *this * FieldElement(power_mod(other.num_, P - 2, P));
+  }
+  /**
+   * @brief Raise the element to a power. A negative exponent e is the same as P - 1 + e per Fermat's little theorem.
+   */
+  constexpr FieldElement power(const int64_t exponent) const {
+    uint64_t e = exponent >= 0 ? (uint64_t)exponent % (P - 1)
+                               : (P - 1) - (uint64_t)(-(exponent + 1)) % (P - 1) - 1;
+    // x^(k * (P - 1)) is 1 for x != 0, but 0 for x == 0 (unless k == 0, as 0^0 is 1, the same as powm()), so a
+    // non-zero exponent is reduced to P - 1 instead of 0
+    if (exponent != 0 && e == 0) { e = P - 1; }
+    return FieldElement(power_mod(this->num_, e, P));
+  }
+};
+
+/**
+ * @brief A point on the curve y^2 = x^3 + A * x + B over the finite field of P elements
+ */
+template <uint64_t A, uint64_t B, uint64_t P>
+class FieldElementPoint {
+  static_assert(A < P && B < P, "A and B have to be elements of the field");
+public:
+  using Element = FieldElement<P>;
+protected:
+  Element x_;
+  Element y_;
+  bool infinity_ = true;
+public:
+  /**
+   * @brief Initialize the point at infinity
+   */
+  constexpr FieldElementPoint() {}
+  /**
+   * @throw invalid_argument if (x, y) is not on the curve
+   */
+  constexpr FieldElementPoint(const Element x, const Element y): x_(x), y_(y), infinity_(false) {
+    if (y * y != x * x * x + Element(A) * x + Element(B)) {
+      throw std::invalid_argument("Point (" + std::to_string(x.num()) + ", " + std::to_string(y.num()) +
+        ") not on the curve");
+    }
+  }
+  constexpr FieldElementPoint(const uint64_t x, const uint64_t y): FieldElementPoint(Element(x), Element(y)) {}
+
+  constexpr bool infinity() const { return this->infinity_; }
+  /**
+   * @throw invalid_argument if the point is at infinity
+   */
+  constexpr Element x() const {
+    if (this->infinity_) { throw std::invalid_argument("Point is at infinity, does not have x coordinate"); }
+    return this->x_;
+  }
+  /**
+   * @throw invalid_argument if the point is at infinity
+   */
+  constexpr Element y() const {
+    if (this->infinity_) { throw std::invalid_argument("Point is at infinity, does not have y coordinate"); }
+    return this->y_;
+  }
+  static constexpr uint64_t a() { return A; }
+  static constexpr uint64_t b() { return B; }
+
+  constexpr bool operator==(const FieldElementPoint& other) const {
+    if (this->infinity_ || other.infinity_) { return this->infinity_ == other.infinity_; }
+    return this->x_ == other.x_ && this->y_ == other.y_;
+  }
+  constexpr bool operator!=(const FieldElementPoint& other) const { return !(*this == other); }
+
+  constexpr FieldElementPoint operator+(const FieldElementPoint& other) const {
+    // Point at infinity is defined as I where point A + I = A. Visualization: ./assets/fig_02-15.png
+    if (this->infinity_) { return other; }
+    if (other.infinity_) { return *this; }
+    Element slope;
+    if (this->x_ == other.x_) {
+      // A + (-A) = I, and the tangent is a vertical line if y == 0. Visualization: ./assets/fig_02-19.png
+      if (this->y_ != other.y_ || this->y_ == Element(0)) { return FieldElementPoint(); }
+      // p1 == p2: slope = (3x^2 + a) / 2y. Visualization: ./assets/fig_02-18.png
+      slope = (this->x_ * this->x_ * 3 + Element(A)) / (this->y_ * 2);
+    } else {
+      slope = (other.y_ - this->y_) / (other.x_ - this->x_);
+    }
+    FieldElementPoint result;
+    result.infinity_ = false;
+    result.x_ = slope * slope - this->x_ - other.x_;
+    result.y_ = slope * (this->x_ - result.x_) - this->y_;
+    return result;
+  }
+  constexpr FieldElementPoint& operator+=(const FieldElementPoint& other) {
+    *this = *this + other;
+    return *this;
+  }
+  /**
+   * @brief Multiply the point by coef with binary expansion, the same as FieldElementPoint::operator*
+   */
+  constexpr FieldElementPoint operator*(uint64_t coef) const {
+    FieldElementPoint result;
+    FieldElementPoint curr = *this;
+    while (coef > 0) {
+      if (coef & 1) { result += curr; }
+      curr += curr;
+      coef >>= 1;
+    }
+    return result;
+  }
+  /**
+   * @brief Get the order of the group generated by the point, i.e., the smallest n > 0 where n * point == I, by
+   * adding the point to itself until it reaches infinity. This takes O(n) additions, so it is only meant for small
+   * curves.
+   */
+  constexpr uint64_t order() const {
+    uint64_t order = 1;
+    FieldElementPoint p = *this;
+    while (!p.infinity()) {
+      p += *this;
+      ++order;
+    }
+    return order;
+  }
+};
+
+}
+
+#endif
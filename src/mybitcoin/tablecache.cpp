@@ -0,0 +1,81 @@
+#include "tablecache.h"
+
+// An estimate of what a key costs without its table: the list node, the index's node and the SEC string
+static const size_t ENTRY_MEMORY_USAGE = 128;
+
+S256PointTableCache::S256PointTableCache(const size_t memory_budget, const uint64_t threshold)
+    : memory_budget_(memory_budget), threshold_(max(threshold, (uint64_t)1)), table_verifications_(0),
+      plain_verifications_(0) {}
+
+void S256PointTableCache::evict() {
+    while (memory_usage_ > memory_budget_ && !entries_.empty()) {
+        Entry& entry = entries_.back();
+        memory_usage_ -= ENTRY_MEMORY_USAGE;
+        if (entry.table) {
+            memory_usage_ -= entry.table->memory_usage();
+            --tables_;
+        }
+        index_.erase(entry.sec);
+        entries_.pop_back();
+        ++evictions_;
+    }
+}
+
+bool S256PointTableCache::verify(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig) {
+    uint8_t sec[S256Point::SEC_COMPRESSED_LEN];
+    string key((char*)sec, pubkey.get_sec_format(true, sec));
+    shared_ptr<const S256PointTable> table;
+    bool build = false;
+    {
+        lock_guard<mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            entries_.push_front(Entry{key, 0, nullptr});
+            index_[key] = entries_.begin();
+            memory_usage_ += ENTRY_MEMORY_USAGE;
+        } else {
+            entries_.splice(entries_.begin(), entries_, it->second);
+        }
+        Entry& entry = entries_.front();
+        ++entry.uses;
+        table = entry.table;
+        // Only the verification that reaches the threshold builds the table, the others don't wait for it
+        build = !table && entry.uses == threshold_;
+        evict();
+    }
+    if (build) {
+        // Thousands of point additions, so not while holding the lock
+        table = make_shared<const S256PointTable>(pubkey.affine_coords());
+        lock_guard<mutex> lock(mutex_);
+        auto it = index_.find(key);
+        size_t table_memory_usage = table->memory_usage();
+        // The key may have been evicted in the meantime, and a table bigger than the whole budget is never kept
+        if (it != index_.end() && !it->second->table && ENTRY_MEMORY_USAGE + table_memory_usage <= memory_budget_) {
+            it->second->table = table;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            memory_usage_ += table_memory_usage;
+            ++tables_;
+            ++tables_built_;
+            evict();
+        }
+    }
+    if (table) {
+        table_verifications_.fetch_add(1, memory_order_relaxed);
+        return pubkey.verify(msg_hash, sig, *table);
+    }
+    plain_verifications_.fetch_add(1, memory_order_relaxed);
+    return pubkey.verify(msg_hash, sig);
+}
+
+S256PointTableCache::Stats S256PointTableCache::stats() const {
+    lock_guard<mutex> lock(mutex_);
+    Stats stats;
+    stats.table_verifications = table_verifications_.load(memory_order_relaxed);
+    stats.plain_verifications = plain_verifications_.load(memory_order_relaxed);
+    stats.tables_built = tables_built_;
+    stats.evictions = evictions_;
+    stats.keys = entries_.size();
+    stats.tables = tables_;
+    stats.memory_usage = memory_usage_;
+    return stats;
+}
@@ -0,0 +1,71 @@
+#ifndef TABLECACHE_H
+#define TABLECACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ecc.h"
+
+/**
+ * @brief An opt-in cache of S256PointTables for the public keys that verify the most, e.g., the few keys of a hot
+ * wallet. Every key it sees is counted, and a key gets a table once it has verified threshold signatures, after
+ * which its verifications go through S256Point::verify() with the table. Keys that stay below the threshold cost a
+ * counter each and verify as usual.
+ * Keys (counted or with a table) are kept in least-recently-used order, and the least recently used ones are
+ * evicted whenever the memory they take exceeds the budget. A table is about 70 KB, a counter about 100 bytes.
+ * The cache can be shared by threads: the bookkeeping is behind a mutex, but tables are built and used outside of
+ * it, and a table that is evicted while a verification is using it lives until that verification is done.
+ */
+class S256PointTableCache {
+protected:
+  struct Entry {
+    // The key in compressed SEC format
+    string sec;
+    uint64_t uses;
+    shared_ptr<const S256PointTable> table;
+  };
+  // Most recently used first
+  list<Entry> entries_;
+  unordered_map<string, list<Entry>::iterator> index_;
+  const size_t memory_budget_;
+  const uint64_t threshold_;
+  size_t memory_usage_ = 0;
+  size_t tables_ = 0;
+  uint64_t tables_built_ = 0;
+  uint64_t evictions_ = 0;
+  atomic<uint64_t> table_verifications_;
+  atomic<uint64_t> plain_verifications_;
+  mutable mutex mutex_;
+  /**
+   * @brief Evict the least recently used keys until the cache fits in its budget. mutex_ has to be held.
+   */
+  void evict();
+public:
+  struct Stats {
+    // Verifications with and without a table
+    uint64_t table_verifications;
+    uint64_t plain_verifications;
+    uint64_t tables_built;
+    // Keys evicted, with or without a table
+    uint64_t evictions;
+    size_t keys;
+    size_t tables;
+    size_t memory_usage;
+  };
+  /**
+   * @param memory_budget the most bytes the tables and counters may take
+   * @param threshold the number of verifications after which a key gets a table. 1 builds it on the first one.
+   */
+  S256PointTableCache(const size_t memory_budget, const uint64_t threshold);
+  /**
+   * @brief The same as pubkey.verify(msg_hash, sig), with pubkey's table if it has one
+   */
+  bool verify(const S256Point& pubkey, const int512_t& msg_hash, const Signature& sig);
+  Stats stats() const;
+};
+
+#endif
@@ -4,6 +4,7 @@
 #include <boost/random/random_device.hpp>
 #include <boost/random.hpp>
 #include <sstream>
+#include <thread>
 #include "utils.h"
 
 
@@ -62,6 +63,22 @@ bool fermat_primality_test(const int512_t input, const int iterations) {
     return true;
 }
 
+void run_in_chunks(const size_t count, unsigned int threads, const function<void(size_t, size_t)>& fn) {
+    if (count == 0) { return; }
+    if (threads == 0) {
+        threads = max(thread::hardware_concurrency(), 1u);
+    }
+    const size_t chunk_size = (count + threads - 1) / threads;
+    vector<thread> workers;
+    for (size_t begin = chunk_size; begin < count; begin += chunk_size) {
+        workers.emplace_back(fn, begin, min(begin + chunk_size, count));
+    }
+    fn(0, min(chunk_size, count));
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+}
+
 char* encode_bytes_to_base58_string(const uint8_t* input_bytes,
     const size_t input_len, const bool bytes_in_big_endian) {
     //cout << ceil(input_len * 1.36565823) - (input_len * 1.36565823) << endl;
@@ -108,17 +125,49 @@ char* encode_bytes_to_base58_string(const uint8_t* input_bytes,
 
 char* encode_base58_checksum(const uint8_t* input_bytes,
     const size_t input_len) {
-    // return encode_base58(b + hash256(b)[:4])
+    char* output = (char*)malloc((input_len + 4) * 138 / 100 + 2);
+    encode_base58_checksum(input_bytes, input_len, output);
+    return output;
+}
+
+size_t encode_base58_checksum(const uint8_t* input_bytes, const size_t input_len, char* output) {
+    // encode_base58(b + hash256(b)[:4])
+    static const char b58_table[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
     uint8_t hash[SHA256_HASH_SIZE];
     cal_sha256_hash(input_bytes, input_len, hash);
-    cal_sha256_hash(hash, SHA256_HASH_SIZE, hash);  
-    vector<uint8_t> base58_input(input_len + 4);
-
-    memcpy(base58_input.data(), input_bytes, input_len);
-    memcpy(base58_input.data() + input_len, hash, 4);
-
-    return encode_bytes_to_base58_string(base58_input.data(),
-        input_len + 4, true);
+    cal_sha256_hash(hash, SHA256_HASH_SIZE, hash);
+    const size_t len = input_len + 4;
+    // output doubles as the work area: it holds the base58 digits of the bytes read so far, least significant first,
+    // and each byte multiplies them by 256 and adds itself. Leading zero bytes are not part of the number, each of
+    // them is encoded as a '1' instead.
+    size_t zeros = 0, digits = 0;
+    for (size_t i = 0; i < len; ++i) {
+        uint32_t carry = i < input_len ? input_bytes[i] : hash[i - input_len];
+        if (zeros == i && carry == 0) {
+            ++zeros;
+            continue;
+        }
+        for (size_t j = 0; j < digits; ++j) {
+            carry += (uint32_t)(uint8_t)output[j] << 8;
+            output[j] = (char)(carry % 58);
+            carry /= 58;
+        }
+        while (carry > 0) {
+            output[digits++] = (char)(carry % 58);
+            carry /= 58;
+        }
+    }
+    // Most significant digit first, after the '1's
+    for (size_t j = 0; j < digits / 2; ++j) {
+        char digit = output[j];
+        output[j] = output[digits - 1 - j];
+        output[digits - 1 - j] = digit;
+    }
+    memmove(output + zeros, output, digits);
+    for (size_t j = 0; j < zeros; ++j) { output[j] = 0; }
+    for (size_t j = 0; j < zeros + digits; ++j) { output[j] = b58_table[(uint8_t)output[j]]; }
+    output[zeros + digits] = '\0';
+    return zeros + digits;
 }
 
 void hash160(const uint8_t* input_bytes, const size_t input_len,
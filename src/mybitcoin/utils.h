@@ -1,6 +1,7 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <functional>
 #include <stdint.h>
 #include <vector>
 
@@ -50,6 +51,15 @@ void get_bytes_from_int256(
  */
 bool fermat_primality_test(const int512_t input, const int iterations);
 
+/**
+ * @brief Split [0, count) into contiguous chunks, one per thread, and run fn on each of them at the same time. The
+ * calling thread takes the first chunk, and this returns once every chunk is done.
+ * @param count the number of items, nothing is run if it is 0
+ * @param threads the number of threads, 0 for one per hardware thread. Fewer are used if there aren't enough items.
+ * @param fn called as fn(begin, end) for the items [begin, end) of each chunk, from different threads
+ */
+void run_in_chunks(const size_t count, unsigned int threads, const function<void(size_t, size_t)>& fn);
+
 /**
  * @brief Encode a byte array into a base58 string
  * @param input_bytes pointer to data in byte array to be encoded
@@ -67,6 +77,15 @@ char* encode_bytes_to_base58_string(
 */
 char* encode_base58_checksum(const uint8_t* input_bytes, const size_t input_len);
 
+/**
+ * @brief The same as encode_base58_checksum() above, but the string is written to a caller-provided buffer, so
+ * nothing is allocated, and it is computed byte by byte instead of through int512_t divisions.
+ * @param output a pre-allocated buffer of at least (input_len + 4) * 138 / 100 + 2 bytes, where the null-terminated
+ * string is delivered
+ * @returns the length of the string, not counting the null terminator
+ */
+size_t encode_base58_checksum(const uint8_t* input_bytes, const size_t input_len, char* output);
+
 /**
  * @brief Calculate the hash160 hash value (i.e., RIPEMD160 on top of SHA256) from a given byte array
  * @param input_bytes Pointer to the data the hash shall be calculated on.